@@ -48,6 +48,46 @@ void DoScalarIndependentDefinitions(py::module m) {
     DefCopyAndDeepCopy(&cls);
   }
 
+  {
+    using Class = CameraImagesRequest;
+    constexpr auto& cls_doc = doc.CameraImagesRequest;
+    py::class_<Class> cls(m, "CameraImagesRequest", cls_doc.doc);
+    cls  // BR
+        .def(py::init([](FrameId parent_frame,
+                          const math::RigidTransformd& X_PC,
+                          const render::ColorRenderCamera* color_camera,
+                          const render::DepthRenderCamera* depth_camera,
+                          systems::sensors::ImageRgba8U* color_image,
+                          systems::sensors::ImageDepth32F* depth_image,
+                          systems::sensors::ImageLabel16I* label_image) {
+          return Class{parent_frame, X_PC, color_camera, depth_camera,
+              color_image, depth_image, label_image};
+        }),
+            py::arg("parent_frame"), py::arg("X_PC"),
+            py::arg("color_camera") = nullptr,
+            py::arg("depth_camera") = nullptr,
+            py::arg("color_image") = nullptr, py::arg("depth_image") = nullptr,
+            py::arg("label_image") = nullptr,
+            // Keep alive, reference: `self` keeps the cameras and the images
+            // alive.
+            py::keep_alive<1, 4>(), py::keep_alive<1, 5>(),
+            py::keep_alive<1, 6>(), py::keep_alive<1, 7>(),
+            py::keep_alive<1, 8>())
+        .def_readwrite(
+            "parent_frame", &Class::parent_frame, cls_doc.parent_frame.doc)
+        .def_readwrite("X_PC", &Class::X_PC, cls_doc.X_PC.doc)
+        .def_readonly(
+            "color_camera", &Class::color_camera, cls_doc.color_camera.doc)
+        .def_readonly(
+            "depth_camera", &Class::depth_camera, cls_doc.depth_camera.doc)
+        .def_readonly(
+            "color_image", &Class::color_image, cls_doc.color_image.doc)
+        .def_readonly(
+            "depth_image", &Class::depth_image, cls_doc.depth_image.doc)
+        .def_readonly(
+            "label_image", &Class::label_image, cls_doc.label_image.doc);
+  }
+
   {
     using Class = geometry::SceneGraphConfig;
     constexpr auto& cls_doc = doc.SceneGraphConfig;
@@ -631,7 +671,9 @@ void DefineQueryObject(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
-            cls_doc.RenderLabelImage.doc);
+            cls_doc.RenderLabelImage.doc)
+        .def("RenderImages", &Class::RenderImages, py::arg("requests"),
+            cls_doc.RenderImages.doc);
 
     if constexpr (scalar_predicate<T>::is_bool) {
       cls  // BR
@@ -371,6 +371,7 @@ class TestGeometrySceneGraph(unittest.TestCase):
         self.assertEqual(
             got_config.default_proximity_properties.compliance_type,
             "undefined")
+        self.assertEqual(got_config.proximity_query_num_threads, 1)
         scene_graph_config.default_proximity_properties.compliance_type = \
             "compliant"
         scene_graph.set_config(config=scene_graph_config)
@@ -733,6 +734,32 @@ class TestGeometrySceneGraph(unittest.TestCase):
             X_PC=RigidTransform())
         self.assertIsInstance(image, ImageLabel16I)
 
+        # Render all three images of a camera at once.
+        request = mut.CameraImagesRequest(
+            parent_frame=SceneGraph.world_frame_id(),
+            X_PC=RigidTransform(),
+            color_camera=color_camera,
+            depth_camera=depth_camera,
+            color_image=ImageRgba8U(10, 10),
+            depth_image=ImageDepth32F(10, 10),
+            label_image=ImageLabel16I(10, 10))
+        self.assertEqual(request.parent_frame, SceneGraph.world_frame_id())
+        self.assertIsInstance(request.X_PC, RigidTransform)
+        self.assertIsInstance(request.color_camera, mut.ColorRenderCamera)
+        self.assertIsInstance(request.depth_camera, mut.DepthRenderCamera)
+        query_object.RenderImages(requests=[request])
+        self.assertEqual(request.color_image.width(), 10)
+        self.assertEqual(request.depth_image.height(), 10)
+        self.assertIsInstance(request.label_image, ImageLabel16I)
+        # The cameras and images are optional.
+        depth_only = mut.CameraImagesRequest(
+            parent_frame=SceneGraph.world_frame_id(),
+            X_PC=RigidTransform(),
+            depth_camera=depth_camera,
+            depth_image=ImageDepth32F(10, 10))
+        self.assertIsNone(depth_only.color_image)
+        query_object.RenderImages(requests=[depth_only])
+
     @numpy_compare.check_all_types
     def test_value_instantiations(self, T):
         Value[mut.FramePoseVector_[T]]
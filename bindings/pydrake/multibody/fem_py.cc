@@ -25,6 +25,16 @@ void DoScalarIndependentDefinitions(py::module m) {
         .value("kNeoHookean", Class::kNeoHookean, cls_doc.kNeoHookean.doc)
         .value("kLinear", Class::kLinear, cls_doc.kLinear.doc);
   }
+
+  {
+    using Class = LinearSolverPreconditioner;
+    constexpr auto& cls_doc = doc.LinearSolverPreconditioner;
+    py::enum_<Class>(m, "LinearSolverPreconditioner", cls_doc.doc)
+        .value("kDiagonal", Class::kDiagonal, cls_doc.kDiagonal.doc)
+        .value("kBlockJacobi", Class::kBlockJacobi, cls_doc.kBlockJacobi.doc)
+        .value("kIncompleteCholesky", Class::kIncompleteCholesky,
+            cls_doc.kIncompleteCholesky.doc);
+  }
 }
 
 template <typename T>
@@ -58,6 +68,13 @@ void DoScalarDependentDefinitions(py::module m, T) {
             py::arg("mass_density"), cls_doc.set_mass_density.doc)
         .def("set_material_model", &Class::set_material_model,
             py::arg("material_model"), cls_doc.set_material_model.doc)
+        .def("set_linear_solver_preconditioner",
+            &Class::set_linear_solver_preconditioner,
+            py::arg("linear_solver_preconditioner"),
+            cls_doc.set_linear_solver_preconditioner.doc)
+        .def("set_use_matrix_free_tangent", &Class::set_use_matrix_free_tangent,
+            py::arg("use_matrix_free_tangent"),
+            cls_doc.set_use_matrix_free_tangent.doc)
         .def("youngs_modulus", &Class::youngs_modulus,
             py_rvp::reference_internal, cls_doc.youngs_modulus.doc)
         .def("poissons_ratio", &Class::poissons_ratio,
@@ -70,7 +87,12 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("mass_density", &Class::mass_density, py_rvp::reference_internal,
             cls_doc.mass_density.doc)
         .def("material_model", &Class::material_model,
-            cls_doc.material_model.doc);
+            cls_doc.material_model.doc)
+        .def("linear_solver_preconditioner",
+            &Class::linear_solver_preconditioner,
+            cls_doc.linear_solver_preconditioner.doc)
+        .def("use_matrix_free_tangent", &Class::use_matrix_free_tangent,
+            cls_doc.use_matrix_free_tangent.doc);
     DefCopyAndDeepCopy(&cls);
   }
 }
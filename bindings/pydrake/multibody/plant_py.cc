@@ -572,6 +572,16 @@ void DoScalarDependentDefinitions(py::module m, T) {
             },
             py::arg("context"), py::arg("body"),
             cls_doc.EvalBodyPoseInWorld.doc)
+        .def(
+            "CalcAllBodyPosesInWorldBatch",
+            [](const Class* self, const Context<T>& context,
+                const Eigen::Ref<const MatrixX<T>>& q_batch) {
+              std::vector<std::vector<RigidTransform<T>>> X_WB_batch;
+              self->CalcAllBodyPosesInWorldBatch(context, q_batch, &X_WB_batch);
+              return X_WB_batch;
+            },
+            py::arg("context"), py::arg("q_batch"),
+            cls_doc.CalcAllBodyPosesInWorldBatch.doc)
         .def(
             "EvalBodySpatialAccelerationInWorld",
             [](const Class* self, const Context<T>& context,
@@ -1187,6 +1197,13 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("get_contact_surface_representation",
             &Class::get_contact_surface_representation,
             cls_doc.get_contact_surface_representation.doc)
+        .def("set_hydroelastic_traction_parallelism",
+            &Class::set_hydroelastic_traction_parallelism,
+            py::arg("parallelism"),
+            cls_doc.set_hydroelastic_traction_parallelism.doc)
+        .def("hydroelastic_traction_parallelism",
+            &Class::hydroelastic_traction_parallelism,
+            cls_doc.hydroelastic_traction_parallelism.doc)
         .def("set_adjacent_bodies_collision_filters",
             &Class::set_adjacent_bodies_collision_filters, py::arg("value"),
             cls_doc.set_adjacent_bodies_collision_filters.doc)
@@ -4,6 +4,7 @@ from pydrake.common.test_utilities import numpy_compare
 from pydrake.autodiffutils import AutoDiffXd
 from pydrake.multibody.fem import (
     MaterialModel,
+    LinearSolverPreconditioner,
     DeformableBodyConfig_,
 )
 
@@ -36,3 +37,20 @@ class TestMultibodyFem(unittest.TestCase):
         for model in models:
             dut.set_material_model(model)
             self.assertEqual(dut.material_model(), model)
+
+        self.assertEqual(dut.linear_solver_preconditioner(),
+                         LinearSolverPreconditioner.kDiagonal)
+        preconditioners = [
+            LinearSolverPreconditioner.kDiagonal,
+            LinearSolverPreconditioner.kBlockJacobi,
+            LinearSolverPreconditioner.kIncompleteCholesky,
+        ]
+        for preconditioner in preconditioners:
+            dut.set_linear_solver_preconditioner(
+                linear_solver_preconditioner=preconditioner)
+            self.assertEqual(dut.linear_solver_preconditioner(),
+                             preconditioner)
+
+        self.assertFalse(dut.use_matrix_free_tangent())
+        dut.set_use_matrix_free_tangent(use_matrix_free_tangent=True)
+        self.assertTrue(dut.use_matrix_free_tangent())
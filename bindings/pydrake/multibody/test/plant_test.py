@@ -1355,6 +1355,13 @@ class TestPlant(unittest.TestCase):
         # Compute body pose.
         X_WBase = plant.EvalBodyPoseInWorld(context, base)
         self.assertIsInstance(X_WBase, RigidTransform)
+        q = plant.GetPositions(context)
+        q_batch = np.stack([q, q], axis=1)
+        X_WB_batch = plant.CalcAllBodyPosesInWorldBatch(
+            context=context, q_batch=q_batch)
+        self.assertEqual(len(X_WB_batch), 2)
+        self.assertEqual(len(X_WB_batch[1]), plant.num_bodies())
+        self.assertIsInstance(X_WB_batch[1][base.index()], RigidTransform)
 
         # Set pose for the base.
         X_WB_desired = RigidTransform.Identity()
@@ -3049,6 +3056,18 @@ class TestPlant(unittest.TestCase):
                 self.assertEqual(
                     plant.get_contact_surface_representation(), rep)
 
+    def test_hydroelastic_traction_parallelism(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertEqual(
+            plant.hydroelastic_traction_parallelism().num_threads(), 1)
+        plant.set_hydroelastic_traction_parallelism(
+            parallelism=Parallelism(2))
+        self.assertEqual(
+            plant.hydroelastic_traction_parallelism().num_threads(), 2)
+        plant.set_hydroelastic_traction_parallelism(parallelism=False)
+        self.assertEqual(
+            plant.hydroelastic_traction_parallelism().num_threads(), 1)
+
     def test_adjacent_bodies_collision_filters(self):
         plant = MultibodyPlant_[float](0.1)
         values = [False, True]
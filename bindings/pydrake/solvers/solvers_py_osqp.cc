@@ -15,7 +15,11 @@ void DefineSolversOsqp(py::module m) {
 
   py::class_<OsqpSolver, SolverInterface>(m, "OsqpSolver", doc.OsqpSolver.doc)
       .def(py::init<>(), doc.OsqpSolver.ctor.doc)
-      .def_static("id", &OsqpSolver::id, doc.OsqpSolver.id.doc);
+      .def_static("id", &OsqpSolver::id, doc.OsqpSolver.id.doc)
+      .def("SetPersistentWorkspace", &OsqpSolver::SetPersistentWorkspace,
+          py::arg("persistent"), doc.OsqpSolver.SetPersistentWorkspace.doc)
+      .def("persistent_workspace", &OsqpSolver::persistent_workspace,
+          doc.OsqpSolver.persistent_workspace.doc);
 
   py::class_<OsqpSolverDetails>(
       m, "OsqpSolverDetails", doc.OsqpSolverDetails.doc)
@@ -29,13 +33,17 @@ void DefineSolversOsqp(py::module m) {
           doc.OsqpSolverDetails.dual_res.doc)
       .def_readonly("setup_time", &OsqpSolverDetails::setup_time,
           doc.OsqpSolverDetails.setup_time.doc)
+      .def_readonly("update_time", &OsqpSolverDetails::update_time,
+          doc.OsqpSolverDetails.update_time.doc)
       .def_readonly("solve_time", &OsqpSolverDetails::solve_time,
           doc.OsqpSolverDetails.solve_time.doc)
       .def_readonly("polish_time", &OsqpSolverDetails::polish_time,
           doc.OsqpSolverDetails.polish_time.doc)
       .def_readonly("run_time", &OsqpSolverDetails::run_time,
           doc.OsqpSolverDetails.run_time.doc)
-      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc);
+      .def_readonly("y", &OsqpSolverDetails::y, doc.OsqpSolverDetails.y.doc)
+      .def_readonly("reused_workspace", &OsqpSolverDetails::reused_workspace,
+          doc.OsqpSolverDetails.reused_workspace.doc);
   AddValueInstantiation<OsqpSolverDetails>(m);
 }
 
@@ -31,6 +31,33 @@ class TestOsqpSolver(unittest.TestCase):
         np.testing.assert_allclose(result.GetDualSolution(constraint1), [1.])
         np.testing.assert_allclose(result.GetDualSolution(constraint2), [1.])
 
+    def test_persistent_workspace(self):
+        prog = MathematicalProgram()
+        x = prog.NewContinuousVariables(2, "x")
+        prog.AddLinearConstraint(x[0] >= 1)
+        prog.AddLinearConstraint(x[1] >= 1)
+        prog.AddQuadraticCost(np.eye(2), np.zeros(2), x)
+        solver = OsqpSolver()
+        self.assertFalse(solver.persistent_workspace())
+        solver.SetPersistentWorkspace(persistent=True)
+        self.assertTrue(solver.persistent_workspace())
+
+        # The first solve sets up the workspace; the second one reuses it.
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.is_success())
+        self.assertFalse(result.get_solver_details().reused_workspace)
+        self.assertEqual(result.get_solver_details().update_time, 0.)
+        result = solver.Solve(prog, None, None)
+        self.assertTrue(result.is_success())
+        self.assertTrue(result.get_solver_details().reused_workspace)
+        self.assertGreaterEqual(result.get_solver_details().update_time, 0.)
+        self.assertTrue(np.allclose(result.GetSolution(x), [1, 1]))
+
+        solver.SetPersistentWorkspace(persistent=False)
+        self.assertFalse(solver.persistent_workspace())
+        result = solver.Solve(prog, None, None)
+        self.assertFalse(result.get_solver_details().reused_workspace)
+
     def unavailable(self):
         """Per the BUILD file, this test is only run when OSQP is disabled."""
         solver = OsqpSolver()
@@ -40,6 +40,10 @@ void DefineSensorsImageIo(py::module m) {
 
     cls  // BR
         .def(py::init<>(), cls_doc.ctor.doc)
+        .def("set_compression_level", &Class::set_compression_level,
+            py::arg("level"), cls_doc.set_compression_level.doc)
+        .def("compression_level", &Class::compression_level,
+            cls_doc.compression_level.doc)
         .def("LoadMetadata",
             overload_cast_explicit<std::optional<Class::Metadata>,
                 const std::filesystem::path&>(&Class::LoadMetadata),
@@ -96,12 +100,41 @@ void DefineSensorsImageIo(py::module m) {
             py::arg("image"), py::arg("format"), cls_doc.Save.doc_2args);
   }
 
+  {
+    using Class = ImageWriterParams;
+    constexpr auto& cls_doc = doc.ImageWriterParams;
+    py::class_<Class> cls(m, "ImageWriterParams", cls_doc.doc);
+    cls  // BR
+        .def(ParamInit<Class>());
+    DefAttributesUsingSerialize(&cls, cls_doc);
+    DefReprUsingSerialize(&cls);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  {
+    using Class = ImageWriterStatistics;
+    constexpr auto& cls_doc = doc.ImageWriterStatistics;
+    py::class_<Class> cls(m, "ImageWriterStatistics", cls_doc.doc);
+    cls  // BR
+        .def(py::init<>())
+        .def_readonly("num_queued", &Class::num_queued, cls_doc.num_queued.doc)
+        .def_readonly(
+            "num_written", &Class::num_written, cls_doc.num_written.doc)
+        .def_readonly("num_stalls", &Class::num_stalls, cls_doc.num_stalls.doc)
+        .def_readonly("stall_time", &Class::stall_time, cls_doc.stall_time.doc)
+        .def_readonly("max_queue_depth", &Class::max_queue_depth,
+            cls_doc.max_queue_depth.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   {
     using Class = ImageWriter;
     constexpr auto& cls_doc = doc.ImageWriter;
     py::class_<Class, LeafSystem<double>> cls(m, "ImageWriter", cls_doc.doc);
     cls  // BR
-        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<>(), cls_doc.ctor.doc_0args)
+        .def(py::init<const ImageWriterParams&>(), py::arg("params"),
+            cls_doc.ctor.doc_1args)
         .def(
             "DeclareImageInputPort",
             [](Class& self, PixelType pixel_type, std::string port_name,
@@ -116,7 +149,11 @@ void DefineSensorsImageIo(py::module m) {
             py::arg("start_time"), py_rvp::reference_internal,
             cls_doc.DeclareImageInputPort.doc)
         .def("ResetAllImageCounts", &Class::ResetAllImageCounts,
-            cls_doc.ResetAllImageCounts.doc);
+            cls_doc.ResetAllImageCounts.doc)
+        .def("params", &Class::params, py_rvp::reference_internal,
+            cls_doc.params.doc)
+        .def("Flush", &Class::Flush, cls_doc.Flush.doc)
+        .def("GetStatistics", &Class::GetStatistics, cls_doc.GetStatistics.doc);
   }
 }
 
@@ -2,6 +2,7 @@ import pydrake.systems.sensors as mut
 
 import copy
 import gc
+import os
 import tempfile
 import unittest
 
@@ -642,6 +643,45 @@ class TestSensors(unittest.TestCase):
             start_time=0.0)
         self.assertIsNotNone(input_port)
 
+    def test_image_io_compression_level(self):
+        dut = mut.ImageIo()
+        self.assertIsNone(dut.compression_level())
+        dut.set_compression_level(level=1)
+        self.assertEqual(dut.compression_level(), 1)
+        dut.set_compression_level(level=None)
+        self.assertIsNone(dut.compression_level())
+
+    def test_image_writer_params(self):
+        params = mut.ImageWriterParams(num_threads=2, compression_level=1)
+        self.assertEqual(params.num_threads, 2)
+        self.assertEqual(params.max_queue_size, 16)
+        self.assertEqual(params.compression_level, 1)
+        self.assertIn("num_threads=2", repr(params))
+        copy.copy(params)
+
+    def test_image_writer_async(self):
+        params = mut.ImageWriterParams(num_threads=1, compression_level=0)
+        writer = mut.ImageWriter(params=params)
+        self.assertEqual(writer.params().num_threads, 1)
+        with tempfile.TemporaryDirectory() as temp:
+            writer.DeclareImageInputPort(
+                pixel_type=mut.PixelType.kRgba8U,
+                port_name="color",
+                file_name_format=temp + "/{port_name}-{count:03}",
+                publish_period=0.125,
+                start_time=0.0)
+            context = writer.CreateDefaultContext()
+            writer.get_input_port().FixValue(context, mut.ImageRgba8U(6, 4))
+            writer.ForcedPublish(context)
+            writer.Flush()
+            stats = writer.GetStatistics()
+            self.assertEqual(stats.num_queued, 1)
+            self.assertEqual(stats.num_written, 1)
+            self.assertGreaterEqual(stats.num_stalls, 0)
+            self.assertGreaterEqual(stats.stall_time, 0.0)
+            self.assertEqual(stats.max_queue_depth, 1)
+            self.assertEqual(os.listdir(temp), ["color-000.png"])
+
     @numpy_compare.check_all_types
     def test_rotary_encoders(self, T):
         encoders = mut.RotaryEncoders_[T](ticks_per_revolution=[100, 200])
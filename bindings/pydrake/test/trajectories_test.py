@@ -671,6 +671,26 @@ class TestTrajectories(unittest.TestCase):
         v = pp.vector_values([0, 4])
         self.assertEqual(v.shape, (3, 2))
 
+    @numpy_compare.check_all_types
+    def test_eval_batch(self, T):
+        PiecewisePolynomial = PiecewisePolynomial_[T]
+
+        pp = PiecewisePolynomial.FirstOrderHold([0., 1.], np.array([[1., 3.]]))
+        numpy_compare.assert_float_equal(
+            pp.EvalBatch(t=[0., 0.5, 1.]), np.array([[1., 2., 3.]]))
+        numpy_compare.assert_float_equal(
+            pp.EvalBatch(t=[0.5, 0.25], derivative_order=1),
+            np.array([[2., 2.]]))
+
+    def test_eval_batch_into_values(self):
+        pp = PiecewisePolynomial_[float].FirstOrderHold(
+            [0., 1.], np.array([[1., 3.]]))
+        values = np.zeros((1, 3))
+        pp.EvalBatch(t=[0., 0.5, 1.], derivative_order=0, values=values)
+        np.testing.assert_array_equal(values, [[1., 2., 3.]])
+        with self.assertRaises(RuntimeError):
+            pp.EvalBatch(t=[0., 1.], derivative_order=0, values=values)
+
     @numpy_compare.check_all_types
     def test_addition(self, T):
         PiecewisePolynomial = PiecewisePolynomial_[T]
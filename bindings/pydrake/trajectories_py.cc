@@ -330,6 +330,25 @@ struct Impl {
               overload_cast_explicit<MatrixX<T>, const std::vector<T>&>(
                   &Class::vector_values),
               py::arg("t"), cls_doc.vector_values.doc)
+          .def(
+              "EvalBatch",
+              [](const Class& self, const Eigen::Ref<const VectorX<T>>& t,
+                  int derivative_order, EigenPtr<MatrixX<T>> values) {
+                // A numpy array can't be resized in place, so the result is
+                // copied into `values`, which must already have its shape.
+                MatrixX<T> result;
+                self.EvalBatch(t, derivative_order, &result);
+                DRAKE_THROW_UNLESS(values->rows() == result.rows() &&
+                                   values->cols() == result.cols());
+                *values = result;
+              },
+              py::arg("t"), py::arg("derivative_order"), py::arg("values"),
+              cls_doc.EvalBatch.doc_3args)
+          .def("EvalBatch",
+              overload_cast_explicit<MatrixX<T>,
+                  const Eigen::Ref<const VectorX<T>>&, int>(&Class::EvalBatch),
+              py::arg("t"), py::arg("derivative_order") = 0,
+              cls_doc.EvalBatch.doc_2args)
           .def("has_derivative", &Class::has_derivative,
               cls_doc.has_derivative.doc)
           .def("EvalDerivative", &Class::EvalDerivative, py::arg("t"),
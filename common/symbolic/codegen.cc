@@ -2,9 +2,13 @@
 
 #include <sstream>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
+#include "drake/common/ssize.h"
+#include "drake/common/symbolic/expression_dag.h"
+
 namespace drake {
 namespace symbolic {
 
@@ -13,6 +17,7 @@ using std::ostringstream;
 using std::runtime_error;
 using std::string;
 using std::to_string;
+using std::unordered_map;
 using std::vector;
 
 CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
@@ -21,7 +26,20 @@ CodeGenVisitor::CodeGenVisitor(const vector<Variable>& parameters) {
   }
 }
 
+CodeGenVisitor::CodeGenVisitor(
+    const vector<Variable>& parameters,
+    const unordered_map<Expression, string>* const temporaries)
+    : CodeGenVisitor(parameters) {
+  temporaries_ = temporaries;
+}
+
 string CodeGenVisitor::CodeGen(const Expression& e) const {
+  if (temporaries_ != nullptr) {
+    const auto it = temporaries_->find(e);
+    if (it != temporaries_->end()) {
+      return it->second;
+    }
+  }
   return VisitExpression<string>(this, e);
 }
 
@@ -177,13 +195,46 @@ string CodeGenVisitor::VisitUninterpretedFunction(const Expression&) const {
   throw runtime_error("Codegen does not support uninterpreted functions.");
 }
 
+namespace {
+// Generates the declarations of the common subexpressions of data[0], ...,
+// data[size - 1] as temporaries, and records their names into `temporaries`,
+// which is the map aliased by `visitor`.
+void CodeGenTemporaries(const CodeGenVisitor& visitor,
+                        const Expression* const data, const int size,
+                        unordered_map<Expression, string>* const temporaries,
+                        ostream* const os) {
+  internal::ExpressionDag dag;
+  for (int i = 0; i < size; ++i) {
+    dag.Add(data[i]);
+  }
+  // The nodes are sorted such that each one comes after its operands, so the
+  // temporaries are declared in an order in which they can be computed.
+  for (int i = 0; i < ssize(dag.nodes()); ++i) {
+    const Expression& e = dag.nodes()[i];
+    if (dag.num_uses(i) == 1 || is_variable(e) || is_constant(e)) {
+      continue;
+    }
+    const string name = "t" + to_string(temporaries->size());
+    // The code for e uses the temporaries declared so far, but not e itself.
+    (*os) << "    const double " << name << " = " << visitor.CodeGen(e)
+          << ";\n";
+    temporaries->emplace(e, name);
+  }
+}
+}  // namespace
+
 string CodeGen(const string& function_name, const vector<Variable>& parameters,
-               const Expression& e) {
+               const Expression& e, const CodeGenOptions& options) {
   ostringstream oss;
   // Add header for the main function.
   oss << "double " << function_name << "(const double* p) {\n";
+  unordered_map<Expression, string> temporaries;
+  const CodeGenVisitor visitor{parameters, &temporaries};
+  if (options.eliminate_common_subexpressions) {
+    CodeGenTemporaries(visitor, &e, 1, &temporaries, &oss);
+  }
   // Codegen the expression.
-  oss << "    return " << CodeGenVisitor{parameters}.CodeGen(e) << ";\n";
+  oss << "    return " << visitor.CodeGen(e) << ";\n";
   // Add footer for the main function.
   oss << "}\n";
   // <function_name>_meta_t type.
@@ -202,10 +253,14 @@ namespace internal {
 void CodeGenDenseData(const string& function_name,
                       const vector<Variable>& parameters,
                       const Expression* const data, const int size,
-                      ostream* const os) {
+                      const CodeGenOptions& options, ostream* const os) {
   // Add header for the main function.
   (*os) << "void " << function_name << "(const double* p, double* m) {\n";
-  const CodeGenVisitor visitor{parameters};
+  unordered_map<Expression, string> temporaries;
+  const CodeGenVisitor visitor{parameters, &temporaries};
+  if (options.eliminate_common_subexpressions) {
+    CodeGenTemporaries(visitor, data, size, &temporaries, os);
+  }
   for (int i = 0; i < size; ++i) {
     (*os) << "    "
           << "m[" << i << "] = " << visitor.CodeGen(data[i]) << ";\n";
@@ -235,7 +290,8 @@ void CodeGenSparseData(const string& function_name,
                        const int outer_index_size, const int non_zeros,
                        const int* const outer_index_ptr,
                        const int* const inner_index_ptr,
-                       const Expression* const value_ptr, ostream* const os) {
+                       const Expression* const value_ptr,
+                       const CodeGenOptions& options, ostream* const os) {
   // Print header.
   (*os) << fmt::format(
       "void {}(const double* p, int* outer_indices, int* "
@@ -250,7 +306,11 @@ void CodeGenSparseData(const string& function_name,
     (*os) << fmt::format("    inner_indices[{0}] = {1};\n", i,
                          inner_index_ptr[i]);
   }
-  const CodeGenVisitor visitor{parameters};
+  unordered_map<Expression, string> temporaries;
+  const CodeGenVisitor visitor{parameters, &temporaries};
+  if (options.eliminate_common_subexpressions) {
+    CodeGenTemporaries(visitor, value_ptr, non_zeros, &temporaries, os);
+  }
   for (int i = 0; i < non_zeros; ++i) {
     (*os) << fmt::format("    values[{0}] = {1};\n", i,
                          visitor.CodeGen(value_ptr[i]));
@@ -290,17 +350,92 @@ void CodeGenSparseMeta(const string& function_name, const int parameter_size,
 
 std::string CodeGen(
     const std::string& function_name, const std::vector<Variable>& parameters,
-    const Eigen::Ref<const Eigen::SparseMatrix<Expression>>& M) {
+    const Eigen::Ref<const Eigen::SparseMatrix<Expression>>& M,
+    const CodeGenOptions& options) {
   DRAKE_ASSERT(M.isCompressed());
   ostringstream oss;
   internal::CodeGenSparseData(function_name, parameters, M.cols() + 1,
                               M.nonZeros(), M.outerIndexPtr(),
-                              M.innerIndexPtr(), M.valuePtr(), &oss);
+                              M.innerIndexPtr(), M.valuePtr(), options, &oss);
   internal::CodeGenSparseMeta(function_name, parameters.size(), M.rows(),
                               M.cols(), M.nonZeros(), M.cols() + 1,
                               M.nonZeros(), &oss);
   return oss.str();
 }
 
+std::string CodeGenWithJacobian(
+    const std::string& function_name, const std::vector<Variable>& parameters,
+    const Eigen::Ref<const VectorX<Expression>>& f) {
+  const MatrixX<Expression> J = Jacobian(f, parameters);
+  // The structurally non-zero entries of J, in column-major order.
+  vector<int> outer_indices{0};
+  vector<int> inner_indices;
+  for (int j = 0; j < J.cols(); ++j) {
+    for (int i = 0; i < J.rows(); ++i) {
+      if (!is_zero(J(i, j))) {
+        inner_indices.push_back(i);
+      }
+    }
+    outer_indices.push_back(inner_indices.size());
+  }
+  // The expressions to evaluate: f, followed by the non-zeros of J.
+  vector<Expression> outputs(f.data(), f.data() + f.size());
+  for (int j = 0; j < J.cols(); ++j) {
+    for (int k = outer_indices[j]; k < outer_indices[j + 1]; ++k) {
+      outputs.push_back(J(inner_indices[k], j));
+    }
+  }
+  const int non_zeros = inner_indices.size();
+
+  ostringstream oss;
+  oss << fmt::format(
+      "void {}(const double* p, double* m, int* outer_indices, int* "
+      "inner_indices, double* values) {{\n",
+      function_name);
+  unordered_map<Expression, string> temporaries;
+  const CodeGenVisitor visitor{parameters, &temporaries};
+  CodeGenTemporaries(visitor, outputs.data(), outputs.size(), &temporaries,
+                     &oss);
+  for (int i = 0; i < f.size(); ++i) {
+    oss << fmt::format("    m[{0}] = {1};\n", i, visitor.CodeGen(outputs[i]));
+  }
+  for (int i = 0; i < static_cast<int>(outer_indices.size()); ++i) {
+    oss << fmt::format("    outer_indices[{0}] = {1};\n", i,
+                       outer_indices[i]);
+  }
+  for (int i = 0; i < non_zeros; ++i) {
+    oss << fmt::format("    inner_indices[{0}] = {1};\n", i,
+                       inner_indices[i]);
+  }
+  for (int i = 0; i < non_zeros; ++i) {
+    oss << fmt::format("    values[{0}] = {1};\n", i,
+                       visitor.CodeGen(outputs[f.size() + i]));
+  }
+  oss << "}\n";
+  // <function_name>_meta_t type.
+  oss << "typedef struct {\n"
+         "    /* p: input, vector */\n"
+         "    struct { int size; } p;\n"
+         "    /* m: output, vector */\n"
+         "    struct { int size; } m;\n"
+         "    /* J: output, matrix */\n"
+         "    struct {\n"
+         "        int rows;\n"
+         "        int cols;\n"
+         "        int non_zeros;\n"
+         "        int outer_indices;\n"
+         "        int inner_indices;\n"
+         "    } J;\n"
+         "} "
+      << function_name << "_meta_t;\n";
+  // <function_name>_meta().
+  oss << fmt::format(
+      "{0}_meta_t {0}_meta() {{ return {{{{{1}}}, {{{2}}}, {{{3}, {4}, {5}, "
+      "{6}, {7}}}}}; }}\n",
+      function_name, parameters.size(), f.size(), J.rows(), J.cols(),
+      non_zeros, outer_indices.size(), non_zeros);
+  return oss.str();
+}
+
 }  // namespace symbolic
 }  // namespace drake
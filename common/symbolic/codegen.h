@@ -28,6 +28,14 @@ class CodeGenVisitor {
   /// parameters.
   explicit CodeGenVisitor(const std::vector<Variable>& parameters);
 
+  /// Constructs an instance of this visitor class as above, which additionally
+  /// generates the name `temporaries->at(e)`, rather than the code, for every
+  /// subexpression `e` that is in @p temporaries. The map is aliased, and may
+  /// grow while this visitor is in use; it must outlive this visitor.
+  CodeGenVisitor(
+      const std::vector<Variable>& parameters,
+      const std::unordered_map<Expression, std::string>* temporaries);
+
   /// Generates C expression for the expression @p e.
   [[nodiscard]] std::string CodeGen(const Expression& e) const;
 
@@ -71,6 +79,18 @@ class CodeGenVisitor {
                                                   const Expression&);
 
   IdToIndexMap id_to_idx_map_;
+  const std::unordered_map<Expression, std::string>* temporaries_{};
+};
+
+/// Options for the `CodeGen` functions.
+struct CodeGenOptions {
+  /// When true, every non-trivial subexpression that occurs more than once in
+  /// the generated function (e.g., `sin(x)` in `m[0] = sin(x) * y` and
+  /// `m[1] = sin(x) + 1`) is computed once, into a local variable
+  /// `const double t<k> = ...;` declared before the outputs are computed,
+  /// and reused. Identical subexpressions are found by structural equality (see
+  /// Expression::EqualTo()).
+  bool eliminate_common_subexpressions{false};
 };
 
 /// @defgroup codegen Code Generation
@@ -95,6 +115,7 @@ class CodeGenVisitor {
 /// @param[in] parameters    Vector of variables provide the ordering of
 ///                          symbolic variables.
 /// @param[in] e             Symbolic expression to codegen.
+/// @param[in] options       Options for the generated code.
 ///
 /// For example, `Codegen("f", {x, y}, 1 + sin(x) + cos(y))` generates the
 /// following string.
@@ -114,7 +135,7 @@ class CodeGenVisitor {
 /// respectively because we passed `{x, y}` to `Codegen`.
 std::string CodeGen(const std::string& function_name,
                     const std::vector<Variable>& parameters,
-                    const Expression& e);
+                    const Expression& e, const CodeGenOptions& options = {});
 
 namespace internal {
 // Generates code for the internal representation of a matrix, @p data, using
@@ -126,7 +147,8 @@ namespace internal {
 // const Eigen::PlainObjectBase<Derived>&).
 void CodeGenDenseData(const std::string& function_name,
                       const std::vector<Variable>& parameters,
-                      const Expression* data, int size, std::ostream* os);
+                      const Expression* data, int size,
+                      const CodeGenOptions& options, std::ostream* os);
 
 // Generates code for the meta information and outputs to the output stream @p
 // os.
@@ -198,15 +220,18 @@ void CodeGenDenseMeta(const std::string& function_name, int parameter_size,
 ///     m[3] = sin(p[0]);
 /// }
 /// @endcode
+///
+/// See CodeGenOptions for the @p options.
 template <typename Derived>
 std::string CodeGen(const std::string& function_name,
                     const std::vector<Variable>& parameters,
-                    const Eigen::PlainObjectBase<Derived>& M) {
+                    const Eigen::PlainObjectBase<Derived>& M,
+                    const CodeGenOptions& options = {}) {
   static_assert(std::is_same_v<typename Derived::Scalar, Expression>,
                 "CodeGen should take a symbolic matrix.");
   std::ostringstream oss;
   internal::CodeGenDenseData(function_name, parameters, M.data(),
-                             M.cols() * M.rows(), &oss);
+                             M.cols() * M.rows(), options, &oss);
   internal::CodeGenDenseMeta(function_name, parameters.size(), M.rows(),
                              M.cols(), &oss);
   return oss.str();
@@ -326,10 +351,84 @@ std::string CodeGen(const std::string& function_name,
 ///     inner_indices.data(), values.data());
 /// const Eigen::SparseMatrix<double> m_double{map_sp.eval()};
 /// @endcode
+///
+/// See CodeGenOptions for the @p options.
 std::string CodeGen(
     const std::string& function_name, const std::vector<Variable>& parameters,
     const Eigen::Ref<const Eigen::SparseMatrix<Expression, Eigen::ColMajor>>&
-        M);
+        M,
+    const CodeGenOptions& options = {});
+
+/// For a given vector of symbolic expressions @p f, generates two C functions,
+/// `<function_name>` and `<function_name>_meta`. The generated
+/// `<function_name>` evaluates both `f` and its Jacobian with respect to
+/// @p parameters, as a column-major sparse matrix, in a single function body.
+/// It takes one input parameter and four output parameters:
+///
+///  - const double* p : An array of doubles for input parameters.
+///  - double* m : An array of doubles to store the evaluation result of `f`.
+///  - int* outer_indices, int* inner_indices, double* values : The Jacobian,
+///    in the Compressed Column Storage (CCS) scheme, as in the CodeGen()
+///    function for sparse matrices above.
+///
+/// The sparsity pattern of the Jacobian is the structural one: an entry is
+/// stored unless its symbolic derivative is the constant zero.
+///
+/// The values of `f` and the entries of the Jacobian typically share many
+/// subexpressions (e.g., the derivative of `sin(x) * y` is `cos(x) * y` and
+/// `sin(x)`). The generated function therefore always computes every common
+/// subexpression once, as with
+/// CodeGenOptions::eliminate_common_subexpressions.
+///
+/// `<function_name>_meta()` returns a nested struct from which a caller can
+/// obtain the following information:
+///  - `.p.size`: the size of input parameters.
+///  - `.m.size`: the size of `f`.
+///  - `.J.rows`, `.J.cols`, `.J.non_zeros`, `.J.outer_indices`,
+///    `.J.inner_indices`: the size of the Jacobian, its number of non-zero
+///    elements, and the lengths of its outer_indices and inner_indices.
+///
+/// For example, `CodeGenWithJacobian("f", {x, y}, f)` with
+/// `f = [sin(x) * y, x]` generates the following string.
+///
+/// @code
+/// void f(const double* p, double* m, int* outer_indices, int* inner_indices,
+///        double* values) {
+///     const double t0 = sin(p[0]);
+///     m[0] = (1 * p[1] * t0);
+///     m[1] = p[0];
+///     outer_indices[0] = 0;
+///     outer_indices[1] = 2;
+///     outer_indices[2] = 3;
+///     inner_indices[0] = 0;
+///     inner_indices[1] = 1;
+///     inner_indices[2] = 0;
+///     values[0] = (1 * p[1] * cos(p[0]));
+///     values[1] = 1.000000;
+///     values[2] = t0;
+/// }
+/// typedef struct {
+///     /* p: input, vector */
+///     struct { int size; } p;
+///     /* m: output, vector */
+///     struct { int size; } m;
+///     /* J: output, matrix */
+///     struct {
+///         int rows;
+///         int cols;
+///         int non_zeros;
+///         int outer_indices;
+///         int inner_indices;
+///     } J;
+/// } f_meta_t;
+/// f_meta_t f_meta() { return {{2}, {2}, {2, 2, 3, 3, 3}}; }
+/// @endcode
+///
+/// @throws std::exception if @p f contains an if-then-else expression or an
+/// uninterpreted function.
+std::string CodeGenWithJacobian(
+    const std::string& function_name, const std::vector<Variable>& parameters,
+    const Eigen::Ref<const VectorX<Expression>>& f);
 /// @} End of codegen group.
 
 }  // namespace symbolic
@@ -0,0 +1,53 @@
+#include "drake/common/symbolic/expression_dag.h"
+
+namespace drake {
+namespace symbolic {
+namespace internal {
+
+int ExpressionDag::Add(const Expression& e) {
+  const auto iter = indices_.find(e);
+  if (iter != indices_.end()) {
+    ++num_uses_[iter->second];
+    return iter->second;
+  }
+  switch (e.get_kind()) {
+    case ExpressionKind::Constant:
+    case ExpressionKind::Var:
+    case ExpressionKind::NaN:
+    case ExpressionKind::IfThenElse:
+    case ExpressionKind::UninterpretedFunction:
+      break;
+    case ExpressionKind::Add:
+      for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+        Add(e_i);
+      }
+      break;
+    case ExpressionKind::Mul:
+      for (const auto& [base, exponent] :
+           get_base_to_exponent_map_in_multiplication(e)) {
+        Add(base);
+        Add(exponent);
+      }
+      break;
+    case ExpressionKind::Div:
+    case ExpressionKind::Pow:
+    case ExpressionKind::Atan2:
+    case ExpressionKind::Min:
+    case ExpressionKind::Max:
+      Add(get_first_argument(e));
+      Add(get_second_argument(e));
+      break;
+    default:
+      Add(get_argument(e));
+  }
+  // The operands of e come before e.
+  const int index = static_cast<int>(nodes_.size());
+  nodes_.push_back(e);
+  num_uses_.push_back(1);
+  indices_.emplace(e, index);
+  return index;
+}
+
+}  // namespace internal
+}  // namespace symbolic
+}  // namespace drake
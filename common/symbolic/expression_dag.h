@@ -0,0 +1,52 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/symbolic/expression.h"
+
+namespace drake {
+namespace symbolic {
+namespace internal {
+
+/* The distinct subexpressions of a set of expressions, walked as a directed
+acyclic graph: structurally equal subexpressions are a single node, and the
+operands of a node are only walked the first time the node is reached.
+
+This is the common subexpression elimination pass shared by CodeGen() (which
+declares the nodes used more than once as temporaries) and ExpressionTape
+(which computes each node once). */
+class ExpressionDag {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionDag);
+
+  ExpressionDag() = default;
+
+  /* Adds `e` and its subexpressions. The operands of if-then-else expressions
+  and uninterpreted functions are not walked; those expressions (and NaN) are
+  leaves of the graph, for the caller to accept or reject. Returns the index
+  of `e` in nodes(). */
+  int Add(const Expression& e);
+
+  /* Returns the distinct subexpressions added so far (including variables and
+  constants), such that each one comes after all of its own operands. */
+  const std::vector<Expression>& nodes() const { return nodes_; }
+
+  /* Returns the number of times that nodes()[i] was reached by Add(): once per
+  direct call, plus once per occurrence as an operand of a distinct node. */
+  int num_uses(int i) const { return num_uses_[i]; }
+
+  /* Returns the index of `e` in nodes().
+  @pre `e` was added (directly or as a subexpression). */
+  int index(const Expression& e) const { return indices_.at(e); }
+
+ private:
+  std::vector<Expression> nodes_;
+  std::vector<int> num_uses_;
+  std::unordered_map<Expression, int> indices_;
+};
+
+}  // namespace internal
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,539 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/ssize.h"
+#include "drake/common/symbolic/expression_dag.h"
+
+namespace drake {
+namespace symbolic {
+
+using std::runtime_error;
+using std::vector;
+
+// Compiles expressions into an ExpressionTape. It visits each distinct
+// subexpression (each node of an internal::ExpressionDag) once, after its
+// operands, appending the instructions that compute it to the tape.
+class ExpressionTapeBuilder {
+ public:
+  using Op = ExpressionTape::Op;
+
+  ExpressionTapeBuilder(const vector<Variable>& parameters,
+                        const internal::ExpressionDag* dag,
+                        ExpressionTape* tape)
+      : dag_(*dag), tape_(*tape) {
+    tape_.parameters_ = parameters;
+    tape_.gradient_start_.push_back(0);
+    for (int i = 0; i < ssize(parameters); ++i) {
+      const bool inserted =
+          parameter_index_.emplace(parameters[i].get_id(), i).second;
+      if (!inserted) {
+        throw runtime_error(fmt::format(
+            "ExpressionTape: the parameter {} is given more than once.",
+            parameters[i]));
+      }
+      NewSlot(vector<int>{i});
+    }
+    tape_.a_to_out_start_.push_back(0);
+    tape_.b_to_out_start_.push_back(0);
+    node_slots_.reserve(dag_.nodes().size());
+    for (const Expression& e : dag_.nodes()) {
+      node_slots_.push_back(VisitExpression<int>(this, e));
+    }
+  }
+
+  // Returns the slot of the value of `e`.
+  // @pre `e` is a node of the DAG that was already visited.
+  int Visit(const Expression& e) const { return node_slots_[dag_.index(e)]; }
+
+  int VisitVariable(const Expression& e) {
+    const Variable& v{get_variable(e)};
+    const auto iter = parameter_index_.find(v.get_id());
+    if (iter == parameter_index_.end()) {
+      throw runtime_error(fmt::format(
+          "ExpressionTape: the variable {} is not one of the parameters.", v));
+    }
+    return iter->second;
+  }
+
+  int VisitConstant(const Expression& e) {
+    const int slot = NewSlot({});
+    tape_.constants_.emplace_back(slot, get_constant_value(e));
+    return slot;
+  }
+
+  int VisitAddition(const Expression& e) {
+    // e = c₀ + ∑ᵢ cᵢ eᵢ.
+    std::optional<int> sum;
+    for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+      const int slot = Visit(e_i);
+      if (!sum.has_value()) {
+        sum = (c_i == 1.0) ? slot : Emit(Op::kScale, slot, -1, c_i);
+      } else {
+        sum = Emit(Op::kAddScaled, *sum, slot, c_i);
+      }
+    }
+    DRAKE_DEMAND(sum.has_value());
+    const double c_0 = get_constant_in_addition(e);
+    return (c_0 == 0.0) ? *sum : Emit(Op::kAddConstant, *sum, -1, c_0);
+  }
+
+  int VisitMultiplication(const Expression& e) {
+    // e = c ∏ᵢ pow(bᵢ, eᵢ).
+    std::optional<int> product;
+    for (const auto& [base, exponent] :
+         get_base_to_exponent_map_in_multiplication(e)) {
+      const int slot = VisitPow(base, exponent, /* check_domain = */ false);
+      product = product.has_value() ? Emit(Op::kMul, *product, slot) : slot;
+    }
+    DRAKE_DEMAND(product.has_value());
+    const double c = get_constant_in_multiplication(e);
+    return (c == 1.0) ? *product : Emit(Op::kScale, *product, -1, c);
+  }
+
+  int VisitPow(const Expression& e) {
+    return VisitPow(get_first_argument(e), get_second_argument(e),
+                    /* check_domain = */ true);
+  }
+
+  int VisitDivision(const Expression& e) { return VisitBinary(Op::kDiv, e); }
+  int VisitAbs(const Expression& e) { return VisitUnary(Op::kAbs, e); }
+  int VisitLog(const Expression& e) { return VisitUnary(Op::kLog, e); }
+  int VisitExp(const Expression& e) { return VisitUnary(Op::kExp, e); }
+  int VisitSqrt(const Expression& e) { return VisitUnary(Op::kSqrt, e); }
+  int VisitSin(const Expression& e) { return VisitUnary(Op::kSin, e); }
+  int VisitCos(const Expression& e) { return VisitUnary(Op::kCos, e); }
+  int VisitTan(const Expression& e) { return VisitUnary(Op::kTan, e); }
+  int VisitAsin(const Expression& e) { return VisitUnary(Op::kAsin, e); }
+  int VisitAcos(const Expression& e) { return VisitUnary(Op::kAcos, e); }
+  int VisitAtan(const Expression& e) { return VisitUnary(Op::kAtan, e); }
+  int VisitAtan2(const Expression& e) { return VisitBinary(Op::kAtan2, e); }
+  int VisitSinh(const Expression& e) { return VisitUnary(Op::kSinh, e); }
+  int VisitCosh(const Expression& e) { return VisitUnary(Op::kCosh, e); }
+  int VisitTanh(const Expression& e) { return VisitUnary(Op::kTanh, e); }
+  int VisitMin(const Expression& e) { return VisitBinary(Op::kMin, e); }
+  int VisitMax(const Expression& e) { return VisitBinary(Op::kMax, e); }
+  int VisitCeil(const Expression& e) { return VisitUnary(Op::kCeil, e); }
+  int VisitFloor(const Expression& e) { return VisitUnary(Op::kFloor, e); }
+
+  int VisitIfThenElse(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support if-then-else expressions.");
+  }
+
+  int VisitUninterpretedFunction(const Expression&) {
+    throw runtime_error(
+        "ExpressionTape does not support uninterpreted functions.");
+  }
+
+ private:
+  int VisitUnary(Op op, const Expression& e) {
+    return Emit(op, Visit(get_argument(e)));
+  }
+
+  int VisitBinary(Op op, const Expression& e) {
+    const int a = Visit(get_first_argument(e));
+    const int b = Visit(get_second_argument(e));
+    return Emit(op, a, b);
+  }
+
+  // Returns the slot of pow(base, exponent).
+  int VisitPow(const Expression& base, const Expression& exponent,
+               bool check_domain) {
+    const int a = Visit(base);
+    if (is_constant(exponent)) {
+      const double n = get_constant_value(exponent);
+      return (n == 1.0) ? a
+                        : Emit(Op::kPowConstant, a, -1, n, check_domain);
+    }
+    return Emit(Op::kPow, a, Visit(exponent), 0.0, check_domain);
+  }
+
+  // Returns the parameters that the value in `slot` depends on.
+  vector<int> GradientParameters(int slot) const {
+    return vector<int>(
+        tape_.gradient_parameters_.begin() + tape_.gradient_start_[slot],
+        tape_.gradient_parameters_.begin() + tape_.gradient_start_[slot + 1]);
+  }
+
+  // Adds a slot whose value depends on the (sorted) `parameters`.
+  int NewSlot(const vector<int>& parameters) {
+    tape_.gradient_parameters_.insert(tape_.gradient_parameters_.end(),
+                                      parameters.begin(), parameters.end());
+    tape_.gradient_start_.push_back(ssize(tape_.gradient_parameters_));
+    return tape_.num_slots_++;
+  }
+
+  // Appends the positions of the entries of `from` within `to` to `map`.
+  static void AppendPositions(const vector<int>& from, const vector<int>& to,
+                              vector<int>* map) {
+    auto iter = to.begin();
+    for (int parameter : from) {
+      iter = std::lower_bound(iter, to.end(), parameter);
+      DRAKE_ASSERT(iter != to.end() && *iter == parameter);
+      map->push_back(static_cast<int>(iter - to.begin()));
+    }
+  }
+
+  // Appends an instruction, and returns the slot of its result.
+  int Emit(Op op, int a, int b = -1, double c = 0.0,
+           bool check_domain = false) {
+    const vector<int> a_parameters = GradientParameters(a);
+    vector<int> b_parameters;
+    if (b >= 0) {
+      b_parameters = GradientParameters(b);
+    }
+    vector<int> out_parameters;
+    std::set_union(a_parameters.begin(), a_parameters.end(),
+                   b_parameters.begin(), b_parameters.end(),
+                   std::back_inserter(out_parameters));
+    const int out = NewSlot(out_parameters);
+    tape_.instructions_.push_back({op, out, a, b, c, check_domain});
+    AppendPositions(a_parameters, out_parameters, &tape_.a_to_out_);
+    AppendPositions(b_parameters, out_parameters, &tape_.b_to_out_);
+    tape_.a_to_out_start_.push_back(ssize(tape_.a_to_out_));
+    tape_.b_to_out_start_.push_back(ssize(tape_.b_to_out_));
+    return out;
+  }
+
+  const internal::ExpressionDag& dag_;
+  ExpressionTape& tape_;
+  std::unordered_map<Variable::Id, int> parameter_index_;
+  // The slot of the value of each node of the DAG.
+  vector<int> node_slots_;
+};
+
+ExpressionTape::ExpressionTape(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const vector<Variable>& parameters) {
+  internal::ExpressionDag dag;
+  for (int i = 0; i < expressions.size(); ++i) {
+    dag.Add(expressions(i));
+  }
+  const ExpressionTapeBuilder builder(parameters, &dag, this);
+  output_slots_.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    output_slots_.push_back(builder.Visit(expressions(i)));
+  }
+}
+
+std::optional<ExpressionTape> ExpressionTape::TryMake(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const vector<Variable>& parameters) {
+  internal::ExpressionDag dag;
+  for (int i = 0; i < expressions.size(); ++i) {
+    dag.Add(expressions(i));
+  }
+  for (const Expression& e : dag.nodes()) {
+    switch (e.get_kind()) {
+      case ExpressionKind::IfThenElse:
+      case ExpressionKind::UninterpretedFunction:
+      case ExpressionKind::NaN:
+        return std::nullopt;
+      default:
+        break;
+    }
+  }
+  return ExpressionTape(expressions, parameters);
+}
+
+namespace {
+
+// The domain checks of Expression::Evaluate().
+[[noreturn]] void ThrowOutOfDomain(const char* function, double v,
+                                   const char* domain) {
+  throw std::domain_error(fmt::format(
+      "{}({}) : numerical argument out of domain. {} is not in {}", function,
+      v, v, domain));
+}
+
+void CheckPowDomain(double a, double b) {
+  double b_integer_part;
+  if (std::isfinite(a) && (a < 0.0) && std::isfinite(b) &&
+      (std::modf(b, &b_integer_part) != 0.0)) {
+    throw std::domain_error(fmt::format(
+        "pow({}, {}) : numerical argument out of domain. {} is finite "
+        "negative and {} is finite non-integer.",
+        a, b, a, b));
+  }
+}
+
+}  // namespace
+
+double ExpressionTape::Value(const Instruction& instruction, double a,
+                             double b) {
+  const double c = instruction.c;
+  switch (instruction.op) {
+    case Op::kAddConstant:
+      return a + c;
+    case Op::kScale:
+      return c * a;
+    case Op::kAddScaled:
+      return a + c * b;
+    case Op::kMul:
+      return a * b;
+    case Op::kDiv:
+      if (b == 0.0) {
+        throw runtime_error(fmt::format("Division by zero: {} / {}", a, b));
+      }
+      return a / b;
+    case Op::kPowConstant:
+      if (instruction.check_domain) {
+        CheckPowDomain(a, c);
+      }
+      return (c == 2.0) ? a * a : std::pow(a, c);
+    case Op::kPow:
+      if (instruction.check_domain) {
+        CheckPowDomain(a, b);
+      }
+      return std::pow(a, b);
+    case Op::kAbs:
+      return std::fabs(a);
+    case Op::kLog:
+      if (!(a >= 0)) {
+        ThrowOutOfDomain("log", a, "[0, +oo)");
+      }
+      return std::log(a);
+    case Op::kExp:
+      return std::exp(a);
+    case Op::kSqrt:
+      if (!(a >= 0)) {
+        ThrowOutOfDomain("sqrt", a, "[0, +oo)");
+      }
+      return std::sqrt(a);
+    case Op::kSin:
+      return std::sin(a);
+    case Op::kCos:
+      return std::cos(a);
+    case Op::kTan:
+      return std::tan(a);
+    case Op::kAsin:
+      if (!((a >= -1.0) && (a <= 1.0))) {
+        ThrowOutOfDomain("asin", a, "[-1.0, +1.0]");
+      }
+      return std::asin(a);
+    case Op::kAcos:
+      if (!((a >= -1.0) && (a <= 1.0))) {
+        ThrowOutOfDomain("acos", a, "[-1.0, +1.0]");
+      }
+      return std::acos(a);
+    case Op::kAtan:
+      return std::atan(a);
+    case Op::kAtan2:
+      return std::atan2(a, b);
+    case Op::kSinh:
+      return std::sinh(a);
+    case Op::kCosh:
+      return std::cosh(a);
+    case Op::kTanh:
+      return std::tanh(a);
+    case Op::kMin:
+      return std::min(a, b);
+    case Op::kMax:
+      return std::max(a, b);
+    case Op::kCeil:
+      return std::ceil(a);
+    case Op::kFloor:
+      return std::floor(a);
+  }
+  DRAKE_UNREACHABLE();
+}
+
+void ExpressionTape::Partials(const Instruction& instruction, double a,
+                              double b, double out, double* d_a, double* d_b) {
+  constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+  const double c = instruction.c;
+  *d_b = 0.0;
+  switch (instruction.op) {
+    case Op::kAddConstant:
+      *d_a = 1.0;
+      return;
+    case Op::kScale:
+      *d_a = c;
+      return;
+    case Op::kAddScaled:
+      *d_a = 1.0;
+      *d_b = c;
+      return;
+    case Op::kMul:
+      *d_a = b;
+      *d_b = a;
+      return;
+    case Op::kDiv:
+      *d_a = 1.0 / b;
+      *d_b = -out / b;
+      return;
+    case Op::kPowConstant:
+      *d_a = (c == 2.0) ? 2.0 * a : c * std::pow(a, c - 1.0);
+      return;
+    case Op::kPow:
+      *d_a = b * std::pow(a, b - 1.0);
+      *d_b = std::log(a) * out;
+      return;
+    case Op::kAbs:
+      *d_a = (a > 0.0) ? 1.0 : (a < 0.0) ? -1.0 : kNaN;
+      return;
+    case Op::kLog:
+      *d_a = 1.0 / a;
+      return;
+    case Op::kExp:
+      *d_a = out;
+      return;
+    case Op::kSqrt:
+      *d_a = 0.5 / out;
+      return;
+    case Op::kSin:
+      *d_a = std::cos(a);
+      return;
+    case Op::kCos:
+      *d_a = -std::sin(a);
+      return;
+    case Op::kTan: {
+      const double cos_a = std::cos(a);
+      *d_a = 1.0 / (cos_a * cos_a);
+      return;
+    }
+    case Op::kAsin:
+      *d_a = 1.0 / std::sqrt(1.0 - a * a);
+      return;
+    case Op::kAcos:
+      *d_a = -1.0 / std::sqrt(1.0 - a * a);
+      return;
+    case Op::kAtan:
+      *d_a = 1.0 / (1.0 + a * a);
+      return;
+    case Op::kAtan2: {
+      const double norm_squared = a * a + b * b;
+      *d_a = b / norm_squared;
+      *d_b = -a / norm_squared;
+      return;
+    }
+    case Op::kSinh:
+      *d_a = std::cosh(a);
+      return;
+    case Op::kCosh:
+      *d_a = std::sinh(a);
+      return;
+    case Op::kTanh: {
+      const double cosh_a = std::cosh(a);
+      *d_a = 1.0 / (cosh_a * cosh_a);
+      return;
+    }
+    case Op::kMin:
+    case Op::kMax: {
+      const bool a_is_result = (instruction.op == Op::kMin) ? a < b : a > b;
+      const bool b_is_result = (instruction.op == Op::kMin) ? b < a : b > a;
+      *d_a = a_is_result ? 1.0 : b_is_result ? 0.0 : kNaN;
+      *d_b = b_is_result ? 1.0 : a_is_result ? 0.0 : kNaN;
+      return;
+    }
+    case Op::kCeil:
+    case Op::kFloor:
+      *d_a = (std::ceil(a) == std::floor(a)) ? kNaN : 0.0;
+      return;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+void ExpressionTape::Initialize(const Eigen::Ref<const Eigen::VectorXd>& p,
+                                Workspace* workspace) const {
+  DRAKE_THROW_UNLESS(p.size() == num_parameters());
+  vector<double>& values = workspace->values_;
+  values.resize(num_slots_);
+  std::copy(p.data(), p.data() + p.size(), values.begin());
+  for (const auto& [slot, value] : constants_) {
+    values[slot] = value;
+  }
+}
+
+void ExpressionTape::Evaluate(const Eigen::Ref<const Eigen::VectorXd>& p,
+                              Eigen::VectorXd* y, Workspace* workspace) const {
+  DRAKE_DEMAND(y != nullptr);
+  Workspace local_workspace;
+  if (workspace == nullptr) {
+    workspace = &local_workspace;
+  }
+  Initialize(p, workspace);
+  double* const values = workspace->values_.data();
+  for (const Instruction& instruction : instructions_) {
+    values[instruction.out] =
+        Value(instruction, values[instruction.a],
+              instruction.b >= 0 ? values[instruction.b] : 0.0);
+  }
+  y->resize(num_outputs());
+  for (int i = 0; i < num_outputs(); ++i) {
+    (*y)(i) = values[output_slots_[i]];
+  }
+}
+
+void ExpressionTape::EvaluateWithJacobian(
+    const Eigen::Ref<const Eigen::VectorXd>& p, Eigen::VectorXd* y,
+    Eigen::MatrixXd* J, Workspace* workspace) const {
+  DRAKE_DEMAND(y != nullptr);
+  DRAKE_DEMAND(J != nullptr);
+  Workspace local_workspace;
+  if (workspace == nullptr) {
+    workspace = &local_workspace;
+  }
+  Initialize(p, workspace);
+  double* const values = workspace->values_.data();
+  vector<double>& gradients_storage = workspace->gradients_;
+  gradients_storage.resize(gradient_parameters_.size());
+  double* const gradients = gradients_storage.data();
+  // The gradient of each parameter is a single 1 with respect to itself.
+  for (int i = 0; i < num_parameters(); ++i) {
+    gradients[gradient_start_[i]] = 1.0;
+  }
+  for (int i = 0; i < num_instructions(); ++i) {
+    const Instruction& instruction = instructions_[i];
+    const double a = values[instruction.a];
+    const double b = instruction.b >= 0 ? values[instruction.b] : 0.0;
+    const double out = Value(instruction, a, b);
+    values[instruction.out] = out;
+    double d_a, d_b;
+    Partials(instruction, a, b, out, &d_a, &d_b);
+    // Chain rule: ∇out = ∂out/∂a ∇a + ∂out/∂b ∇b.
+    double* const out_gradient = gradients + gradient_start_[instruction.out];
+    std::fill(out_gradient,
+              gradients + gradient_start_[instruction.out + 1], 0.0);
+    const double* const a_gradient = gradients + gradient_start_[instruction.a];
+    const int* const a_to_out = a_to_out_.data() + a_to_out_start_[i];
+    const int a_size =
+        gradient_start_[instruction.a + 1] - gradient_start_[instruction.a];
+    for (int k = 0; k < a_size; ++k) {
+      out_gradient[a_to_out[k]] += d_a * a_gradient[k];
+    }
+    if (instruction.b >= 0) {
+      const double* const b_gradient =
+          gradients + gradient_start_[instruction.b];
+      const int* const b_to_out = b_to_out_.data() + b_to_out_start_[i];
+      const int b_size =
+          gradient_start_[instruction.b + 1] - gradient_start_[instruction.b];
+      for (int k = 0; k < b_size; ++k) {
+        out_gradient[b_to_out[k]] += d_b * b_gradient[k];
+      }
+    }
+  }
+  y->resize(num_outputs());
+  J->setZero(num_outputs(), num_parameters());
+  for (int i = 0; i < num_outputs(); ++i) {
+    const int slot = output_slots_[i];
+    (*y)(i) = values[slot];
+    for (int k = gradient_start_[slot]; k < gradient_start_[slot + 1]; ++k) {
+      (*J)(i, gradient_parameters_[k]) = gradients[k];
+    }
+  }
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic/expression.h"
+
+namespace drake {
+namespace symbolic {
+
+/// A vector of symbolic expressions, compiled into a flat list of
+/// instructions that evaluates the expressions (and, optionally, their
+/// Jacobian) for numerical values of their variables.
+///
+/// Expression::Evaluate() and symbolic::Jacobian() walk the expression trees
+/// recursively, looking up the value of each variable in an Environment. When
+/// the same expressions are evaluated many times (e.g., inside the callbacks
+/// of a nonlinear solver) this overhead dominates. The tape instead is built
+/// once:
+///  - The variables are mapped to their indices in a given vector of
+///    parameters, as in CodeGen().
+///  - Identical subexpressions, across all of the expressions, are computed
+///    only once (common subexpression elimination).
+///  - Every subexpression gets a slot in a flat array of values; each
+///    instruction reads its operands from their slots and writes the result
+///    into its own slot.
+///
+/// Evaluating the tape is then a single loop over the instructions. The
+/// Jacobian is computed along the way in forward mode, propagating for each
+/// slot only the partial derivatives with respect to the parameters that it
+/// depends on. No code is generated and no compiler is needed.
+///
+/// The values are checked exactly as by Expression::Evaluate(): division by
+/// zero, and `log`, `sqrt`, `pow`, `asin`, or `acos` outside of their
+/// domains, throw. The derivatives are not checked; e.g., the derivative of
+/// `sqrt(x)` at zero is infinity. As with symbolic::Jacobian(), the
+/// derivative of a non-differentiable function at its discontinuity (e.g.,
+/// `abs(x)` at zero, or `min(x, y)` where `x = y`) is NaN.
+///
+/// If-then-else expressions and uninterpreted functions are not supported;
+/// see TryMake().
+class ExpressionTape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionTape);
+
+  /// Scratch storage for evaluating a tape. Passing the same workspace to
+  /// repeated evaluations avoids allocating memory for each one. A workspace
+  /// may be used with any tape, but not by two evaluations at the same time.
+  class Workspace {
+   public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Workspace);
+    Workspace() = default;
+
+   private:
+    friend class ExpressionTape;
+    std::vector<double> values_;
+    std::vector<double> gradients_;
+  };
+
+  /// Compiles `expressions` into a tape. The variables are mapped to the
+  /// inputs of the tape by their index in `parameters`.
+  /// @throws std::exception if `expressions` use a variable that is not in
+  /// `parameters`, or contain an if-then-else expression, an uninterpreted
+  /// function, or NaN.
+  ExpressionTape(const Eigen::Ref<const VectorX<Expression>>& expressions,
+                 const std::vector<Variable>& parameters);
+
+  /// Compiles `expressions` into a tape, like the constructor, unless they
+  /// contain an if-then-else expression, an uninterpreted function, or NaN,
+  /// which the tape does not support; returns nullopt in that case.
+  /// @throws std::exception if `expressions` use a variable that is not in
+  /// `parameters`, or a parameter is given more than once.
+  static std::optional<ExpressionTape> TryMake(
+      const Eigen::Ref<const VectorX<Expression>>& expressions,
+      const std::vector<Variable>& parameters);
+
+  /// Returns the number of expressions.
+  int num_outputs() const { return static_cast<int>(output_slots_.size()); }
+
+  /// Returns the number of parameters.
+  int num_parameters() const { return static_cast<int>(parameters_.size()); }
+
+  /// Returns the parameters, in the order in which the tape expects their
+  /// values.
+  const std::vector<Variable>& parameters() const { return parameters_; }
+
+  /// Returns the number of instructions of the tape. This is the number of
+  /// distinct non-leaf subexpressions of the expressions, possibly plus a few
+  /// instructions for the n-ary additions and multiplications.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Evaluates the expressions, for the given values `p` of the parameters,
+  /// into `y`.
+  /// @pre `p.size() == num_parameters()`.
+  /// @throws std::exception if a function is evaluated outside of its domain.
+  void Evaluate(const Eigen::Ref<const Eigen::VectorXd>& p, Eigen::VectorXd* y,
+                Workspace* workspace = nullptr) const;
+
+  /// Evaluates the expressions, for the given values `p` of the parameters,
+  /// into `y`, and their Jacobian with respect to the parameters into `J`.
+  /// @pre `p.size() == num_parameters()`.
+  /// @throws std::exception if a function is evaluated outside of its domain.
+  void EvaluateWithJacobian(const Eigen::Ref<const Eigen::VectorXd>& p,
+                            Eigen::VectorXd* y, Eigen::MatrixXd* J,
+                            Workspace* workspace = nullptr) const;
+
+ private:
+  friend class ExpressionTapeBuilder;
+
+  enum class Op {
+    kAddConstant,  // out = a + c
+    kScale,        // out = c * a
+    kAddScaled,    // out = a + c * b
+    kMul,          // out = a * b
+    kDiv,          // out = a / b
+    kPowConstant,  // out = pow(a, c)
+    kPow,          // out = pow(a, b)
+    kAbs,
+    kLog,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,  // out = atan2(a, b)
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,  // out = min(a, b)
+    kMax,  // out = max(a, b)
+    kCeil,
+    kFloor,
+  };
+
+  struct Instruction {
+    Op op{};
+    // The slots of the result and of the operands; b is -1 for unary
+    // operations.
+    int out{};
+    int a{};
+    int b{-1};
+    // The constant operand of kAddConstant, kScale, kAddScaled, and
+    // kPowConstant.
+    double c{};
+    // Whether kPowConstant and kPow check their domain. Like
+    // Expression::Evaluate(), pow() expressions do, but the factors of a
+    // multiplication don't.
+    bool check_domain{false};
+  };
+
+  // Returns the value of `instruction`, given the values of its operands.
+  // @throws std::exception if the operands are outside of its domain.
+  static double Value(const Instruction& instruction, double a, double b);
+
+  // Computes the partial derivatives of `instruction` with respect to its
+  // operands, given the values of its operands and of its result.
+  static void Partials(const Instruction& instruction, double a, double b,
+                       double out, double* d_a, double* d_b);
+
+  // Resizes the values of `workspace`, and sets the values of the parameters
+  // and constants.
+  void Initialize(const Eigen::Ref<const Eigen::VectorXd>& p,
+                  Workspace* workspace) const;
+
+  std::vector<Variable> parameters_;
+  // The first num_parameters() slots hold the parameters; the others hold
+  // the constants (at their given slots) and the results of the instructions.
+  int num_slots_{};
+  std::vector<std::pair<int, double>> constants_;
+  std::vector<Instruction> instructions_;
+  std::vector<int> output_slots_;
+
+  // The sparse gradients, for EvaluateWithJacobian(). The gradient of slot s
+  // is stored in gradients[gradient_start_[s]:gradient_start_[s + 1]], with
+  // respect to the parameters gradient_parameters_[gradient_start_[s]:...].
+  std::vector<int> gradient_start_;
+  std::vector<int> gradient_parameters_;
+  // For each instruction i and each entry k of the gradient of its operand a,
+  // the position of that entry within the gradient of the result is
+  // a_to_out_[a_to_out_start_[i] + k]; likewise for its operand b.
+  std::vector<int> a_to_out_start_;
+  std::vector<int> a_to_out_;
+  std::vector<int> b_to_out_start_;
+  std::vector<int> b_to_out_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
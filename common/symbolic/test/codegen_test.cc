@@ -1,11 +1,44 @@
 #include "drake/common/symbolic/codegen.h"
 
+#include <cmath>
 #include <sstream>
 #include <vector>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+namespace {
+// This is the generated code (string expected) from the WithJacobian testcase
+// below. We use it in the WithJacobianExample testcase. It is defined outside
+// of namespace drake::symbolic, so that the math functions are the ones of
+// <cmath> rather than the symbolic ones.
+void f_with_jacobian(const double* p, double* m, int* outer_indices,
+                     int* inner_indices, double* values) {
+  const double t0 = cos(p[1]);
+  const double t1 = (1 * p[0] * t0);
+  const double t2 = sin(p[1]);
+  m[0] = t1;
+  m[1] = (1 * p[0] * t2);
+  m[2] = (0 + p[2] + pow(p[0], 2.000000));
+  outer_indices[0] = 0;
+  outer_indices[1] = 3;
+  outer_indices[2] = 5;
+  outer_indices[3] = 6;
+  inner_indices[0] = 0;
+  inner_indices[1] = 1;
+  inner_indices[2] = 2;
+  inner_indices[3] = 0;
+  inner_indices[4] = 1;
+  inner_indices[5] = 2;
+  values[0] = t0;
+  values[1] = t2;
+  values[2] = (2 * p[0]);
+  values[3] = (-1 * p[0] * t2);
+  values[4] = t1;
+  values[5] = 1.000000;
+}
+}  // namespace
+
 namespace drake {
 namespace symbolic {
 namespace {
@@ -284,6 +317,74 @@ TEST_F(SymbolicCodeGenTest, DenseMatrixExampleInDocumentation) {
                                         2 /* number of columns */, expected));
 }
 
+TEST_F(SymbolicCodeGenTest, ScalarCommonSubexpressions) {
+  const Expression e{exp(x_ + y_) * exp(x_ + y_) * x_ + sin(exp(x_ + y_))};
+  const CodeGenOptions options{.eliminate_common_subexpressions = true};
+  const string expected{
+      R"""(double f(const double* p) {
+    const double t0 = exp((0 + p[0] + p[1]));
+    return (0 + (1 * p[0] * pow(t0, 2.000000)) + sin(t0));
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+} f_meta_t;
+f_meta_t f_meta() { return {{2}}; }
+)"""};
+  EXPECT_EQ(CodeGen("f", {x_, y_}, e, options), expected);
+}
+
+TEST_F(SymbolicCodeGenTest, DenseMatrixCommonSubexpressions) {
+  // sin(x) * y is both an entry of M and a subexpression of the other entry.
+  const Vector2<Expression> M{sin(x_) * y_, sin(x_) + cos(sin(x_) * y_)};
+  const CodeGenOptions options{.eliminate_common_subexpressions = true};
+  const string expected{
+      R"""(void f(const double* p, double* m) {
+    const double t0 = sin(p[0]);
+    const double t1 = (1 * p[1] * t0);
+    m[0] = t1;
+    m[1] = (0 + t0 + cos(t1));
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+    /* m: output, matrix */
+    struct { int rows; int cols; } m;
+} f_meta_t;
+f_meta_t f_meta() { return {{2}, {2, 1}}; }
+)"""};
+  EXPECT_EQ(CodeGen("f", {x_, y_}, M, options), expected);
+
+  // Without the option, the code is unchanged.
+  EXPECT_EQ(CodeGen("f", {x_, y_}, M),
+            MakeDenseMatrixFunctionCode(
+                "f", 2, 2, 1,
+                {"(1 * p[1] * sin(p[0]))",
+                 "(0 + sin(p[0]) + cos((1 * p[1] * sin(p[0]))))"}));
+}
+
+TEST_F(SymbolicCodeGenTest, SparseMatrixCommonSubexpressions) {
+  Eigen::SparseMatrix<Expression, Eigen::ColMajor> m(2, 2);
+  m.insert(0, 0) = exp(x_);
+  m.insert(1, 1) = exp(x_) * y_;
+  m.makeCompressed();
+  const CodeGenOptions options{.eliminate_common_subexpressions = true};
+  const string generated{CodeGen("f", {x_, y_}, m, options)};
+  const string expected_body{
+      R"""(void f(const double* p, int* outer_indices, int* inner_indices, double* values) {
+    outer_indices[0] = 0;
+    outer_indices[1] = 1;
+    outer_indices[2] = 2;
+    inner_indices[0] = 0;
+    inner_indices[1] = 1;
+    const double t0 = exp(p[0]);
+    values[0] = t0;
+    values[1] = (1 * p[1] * t0);
+}
+)"""};
+  EXPECT_EQ(generated.substr(0, expected_body.size()), expected_body);
+}
+
 TEST_F(SymbolicCodeGenTest, SparseMatrixColMajor) {
   const Variable x{"x"};
   const Variable y{"y"};
@@ -415,6 +516,86 @@ TEST_F(SymbolicCodeGenTest, SparseMatrixColMajorExampleUsingEigenMap) {
   EXPECT_EQ(m_double.coeff(2, 5), 2.0 /* y */);
 }
 
+TEST_F(SymbolicCodeGenTest, WithJacobian) {
+  // f = [x cos(y), x sin(y), x² + z].
+  const Vector3<Expression> f{x_ * cos(y_), x_ * sin(y_), pow(x_, 2) + z_};
+  const string generated{CodeGenWithJacobian("f", {x_, y_, z_}, f)};
+  // The Jacobian reuses cos(y), sin(y), and x cos(y) from f.
+  const string expected{
+      R"""(void f(const double* p, double* m, int* outer_indices, int* inner_indices, double* values) {
+    const double t0 = cos(p[1]);
+    const double t1 = (1 * p[0] * t0);
+    const double t2 = sin(p[1]);
+    m[0] = t1;
+    m[1] = (1 * p[0] * t2);
+    m[2] = (0 + p[2] + pow(p[0], 2.000000));
+    outer_indices[0] = 0;
+    outer_indices[1] = 3;
+    outer_indices[2] = 5;
+    outer_indices[3] = 6;
+    inner_indices[0] = 0;
+    inner_indices[1] = 1;
+    inner_indices[2] = 2;
+    inner_indices[3] = 0;
+    inner_indices[4] = 1;
+    inner_indices[5] = 2;
+    values[0] = t0;
+    values[1] = t2;
+    values[2] = (2 * p[0]);
+    values[3] = (-1 * p[0] * t2);
+    values[4] = t1;
+    values[5] = 1.000000;
+}
+typedef struct {
+    /* p: input, vector */
+    struct { int size; } p;
+    /* m: output, vector */
+    struct { int size; } m;
+    /* J: output, matrix */
+    struct {
+        int rows;
+        int cols;
+        int non_zeros;
+        int outer_indices;
+        int inner_indices;
+    } J;
+} f_meta_t;
+f_meta_t f_meta() { return {{3}, {3}, {3, 3, 6, 4, 6}}; }
+)"""};
+  EXPECT_EQ(generated, expected);
+}
+
+TEST_F(SymbolicCodeGenTest, WithJacobianErrors) {
+  const Vector1<Expression> f{uninterpreted_function("uf", {x_, y_})};
+  EXPECT_THROW(CodeGenWithJacobian("f", {x_, y_}, f), std::exception);
+}
+
+TEST_F(SymbolicCodeGenTest, WithJacobianExample) {
+  const Vector3<Expression> f{x_ * cos(y_), x_ * sin(y_), pow(x_, 2) + z_};
+  const vector<Variable> parameters{x_, y_, z_};
+  const Eigen::Vector3d param{0.5, -1.2, 3.0};
+
+  Eigen::Vector3d m;
+  vector<int> outer_indices(4);
+  vector<int> inner_indices(6);
+  vector<double> values(6);
+  ::f_with_jacobian(param.data(), m.data(), outer_indices.data(),
+                    inner_indices.data(), values.data());
+  const Eigen::Map<Eigen::SparseMatrix<double, Eigen::ColMajor>> J(
+      3, 3, 6, outer_indices.data(), inner_indices.data(), values.data());
+
+  // Compares against the symbolic evaluation.
+  const Environment env{{{x_, param(0)}, {y_, param(1)}, {z_, param(2)}}};
+  const Eigen::Matrix3d J_expected =
+      Evaluate(Jacobian(f, parameters), env);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_DOUBLE_EQ(m(i), f(i).Evaluate(env));
+    for (int j = 0; j < 3; ++j) {
+      EXPECT_DOUBLE_EQ(J.coeff(i, j), J_expected(i, j));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace symbolic
 }  // namespace drake
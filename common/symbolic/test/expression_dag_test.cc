@@ -0,0 +1,52 @@
+#include "drake/common/symbolic/expression_dag.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+
+namespace drake {
+namespace symbolic {
+namespace internal {
+namespace {
+
+GTEST_TEST(ExpressionDagTest, DistinctNodesInTopologicalOrder) {
+  const Variable x("x");
+  const Variable y("y");
+  const Expression s = sin(x + y);
+  ExpressionDag dag;
+  const int first = dag.Add(s * s + cos(x + y));
+  const int second = dag.Add(s);
+
+  // Each node comes after its operands, and the root comes last.
+  const std::vector<Expression>& nodes = dag.nodes();
+  EXPECT_EQ(first, ssize(nodes) - 1);
+  EXPECT_EQ(second, dag.index(s));
+  for (int i = 0; i < ssize(nodes); ++i) {
+    EXPECT_EQ(dag.index(nodes[i]), i);
+  }
+  EXPECT_LT(dag.index(x + y), dag.index(s));
+  EXPECT_LT(dag.index(x + y), dag.index(cos(x + y)));
+  EXPECT_LT(dag.index(s), first);
+
+  // x + y is an operand of both sin and cos; its own operands are only walked
+  // once. The second Add() of s counts as one more use.
+  EXPECT_EQ(dag.num_uses(dag.index(x + y)), 2);
+  EXPECT_EQ(dag.num_uses(dag.index(x)), 1);
+  EXPECT_EQ(dag.num_uses(dag.index(s)), 2);
+  EXPECT_EQ(dag.num_uses(first), 1);
+}
+
+GTEST_TEST(ExpressionDagTest, OpaqueLeaves) {
+  const Variable x("x");
+  const Expression e = if_then_else(x > 0, x, -x);
+  ExpressionDag dag;
+  dag.Add(e + 1);
+  // The operands of the if-then-else are not walked.
+  ASSERT_EQ(dag.nodes().size(), 2);
+  EXPECT_TRUE(dag.nodes()[0].EqualTo(e));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace symbolic
+}  // namespace drake
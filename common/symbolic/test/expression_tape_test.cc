@@ -0,0 +1,180 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+class ExpressionTapeTest : public ::testing::Test {
+ protected:
+  // Checks the tape of `e` against Expression::Evaluate() and Jacobian(), at
+  // the given values of x_, y_, and z_.
+  void CheckAgainstSymbolic(const VectorX<Expression>& e, const VectorXd& p) {
+    const std::vector<Variable> parameters{x_, y_, z_};
+    const ExpressionTape dut(e, parameters);
+    EXPECT_EQ(dut.num_outputs(), e.size());
+    EXPECT_EQ(dut.num_parameters(), 3);
+
+    const Environment env{{{x_, p(0)}, {y_, p(1)}, {z_, p(2)}}};
+    VectorXd y_expected(e.size());
+    for (int i = 0; i < e.size(); ++i) {
+      y_expected(i) = e(i).Evaluate(env);
+    }
+    const MatrixXd J_expected = Evaluate(Jacobian(e, parameters), env);
+
+    VectorXd y;
+    dut.Evaluate(p, &y);
+    EXPECT_TRUE(CompareMatrices(y, y_expected, 1e-14));
+
+    MatrixXd J;
+    ExpressionTape::Workspace workspace;
+    dut.EvaluateWithJacobian(p, &y, &J, &workspace);
+    EXPECT_TRUE(CompareMatrices(y, y_expected, 1e-14));
+    EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-13));
+
+    // The workspace can be reused.
+    dut.Evaluate(0.5 * p, &y, &workspace);
+    dut.EvaluateWithJacobian(p, &y, &J, &workspace);
+    EXPECT_TRUE(CompareMatrices(J, J_expected, 1e-13));
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+};
+
+TEST_F(ExpressionTapeTest, Arithmetic) {
+  VectorX<Expression> e(6);
+  e << 3, x_, 2 + 3 * x_ - y_ + 4 * x_ * y_ * y_, x_ / y_,
+      pow(x_, 3) * pow(y_, z_) * 5, pow(2, x_) + pow(x_, 0.5) + pow(x_, -2);
+  CheckAgainstSymbolic(e, Eigen::Vector3d(0.7, 1.3, -0.4));
+}
+
+TEST_F(ExpressionTapeTest, Functions) {
+  VectorX<Expression> e(17);
+  e << log(x_), abs(y_ - x_), exp(x_ * z_), sqrt(x_ + y_), sin(x_), cos(y_),
+      tan(z_), asin(x_), acos(z_), atan(y_), atan2(x_, z_), sinh(x_),
+      cosh(y_), tanh(z_), min(x_, z_), max(x_ * y_, 2 * z_),
+      ceil(x_) + floor(z_ * y_);
+  CheckAgainstSymbolic(e, Eigen::Vector3d(0.3, 1.2, -0.6));
+}
+
+TEST_F(ExpressionTapeTest, CommonSubexpressions) {
+  // sin(x + y) is computed once, and reused by both outputs.
+  const Expression s = sin(x_ + y_);
+  Vector2<Expression> e(s * s + s, 2 * s);
+  const ExpressionTape dut(e, {x_, y_, z_});
+  // x + y, sin(), pow(, 2) (i.e., s * s), +, and 2 *.
+  EXPECT_EQ(dut.num_instructions(), 5);
+  CheckAgainstSymbolic(e, Eigen::Vector3d(0.3, 1.2, -0.6));
+}
+
+TEST_F(ExpressionTapeTest, SparseJacobian) {
+  // Each output only depends on some of the parameters; the others are zero
+  // in the Jacobian even where the partial derivatives are not finite.
+  Vector3<Expression> e(log(x_), sqrt(y_), z_);
+  const ExpressionTape dut(e, {x_, y_, z_});
+  VectorXd y;
+  MatrixXd J;
+  dut.EvaluateWithJacobian(Eigen::Vector3d(0, 0, 1), &y, &J);
+  EXPECT_EQ(J(0, 1), 0.0);
+  EXPECT_EQ(J(0, 2), 0.0);
+  EXPECT_EQ(J(1, 0), 0.0);
+  EXPECT_EQ(J(1, 2), 0.0);
+  EXPECT_EQ(J(2, 2), 1.0);
+}
+
+TEST_F(ExpressionTapeTest, NonDifferentiable) {
+  // Like Jacobian(), the derivatives at the discontinuities are NaN.
+  Vector3<Expression> e(abs(x_), min(x_, y_), ceil(z_));
+  const ExpressionTape dut(e, {x_, y_, z_});
+  VectorXd y;
+  MatrixXd J;
+  dut.EvaluateWithJacobian(Eigen::Vector3d(0, 0, 1), &y, &J);
+  EXPECT_TRUE(CompareMatrices(y, Eigen::Vector3d(0, 0, 1)));
+  EXPECT_TRUE(std::isnan(J(0, 0)));
+  EXPECT_TRUE(std::isnan(J(1, 0)));
+  EXPECT_TRUE(std::isnan(J(1, 1)));
+  EXPECT_TRUE(std::isnan(J(2, 2)));
+  dut.EvaluateWithJacobian(Eigen::Vector3d(-1, 2, 1.5), &y, &J);
+  EXPECT_EQ(J(0, 0), -1.0);
+  EXPECT_EQ(J(1, 0), 1.0);
+  EXPECT_EQ(J(1, 1), 0.0);
+  EXPECT_EQ(J(2, 2), 0.0);
+}
+
+TEST_F(ExpressionTapeTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(Vector1<Expression>(x_ + y_), {x_}),
+      ".*variable y is not one of the parameters.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(Vector1<Expression>(x_), {x_, x_}),
+      ".*parameter x is given more than once.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(Vector1<Expression>(if_then_else(x_ > 0, x_, 0)), {x_}),
+      ".*does not support if-then-else.*");
+  const ExpressionTape dut(Vector1<Expression>(x_), {x_});
+  VectorXd y;
+  EXPECT_THROW(dut.Evaluate(Eigen::Vector2d(1, 2), &y), std::exception);
+}
+
+TEST_F(ExpressionTapeTest, TryMake) {
+  const std::vector<Variable> parameters{x_, y_};
+  EXPECT_TRUE(
+      ExpressionTape::TryMake(Vector1<Expression>(x_ + y_), parameters));
+  EXPECT_FALSE(ExpressionTape::TryMake(
+      Vector2<Expression>(x_, if_then_else(x_ > 0, x_, y_)), parameters));
+  EXPECT_FALSE(ExpressionTape::TryMake(
+      Vector1<Expression>(uninterpreted_function("f", {x_})), parameters));
+  EXPECT_FALSE(ExpressionTape::TryMake(
+      Vector1<Expression>(x_ + Expression::NaN()), parameters));
+  // Misuse still throws.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape::TryMake(Vector1<Expression>(x_ + z_), parameters),
+      ".*variable z is not one of the parameters.*");
+}
+
+TEST_F(ExpressionTapeTest, DomainErrors) {
+  // The values are checked like Expression::Evaluate() does.
+  const Environment env{{{x_, -1}, {y_, 0}, {z_, 2}}};
+  const Eigen::Vector3d p(-1, 0, 2);
+  for (const Expression& e :
+       {log(x_), sqrt(x_), x_ / y_, asin(z_), acos(z_), pow(x_, 0.5),
+        pow(x_, z_ / 4)}) {
+    SCOPED_TRACE(e.to_string());
+    EXPECT_THROW(e.Evaluate(env), std::exception);
+    const ExpressionTape dut(Vector1<Expression>(e), {x_, y_, z_});
+    VectorXd y;
+    MatrixXd J;
+    EXPECT_THROW(dut.Evaluate(p, &y), std::exception);
+    EXPECT_THROW(dut.EvaluateWithJacobian(p, &y, &J), std::exception);
+  }
+  const ExpressionTape log_tape(Vector1<Expression>(log(x_)), {x_});
+  VectorXd log_y;
+  DRAKE_EXPECT_THROWS_MESSAGE(log_tape.Evaluate(Vector1d(-1), &log_y),
+                              ".*log.*out of domain.*");
+
+  // Like Expression::Evaluate(), the factors of a multiplication are not
+  // checked.
+  const Expression product = pow(x_, 0.5) * z_;
+  ASSERT_TRUE(is_multiplication(product));
+  EXPECT_TRUE(std::isnan(product.Evaluate(env)));
+  const ExpressionTape dut(Vector1<Expression>(product), {x_, y_, z_});
+  VectorXd y;
+  dut.Evaluate(p, &y);
+  EXPECT_TRUE(std::isnan(y(0)));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -172,6 +172,52 @@ MatrixX<T> BsplineTrajectory<T>::DoEvalDerivative(const T& time,
   }
 }
 
+template <typename T>
+void BsplineTrajectory<T>::DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                       int derivative_order,
+                                       MatrixX<T>* values) const {
+  const int num_elements = this->rows() * this->cols();
+  if (derivative_order >= basis_.order()) {
+    values->setZero(num_elements, t.size());
+    return;
+  }
+  if (derivative_order > 0) {
+    // The derivative is a B-spline of lower order. Computing its control
+    // points once is cheaper than DoEvalDerivative()'s work for each sample.
+    this->MakeDerivative(derivative_order)->EvalBatch(t, 0, values);
+    return;
+  }
+  values->resize(num_elements, t.size());
+  // Define short names to match the notation of BsplineBasis::EvaluateCurve(),
+  // which this follows with the control points flattened into the columns of
+  // `p`, so that each step of the de Boor algorithm is one vector operation.
+  const std::vector<T>& knots = basis_.knots();
+  const int k = basis_.order();
+  MatrixX<T> p(num_elements, k);
+  int ell = -1;
+  for (int sample = 0; sample < static_cast<int>(t.size()); ++sample) {
+    using std::clamp;
+    const T t_bar = clamp(t[sample], this->start_time(), this->end_time());
+    // Reuse the interval of the previous sample if it contains t_bar.
+    if (ell < 0 || t_bar < knots[ell] || !(t_bar < knots[ell + 1])) {
+      ell = basis_.FindContainingInterval(t_bar);
+    }
+    for (int r = 0; r < k; ++r) {
+      const MatrixX<T>& control_point = control_points_[ell - r];
+      p.col(r) = Eigen::Map<const VectorX<T>>(control_point.data(),
+                                              num_elements);
+    }
+    for (int j = 1; j < k; ++j) {
+      for (int r = 0; r < k - j; ++r) {
+        const int i = ell - r;
+        const T alpha = (t_bar - knots[i]) / (knots[i + k - j] - knots[i]);
+        p.col(r) = (1.0 - alpha) * p.col(r + 1) + alpha * p.col(r);
+      }
+    }
+    values->col(sample) = p.col(0);
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> BsplineTrajectory<T>::DoMakeDerivative(
     int derivative_order) const {
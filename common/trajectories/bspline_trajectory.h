@@ -158,6 +158,8 @@ class BsplineTrajectory final : public trajectories::Trajectory<T> {
   MatrixX<T> do_value(const T& t) const final;
   bool do_has_derivative() const final;
   MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const final;
+  void DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t, int derivative_order,
+                   MatrixX<T>* values) const final;
   std::unique_ptr<trajectories::Trajectory<T>> DoMakeDerivative(
       int derivative_order) const final;
   Eigen::Index do_rows() const final { return control_points()[0].rows(); }
@@ -1,6 +1,7 @@
 #include "drake/common/trajectories/composite_trajectory.h"
 
 #include <utility>
+#include <vector>
 
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/path_parameterized_trajectory.h"
@@ -78,6 +79,61 @@ MatrixX<T> CompositeTrajectory<T>::DoEvalDerivative(
   return this->segments_[segment_index]->EvalDerivative(time, derivative_order);
 }
 
+template <typename T>
+void CompositeTrajectory<T>::DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                         int derivative_order,
+                                         MatrixX<T>* values) const {
+  const int num_samples = t.size();
+  const int num_segments = this->get_number_of_segments();
+  if (num_samples == 0) {
+    values->resize(this->rows() * this->cols(), 0);
+    return;
+  }
+  // Groups the samples by segment (with a counting sort, which keeps the
+  // samples of each segment in order), so that each segment evaluates all of
+  // its samples in a single batch.
+  std::vector<int> segment_of_sample(num_samples);
+  std::vector<int> segment_start(num_segments + 1, 0);
+  int segment_index = -1;
+  for (int i = 0; i < num_samples; ++i) {
+    segment_index = this->get_segment_index(t[i], segment_index);
+    DRAKE_DEMAND(num_segments > segment_index);
+    segment_of_sample[i] = segment_index;
+    ++segment_start[segment_index + 1];
+  }
+  for (int s = 0; s < num_segments; ++s) {
+    segment_start[s + 1] += segment_start[s];
+  }
+  std::vector<int> samples(num_samples);
+  std::vector<int> next(segment_start.begin(), segment_start.end() - 1);
+  for (int i = 0; i < num_samples; ++i) {
+    samples[next[segment_of_sample[i]]++] = i;
+  }
+
+  VectorX<T> segment_times;
+  MatrixX<T> segment_values;
+  bool resized = false;
+  for (int s = 0; s < num_segments; ++s) {
+    const int begin = segment_start[s];
+    const int size = segment_start[s + 1] - begin;
+    if (size == 0) continue;
+    segment_times.resize(size);
+    for (int k = 0; k < size; ++k) {
+      segment_times[k] = t[samples[begin + k]];
+    }
+    segments_[s]->EvalBatch(segment_times, derivative_order, &segment_values);
+    if (!resized) {
+      // The derivatives need not have the shape of the values; see, e.g.,
+      // PiecewisePose.
+      values->resize(segment_values.rows(), num_samples);
+      resized = true;
+    }
+    for (int k = 0; k < size; ++k) {
+      values->col(samples[begin + k]) = segment_values.col(k);
+    }
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> CompositeTrajectory<T>::DoMakeDerivative(
     int derivative_order) const {
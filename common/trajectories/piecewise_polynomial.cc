@@ -222,6 +222,52 @@ MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
   return ret;
 }
 
+template <typename T>
+void PiecewisePolynomial<T>::DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                         int derivative_order,
+                                         MatrixX<T>* values) const {
+  const int num_elements = rows() * cols();
+  values->resize(num_elements, t.size());
+  // The coefficients of the derivative of the polynomials of the current
+  // segment, one row per element (in column-major order) and one column per
+  // power of the time since the start of the segment. Evaluating them with
+  // Horner's rule across all of the elements at once lets Eigen vectorize it.
+  MatrixX<T> coefficients;
+  int segment_index = -1;
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    const int new_segment_index = this->get_segment_index(t[i], segment_index);
+    if (new_segment_index != segment_index) {
+      segment_index = new_segment_index;
+      const PolynomialMatrix& polynomials = polynomials_[segment_index];
+      int max_degree = 0;
+      for (int k = 0; k < num_elements; ++k) {
+        max_degree = max(max_degree, polynomials(k).GetDegree());
+      }
+      coefficients.setZero(num_elements,
+                           max(max_degree - derivative_order, 0) + 1);
+      for (int k = 0; k < num_elements; ++k) {
+        for (const auto& monomial : polynomials(k).GetMonomials()) {
+          int degree = monomial.terms.empty() ? 0 : monomial.terms[0].power;
+          if (degree < derivative_order) continue;
+          T coefficient = monomial.coefficient;
+          for (int j = 0; j < derivative_order; ++j) {
+            coefficient *= degree--;
+          }
+          coefficients(k, degree) += coefficient;
+        }
+      }
+    }
+    const T s = clamp(t[i], this->start_time(), this->end_time()) -
+                this->start_time(segment_index);
+    auto value = values->col(i);
+    const int degree = coefficients.cols() - 1;
+    value = coefficients.col(degree);
+    for (int j = degree - 1; j >= 0; --j) {
+      value = value * s + coefficients.col(j);
+    }
+  }
+}
+
 template <typename T>
 const typename PiecewisePolynomial<T>::PolynomialMatrix&
 PiecewisePolynomial<T>::getPolynomialMatrix(int segment_index) const {
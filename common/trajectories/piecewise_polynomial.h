@@ -820,6 +820,8 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
   // @warning This method comes with the same caveats as value(). See value()
   // @pre derivative_order must be non-negative.
   MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const final;
+  void DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t, int derivative_order,
+                   MatrixX<T>* values) const final;
   std::unique_ptr<Trajectory<T>> DoMakeDerivative(
       int derivative_order) const final {
     return derivative(derivative_order).Clone();
@@ -127,6 +127,33 @@ MatrixX<T> PiecewisePose<T>::DoEvalDerivative(const T& t,
   return derivative;
 }
 
+template <typename T>
+void PiecewisePose<T>::DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                   int derivative_order,
+                                   MatrixX<T>* values) const {
+  if (derivative_order == 0) {
+    // The quaternions are in w, x, y, z order.
+    const MatrixX<T> quaternions = orientation_.EvalBatch(t);
+    const MatrixX<T> positions = position_.EvalBatch(t);
+    values->resize(16, t.size());
+    for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+      const Quaternion<T> q(quaternions(0, i), quaternions(1, i),
+                            quaternions(2, i), quaternions(3, i));
+      Eigen::Map<Matrix4<T>>(values->col(i).data()) =
+          math::RigidTransform<T>(q, positions.col(i)).GetAsMatrix4();
+    }
+    return;
+  }
+  // Stacks the derivatives as DoEvalDerivative() does.
+  const MatrixX<T> orientation_derivatives =
+      orientation_.EvalBatch(t, derivative_order);
+  const MatrixX<T> position_derivatives =
+      position_.EvalBatch(t, derivative_order);
+  values->resize(6, t.size());
+  values->template topRows<3>() = orientation_derivatives;
+  values->template bottomRows<3>() = position_derivatives;
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> PiecewisePose<T>::DoMakeDerivative(
     int derivative_order) const {
@@ -208,6 +208,32 @@ MatrixX<T> PiecewiseQuaternionSlerp<T>::DoEvalDerivative(
   return Vector3<T>::Zero();
 }
 
+template <typename T>
+void PiecewiseQuaternionSlerp<T>::DoEvalBatch(
+    const Eigen::Ref<const VectorX<T>>& t, int derivative_order,
+    MatrixX<T>* values) const {
+  if (derivative_order > 1) {
+    // All higher derivatives are zero.
+    values->setZero(3, t.size());
+    return;
+  }
+  values->resize(derivative_order == 0 ? 4 : 3, t.size());
+  int segment_index = -1;
+  for (int i = 0; i < static_cast<int>(t.size()); ++i) {
+    segment_index = this->get_segment_index(t[i], segment_index);
+    if (derivative_order == 1) {
+      values->col(i) = angular_velocities_[segment_index];
+      continue;
+    }
+    const Quaternion<T> q =
+        quaternions_[segment_index]
+            .slerp(ComputeInterpTime(segment_index, t[i]),
+                   quaternions_[segment_index + 1])
+            .normalized();
+    values->col(i) << q.w(), q.x(), q.y(), q.z();
+  }
+}
+
 template <typename T>
 std::unique_ptr<Trajectory<T>> PiecewiseQuaternionSlerp<T>::DoMakeDerivative(
     int derivative_order) const {
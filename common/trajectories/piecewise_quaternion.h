@@ -151,6 +151,8 @@ class PiecewiseQuaternionSlerp final : public PiecewiseTrajectory<T> {
   }
   bool do_has_derivative() const final;
   MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const final;
+  void DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t, int derivative_order,
+                   MatrixX<T>* values) const final;
   std::unique_ptr<Trajectory<T>> DoMakeDerivative(
       int derivative_order) const final;
   Eigen::Index do_rows() const final { return 4; }
@@ -80,6 +80,24 @@ int PiecewiseTrajectory<T>::get_segment_index(const T& t) const {
                                   static_cast<int>(breaks_.size() - 1));
 }
 
+template <typename T>
+int PiecewiseTrajectory<T>::get_segment_index(const T& t, int hint) const {
+  const int num_segments = get_number_of_segments();
+  if (hint < 0 || hint >= num_segments) return get_segment_index(t);
+  using std::clamp;
+  const T time = clamp(t, start_time(), end_time());
+  if (time < breaks_[hint]) return get_segment_index(t);
+  // Like GetSegmentIndexRecursive(), returns the last segment whose start time
+  // is at most `time`.
+  const int kMaxLinearSearch = 4;
+  const int last_searched = std::min(hint + kMaxLinearSearch, num_segments) - 1;
+  for (int i = hint; i <= last_searched; ++i) {
+    if (i == num_segments - 1 || time < breaks_[i + 1]) return i;
+  }
+  return GetSegmentIndexRecursive(time, last_searched + 1,
+                                  static_cast<int>(breaks_.size() - 1));
+}
+
 template <typename T>
 const std::vector<T>& PiecewiseTrajectory<T>::get_segment_times() const {
   return breaks_;
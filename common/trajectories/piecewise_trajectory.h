@@ -43,6 +43,16 @@ class PiecewiseTrajectory : public Trajectory<T> {
 
   int get_segment_index(const T& t) const;
 
+  /**
+   * Returns the same result as get_segment_index(t), but first looks for `t`
+   * in the segment @p hint and the few segments that follow it. When
+   * evaluating the trajectory at sorted times, passing the segment of the
+   * previous time as the hint finds each segment in constant time. Any @p hint
+   * is allowed; if it is out of range or after the segment of `t`, this falls
+   * back to get_segment_index(t).
+   */
+  int get_segment_index(const T& t, int hint) const;
+
   const std::vector<T>& get_segment_times() const;
 
   void segment_number_range_check(int segment_number) const;
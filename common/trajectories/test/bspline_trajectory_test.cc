@@ -203,6 +203,29 @@ TYPED_TEST(BsplineTrajectoryTests, EvalDerivativeTest) {
   }
 }
 
+// Verifies that EvalBatch() matches EvalDerivative().
+TYPED_TEST(BsplineTrajectoryTests, EvalBatchTest) {
+  using T = TypeParam;
+  BsplineTrajectory<T> trajectory = MakeCircleTrajectory<T>();
+
+  // Sorted times, including some outside of the time interval, followed by
+  // the same times in reverse.
+  const int num_times = 30;
+  VectorX<T> t(2 * num_times);
+  t.head(num_times) = VectorX<T>::LinSpaced(
+      num_times, trajectory.start_time() - 0.1, trajectory.end_time() + 0.1);
+  t.tail(num_times) = t.head(num_times).reverse();
+  for (int o = 0; o <= trajectory.basis().order(); ++o) {
+    const MatrixX<T> values = trajectory.EvalBatch(t, o);
+    ASSERT_EQ(values.rows(), 2);
+    ASSERT_EQ(values.cols(), t.size());
+    for (int k = 0; k < t.size(); ++k) {
+      EXPECT_TRUE(CompareMatrices(values.col(k),
+                                  trajectory.EvalDerivative(t(k), o), 1e-13));
+    }
+  }
+}
+
 // Verifies that CopyBlock() works as expected.
 TYPED_TEST(BsplineTrajectoryTests, CopyBlockTest) {
   using T = TypeParam;
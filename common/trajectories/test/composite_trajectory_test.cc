@@ -6,6 +6,7 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/trajectories/bezier_curve.h"
+#include "drake/common/trajectories/piecewise_polynomial.h"
 
 namespace drake {
 namespace trajectories {
@@ -68,6 +69,37 @@ GTEST_TEST(CompositeTrajectoryTest, Basic) {
       CompareMatrices(clone->value(3.5), Eigen::Vector2d(2.5, 8.5), 1e-14));
 }
 
+GTEST_TEST(CompositeTrajectoryTest, EvalBatch) {
+  std::vector<copyable_unique_ptr<Trajectory<double>>> segments(3);
+  Eigen::Matrix2d points;
+  points << 1, 2, 3, 7;
+  segments[0] = std::make_unique<BezierCurve<double>>(0, 1, points);
+  segments[1] = std::make_unique<PiecewisePolynomial<double>>(
+      PiecewisePolynomial<double>::CubicHermite(
+          Eigen::Vector3d(1, 1.5, 2),
+          (Eigen::Matrix<double, 2, 3>() << 2, 0, 1, 7, 4, 5).finished(),
+          Eigen::Matrix<double, 2, 3>::Ones()));
+  points << 1, 4, 5, 2;
+  segments[2] = std::make_unique<BezierCurve<double>>(2, 3, points);
+  const CompositeTrajectory<double> traj(segments);
+
+  // Unsorted times, with repeats, in every segment and outside of the range.
+  const Eigen::VectorXd t = (Eigen::VectorXd(10) << 2.5, 0.2, -1, 1.7, 1.0,
+                             2.0, 0.2, 4, 1.2, 2.9).finished();
+  for (int derivative_order = 0; derivative_order <= 2; ++derivative_order) {
+    Eigen::MatrixXd values;
+    traj.EvalBatch(t, derivative_order, &values);
+    ASSERT_EQ(values.rows(), 2);
+    ASSERT_EQ(values.cols(), t.size());
+    for (int i = 0; i < t.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(values.col(i),
+                                  traj.EvalDerivative(t[i], derivative_order),
+                                  1e-13));
+    }
+  }
+  EXPECT_EQ(traj.EvalBatch(Eigen::VectorXd(0)).rows(), 2);
+}
+
 template <typename T>
 void CheckScalarType() {
   Eigen::Matrix<T, 2, 3> points;
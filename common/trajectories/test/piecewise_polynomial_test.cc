@@ -1,5 +1,6 @@
 #include "drake/common/trajectories/piecewise_polynomial.h"
 
+#include <algorithm>
 #include <random>
 #include <stdexcept>
 #include <vector>
@@ -373,6 +374,46 @@ GTEST_TEST(testPiecewisePolynomial, VectorValueTest) {
       "This method only supports vector-valued trajectories.");
 }
 
+GTEST_TEST(testPiecewisePolynomial, EvalBatchTest) {
+  default_random_engine generator;
+  const vector<double> segment_times =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(6, generator);
+  const PiecewisePolynomial<double> pp =
+      test::MakeRandomPiecewisePolynomial<double>(2, 3, 5, segment_times);
+
+  // Sorted times, including the breaks and times outside of the range,
+  // followed by unsorted ones.
+  vector<double> times{pp.start_time() - 1};
+  for (double t = pp.start_time(); t < pp.end_time(); t += 0.05) {
+    times.push_back(t);
+  }
+  times.insert(times.end(), segment_times.begin(), segment_times.end());
+  std::sort(times.begin(), times.end());
+  times.push_back(pp.end_time() + 1);
+  times.insert(times.end(), {segment_times[3], pp.start_time(),
+                             segment_times[5], segment_times[1] + 0.01});
+  const Eigen::Map<const Eigen::VectorXd> t(times.data(), times.size());
+
+  Eigen::MatrixXd values;
+  for (int derivative_order = 0; derivative_order <= 5; ++derivative_order) {
+    pp.EvalBatch(t, derivative_order, &values);
+    ASSERT_EQ(values.rows(), 6);
+    ASSERT_EQ(values.cols(), t.size());
+    for (int i = 0; i < t.size(); ++i) {
+      const Eigen::MatrixXd expected =
+          pp.EvalDerivative(t[i], derivative_order);
+      EXPECT_TRUE(CompareMatrices(values.col(i).reshaped(2, 3), expected,
+                                  1e-10, MatrixCompareType::relative));
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(pp.EvalBatch(t).col(2).reshaped(2, 3),
+                              pp.value(t[2])));
+  EXPECT_EQ(pp.EvalBatch(Eigen::VectorXd(0)).rows(), 6);
+  EXPECT_EQ(pp.EvalBatch(Eigen::VectorXd(0)).cols(), 0);
+  DRAKE_EXPECT_THROWS_MESSAGE(pp.EvalBatch(t, -1),
+                              ".*derivative_order >= 0.*");
+}
+
 GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
   Eigen::VectorXd breaks(3);
   breaks << 0, .5, 1.;
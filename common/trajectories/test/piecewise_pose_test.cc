@@ -194,6 +194,26 @@ TEST_F(PiecewisePoseTest, TestTrajectoryOverrides) {
   }
 }
 
+// Tests that EvalBatch() matches value() and EvalDerivative().
+TEST_F(PiecewisePoseTest, TestEvalBatch) {
+  std::vector<double> times = test_times_;
+  times.insert(times.end(), test_times_.rbegin(), test_times_.rend());
+  const Eigen::Map<const Eigen::VectorXd> t(times.data(), times.size());
+
+  for (int derivative_order = 0; derivative_order <= 3; ++derivative_order) {
+    const Eigen::MatrixXd values = dut_.EvalBatch(t, derivative_order);
+    ASSERT_EQ(values.cols(), t.size());
+    for (int i = 0; i < t.size(); ++i) {
+      const Eigen::MatrixXd expected = dut_.EvalDerivative(t[i],
+                                                           derivative_order);
+      ASSERT_EQ(values.rows(), expected.size());
+      EXPECT_TRUE(drake::CompareMatrices(
+          values.col(i).reshaped(expected.rows(), expected.cols()), expected,
+          1e-12, drake::MatrixCompareType::absolute));
+    }
+  }
+}
+
 GTEST_TEST(PiecewisePoseMakeTest, MakeLinear) {
   const std::vector<double> times = {1., 2., 3.};
   const std::vector<RigidTransformd> poses{
@@ -259,6 +259,30 @@ GTEST_TEST(TestPiecewiseQuaternionSlerp, TestDerivatives) {
   }
 }
 
+// Tests that EvalBatch() matches EvalDerivative(), for sorted and unsorted
+// times.
+GTEST_TEST(TestPiecewiseQuaternionSlerp, TestEvalBatch) {
+  const std::vector<double> time = {0, 1.6, 2.32};
+  const Vector3<double> axis = Vector3<double>(1, 2, 3).normalized();
+  const std::vector<AngleAxis<double>> rot = {AngleAxis<double>(1, axis),
+                                              AngleAxis<double>(-0.4, axis),
+                                              AngleAxis<double>(2.1, axis)};
+  const PiecewiseQuaternionSlerp<double> rot_spline(time, rot);
+
+  const Eigen::VectorXd t =
+      (Eigen::VectorXd(8) << -1.0, 0.5, 1.6, 2.0, 4.0, 1.0, -0.2, 2.3)
+          .finished();
+  for (int derivative_order = 0; derivative_order <= 2; ++derivative_order) {
+    const Eigen::MatrixXd values = rot_spline.EvalBatch(t, derivative_order);
+    ASSERT_EQ(values.cols(), t.size());
+    for (int i = 0; i < t.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          values.col(i), rot_spline.EvalDerivative(t[i], derivative_order),
+          1e-14));
+    }
+  }
+}
+
 template <typename T>
 void TestScalarType() {
   std::vector<T> times = {1, 2};
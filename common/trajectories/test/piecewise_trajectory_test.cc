@@ -96,6 +96,24 @@ GTEST_TEST(PiecewiseTrajectoryTest, GetIndexTest) {
   TestPiecewiseTrajectoryTimeRelatedGetters(traj, time);
 }
 
+GTEST_TEST(PiecewiseTrajectoryTest, GetIndexWithHintTest) {
+  std::default_random_engine generator(123);
+  const std::vector<double> time =
+      PiecewiseTrajectory<double>::RandomSegmentTimes(20, generator);
+  PiecewiseTrajectoryTester traj(time);
+
+  std::vector<double> test_times{time.front() - 1, time.back() + 1};
+  for (double t : time) {
+    test_times.insert(test_times.end(), {t - 1e-10, t, t + 1e-10});
+  }
+  for (double t : test_times) {
+    const int expected = traj.get_segment_index(t);
+    for (int hint = -1; hint <= traj.get_number_of_segments(); ++hint) {
+      EXPECT_EQ(traj.get_segment_index(t, hint), expected);
+    }
+  }
+}
+
 template <typename T>
 void TestScalarType() {
   std::default_random_engine generator(123);
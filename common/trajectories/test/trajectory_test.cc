@@ -58,6 +58,22 @@ GTEST_TEST(TrajectoryTest, MakeDerivativesTest) {
                               ".* does not support .*");
 }
 
+GTEST_TEST(TrajectoryTest, EvalBatchTest) {
+  TrajectoryTester traj_yes_deriv(true);
+  const Eigen::Vector3d t(0, 0.5, 1);
+  const Eigen::MatrixXd values = traj_yes_deriv.EvalBatch(t);
+  EXPECT_EQ(values.rows(), 0);
+  EXPECT_EQ(values.cols(), 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(traj_yes_deriv.EvalBatch(t, 1),
+                              ".* must implement .*");
+  DRAKE_EXPECT_THROWS_MESSAGE(traj_yes_deriv.EvalBatch(t, -1),
+                              ".*derivative_order >= 0.*");
+
+  TrajectoryTester traj_no_deriv(false);
+  DRAKE_EXPECT_THROWS_MESSAGE(traj_no_deriv.EvalBatch(t, 1),
+                              ".* does not support .*");
+}
+
 template <typename T>
 void TestScalarType() {
   TrajectoryTester<T> traj(true);
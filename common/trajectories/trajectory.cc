@@ -28,18 +28,49 @@ MatrixX<T> Trajectory<T>::vector_values(
     throw std::runtime_error(
         "This method only supports vector-valued trajectories.");
   }
+  // Each column of the EvalBatch() result is one value, flattened; for a
+  // column (or row) vector that is the vector itself.
+  MatrixX<T> values = EvalBatch(t);
   if (cols() == 1) {
-    MatrixX<T> values(rows(), t.size());
-    for (int i = 0; i < static_cast<int>(t.size()); ++i) {
-      values.col(i) = value(t[i]);
-    }
     return values;
   }
-  MatrixX<T> values(t.size(), cols());
+  return values.transpose();
+}
+
+template <typename T>
+void Trajectory<T>::EvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                              int derivative_order, MatrixX<T>* values) const {
+  DRAKE_THROW_UNLESS(derivative_order >= 0);
+  DRAKE_THROW_UNLESS(values != nullptr);
+  DoEvalBatch(t, derivative_order, values);
+}
+
+template <typename T>
+MatrixX<T> Trajectory<T>::EvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                    int derivative_order) const {
+  MatrixX<T> values;
+  EvalBatch(t, derivative_order, &values);
+  return values;
+}
+
+template <typename T>
+void Trajectory<T>::DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                                int derivative_order,
+                                MatrixX<T>* values) const {
+  if (t.size() == 0) {
+    values->resize(rows() * cols(), 0);
+    return;
+  }
   for (int i = 0; i < static_cast<int>(t.size()); ++i) {
-    values.row(i) = value(t[i]);
+    const MatrixX<T> value_i = derivative_order == 0
+                                   ? value(t[i])
+                                   : EvalDerivative(t[i], derivative_order);
+    if (i == 0) {
+      values->resize(value_i.size(), t.size());
+    }
+    values->col(i) =
+        Eigen::Map<const VectorX<T>>(value_i.data(), value_i.size());
   }
-  return values;
 }
 
 // Switch to be pure virtual on 2025-08-01.
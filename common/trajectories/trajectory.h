@@ -63,6 +63,32 @@ class Trajectory {
    */
   MatrixX<T> vector_values(const Eigen::Ref<const VectorX<T>>& t) const;
 
+  /**
+   * Evaluates the trajectory, or its derivative, at each of the times @p t.
+   * The ith column of @p values is the result of `value(t[i])` (when
+   * `derivative_order` is zero) or `EvalDerivative(t[i], derivative_order)`,
+   * flattened in column-major order. @p values is resized as needed.
+   *
+   * This is equivalent to calling value() or EvalDerivative() in a loop, but
+   * can be much faster: the subclasses which override it (e.g.,
+   * PiecewisePolynomial, BsplineTrajectory, PiecewisePose, and
+   * CompositeTrajectory) locate the segment of each time starting from the
+   * segment of the previous time, reuse the per-segment work across the
+   * samples, and do not allocate memory for each sample. The times may be in
+   * any order, but are fastest to evaluate when they are sorted.
+   *
+   * @throws std::exception if derivative_order is negative, or if it is
+   * positive and the trajectory does not support EvalDerivative().
+   */
+  void EvalBatch(const Eigen::Ref<const VectorX<T>>& t, int derivative_order,
+                 MatrixX<T>* values) const;
+
+  /**
+   * Returns the result of EvalBatch(t, derivative_order, &values).
+   */
+  MatrixX<T> EvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                       int derivative_order = 0) const;
+
   /**
    * Returns true iff the Trajectory provides and implementation for
    * EvalDerivative() and MakeDerivative().  The derivative need not be
@@ -138,6 +164,14 @@ class Trajectory {
   virtual std::unique_ptr<Trajectory<T>> DoMakeDerivative(
       int derivative_order) const;
 
+  // Evaluates value() or EvalDerivative() at each of the times `t`; see
+  // EvalBatch(). The default implementation calls them in a loop. Overrides
+  // must resize `values`.
+  // @pre derivative_order >= 0.
+  // @pre values != nullptr.
+  virtual void DoEvalBatch(const Eigen::Ref<const VectorX<T>>& t,
+                           int derivative_order, MatrixX<T>* values) const;
+
   // This will become pure virtual on 2025-08-01.
   virtual Eigen::Index do_rows() const;
 
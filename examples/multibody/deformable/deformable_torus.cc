@@ -2,6 +2,7 @@
 
 #include <gflags/gflags.h>
 
+#include "drake/common/parallelism.h"
 #include "drake/examples/multibody/deformable/deformable_common.h"
 #include "drake/examples/multibody/deformable/parallel_gripper_controller.h"
 #include "drake/examples/multibody/deformable/point_source_force_field.h"
@@ -31,6 +32,9 @@ DEFINE_string(contact_approximation, "lagged",
               "Type of convex contact approximation. See "
               "multibody::DiscreteContactApproximation for details. Options "
               "are: 'sap', 'lagged', and 'similar'.");
+DEFINE_int32(num_threads, 1,
+             "Number of threads used by the deformable model, both to solve "
+             "the FEM dynamics and to refit the deformable geometries.");
 
 using drake::examples::deformable::ParallelGripperController;
 using drake::examples::deformable::PointSourceForceField;
@@ -169,6 +173,9 @@ int do_main() {
     plant.mutable_deformable_model().AddExternalForce(std::move(suction_force));
   }
 
+  plant.mutable_deformable_model().SetParallelism(
+      Parallelism(FLAGS_num_threads));
+
   /* All rigid and deformable models have been added. Finalize the plant. */
   plant.Finalize();
 
@@ -94,6 +94,27 @@ BENCHMARK_DEFINE_F(BoxesOverlapBenchmark, PosedCase)
   }
 }
 
+// The same posed cases as above, but evaluated as a full batch of pairs with
+// BoxesOverlapBatch(), as used in BVH traversal. Each iteration tests
+// BoxPairBatch::kMaxSize pairs, so compare per-pair cost against PosedCase
+// (which tests two pairs per iteration).
+BENCHMARK_DEFINE_F(BoxesOverlapBenchmark, PosedCaseBatch)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  a = Vector3d(2, 4, 3);
+  b = Vector3d(3.5, 2, 1.5);
+  SetupPosedCase(state);
+  const auto X_BA = X_AB.inverse();
+  BoxPairBatch pairs;
+  for (int i = 0; i < BoxPairBatch::kMaxSize; i += 2) {
+    pairs.Add(a, b, X_AB);
+    pairs.Add(b, a, X_BA);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BoxesOverlapBatch(pairs));
+  }
+}
+
 BENCHMARK_REGISTER_F(BoxesOverlapBenchmark, ParallelContainedCase)
     ->Unit(benchmark::kNanosecond);
 
@@ -101,6 +122,10 @@ BENCHMARK_REGISTER_F(BoxesOverlapBenchmark, PosedCase)
     ->Unit(benchmark::kNanosecond)
     ->ArgsProduct({{false, true}, {0, 1, 2}, {-1, 0, 1, 2}});
 
+BENCHMARK_REGISTER_F(BoxesOverlapBenchmark, PosedCaseBatch)
+    ->Unit(benchmark::kNanosecond)
+    ->ArgsProduct({{false, true}, {0, 1, 2}, {-1, 0, 1, 2}});
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -8,6 +8,8 @@
 #include <fmt/format.h>
 #include <gflags/gflags.h>
 
+#include "drake/common/parallelism.h"
+#include "drake/geometry/render_cpu/factory.h"
 #include "drake/geometry/render_gl/factory.h"
 #include "drake/geometry/render_vtk/factory.h"
 #include "drake/systems/sensors/image_writer.h"
@@ -45,7 +47,7 @@ const double kFovY = M_PI_4;
 
 /* The render engines generally supported by this benchmark; not all
  renderers are supported by all operating systems.  */
-enum class EngineType { Vtk, Gl };
+enum class EngineType { Vtk, Gl, Cpu };
 
 /* Creates a render engine of the given type with the given background color. */
 template <EngineType engine_type>
@@ -65,6 +67,15 @@ std::unique_ptr<RenderEngine> MakeEngine(const Vector3d& bg_rgb) {
         .lights = {{.type = "point", .position = {0.5, 0.5, 0}}}};
     return MakeRenderEngineGl(params);
   }
+  if constexpr (engine_type == EngineType::Cpu) {
+    // The CPU engine only supports its fixed headlight, and it uses every
+    // available core to rasterize a single image.
+    const Rgba bg(bg_rgb[0], bg_rgb[1], bg_rgb[2]);
+    const RenderEngineCpuParams params{
+        .default_clear_color = bg,
+        .num_threads = Parallelism::Max().num_threads()};
+    return MakeRenderEngineCpu(params);
+  }
 }
 
 class RenderBenchmark : public benchmark::Fixture {
@@ -309,8 +320,9 @@ class RenderBenchmark : public benchmark::Fixture {
 
 /* These macros serve the purpose of allowing compact and *consistent*
  declarations of benchmarks. The goal is to create a benchmark for each
- renderer type (e.g., Vtk, Gl) combined with each image type (Color, Depth, and
- Label). Each benchmark instance should be executed using the same parameters.
+ renderer type (e.g., Vtk, Gl, Cpu) combined with each image type (Color, Depth,
+ and Label). Each benchmark instance should be executed using the same
+ parameters.
 
  These macros guarantee that a benchmark is declared, dispatches the right
  benchmark harness and is executed with a common set of parameters.
@@ -361,6 +373,10 @@ MAKE_BENCHMARK(Gl, Depth);
 MAKE_BENCHMARK(Gl, Label);
 #endif
 
+MAKE_BENCHMARK(Cpu, Color);
+MAKE_BENCHMARK(Cpu, Depth);
+MAKE_BENCHMARK(Cpu, Label);
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/render/render_camera.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+
+/** The images to render from a single camera as part of a call to
+ QueryObject::RenderImages(). The camera is posed relative to the frame
+ `parent_frame` by `X_PC`; each camera's own `sensor_pose_in_camera_body()` is
+ applied on top of that, exactly as for QueryObject::RenderColorImage() and its
+ siblings.
+
+ Any of the output images can be `nullptr`, in which case that image is not
+ rendered. The color camera is used for both the color and the label image; a
+ camera is only required if one of the images it is used for is requested.
+ None of the pointers are owned by the request.  */
+struct CameraImagesRequest {
+  /** The frame P that the camera is posed in.  */
+  FrameId parent_frame;
+
+  /** The pose of the camera body in the frame P.  */
+  math::RigidTransformd X_PC;
+
+  /** The camera for the color and label images.  */
+  const render::ColorRenderCamera* color_camera{};
+
+  /** The camera for the depth image.  */
+  const render::DepthRenderCamera* depth_camera{};
+
+  /** The rendered color image, if requested.  */
+  systems::sensors::ImageRgba8U* color_image{};
+
+  /** The rendered depth image, if requested.  */
+  systems::sensors::ImageDepth32F* depth_image{};
+
+  /** The rendered label image, if requested.  */
+  systems::sensors::ImageLabel16I* label_image{};
+};
+
+}  // namespace geometry
+}  // namespace drake
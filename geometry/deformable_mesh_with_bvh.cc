@@ -6,9 +6,9 @@ namespace internal {
 
 template <typename MeshType>
 void DeformableMeshWithBvh<MeshType>::UpdateVertexPositions(
-    const Eigen::Ref<const VectorX<T>>& q) {
+    const Eigen::Ref<const VectorX<T>>& q, Parallelism parallelism) {
   deformable_mesh_.SetAllPositions(q);
-  bvh_updater_.Update();
+  bvh_updater_.Update(parallelism);
 }
 
 template class DeformableMeshWithBvh<VolumeMesh<double>>;
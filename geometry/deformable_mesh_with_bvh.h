@@ -2,6 +2,7 @@
 
 #include <utility>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/bvh_updater.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
@@ -89,8 +90,11 @@ class DeformableMeshWithBvh {
   @param q  A vector of 3N values (where this mesh has N vertices). The iᵗʰ
             vertex gets values <q(3i), q(3i + 1), q(3i + 2>. Each vertex is
             assumed to be measured and expressed in the mesh's frame M.
+  @param parallelism  The number of threads that may be used to refit the
+                      bounding volume hierarchy.
   @pre q.size == 3 * mesh().num_vertices(). */
-  void UpdateVertexPositions(const Eigen::Ref<const VectorX<T>>& q);
+  void UpdateVertexPositions(const Eigen::Ref<const VectorX<T>>& q,
+                             Parallelism parallelism = Parallelism::None());
 
  private:
   // The delegate constructor used by move and copy constructors. The mesh-only
@@ -290,7 +290,9 @@ GeometryState<T>::GeometryState(const GeometryState<U>& source)
       geometry_engine_(
           std::move(source.geometry_engine_->template ToScalarType<T>())),
       render_engines_(source.render_engines_),
-      geometry_version_(source.geometry_version_) {
+      geometry_version_(source.geometry_version_),
+      deformable_geometry_parallelism_(
+          source.deformable_geometry_parallelism_) {
   auto convert_pose_vector = [](const std::vector<RigidTransform<U>>& s,
                                 std::vector<RigidTransform<T>>* d) {
     std::vector<RigidTransform<T>>& dest = *d;
@@ -1592,6 +1594,65 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
   engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(
+    const std::vector<CameraImagesRequest>& requests) const {
+  // Sort the requested images by renderer, so that every renderer sees all of
+  // its images in a single batch. A camera's color (and label) image and its
+  // depth image share a single engine request when they are rendered by the
+  // same renderer from the same pose.
+  std::map<std::string, std::vector<render::RenderImagesRequest>> batches;
+  for (const CameraImagesRequest& request : requests) {
+    std::optional<RigidTransformd> X_WC_color;
+    render::RenderImagesRequest* color_request = nullptr;
+    if (request.color_image != nullptr || request.label_image != nullptr) {
+      if (request.color_camera == nullptr) {
+        throw std::logic_error(
+            "Can't render a color or label image without a color camera");
+      }
+      const render::RenderCameraCore& core = request.color_camera->core();
+      X_WC_color =
+          CalcCameraWorldPose(core, request.parent_frame, request.X_PC);
+      color_request = &batches[core.renderer_name()].emplace_back(
+          render::RenderImagesRequest{.X_WR = *X_WC_color,
+                                      .color_camera = request.color_camera,
+                                      .color_image = request.color_image,
+                                      .label_image = request.label_image});
+    }
+    if (request.depth_image != nullptr) {
+      if (request.depth_camera == nullptr) {
+        throw std::logic_error(
+            "Can't render a depth image without a depth camera");
+      }
+      const render::RenderCameraCore& core = request.depth_camera->core();
+      const RigidTransformd X_WC =
+          CalcCameraWorldPose(core, request.parent_frame, request.X_PC);
+      if (color_request != nullptr &&
+          core.renderer_name() ==
+              request.color_camera->core().renderer_name() &&
+          X_WC.IsExactlyEqualTo(*X_WC_color)) {
+        color_request->depth_camera = request.depth_camera;
+        color_request->depth_image = request.depth_image;
+      } else {
+        batches[core.renderer_name()].push_back(render::RenderImagesRequest{
+            .X_WR = X_WC,
+            .depth_camera = request.depth_camera,
+            .depth_image = request.depth_image});
+      }
+    }
+  }
+  // Confirm that all renderers exist before rendering anything.
+  std::vector<const render::RenderEngine*> engines;
+  for (const auto& [renderer_name, _] : batches) {
+    engines.push_back(&GetRenderEngineOrThrow(renderer_name));
+  }
+  int i = 0;
+  for (const auto& [_, batch] : batches) {
+    // See note in RenderColorImage() about this const cast.
+    const_cast<render::RenderEngine*>(engines[i++])->RenderImages(batch);
+  }
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
@@ -1773,7 +1834,8 @@ void GeometryState<T>::FinalizeConfigurationUpdate(
   const internal::DrivenMeshData& proximity_driven_mesh_data =
       kinematics_data.driven_mesh_data.at(Role::kProximity);
   proximity_engine->UpdateDeformableVertexPositions(
-      kinematics_data.q_WGs, proximity_driven_mesh_data.driven_meshes());
+      kinematics_data.q_WGs, proximity_driven_mesh_data.driven_meshes(),
+      deformable_geometry_parallelism_);
   const internal::DrivenMeshData& perception_driven_mesh_data =
       kinematics_data.driven_mesh_data.at(Role::kPerception);
   for (const auto& [id, meshes] : perception_driven_mesh_data.driven_meshes()) {
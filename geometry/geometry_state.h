@@ -13,6 +13,8 @@
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/camera_images_request.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -467,6 +469,16 @@ class GeometryState {
       SourceId source_id, FrameId frame_id,
       std::unique_ptr<GeometryInstance> geometry, double resolution_hint);
 
+  /** Implementation of SceneGraph::SetDeformableGeometryParallelism().  */
+  void SetDeformableGeometryParallelism(Parallelism parallelism) {
+    deformable_geometry_parallelism_ = parallelism;
+  }
+
+  /** Implementation of SceneGraph::GetDeformableGeometryParallelism().  */
+  Parallelism GetDeformableGeometryParallelism() const {
+    return deformable_geometry_parallelism_;
+  }
+
   /** Implementation of SceneGraph::RenameGeometry().  */
   void RenameGeometry(GeometryId geometry_id, const std::string& name);
 
@@ -562,33 +574,45 @@ class GeometryState {
    See @ref collision_queries "Collision Queries" for more details.  */
   //@{
 
-  /** Implementation of QueryObject::ComputePointPairPenetration().  */
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const {
-    return geometry_engine_->ComputePointPairPenetration(
-        kinematics_data_.X_WGs);
+  /** Implementation of QueryObject::ComputePointPairPenetration().
+   @param parallelism  The number of threads used to evaluate the candidate
+                       pairs; see SceneGraphConfig::proximity_query_num_threads.
+   */
+  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
+      Parallelism parallelism = Parallelism::None()) const {
+    return geometry_engine_->ComputePointPairPenetration(kinematics_data_.X_WGs,
+                                                         parallelism);
   }
 
-  /** Implementation of QueryObject::ComputeContactSurfaces().  */
+  /** Implementation of QueryObject::ComputeContactSurfaces().
+   @param parallelism  The number of threads used to evaluate the candidate
+                       pairs; see SceneGraphConfig::proximity_query_num_threads.
+   */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
-  ComputeContactSurfaces(
-      HydroelasticContactRepresentation representation) const {
-    return geometry_engine_->ComputeContactSurfaces(representation,
-                                                    kinematics_data_.X_WGs);
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         Parallelism parallelism = Parallelism::None()) const {
+    return geometry_engine_->ComputeContactSurfaces(
+        representation, kinematics_data_.X_WGs, parallelism);
   }
 
-  /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().  */
+  /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().
+   @param parallelism  The number of threads used to evaluate the candidate
+                       pairs; see SceneGraphConfig::proximity_query_num_threads.
+   */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
   ComputeContactSurfacesWithFallback(
       HydroelasticContactRepresentation representation,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelism = Parallelism::None()) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
     return geometry_engine_->ComputeContactSurfacesWithFallback(
-        representation, kinematics_data_.X_WGs, surfaces, point_pairs);
+        representation, kinematics_data_.X_WGs, surfaces, point_pairs,
+        parallelism);
   }
 
   /** Implementation of QueryObject::ComputeDeformableContact().  */
@@ -629,11 +653,15 @@ class GeometryState {
   //@{
 
   /** Implementation of
-   QueryObject::ComputeSignedDistancePairwiseClosestPoints().  */
+   QueryObject::ComputeSignedDistancePairwiseClosestPoints().
+   @param parallelism  The number of threads used to evaluate the candidate
+                       pairs; see SceneGraphConfig::proximity_query_num_threads.
+   */
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
-      double max_distance) const {
+      double max_distance,
+      Parallelism parallelism = Parallelism::None()) const {
     return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
-        kinematics_data_.X_WGs, max_distance);
+        kinematics_data_.X_WGs, max_distance, parallelism);
   }
 
   /** Implementation of
@@ -704,6 +732,10 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(const std::vector<CameraImagesRequest>& requests) const;
+
   //@}
 
   /** @name Scalar conversion */
@@ -1107,6 +1139,11 @@ class GeometryState {
 
   // The version for this geometry data.
   GeometryVersion geometry_version_;
+
+  // The number of threads used to update the proximity representations (e.g.,
+  // refit the bounding volume hierarchies) of the deformable geometries when
+  // their configurations change.
+  Parallelism deformable_geometry_parallelism_{Parallelism::None()};
 };
 }  // namespace geometry
 }  // namespace drake
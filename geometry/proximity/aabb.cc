@@ -14,6 +14,25 @@ using Eigen::Vector3d;
 using math::RigidTransformd;
 using math::RotationMatrixd;
 
+namespace {
+
+/* Computes X_AB, the pose of b_H's canonical frame B in a_G's canonical frame
+ A (see the derivation in Aabb::HasOverlap()). */
+RigidTransformd CalcAabbAabbPose(const Aabb& a_G, const Aabb& b_H,
+                                 const RigidTransformd& X_GH) {
+  return RigidTransformd(X_GH.rotation(), X_GH * b_H.center() - a_G.center());
+}
+
+/* Computes X_AO, the pose of obb_H's canonical frame O in aabb_G's canonical
+ frame A (see the derivation in Aabb::HasOverlap()). */
+RigidTransformd CalcAabbObbPose(const Aabb& aabb_G, const Obb& obb_H,
+                                const RigidTransformd& X_GH) {
+  return RigidTransformd(X_GH.rotation() * obb_H.pose().rotation(),
+                         X_GH * obb_H.pose().translation() - aabb_G.center());
+}
+
+}  // namespace
+
 bool Aabb::HasOverlap(const Aabb& a_G, const Aabb& b_H,
                       const RigidTransformd& X_GH) {
   /* For this analysis, a_G has local frame A and b_H has local frame B.
@@ -27,9 +46,8 @@ bool Aabb::HasOverlap(const Aabb& a_G, const Aabb& b_H,
             = p_GB_G - p_GA_G
             = X_GH * p_HB_H - p_GA_G
             = X_GH * b_H.center() - a_G.center()  */
-  const RigidTransformd X_AB(X_GH.rotation(),
-                             X_GH * b_H.center() - a_G.center());
-  return BoxesOverlap(a_G.half_width(), b_H.half_width(), X_AB);
+  return BoxesOverlap(a_G.half_width(), b_H.half_width(),
+                      CalcAabbAabbPose(a_G, b_H, X_GH));
 }
 
 bool Aabb::HasOverlap(const Aabb& aabb_G, const Obb& obb_H,
@@ -44,10 +62,22 @@ bool Aabb::HasOverlap(const Aabb& aabb_G, const Obb& obb_H,
             = p_GO_G - p_GA_G
             = X_GH * p_HO_H - p_GA_G
             = X_GH * p_HO_H - aabb_G.center()  */
-  const RigidTransformd X_AO(
-      X_GH.rotation() * obb_H.pose().rotation(),
-      X_GH * obb_H.pose().translation() - aabb_G.center());
-  return BoxesOverlap(aabb_G.half_width(), obb_H.half_width(), X_AO);
+  return BoxesOverlap(aabb_G.half_width(), obb_H.half_width(),
+                      CalcAabbObbPose(aabb_G, obb_H, X_GH));
+}
+
+void Aabb::AddToBatch(const Aabb& a_G, const Aabb& b_H,
+                      const RigidTransformd& X_GH, BoxPairBatch* pairs) {
+  DRAKE_ASSERT(pairs != nullptr);
+  pairs->Add(a_G.half_width(), b_H.half_width(),
+             CalcAabbAabbPose(a_G, b_H, X_GH));
+}
+
+void Aabb::AddToBatch(const Aabb& aabb_G, const Obb& obb_H,
+                      const RigidTransformd& X_GH, BoxPairBatch* pairs) {
+  DRAKE_ASSERT(pairs != nullptr);
+  pairs->Add(aabb_G.half_width(), obb_H.half_width(),
+             CalcAabbObbPose(aabb_G, obb_H, X_GH));
 }
 
 template <typename MeshType>
@@ -17,6 +17,7 @@ template <typename>
 class AabbMaker;
 template <typename>
 class BvhUpdater;
+class BoxPairBatch;
 class Obb;
 
 /* Axis-aligned bounding box. The box is defined in a canonical frame B such
@@ -120,6 +121,22 @@ class Aabb {
   static bool HasOverlap(const Aabb& aabb_G, const Obb& obb_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Adds the pair of boxes `a_G` and `b_H` to the given batch, so that a
+   subsequent call to BoxesOverlapBatch() tests them exactly as
+   HasOverlap(a_G, b_H, X_GH) would.
+   @pre pairs != nullptr and pairs->size() < BoxPairBatch::kMaxSize. */
+  static void AddToBatch(const Aabb& a_G, const Aabb& b_H,
+                         const math::RigidTransformd& X_GH,
+                         BoxPairBatch* pairs);
+
+  /* Adds the pair of boxes `aabb_G` and `obb_H` to the given batch, so that a
+   subsequent call to BoxesOverlapBatch() tests them exactly as
+   HasOverlap(aabb_G, obb_H, X_GH) would.
+   @pre pairs != nullptr and pairs->size() < BoxPairBatch::kMaxSize. */
+  static void AddToBatch(const Aabb& aabb_G, const Obb& obb_H,
+                         const math::RigidTransformd& X_GH,
+                         BoxPairBatch* pairs);
+
   // TODO(SeanCurtis-TRI): Support collision with primitives as appropriate
   //  (see obb.h for an example).
 
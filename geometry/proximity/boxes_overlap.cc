@@ -259,6 +259,121 @@ bool BoxesOverlapImpl(const Vector3d* half_size_a_ptr,
 
 #endif  // HWY_MAX_BYTES
 
+// Arrays of vectors are not allowed for scalable vector targets, so we limit
+// the batched implementation to fixed-size vectors.
+#if HWY_HAVE_SCALABLE == 0
+
+// Tests every pair in the batch with one SIMD lane per pair. Unlike
+// BoxesOverlapImpl(), no shuffling is needed: every lane evaluates the same
+// expression, so the fifteen separating axis tests map directly onto lane-wise
+// arithmetic. The order of operations matches the 4-wide implementation above.
+// We stop early only once every lane has found a separating axis.
+// See note in BoxesOverlap as to why the parameter is a pointer.
+uint32_t BoxesOverlapBatchImpl(const BoxPairBatch* pairs_ptr) {
+  const BoxPairBatch& pairs = *pairs_ptr;
+  const hn::CappedTag<double, BoxPairBatch::kMaxSize> tag;
+  using VecT = hn::Vec<decltype(tag)>;
+  using MaskT = hn::Mask<decltype(tag)>;
+  const int num_lanes = static_cast<int>(hn::Lanes(tag));
+  const double kEpsilon = 0.000001;
+  const VecT eps = hn::Set(tag, kEpsilon);
+
+  uint32_t result = 0;
+  for (int offset = 0; offset < pairs.size(); offset += num_lanes) {
+    VecT a[3], b[3], p[3], R[3][3], abs_R[3][3];
+    for (int k = 0; k < 3; ++k) {
+      a[k] = hn::LoadU(tag, pairs.half_size_a(k) + offset);
+      b[k] = hn::LoadU(tag, pairs.half_size_b(k) + offset);
+      p[k] = hn::LoadU(tag, pairs.p_AB(k) + offset);
+      for (int c = 0; c < 3; ++c) {
+        R[k][c] = hn::LoadU(tag, pairs.R_AB(3 * k + c) + offset);
+        abs_R[k][c] = hn::Add(hn::Abs(R[k][c]), eps);
+      }
+    }
+
+    // Lanes for which a separating axis has been found.
+    MaskT separated = hn::MaskFalse(tag);
+
+    // First category of cases separating along a's axes.
+    for (int i = 0; i < 3; ++i) {
+      const VecT left = hn::Abs(p[i]);
+      VecT right = a[i];
+      right = hn::MulAdd(b[0], abs_R[i][0], right);
+      right = hn::MulAdd(b[1], abs_R[i][1], right);
+      right = hn::MulAdd(b[2], abs_R[i][2], right);
+      separated = hn::Or(separated, hn::Gt(left, right));
+    }
+
+    // Second category of cases separating along b's axes.
+    for (int j = 0; j < 3; ++j) {
+      VecT left = hn::Mul(p[0], R[0][j]);
+      left = hn::MulAdd(p[1], R[1][j], left);
+      left = hn::MulAdd(p[2], R[2][j], left);
+      left = hn::Abs(left);
+      VecT right = b[j];
+      right = hn::MulAdd(a[0], abs_R[0][j], right);
+      right = hn::MulAdd(a[1], abs_R[1][j], right);
+      right = hn::MulAdd(a[2], abs_R[2][j], right);
+      separated = hn::Or(separated, hn::Gt(left, right));
+    }
+
+    // Third category of cases separating along the axes formed from the cross
+    // products of a's and b's axes.
+    if (!hn::AllTrue(tag, separated)) {
+      for (int i = 0; i < 3; ++i) {
+        const int i1 = (i + 1) % 3;
+        const int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j) {
+          const int j1 = (j + 1) % 3;
+          const int j2 = (j + 2) % 3;
+          VecT left = hn::Mul(p[i2], R[i1][j]);
+          left = hn::NegMulAdd(p[i1], R[i2][j], left);
+          left = hn::Abs(left);
+          VecT right = hn::Mul(a[i1], abs_R[i2][j]);
+          right = hn::MulAdd(a[i2], abs_R[i1][j], right);
+          right = hn::MulAdd(b[j1], abs_R[i][j2], right);
+          right = hn::MulAdd(b[j2], abs_R[i][j1], right);
+          separated = hn::Or(separated, hn::Gt(left, right));
+        }
+      }
+    }
+
+    uint8_t bits[8] = {};
+    hn::StoreMaskBits(tag, hn::Not(separated), bits);
+    result |= static_cast<uint32_t>(bits[0]) << offset;
+  }
+  // Clear any bits for lanes beyond the end of the batch.
+  return result & ((uint32_t{1} << pairs.size()) - 1);
+}
+
+#else  // HWY_HAVE_SCALABLE
+
+// See note in BoxesOverlap as to why the parameter is a pointer.
+uint32_t BoxesOverlapBatchImpl(const BoxPairBatch* pairs_ptr) {
+  const BoxPairBatch& pairs = *pairs_ptr;
+  uint32_t result = 0;
+  for (int i = 0; i < pairs.size(); ++i) {
+    Vector3d half_size_a, half_size_b, p_AB;
+    Matrix3d R_AB;
+    for (int r = 0; r < 3; ++r) {
+      half_size_a[r] = pairs.half_size_a(r)[i];
+      half_size_b[r] = pairs.half_size_b(r)[i];
+      p_AB[r] = pairs.p_AB(r)[i];
+      for (int c = 0; c < 3; ++c) {
+        R_AB(r, c) = pairs.R_AB(3 * r + c)[i];
+      }
+    }
+    const RigidTransformd X_AB(
+        math::RotationMatrixd::MakeUnchecked(R_AB), p_AB);
+    if (BoxesOverlapImpl(&half_size_a, &half_size_b, &X_AB)) {
+      result |= uint32_t{1} << i;
+    }
+  }
+  return result;
+}
+
+#endif  // HWY_HAVE_SCALABLE
+
 }  // namespace HWY_NAMESPACE
 }  // namespace
 }  // namespace internal
@@ -280,6 +395,11 @@ struct ChooseBestBoxesOverlapImpl {
   auto operator()() { return HWY_DYNAMIC_POINTER(BoxesOverlapImpl); }
 };
 
+HWY_EXPORT(BoxesOverlapBatchImpl);
+struct ChooseBestBoxesOverlapBatchImpl {
+  auto operator()() { return HWY_DYNAMIC_POINTER(BoxesOverlapBatchImpl); }
+};
+
 }  // namespace
 
 bool BoxesOverlap(const Vector3<double>& half_size_a,
@@ -293,6 +413,11 @@ bool BoxesOverlap(const Vector3<double>& half_size_a,
       &half_size_a, &half_size_b, &X_AB);
 }
 
+uint32_t BoxesOverlapBatch(const BoxPairBatch& pairs) {
+  if (pairs.size() == 0) return 0;
+  return LateBoundFunction<ChooseBestBoxesOverlapBatchImpl>::Call(&pairs);
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
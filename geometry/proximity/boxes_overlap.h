@@ -1,7 +1,12 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+
 #include <Eigen/Core>
 
+#include "drake/common/drake_assert.h"
+
 #include "drake/math/rigid_transform.h"
 
 namespace drake {
@@ -22,6 +27,72 @@ bool BoxesOverlap(const Vector3<double>& half_size_a,
                   const Vector3<double>& half_size_b,
                   const math::RigidTransformd& X_AB);
 
+/* A batch of box pairs (A_i, B_i) to be tested for overlap with a single call
+ to BoxesOverlapBatch(). The data is stored as a structure of arrays so that
+ each pair occupies one SIMD lane, and all lanes share the same instruction
+ stream. Each pair is defined as for BoxesOverlap(): the half sizes of A_i and
+ B_i in their own canonical frames and the relative pose X_AiBi. */
+class BoxPairBatch {
+ public:
+  /* The maximum number of pairs in a batch. */
+  static constexpr int kMaxSize = 8;
+
+  BoxPairBatch() = default;
+
+  /* Returns the number of pairs in the batch. */
+  int size() const { return size_; }
+
+  /* Removes all pairs from the batch. */
+  void clear() { size_ = 0; }
+
+  /* Appends the pair (A, B) to the batch.
+   @pre size() < kMaxSize. */
+  void Add(const Vector3<double>& half_size_a,
+           const Vector3<double>& half_size_b,
+           const math::RigidTransformd& X_AB) {
+    DRAKE_ASSERT(size_ < kMaxSize);
+    const int i = size_++;
+    const Eigen::Matrix3d& R_AB = X_AB.rotation().matrix();
+    const Vector3<double>& p_AB = X_AB.translation();
+    for (int r = 0; r < 3; ++r) {
+      half_size_a_[r][i] = half_size_a[r];
+      half_size_b_[r][i] = half_size_b[r];
+      p_AB_[r][i] = p_AB[r];
+      for (int c = 0; c < 3; ++c) {
+        R_AB_[3 * r + c][i] = R_AB(r, c);
+      }
+    }
+  }
+
+  /* (Internal use only) Accessors for the structure-of-arrays data. Each
+   accessor returns a pointer to kMaxSize contiguous values; the values in
+   lanes at or beyond size() are unspecified.
+   @pre 0 <= k < 3 (or 0 <= k < 9 for R_AB, in row-major order). */
+  const double* half_size_a(int k) const { return half_size_a_[k].data(); }
+  const double* half_size_b(int k) const { return half_size_b_[k].data(); }
+  const double* p_AB(int k) const { return p_AB_[k].data(); }
+  const double* R_AB(int k) const { return R_AB_[k].data(); }
+
+ private:
+  using Lanes = std::array<double, kMaxSize>;
+
+  int size_{0};
+  alignas(64) std::array<Lanes, 3> half_size_a_{};
+  alignas(64) std::array<Lanes, 3> half_size_b_{};
+  alignas(64) std::array<Lanes, 3> p_AB_{};
+  alignas(64) std::array<Lanes, 9> R_AB_{};
+};
+
+/* Tests all of the box pairs in `pairs` for overlap, processing several pairs
+ at once with SIMD instructions where the CPU supports it.
+
+ Each pair is evaluated with the same fifteen separating axis tests (and the
+ same robustness tolerance) as BoxesOverlap().
+
+ @returns A bit mask whose i-th bit is set iff the i-th pair in the batch
+ overlaps. Bits at or beyond pairs.size() are zero. */
+uint32_t BoxesOverlapBatch(const BoxPairBatch& pairs);
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -1,10 +1,11 @@
 #include "drake/geometry/proximity/bvh.h"
 
 #include <algorithm>
-#include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "drake/common/ssize.h"
 #include "drake/geometry/utilities.h"
 
 namespace drake {
@@ -25,16 +26,26 @@ Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh) {
     element_centroids.emplace_back(i, ComputeCentroid(mesh, i));
   }
 
-  root_node_ =
-      BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  // A median split tree with at least one element per leaf has at most
+  // 2 * num_elements - 1 nodes.
+  nodes_.reserve(std::max(2 * num_elements - 1, 1));
+  BuildBvTree(mesh, element_centroids.begin(), element_centroids.end(),
+              &nodes_);
+  nodes_.shrink_to_fit();
 }
 
+namespace {
+// Placeholder for a branch node's offset to its right child while its left
+// subtree is still being built. Any value that marks a valid branch will do.
+constexpr int kUnsetRightOffset = 2;
+}  // namespace
+
 template <class BvType, class SourceMeshType>
-std::unique_ptr<BvNode<BvType, SourceMeshType>>
-Bvh<BvType, SourceMeshType>::BuildBvTree(
+void Bvh<BvType, SourceMeshType>::BuildBvTree(
     const SourceMeshType& mesh_M,
     const typename std::vector<CentroidPair>::iterator& start,
-    const typename std::vector<CentroidPair>::iterator& end) {
+    const typename std::vector<CentroidPair>::iterator& end,
+    std::vector<NodeType>* nodes) {
   // Generate bounding volume.
   BvType bv_M = ComputeBoundingVolume(mesh_M, start, end);
 
@@ -45,7 +56,7 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
       data.indices[i] = (start + i)->first;
     }
     // Store element indices in this leaf node.
-    return std::make_unique<NodeType>(bv_M, data);
+    nodes->push_back(NodeType(std::move(bv_M), data));
   } else {
     // Sort the elements by centroid along the axis of greatest spread.
     // Note: We tried an alternative strategy for building the BVH using a
@@ -95,11 +106,16 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
                 return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
               });
 
-    // Continue with the next branches.
+    // Continue with the next branches. The left subtree is laid out right
+    // after this node, followed by the right subtree; this node's offset to
+    // its right child is only known once the left subtree is complete.
     const typename std::vector<CentroidPair>::iterator mid =
         start + num_elements / 2;
-    return std::make_unique<NodeType>(bv_M, BuildBvTree(mesh_M, start, mid),
-                                      BuildBvTree(mesh_M, mid, end));
+    const int index = ssize(*nodes);
+    nodes->push_back(NodeType(std::move(bv_M), kUnsetRightOffset));
+    BuildBvTree(mesh_M, start, mid, nodes);
+    (*nodes)[index].right_offset_ = ssize(*nodes) - index;
+    BuildBvTree(mesh_M, mid, end, nodes);
   }
 }
 
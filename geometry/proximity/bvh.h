@@ -1,17 +1,17 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <stack>
 #include <utility>
-#include <variant>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/proximity/volume_mesh.h"
@@ -39,7 +39,15 @@ struct MeshTraits<VolumeMesh<T>> {
   static constexpr int kMaxElementPerBvhLeaf = 1;
 };
 
-/* Node of the tree structure representing the Bvh.  */
+/* Node of the tree structure representing the Bvh.
+
+ The nodes of a Bvh are stored contiguously, in depth-first (pre-order) order,
+ in a single array owned by the Bvh. A branch node's left child immediately
+ follows it in that array and its right child is found at a fixed offset from
+ it. This keeps the nodes visited together during traversal and refit close in
+ memory and makes copying a Bvh a single array copy. As a consequence, a branch
+ node is only meaningful in the array of the Bvh that created it; only leaf
+ nodes can be constructed (and copied) on their own.  */
 template <class BvType, class MeshType>
 class BvNode {
  public:
@@ -59,17 +67,7 @@ class BvNode {
    @param bv    The bounding volume encompassing the elements.
    @param data  The indices of the mesh elements contained in the leaf. */
   BvNode(BvType bv, LeafData data)
-      : bv_(std::move(bv)), child_(std::move(data)) {}
-
-  /* Constructor for branch/internal nodes.
-   @param bv The bounding volume encompassing the elements in child branches.
-   @param left Unique pointer to the left child branch.
-   @param right Unique pointer to the right child branch.
-   @pre Both children must be distinct and not null.   */
-  BvNode(BvType bv, std::unique_ptr<BvNode<BvType, MeshType>> left,
-         std::unique_ptr<BvNode<BvType, MeshType>> right)
-      : bv_(std::move(bv)),
-        child_(NodeChildren(std::move(left), std::move(right))) {}
+      : bv_(std::move(bv)), right_offset_(0), leaf_(std::move(data)) {}
 
   /* Returns the bounding volume.  */
   const BvType& bv() const { return bv_; }
@@ -77,31 +75,35 @@ class BvNode {
   /* Returns the number of element indices.
    @pre is_leaf() returns true. */
   int num_element_indices() const {
-    return std::get<LeafData>(child_).num_index;
+    DRAKE_ASSERT(is_leaf());
+    return leaf_.num_index;
   }
 
   /* Returns the i-th element index in the leaf data.
    @pre is_leaf() returns true.
    @pre `i` is less than LeafData::num_index, and i >= 0. */
   int element_index(int i) const {
-    DRAKE_ASSERT(0 <= i && i < std::get<LeafData>(child_).num_index);
-    return std::get<LeafData>(child_).indices[i];
+    DRAKE_ASSERT(is_leaf());
+    DRAKE_ASSERT(0 <= i && i < leaf_.num_index);
+    return leaf_.indices[i];
   }
 
   /* Returns the left child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& left() const {
-    return *(std::get<NodeChildren>(child_).left);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + 1);
   }
 
   /* Returns the right child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& right() const {
-    return *(std::get<NodeChildren>(child_).right);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + right_offset_);
   }
 
   /* Returns whether this is a leaf node as opposed to a branch node.  */
-  bool is_leaf() const { return std::holds_alternative<LeafData>(child_); }
+  bool is_leaf() const { return right_offset_ == 0; }
 
   /* Compares this node with the given node in a strictly *topological* manner.
    For them to be considered "equal leaves", both nodes must be leaves and must
@@ -133,40 +135,34 @@ class BvNode {
   template <typename>
   friend class BvhUpdater;
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& left() {
-    return *(std::get<NodeChildren>(child_).left);
-  }
+  template <class, class>
+  friend class Bvh;
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& right() {
-    return *(std::get<NodeChildren>(child_).right);
+  /* Constructor for branch/internal nodes, used by Bvh as it lays out its
+   nodes. The left child must be stored immediately after this node and the
+   right child `right_offset` nodes after it.
+   @param bv The bounding volume encompassing the elements in child branches.
+   @param right_offset The distance (in nodes) to the right child.
+   @pre right_offset > 1.  */
+  BvNode(BvType bv, int right_offset)
+      : bv_(std::move(bv)), right_offset_(right_offset), leaf_{0, {}} {
+    DRAKE_DEMAND(right_offset > 1);
   }
 
   /* Provide disciplined access to BvhUpdater to a mutable bounding volume. */
   BvType& bv() { return bv_; }
 
-  struct NodeChildren {
-    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(NodeChildren);
-
-    NodeChildren(std::unique_ptr<BvNode> left_in,
-                 std::unique_ptr<BvNode> right_in)
-        : left(std::move(left_in)), right(std::move(right_in)) {
-      DRAKE_DEMAND(left != nullptr);
-      DRAKE_DEMAND(right != nullptr);
-      DRAKE_DEMAND(left != right);
-    }
-
-    copyable_unique_ptr<BvNode> left;
-    copyable_unique_ptr<BvNode> right;
-  };
-
   BvType bv_;
 
-  // If this is a leaf node then the child refers to indices into the mesh's
-  // elements (i.e., triangles or tetrahedra) bounded by the node's bounding
-  // volume. Otherwise, it refers to child nodes further down the tree.
-  std::variant<LeafData, NodeChildren> child_;
+  // The distance (in nodes) from this node to its right child in the Bvh's
+  // node array, or zero if this is a leaf node. The left child, if any, is
+  // always the next node.
+  int right_offset_{};
+
+  // If this is a leaf node then these are the indices into the mesh's elements
+  // (i.e., triangles or tetrahedra) bounded by the node's bounding volume.
+  // Unused for branch nodes.
+  LeafData leaf_;
 };
 
 /* Resulting instruction from performing the bounding volume tree traversal
@@ -205,7 +201,10 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
-  const NodeType& root_node() const { return *root_node_; }
+  const NodeType& root_node() const { return nodes_.front(); }
+
+  /* Returns the total number of nodes (branches and leaves) in the tree.  */
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
    Frame A) against the given %Bvh's mesh elements (measured and expressed in
@@ -220,43 +219,65 @@ class Bvh {
   template <class OtherBvhType>
   void Collide(const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
                BvttCallback callback) const {
-    using NodePair =
-        std::pair<const NodeType&, const typename OtherBvhType::NodeType&>;
+    using OtherNodeType = typename OtherBvhType::NodeType;
+    using NodePair = std::pair<const NodeType*, const OtherNodeType*>;
+
+    // Each pair on the stack is already known to have overlapping bounding
+    // volumes. When a pair is expanded, its (up to four) child pairs are tested
+    // together as a single SIMD batch, and only the overlapping ones are
+    // pushed. The pairs are pushed in the same order as they would be with one
+    // overlap test per popped pair, so the callback sees the same sequence of
+    // element pairs.
+    if (!BvType::HasOverlap(root_node().bv(), bvh_B.root_node().bv(), X_AB)) {
+      return;
+    }
     std::stack<NodePair, std::vector<NodePair>> node_pairs;
-    node_pairs.emplace(root_node(), bvh_B.root_node());
+    node_pairs.emplace(&root_node(), &bvh_B.root_node());
 
+    std::array<NodePair, 4> children;
+    BoxPairBatch batch;
     while (!node_pairs.empty()) {
-      const auto& [node_a, node_b] = node_pairs.top();
+      const auto [node_a, node_b] = node_pairs.top();
       node_pairs.pop();
 
-      // Check if the bounding volumes overlap.
-      if (!BvType::HasOverlap(node_a.bv(), node_b.bv(), X_AB)) {
-        continue;
-      }
-
       // Run the callback on the pair if they are both leaf nodes, otherwise
       // check each branch.
-      if (node_a.is_leaf() && node_b.is_leaf()) {
-        const int num_a_elements = node_a.num_element_indices();
-        const int num_b_elements = node_b.num_element_indices();
+      if (node_a->is_leaf() && node_b->is_leaf()) {
+        const int num_a_elements = node_a->num_element_indices();
+        const int num_b_elements = node_b->num_element_indices();
         for (int a = 0; a < num_a_elements; ++a) {
           for (int b = 0; b < num_b_elements; ++b) {
             const BvttCallbackResult result =
-                callback(node_a.element_index(a), node_b.element_index(b));
+                callback(node_a->element_index(a), node_b->element_index(b));
             if (result == BvttCallbackResult::Terminate) return;
           }
         }
-      } else if (node_b.is_leaf()) {
-        node_pairs.emplace(node_a.left(), node_b);
-        node_pairs.emplace(node_a.right(), node_b);
-      } else if (node_a.is_leaf()) {
-        node_pairs.emplace(node_a, node_b.left());
-        node_pairs.emplace(node_a, node_b.right());
+        continue;
+      }
+      int num_children = 0;
+      if (node_b->is_leaf()) {
+        children[num_children++] = {&node_a->left(), node_b};
+        children[num_children++] = {&node_a->right(), node_b};
+      } else if (node_a->is_leaf()) {
+        children[num_children++] = {node_a, &node_b->left()};
+        children[num_children++] = {node_a, &node_b->right()};
       } else {
-        node_pairs.emplace(node_a.left(), node_b.left());
-        node_pairs.emplace(node_a.right(), node_b.left());
-        node_pairs.emplace(node_a.left(), node_b.right());
-        node_pairs.emplace(node_a.right(), node_b.right());
+        children[num_children++] = {&node_a->left(), &node_b->left()};
+        children[num_children++] = {&node_a->right(), &node_b->left()};
+        children[num_children++] = {&node_a->left(), &node_b->right()};
+        children[num_children++] = {&node_a->right(), &node_b->right()};
+      }
+
+      batch.clear();
+      for (int i = 0; i < num_children; ++i) {
+        BvType::AddToBatch(children[i].first->bv(), children[i].second->bv(),
+                           X_AB, &batch);
+      }
+      const uint32_t overlaps = BoxesOverlapBatch(batch);
+      for (int i = 0; i < num_children; ++i) {
+        if (overlaps & (uint32_t{1} << i)) {
+          node_pairs.push(children[i]);
+        }
       }
     }
   }
@@ -332,7 +353,7 @@ class Bvh {
     if constexpr (std::is_same_v<OtherBvhType, Bvh<BvType, SourceMeshType>>) {
       if (this == &other) return true;
     }
-    return EqualTrees(this->root_node(), other.root_node());
+    return EqualTrees(this->nodes_, other.nodes_);
   }
 
  private:
@@ -342,14 +363,23 @@ class Bvh {
   template <typename>
   friend class BvhUpdater;
 
-  NodeType& mutable_root_node() { return *root_node_; }
+  template <class, class>
+  friend class Bvh;
+
+  /* Provide disciplined access to BvhUpdater to the mutable nodes. Because the
+   nodes are stored in depth-first order, every node's children follow it in
+   this array.  */
+  std::vector<NodeType>& mutable_nodes() { return nodes_; }
 
   using CentroidPair = std::pair<int, Vector3<double>>;
 
-  static std::unique_ptr<NodeType> BuildBvTree(
+  // Appends the subtree bounding the elements in [start, end) to `nodes`, in
+  // depth-first order.
+  static void BuildBvTree(
       const MeshType& mesh,
       const typename std::vector<CentroidPair>::iterator& start,
-      const typename std::vector<CentroidPair>::iterator& end);
+      const typename std::vector<CentroidPair>::iterator& end,
+      std::vector<NodeType>* nodes);
 
   static BvType ComputeBoundingVolume(
       const MeshType& mesh,
@@ -361,35 +391,33 @@ class Bvh {
   // Computes the centroid of the ith element of the given mesh.
   static Vector3<double> ComputeCentroid(const MeshType& mesh, int i);
 
-  // Tests that two trees, rooted at nodes a and b, respectively, are equal
-  // in the sense that they have identical node structure and equal bounding
-  // volumes (see BvType::Equal()). The two hierarchies must be built from the
-  // same bounding volume type, and the same mesh type, but the mesh scalar can
-  // differ.
+  // Tests that two trees, stored as the node arrays a and b, respectively, are
+  // equal in the sense that they have identical node structure and equal
+  // bounding volumes (see BvType::Equal()). The two hierarchies must be built
+  // from the same bounding volume type, and the same mesh type, but the mesh
+  // scalar can differ. Because both arrays are in depth-first order, identical
+  // structure means that corresponding entries match one-to-one.
   template <typename OtherNodeType>
-  static bool EqualTrees(const NodeType& a, const OtherNodeType& b) {
-    if constexpr (std::is_same_v<NodeType, OtherNodeType>) {
-      if (&a == &b) return true;
-    }
-
-    if (!a.bv().Equal(b.bv())) return false;
-
-    if (a.is_leaf()) {
-      if (!b.is_leaf()) {
+  static bool EqualTrees(const std::vector<NodeType>& a,
+                         const std::vector<OtherNodeType>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+      if (!a[i].bv().Equal(b[i].bv())) return false;
+      if (a[i].is_leaf() != b[i].is_leaf()) return false;
+      if (a[i].is_leaf()) {
+        if (!a[i].EqualLeaf(b[i])) return false;
+      } else if (&a[i].right() - &a[i] != &b[i].right() - &b[i]) {
         return false;
       }
-      return a.EqualLeaf(b);
-    } else {
-      if (b.is_leaf()) {
-        return false;
-      }
-      return EqualTrees(a.left(), b.left()) && EqualTrees(a.right(), b.right());
     }
+    return true;
   }
 
   static constexpr int kElementVertexCount = MeshType::kVertexPerElement;
 
-  copyable_unique_ptr<NodeType> root_node_;
+  // All of the nodes of the tree in depth-first (pre-order) order; the root is
+  // the first node.
+  std::vector<NodeType> nodes_;
 };
 
 }  // namespace internal
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <limits>
+#include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
+#include "drake/common/ssize.h"
 #include "drake/geometry/proximity/aabb.h"
 #include "drake/geometry/proximity/bvh.h"
 
@@ -49,15 +54,73 @@ class BvhUpdater {
   const Bvh<Aabb, MeshType>& bvh() const { return bvh_; }
 
   /* Updates the referenced bvh to maintain a good fit on the referenced mesh.
-   */
-  void Update() {
+   @param parallelism  Specifies the number of threads that may be used to
+                       refit the bvh. Large hierarchies are split into
+                       independent subtrees that are refit concurrently; the
+                       resulting bounding volumes are the same regardless of
+                       the number of threads. */
+  void Update(Parallelism parallelism = Parallelism::None()) {
     /* Get the *double-valued* mesh vertices. */
     const auto& vertices = GetMeshVertices(mesh_.vertices());
     if (vertices.size() == 0) return;
 
     /* This implementation doesn't change the bvh topology; it simply passes
-     through each box in a bottom-up manner refitting the box to the data. */
-    UpdateRecursive(&bvh_.mutable_root_node(), vertices);
+     through each box in a bottom-up manner refitting the box to the data.
+     The nodes are stored in depth-first order, so every node's children come
+     after it; sweeping the node array backwards refits children before their
+     parents while walking memory sequentially. */
+    auto& nodes = bvh_.mutable_nodes();
+    [[maybe_unused]] const int num_threads = parallelism.num_threads();
+#if defined(_OPENMP)
+    const bool operate_in_parallel =
+        num_threads > 1 && ssize(nodes) >= kMinNodesForParallelRefit;
+#else
+    constexpr bool operate_in_parallel = false;
+#endif
+    if (!operate_in_parallel) {
+      RefitRange(0, ssize(nodes), vertices);
+      return;
+    }
+
+    /* Each subtree occupies a contiguous range of the node array, so disjoint
+     subtrees can be refit concurrently with the same backwards sweep. We
+     split the top of the tree, breadth first, until there are a few subtrees
+     per thread; the split nodes are then refit once all subtrees are done. */
+    std::vector<int> subtree_roots{0};
+    std::vector<int> split_nodes;
+    const int target_num_subtrees = kSubtreesPerThread * num_threads;
+    bool can_split = true;
+    while (ssize(subtree_roots) < target_num_subtrees && can_split) {
+      can_split = false;
+      std::vector<int> next_roots;
+      next_roots.reserve(2 * subtree_roots.size());
+      for (int n : subtree_roots) {
+        if (nodes[n].is_leaf()) {
+          next_roots.push_back(n);
+        } else {
+          split_nodes.push_back(n);
+          next_roots.push_back(n + 1);
+          next_roots.push_back(n + (&nodes[n].right() - &nodes[n]));
+          can_split = true;
+        }
+      }
+      subtree_roots = std::move(next_roots);
+    }
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+    for (int i = 0; i < ssize(subtree_roots); ++i) {
+      const int root = subtree_roots[i];
+      RefitRange(root, SubtreeEnd(nodes, root), vertices);
+    }
+
+    /* Children always have larger indices than their parents, so refitting
+     the split nodes from the largest index down visits children first. */
+    std::sort(split_nodes.begin(), split_nodes.end(), std::greater<int>());
+    for (int n : split_nodes) {
+      RefitNode(&nodes[n], vertices);
+    }
   }
 
  private:
@@ -78,9 +141,31 @@ class BvhUpdater {
     return vertices_dbl;
   }
 
-  // Helper function to perform a bottom-up refit.
-  void UpdateRecursive(typename Bvh<Aabb, MeshType>::NodeType* node,
-                       const std::vector<Vector3<double>>& vertices) {
+  // Refits the boxes of the nodes in the index range [begin, end) of the bvh's
+  // node array, from last to first. The range must hold complete subtrees.
+  void RefitRange(int begin, int end,
+                  const std::vector<Vector3<double>>& vertices) {
+    auto& nodes = bvh_.mutable_nodes();
+    for (int n = end - 1; n >= begin; --n) {
+      RefitNode(&nodes[n], vertices);
+    }
+  }
+
+  // Returns one past the index of the last node in the subtree rooted at the
+  // node with index `root`. In depth-first order, that is one past the
+  // subtree's right-most leaf.
+  static int SubtreeEnd(
+      const std::vector<typename Bvh<Aabb, MeshType>::NodeType>& nodes,
+      int root) {
+    const auto* node = &nodes[root];
+    while (!node->is_leaf()) node = &node->right();
+    return static_cast<int>(node - nodes.data()) + 1;
+  }
+
+  // Refits the box of a single node. For a branch node, the boxes of its
+  // children must already be refit.
+  void RefitNode(typename Bvh<Aabb, MeshType>::NodeType* node,
+                 const std::vector<Vector3<double>>& vertices) {
     /* Intentionally uninitialized. */
     Eigen::Vector3d lower, upper;
     constexpr int kElementVertexCount = MeshType::kVertexPerElement;
@@ -102,8 +187,6 @@ class BvhUpdater {
         }
       }
     } else {
-      UpdateRecursive(&node->left(), vertices);
-      UpdateRecursive(&node->right(), vertices);
       // Update box on child boxes.
       lower = node->left().bv().lower().cwiseMin(node->right().bv().lower());
       upper = node->left().bv().upper().cwiseMax(node->right().bv().upper());
@@ -111,6 +194,14 @@ class BvhUpdater {
     node->bv().set_bounds(lower, upper);
   }
 
+  // Hierarchies with fewer nodes are always refit serially; the refit is too
+  // cheap to amortize the cost of spinning up threads.
+  static constexpr int kMinNodesForParallelRefit = 4096;
+
+  // The number of subtrees per thread the refit is split into, to balance the
+  // load when the tree isn't perfectly balanced.
+  static constexpr int kSubtreesPerThread = 4;
+
   const MeshType& mesh_;
   Bvh<Aabb, MeshType>& bvh_;
 };
@@ -7,6 +7,7 @@
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/deformable_mesh_with_bvh.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
@@ -82,17 +83,20 @@ class DeformableGeometry {
                    measured and expressed in the mesh's frame M.
   @param q_surface Similar to `q_volume`, but provides the vertex positions of
                    the surface mesh.
+  @param parallelism The number of threads that may be used to refit the
+                   bounding volume hierarchies of the meshes.
   @pre q_volume.size() == 3 * deformable_volume().mesh().num_vertices().
   @pre q_surface.size() == 3 * deformable_surface().mesh(). num_vertices(). */
   void UpdateVertexPositions(
       const Eigen::Ref<const VectorX<double>>& q_volume,
-      const Eigen::Ref<const VectorX<double>>& q_surface) {
+      const Eigen::Ref<const VectorX<double>>& q_surface,
+      Parallelism parallelism = Parallelism::None()) {
     DRAKE_DEMAND(q_volume.size() ==
                  3 * deformable_volume().mesh().num_vertices());
     DRAKE_DEMAND(q_surface.size() ==
                  3 * deformable_surface().mesh().num_vertices());
-    deformable_volume_->UpdateVertexPositions(q_volume);
-    deformable_surface_->UpdateVertexPositions(q_surface);
+    deformable_volume_->UpdateVertexPositions(q_volume, parallelism);
+    deformable_surface_->UpdateVertexPositions(q_surface, parallelism);
   }
 
   /* Returns the approximate signed distance field (sdf) for the deformable
@@ -69,9 +69,10 @@ void Geometries::AddDeformableGeometry(
 
 void Geometries::UpdateDeformableVertexPositions(
     GeometryId id, const Eigen::Ref<const VectorX<double>>& q_WV,
-    const Eigen::Ref<const VectorX<double>>& q_WS) {
+    const Eigen::Ref<const VectorX<double>>& q_WS, Parallelism parallelism) {
   if (is_deformable(id)) {
-    deformable_geometries_.at(id).UpdateVertexPositions(q_WV, q_WS);
+    deformable_geometries_.at(id).UpdateVertexPositions(q_WV, q_WS,
+                                                        parallelism);
   }
 }
 
@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/geometry/proximity/collision_filter.h"
@@ -123,10 +124,13 @@ class Geometries final : public ShapeReifier {
 
   /* If a deformable geometry with `id` exists, updates the vertex positions
    of the volume mesh (in the world frame) to `q_WV` and the vertex positions
-   of the surface mesh (in the world frame) to `q_WS`. */
+   of the surface mesh (in the world frame) to `q_WS`. The bounding volume
+   hierarchies of the meshes are refit using up to `parallelism` threads.
+   Updates of distinct deformable geometries may run concurrently. */
   void UpdateDeformableVertexPositions(
       GeometryId id, const Eigen::Ref<const VectorX<double>>& q_WV,
-      const Eigen::Ref<const VectorX<double>>& q_WS);
+      const Eigen::Ref<const VectorX<double>>& q_WS,
+      Parallelism parallelism = Parallelism::None());
 
   /* For each registered deformable geometry, computes the contact data of it
    with respect to all registered rigid geometries and all other deformable
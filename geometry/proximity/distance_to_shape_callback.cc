@@ -209,13 +209,12 @@ bool ScalarSupport<double>::is_supported(fcl::NODE_TYPE node1,
          (node2 != fcl::GEOM_HALFSPACE || node1 == fcl::GEOM_SPHERE);
 }
 
-template <typename T>
-bool Callback(fcl::CollisionObjectd* object_A_ptr,
-              fcl::CollisionObjectd* object_B_ptr, void* callback_data,
-              // NOLINTNEXTLINE
-              double& max_distance) {
-  auto& data = *static_cast<CallbackData<T>*>(callback_data);
+namespace {
 
+/* Sets the broadphase threshold for the distance callbacks. */
+void SetBroadphaseMaxDistance(double data_max_distance,
+                              // NOLINTNEXTLINE
+                              double& max_distance) {
   // Three things:
   //   1. We repeatedly set max_distance in each call to the callback because we
   //   can't initialize it. The cost is negligible but maximizes any culling
@@ -230,7 +229,19 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   //   bounding box test in which this is used doesn't produce a code via
   //   calculation; it is a perfect, hard-coded zero.
   const double kEps = std::numeric_limits<double>::epsilon() / 10;
-  max_distance = std::max(data.max_distance, kEps);
+  max_distance = std::max(data_max_distance, kEps);
+}
+
+}  // namespace
+
+template <typename T>
+bool Callback(fcl::CollisionObjectd* object_A_ptr,
+              fcl::CollisionObjectd* object_B_ptr, void* callback_data,
+              // NOLINTNEXTLINE
+              double& max_distance) {
+  auto& data = *static_cast<CallbackData<T>*>(callback_data);
+
+  SetBroadphaseMaxDistance(data.max_distance, max_distance);
 
   const EncodedData encoding_a(*object_A_ptr);
   const EncodedData encoding_b(*object_B_ptr);
@@ -240,45 +251,10 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
       data.collision_filter->CanCollideWith(encoding_a.id(), encoding_b.id());
 
   if (can_collide) {
-    // Throw if the geometry-pair isn't supported.
-    if (ScalarSupport<T>::is_supported(
-            object_A_ptr->collisionGeometry()->getNodeType(),
-            object_B_ptr->collisionGeometry()->getNodeType())) {
-      // We want to pass object_A and object_B to the narrowphase distance in a
-      // specific order. This way the broadphase distance is free to give us
-      // either (A,B) or (B,A), but the narrowphase distance will always receive
-      // the result in a consistent order.
-      const GeometryId orig_id_A = encoding_a.id();
-      const GeometryId orig_id_B = encoding_b.id();
-      const bool swap_AB = (orig_id_B < orig_id_A);
-
-      // NOTE: Although this function *takes* pointers to non-const objects to
-      // satisfy the fcl api, it should not exploit the non-constness to modify
-      // the collision objects. We ensure this by a reference to a const version
-      // and not directly use the provided pointers afterwards.
-      const fcl::CollisionObjectd& fcl_object_A =
-          *(swap_AB ? object_B_ptr : object_A_ptr);
-      const fcl::CollisionObjectd& fcl_object_B =
-          *(swap_AB ? object_A_ptr : object_B_ptr);
-
-      const GeometryId id_A = swap_AB ? encoding_b.id() : encoding_a.id();
-      const GeometryId id_B = swap_AB ? encoding_a.id() : encoding_b.id();
-
-      SignedDistancePair<T> signed_pair;
-      ComputeNarrowPhaseDistance(fcl_object_A, data.X_WGs.at(id_A),
-                                 fcl_object_B, data.X_WGs.at(id_B),
-                                 data.request, &signed_pair);
-      if (ExtractDoubleOrThrow(signed_pair.distance) <= data.max_distance) {
-        data.nearest_pairs.emplace_back(std::move(signed_pair));
-      }
-    } else {
-      throw std::logic_error(fmt::format(
-          "Signed distance queries between shapes '{}' and '{}' "
-          "are not supported for scalar type {}. See the documentation for "
-          "QueryObject::ComputeSignedDistancePairwiseClosestPoints() for the "
-          "full status of supported geometries.",
-          GetGeometryName(*object_A_ptr), GetGeometryName(*object_B_ptr),
-          NiceTypeName::Get<T>()));
+    std::optional<SignedDistancePair<T>> signed_pair =
+        MaybeMakeDistancePair(object_A_ptr, object_B_ptr, data);
+    if (signed_pair.has_value()) {
+      data.nearest_pairs.emplace_back(std::move(*signed_pair));
     }
   }
   // Returning true would tell the broadphase manager to terminate early. Since
@@ -287,8 +263,79 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   return false;
 }
 
+template <typename T>
+std::optional<SignedDistancePair<T>> MaybeMakeDistancePair(
+    fcl::CollisionObjectd* object_A_ptr, fcl::CollisionObjectd* object_B_ptr,
+    const CallbackData<T>& data) {
+  // Throw if the geometry-pair isn't supported.
+  if (!ScalarSupport<T>::is_supported(
+          object_A_ptr->collisionGeometry()->getNodeType(),
+          object_B_ptr->collisionGeometry()->getNodeType())) {
+    throw std::logic_error(fmt::format(
+        "Signed distance queries between shapes '{}' and '{}' "
+        "are not supported for scalar type {}. See the documentation for "
+        "QueryObject::ComputeSignedDistancePairwiseClosestPoints() for the "
+        "full status of supported geometries.",
+        GetGeometryName(*object_A_ptr), GetGeometryName(*object_B_ptr),
+        NiceTypeName::Get<T>()));
+  }
+
+  const EncodedData encoding_a(*object_A_ptr);
+  const EncodedData encoding_b(*object_B_ptr);
+
+  // We want to pass object_A and object_B to the narrowphase distance in a
+  // specific order. This way the broadphase distance is free to give us
+  // either (A,B) or (B,A), but the narrowphase distance will always receive
+  // the result in a consistent order.
+  const GeometryId orig_id_A = encoding_a.id();
+  const GeometryId orig_id_B = encoding_b.id();
+  const bool swap_AB = (orig_id_B < orig_id_A);
+
+  // NOTE: Although this function *takes* pointers to non-const objects to
+  // satisfy the fcl api, it should not exploit the non-constness to modify
+  // the collision objects. We ensure this by a reference to a const version
+  // and not directly use the provided pointers afterwards.
+  const fcl::CollisionObjectd& fcl_object_A =
+      *(swap_AB ? object_B_ptr : object_A_ptr);
+  const fcl::CollisionObjectd& fcl_object_B =
+      *(swap_AB ? object_A_ptr : object_B_ptr);
+
+  const GeometryId id_A = swap_AB ? encoding_b.id() : encoding_a.id();
+  const GeometryId id_B = swap_AB ? encoding_a.id() : encoding_b.id();
+
+  SignedDistancePair<T> signed_pair;
+  ComputeNarrowPhaseDistance(fcl_object_A, data.X_WGs.at(id_A), fcl_object_B,
+                             data.X_WGs.at(id_B), data.request, &signed_pair);
+  if (ExtractDoubleOrThrow(signed_pair.distance) <= data.max_distance) {
+    return signed_pair;
+  }
+  return std::nullopt;
+}
+
+bool CandidateCallback(fcl::CollisionObjectd* object_A_ptr,
+                       fcl::CollisionObjectd* object_B_ptr, void* callback_data,
+                       // NOLINTNEXTLINE
+                       double& max_distance) {
+  auto& data = *static_cast<CandidateCallbackData*>(callback_data);
+
+  SetBroadphaseMaxDistance(data.max_distance, max_distance);
+
+  const EncodedData encoding_a(*object_A_ptr);
+  const EncodedData encoding_b(*object_B_ptr);
+
+  const bool can_collide =
+      data.collision_filter == nullptr ||
+      data.collision_filter->CanCollideWith(encoding_a.id(), encoding_b.id());
+
+  if (can_collide) {
+    data.candidates.emplace_back(encoding_a.id(), encoding_b.id());
+  }
+  return false;
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
-    (&ComputeNarrowPhaseDistance<T>, &Callback<T>));
+    (&ComputeNarrowPhaseDistance<T>, &Callback<T>,
+     &MaybeMakeDistancePair<T>));
 
 }  // namespace shape_distance
 }  // namespace internal
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include "drake/common/drake_export.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collision_filter.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
@@ -293,6 +295,61 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
               // NOLINTNEXTLINE
               void* callback_data, double& max_distance);
 
+/* Given two objects that are candidates for a distance query, returns their
+ signed distance result. The result is the same, regardless of the order of the
+ two fcl objects. If the distance exceeds `data.max_distance`, returns nullopt.
+ The collision filter in `data` is _not_ considered, and `data.nearest_pairs`
+ is not modified.
+
+ @throws std::exception if the pair of shapes is not supported for scalar T. */
+template <typename T>
+std::optional<SignedDistancePair<T>> MaybeMakeDistancePair(
+    fcl::CollisionObjectd* object_A_ptr, fcl::CollisionObjectd* object_B_ptr,
+    const CallbackData<T>& data);
+
+/* Supporting data for the candidate-gathering callback (see CandidateCallback
+ below). */
+struct CandidateCallbackData {
+  /* Constructs the callback data. The parameters are aliased in the data and
+   must remain valid at least as long as the CandidateCallbackData instance.
+
+   @param collision_filter_in  The collision filter system. Aliased. If null,
+                               collision filters will not be considered.
+   @param max_distance_in      The maximum distance at which a pair is
+                               reported.
+   @param candidates_in[out]   The output results. Aliased.  */
+  CandidateCallbackData(const CollisionFilter* collision_filter_in,
+                        double max_distance_in,
+                        std::vector<SortedPair<GeometryId>>* candidates_in)
+      : collision_filter(collision_filter_in),
+        max_distance(max_distance_in),
+        candidates(*candidates_in) {
+    DRAKE_DEMAND(candidates_in != nullptr);
+  }
+
+  /* The collision filter system.  */
+  const CollisionFilter* collision_filter{};
+
+  /* The maximum distance at which a pair's distance will be reported.  */
+  const double max_distance{};
+
+  /* The pairs whose distance must be evaluated.  */
+  std::vector<SortedPair<GeometryId>>& candidates;
+};
+
+/* The broadphase callback for gathering the geometry pairs that Callback()
+ would evaluate, without evaluating them. It applies the same broadphase
+ threshold and collision filtering as Callback(), so that evaluating
+ MaybeMakeDistancePair() on every reported candidate produces the same results
+ as Callback(). This allows the narrowphase to be evaluated afterwards, e.g.,
+ in parallel.
+
+ @returns False; the broadphase should *not* terminate its process.  */
+bool CandidateCallback(fcl::CollisionObjectd* object_A_ptr,
+                       fcl::CollisionObjectd* object_B_ptr,
+                       // NOLINTNEXTLINE
+                       void* callback_data, double& max_distance);
+
 // clang-format off
 }  // namespace shape_distance
 // clang-format on
@@ -18,6 +18,28 @@ using math::RigidTransformd;
 using math::RollPitchYawd;
 using math::RotationMatrixd;
 
+namespace {
+
+/* Computes X_AB, the pose of b's canonical frame B in a's canonical frame A,
+ where box `a` is posed in hierarchy frame G and `b` in hierarchy frame H. */
+RigidTransformd CalcObbObbPose(const Obb& a, const Obb& b,
+                               const RigidTransformd& X_GH) {
+  const RigidTransformd& X_GA = a.pose();
+  const RigidTransformd& X_HB = b.pose();
+  return X_GA.InvertAndCompose(X_GH * X_HB);
+}
+
+/* Computes X_AO, the pose of obb_G's canonical frame O in aabb_H's canonical
+ frame A (see the derivation in Obb::HasOverlap()). */
+RigidTransformd CalcAabbObbPose(const Obb& obb_G, const Aabb& aabb_H,
+                                const RigidTransformd& X_GH) {
+  const RigidTransformd X_HG = X_GH.inverse();
+  const RotationMatrixd R_AO = X_HG.rotation() * obb_G.pose().rotation();
+  return RigidTransformd(R_AO, X_HG * obb_G.center() - aabb_H.center());
+}
+
+}  // namespace
+
 Obb::Obb(const RigidTransformd& X_HB, const Vector3<double>& half_width)
     : pose_(X_HB), half_width_(half_width) {
   DRAKE_DEMAND(half_width.x() >= 0.0);
@@ -30,10 +52,8 @@ Obb::Obb(const RigidTransformd& X_HB, const Vector3<double>& half_width)
 bool Obb::HasOverlap(const Obb& a, const Obb& b, const RigidTransformd& X_GH) {
   // The canonical frame A of box `a` is posed in the hierarchy frame G, and
   // the canonical frame B of box `b` is posed in the hierarchy frame H.
-  const RigidTransformd& X_GA = a.pose();
-  const RigidTransformd& X_HB = b.pose();
-  const RigidTransformd X_AB = X_GA.InvertAndCompose(X_GH * X_HB);
-  return BoxesOverlap(a.half_width(), b.half_width(), X_AB);
+  return BoxesOverlap(a.half_width(), b.half_width(),
+                      CalcObbObbPose(a, b, X_GH));
 }
 
 bool Obb::HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
@@ -48,10 +68,22 @@ bool Obb::HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
             = p_HO_H - p_HA_H
             = X_HG * p_GO_G - p_HA_H
             = X_HG * obb_G.center() - aabb_H.center()  */
-  const RigidTransformd X_HG = X_GH.inverse();
-  const RotationMatrixd R_AO = X_HG.rotation() * obb_G.pose().rotation();
-  const RigidTransformd X_AO(R_AO, X_HG * obb_G.center() - aabb_H.center());
-  return BoxesOverlap(aabb_H.half_width(), obb_G.half_width(), X_AO);
+  return BoxesOverlap(aabb_H.half_width(), obb_G.half_width(),
+                      CalcAabbObbPose(obb_G, aabb_H, X_GH));
+}
+
+void Obb::AddToBatch(const Obb& a_G, const Obb& b_H,
+                     const RigidTransformd& X_GH, BoxPairBatch* pairs) {
+  DRAKE_ASSERT(pairs != nullptr);
+  pairs->Add(a_G.half_width(), b_H.half_width(),
+             CalcObbObbPose(a_G, b_H, X_GH));
+}
+
+void Obb::AddToBatch(const Obb& obb_G, const Aabb& aabb_H,
+                     const RigidTransformd& X_GH, BoxPairBatch* pairs) {
+  DRAKE_ASSERT(pairs != nullptr);
+  pairs->Add(aabb_H.half_width(), obb_G.half_width(),
+             CalcAabbObbPose(obb_G, aabb_H, X_GH));
 }
 
 bool Obb::HasOverlap(const Obb& bv, const Plane<double>& plane_P,
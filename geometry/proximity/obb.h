@@ -19,6 +19,7 @@ namespace internal {
 template <typename>
 class ObbMaker;
 class Aabb;
+class BoxPairBatch;
 
 /* Oriented bounding box used in Bvh. The box is defined in a canonical
  frame B such that it is centered on Bo and its extents are aligned with
@@ -96,6 +97,22 @@ class Obb {
   static bool HasOverlap(const Obb& obb_G, const Aabb& aabb_H,
                          const math::RigidTransformd& X_GH);
 
+  /* Adds the pair of boxes `a_G` and `b_H` to the given batch, so that a
+   subsequent call to BoxesOverlapBatch() tests them exactly as
+   HasOverlap(a_G, b_H, X_GH) would.
+   @pre pairs != nullptr and pairs->size() < BoxPairBatch::kMaxSize. */
+  static void AddToBatch(const Obb& a_G, const Obb& b_H,
+                         const math::RigidTransformd& X_GH,
+                         BoxPairBatch* pairs);
+
+  /* Adds the pair of boxes `obb_G` and `aabb_H` to the given batch, so that a
+   subsequent call to BoxesOverlapBatch() tests them exactly as
+   HasOverlap(obb_G, aabb_H, X_GH) would.
+   @pre pairs != nullptr and pairs->size() < BoxPairBatch::kMaxSize. */
+  static void AddToBatch(const Obb& obb_G, const Aabb& aabb_H,
+                         const math::RigidTransformd& X_GH,
+                         BoxPairBatch* pairs);
+
   /* Checks whether bounding volume `bv` intersects the given plane. The
    bounding volume is centered on its canonical frame B, and B is posed in the
    corresponding hierarchy frame H. The plane is defined in frame P.
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/obb.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 
@@ -125,6 +126,10 @@ GTEST_TEST(AabbTest, BoxOverlap) {
       const RigidTransformd X_GH = X_WG.inverse() * X_WH;
 
       EXPECT_EQ(Aabb::HasOverlap(aabbA_G, aabbB_H, X_GH), expect_overlap);
+
+      BoxPairBatch pairs;
+      Aabb::AddToBatch(aabbA_G, aabbB_H, X_GH, &pairs);
+      EXPECT_EQ(BoxesOverlapBatch(pairs), expect_overlap ? 1u : 0u);
     }
 
     {
@@ -141,6 +146,10 @@ GTEST_TEST(AabbTest, BoxOverlap) {
       const RigidTransformd X_GH = X_WG.inverse() * X_WH;
 
       EXPECT_EQ(Aabb::HasOverlap(aabbA_G, obbB_H, X_GH), expect_overlap);
+
+      BoxPairBatch pairs;
+      Aabb::AddToBatch(aabbA_G, obbB_H, X_GH, &pairs);
+      EXPECT_EQ(BoxesOverlapBatch(pairs), expect_overlap ? 1u : 0u);
     }
   }
 }
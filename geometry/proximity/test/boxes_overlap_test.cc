@@ -1,6 +1,7 @@
 #include "drake/geometry/proximity/boxes_overlap.h"
 
 #include <string>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -59,9 +60,10 @@ class BoxesOverlapTest : public hwy::TestWithParamTarget {
 
   // Tests to see if the two oriented bounding boxes overlap. The boxes are
   // represented with vectors containing their half sizes as measured in their
-  // own frames. This tests A against B and B against A. If the two queries
-  // return different results, that is an error condition. Otherwise, reports
-  // the result of BoxesOverlap().
+  // own frames. This tests A against B and B against A, with both
+  // BoxesOverlap() and BoxesOverlapBatch(). If the queries return different
+  // results, that is an error condition. Otherwise, reports the result of
+  // BoxesOverlap().
   static bool InvokeBoxesOverlap(const Vector3d& a_half, const Vector3d& b_half,
                                  const RigidTransformd& X_AB,
                                  const std::string& label) {
@@ -69,6 +71,15 @@ class BoxesOverlapTest : public hwy::TestWithParamTarget {
     const bool b_to_a = BoxesOverlap(b_half, a_half, X_AB.inverse());
     DrawCase(a_half, b_half, X_AB, "BoxesOverlapTest/" + label);
     DRAKE_DEMAND(a_to_b == b_to_a);
+
+    // The same pair in every lane of a full batch, alternating directions.
+    BoxPairBatch pairs;
+    for (int i = 0; i < BoxPairBatch::kMaxSize; i += 2) {
+      pairs.Add(a_half, b_half, X_AB);
+      pairs.Add(b_half, a_half, X_AB.inverse());
+    }
+    const uint32_t expected = a_to_b ? 0xFF : 0;
+    EXPECT_EQ(BoxesOverlapBatch(pairs), expected) << label;
     return a_to_b;
   }
 
@@ -194,6 +205,40 @@ TEST_P(BoxesOverlapTest, AllCases) {
   }
 }
 
+// Tests a batch whose pairs have mixed results, including partially filled
+// batches, to confirm that each lane reports its own pair.
+TEST_P(BoxesOverlapTest, MixedBatch) {
+  const Vector3d a(2, 4, 3);
+  const Vector3d b(3.5, 2, 1.5);
+  std::vector<RigidTransformd> poses;
+  std::vector<bool> expected;
+  for (int axis = 0; axis < 3; ++axis) {
+    for (bool expect_overlap : {true, false}) {
+      poses.push_back(CalcCornerTransform(a, b, axis, expect_overlap));
+      expected.push_back(expect_overlap);
+    }
+  }
+  poses.push_back(CalcEdgeTransform(a, b, 0, 1, false));
+  expected.push_back(false);
+  poses.push_back(CalcEdgeTransform(a, b, 2, 0, true));
+  expected.push_back(true);
+  ASSERT_EQ(static_cast<int>(poses.size()), BoxPairBatch::kMaxSize);
+
+  BoxPairBatch pairs;
+  EXPECT_EQ(BoxesOverlapBatch(pairs), 0u);
+  uint32_t expected_bits = 0;
+  for (int i = 0; i < BoxPairBatch::kMaxSize; ++i) {
+    pairs.Add(a, b, poses[i]);
+    if (expected[i]) expected_bits |= uint32_t{1} << i;
+    EXPECT_EQ(pairs.size(), i + 1);
+    EXPECT_EQ(BoxesOverlapBatch(pairs), expected_bits);
+  }
+
+  pairs.clear();
+  EXPECT_EQ(pairs.size(), 0);
+  EXPECT_EQ(BoxesOverlapBatch(pairs), 0u);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
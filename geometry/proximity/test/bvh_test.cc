@@ -271,6 +271,35 @@ TYPED_TEST(BvhTest, TestCopy) {
   check_copy(this->bvh_.root_node(), bvh_copy.root_node());
 }
 
+// Tests that the nodes are stored contiguously in depth-first order: each
+// branch's left child immediately follows it, its right child follows the
+// whole left subtree, and the whole tree spans exactly num_nodes() nodes.
+TYPED_TEST(BvhTest, TestDepthFirstLayout) {
+  using BvType = TypeParam;
+  using NodeType = BvNode<BvType, TriangleSurfaceMesh<double>>;
+  const NodeType& root = this->bvh_.root_node();
+  EXPECT_EQ(this->bvh_.num_nodes(), CountAllNodes(root));
+
+  // Visits the subtree rooted at `node` and returns the node one past the last
+  // node of that subtree.
+  std::function<const NodeType*(const NodeType&)> check_layout;
+  check_layout = [&check_layout](const NodeType& node) -> const NodeType* {
+    if (node.is_leaf()) return &node + 1;
+    EXPECT_EQ(&node.left(), &node + 1);
+    const NodeType* left_end = check_layout(node.left());
+    EXPECT_EQ(&node.right(), left_end);
+    return check_layout(node.right());
+  };
+  EXPECT_EQ(check_layout(root), &root + this->bvh_.num_nodes());
+
+  // The node layout survives copying, with no references back into the
+  // original tree.
+  const Bvh<BvType, TriangleSurfaceMesh<double>> bvh_copy(this->bvh_);
+  const NodeType& copy_root = bvh_copy.root_node();
+  EXPECT_EQ(check_layout(copy_root), &copy_root + bvh_copy.num_nodes());
+  EXPECT_TRUE(bvh_copy.Equal(this->bvh_));
+}
+
 // Tests colliding while traversing through the bvh trees. We want to ensure
 // that the case of no overlap is covered as well as the 4 cases of branch and
 // leaf comparisons, i.e:
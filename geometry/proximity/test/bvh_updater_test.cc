@@ -7,6 +7,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
 
 namespace drake {
 namespace geometry {
@@ -191,6 +192,45 @@ TYPED_TEST(BvhUpdaterTest, Update) {
       (R * expected_right_bv.half_width().cast<T>()).cwiseAbs(), 2 * kEps));
 }
 
+/* Tests that refitting a large hierarchy with multiple threads (which splits
+ it into subtrees that are refit concurrently) produces exactly the same
+ bounding volumes as the serial refit. */
+GTEST_TEST(BvhUpdaterParallelTest, ParallelMatchesSerial) {
+  const VolumeMesh<double> reference_mesh = MakeSphereVolumeMesh<double>(
+      Sphere(1.0), 0.1, TessellationStrategy::kDenseInteriorVertices);
+
+  VolumeMesh<double> mesh_serial = reference_mesh;
+  VolumeMesh<double> mesh_parallel = reference_mesh;
+  Bvh<Aabb, VolumeMesh<double>> bvh_serial(mesh_serial);
+  Bvh<Aabb, VolumeMesh<double>> bvh_parallel(mesh_parallel);
+  /* The hierarchy must be large enough to be refit in parallel. */
+  ASSERT_GT(bvh_parallel.num_nodes(), 4096);
+  BvhUpdater<VolumeMesh<double>> updater_serial(&mesh_serial, &bvh_serial);
+  BvhUpdater<VolumeMesh<double>> updater_parallel(&mesh_parallel,
+                                                  &bvh_parallel);
+
+  /* Deform the mesh non-uniformly so that every box changes. */
+  VectorX<double> q(3 * reference_mesh.num_vertices());
+  for (int i = 0; i < reference_mesh.num_vertices(); ++i) {
+    const Vector3d& p = reference_mesh.vertex(i);
+    q.segment<3>(3 * i) =
+        Vector3d(p.x() + 0.1 * std::sin(3 * p.y()), 1.5 * p.y(),
+                 p.z() + 0.2 * p.x() * p.x());
+  }
+  mesh_serial.SetAllPositions(q);
+  mesh_parallel.SetAllPositions(q);
+  updater_serial.Update();
+  updater_parallel.Update(Parallelism(2));
+
+  EXPECT_TRUE(bvh_parallel.Equal(bvh_serial));
+  /* The refit root box bounds the deformed mesh. */
+  const Aabb& root = bvh_parallel.root_node().bv();
+  for (int i = 0; i < mesh_parallel.num_vertices(); ++i) {
+    const Vector3d p_MV = mesh_parallel.vertex(i) - root.center();
+    EXPECT_TRUE((p_MV.cwiseAbs().array() <= root.half_width().array()).all());
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -5,6 +5,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/boxes_overlap.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
@@ -829,6 +830,12 @@ GTEST_TEST(ObbTest, AabbOverlap) {
     const RigidTransformd X_GH = X_WG.inverse() * X_WH;
 
     EXPECT_EQ(Obb::HasOverlap(obb_G, aabb_H, X_GH), expect_overlap);
+
+    /* The batched test agrees, for both Obb-Aabb and Obb-Obb pairs. */
+    BoxPairBatch pairs;
+    Obb::AddToBatch(obb_G, aabb_H, X_GH, &pairs);
+    Obb::AddToBatch(obb_G, Obb(X_HB, half_sizeB), X_GH, &pairs);
+    EXPECT_EQ(BoxesOverlapBatch(pairs), expect_overlap ? 0b11u : 0u);
   }
 }
 
@@ -1,6 +1,7 @@
 #include "drake/geometry/proximity_engine.h"
 
 #include <algorithm>
+#include <exception>
 #include <filesystem>
 #include <limits>
 #include <string>
@@ -269,6 +270,58 @@ void CullFlatten(std::vector<X>* maybes, std::vector<R>* objects) {
   }
 }
 
+// Evaluates `calc(k)` for every k in [0, count). If `parallelism` requests
+// more than one thread (and OpenMP is available), the evaluations are spread
+// across threads, so `calc(k)` must only write to storage owned by index k.
+// Exceptions can't propagate out of an OpenMP region; they are captured and,
+// once all evaluations are done, the exception thrown for the smallest k is
+// rethrown. This matches the exception a serial evaluation would throw and
+// keeps the reported error independent of thread scheduling.
+template <typename Calc>
+void ParallelForWithErrorCapture(int count, Parallelism parallelism,
+                                 const Calc& calc) {
+  [[maybe_unused]] const int num_threads = parallelism.num_threads();
+#if defined(_OPENMP)
+  const bool operate_in_parallel = num_threads > 1 && count > 1;
+#else
+  constexpr bool operate_in_parallel = false;
+#endif
+
+  if (!operate_in_parallel) {
+    for (int k = 0; k < count; ++k) {
+      calc(k);
+    }
+    return;
+  }
+
+  int first_error_index = count;
+  std::exception_ptr first_error;
+  // The cost per index varies wildly (e.g., primitive pairs vs. mesh pairs, or
+  // deformable meshes of different sizes), so indices are handed out
+  // dynamically.
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int k = 0; k < count; ++k) {
+    try {
+      calc(k);
+    } catch (...) {
+#if defined(_OPENMP)
+#pragma omp critical(drake_geometry_proximity_engine_parallel_for_error)
+#endif
+      {
+        if (k < first_error_index) {
+          first_error_index = k;
+          first_error = std::current_exception();
+        }
+      }
+    }
+  }
+  if (first_error != nullptr) {
+    std::rethrow_exception(first_error);
+  }
+}
+
 }  // namespace
 
 // The implementation class for the fcl engine. Each of these functions
@@ -527,18 +580,34 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   void UpdateDeformableVertexPositions(
       const std::unordered_map<GeometryId, VectorX<T>>& q_WGs,
       const std::unordered_map<GeometryId, std::vector<DrivenTriangleMesh>>&
-          driven_meshes) {
+          driven_meshes,
+      Parallelism parallelism) {
+    std::vector<std::pair<GeometryId, const VectorX<T>*>> updates;
+    updates.reserve(q_WGs.size());
     for (const auto& [id, q_WG] : q_WGs) {
       if (!driven_meshes.contains(id)) {
         continue;  // No driven meshes for this id because there's no proximity
                    // role for this geometry.
       }
       DRAKE_DEMAND(driven_meshes.at(id).size() == 1);
+      updates.emplace_back(id, &q_WG);
+    }
+    // Each deformable geometry is updated independently. When there are at
+    // least as many geometries as threads, the geometries are distributed
+    // across the threads. Otherwise, they are updated one at a time and the
+    // threads are spent refitting the bounding volume hierarchies of each.
+    const bool across_geometries = ssize(updates) >= parallelism.num_threads();
+    const Parallelism outer =
+        across_geometries ? parallelism : Parallelism::None();
+    const Parallelism inner =
+        across_geometries ? Parallelism::None() : parallelism;
+    ParallelForWithErrorCapture(ssize(updates), outer, [&](int k) {
+      const auto& [id, q_WG] = updates[k];
       const DrivenTriangleMesh& driven_mesh = driven_meshes.at(id)[0];
       geometries_for_deformable_contact_.UpdateDeformableVertexPositions(
-          id, ExtractDoubleOrThrow(q_WG),
-          driven_mesh.GetDrivenVertexPositions());
-    }
+          id, ExtractDoubleOrThrow(*q_WG),
+          driven_mesh.GetDrivenVertexPositions(), inner);
+    });
   }
 
   // Implementation of ShapeReifier interface
@@ -636,7 +705,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-      const double max_distance) const {
+      const double max_distance, Parallelism parallelism) const {
     std::vector<SignedDistancePair<T>> witness_pairs;
     // All these quantities are aliased in the callback data.
     shape_distance::CallbackData<T> data{&collision_filter_, &X_WGs,
@@ -646,6 +715,31 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
     data.request.distance_tolerance = distance_tolerance_;
 
+    if (parallelism.num_threads() > 1) {
+      // Gather the pairs the broadphase would dispatch to the narrowphase and
+      // evaluate them independently. Each candidate's result is evaluated by
+      // the same function as the serial callback, and the sorted order of the
+      // candidates is the final order of the results.
+      std::vector<SortedPair<GeometryId>> candidates;
+      shape_distance::CandidateCallbackData candidate_data{
+          &collision_filter_, max_distance, &candidates};
+      dynamic_tree_.distance(&candidate_data,
+                             shape_distance::CandidateCallback);
+      FclDistance(dynamic_tree_, anchored_tree_, &candidate_data,
+                  shape_distance::CandidateCallback);
+      std::sort(candidates.begin(), candidates.end());
+
+      vector<std::optional<SignedDistancePair<T>>> witness_pair_maybes(
+          candidates.size());
+      ParallelForWithErrorCapture(ssize(candidates), parallelism, [&](int k) {
+        const auto& [id0, id1] = candidates[k];
+        witness_pair_maybes[k] = shape_distance::MaybeMakeDistancePair(
+            GetFclPtr(id0), GetFclPtr(id1), data);
+      });
+      CullFlatten(&witness_pair_maybes, &witness_pairs);
+      return witness_pairs;
+    }
+
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.distance(&data, shape_distance::Callback<T>);
 
@@ -760,11 +854,30 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      Parallelism parallelism) const {
     std::vector<PenetrationAsPointPair<T>> contacts;
     penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
                                                  &contacts};
 
+    if (parallelism.num_threads() > 1) {
+      // The collision candidates are exactly the pairs the broadphase would
+      // dispatch to the narrowphase callback; their sorted order is the final
+      // order of the results.
+      std::vector<SortedPair<GeometryId>> candidates =
+          FindCollisionCandidates();
+      vector<std::optional<PenetrationAsPointPair<T>>> contact_maybes(
+          candidates.size());
+      ParallelForWithErrorCapture(ssize(candidates), parallelism, [&](int k) {
+        const auto& [id0, id1] = candidates[k];
+        contact_maybes[k] = penetration_as_point_pair::MaybeMakePointPair(
+            GetFclPtr(id0), GetFclPtr(id1), data);
+      });
+      CullFlatten(&contact_maybes, &contacts);
+      DRAKE_ASSERT(IsSortedByOrder(contacts));
+      return contacts;
+    }
+
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
 
@@ -817,7 +930,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      Parallelism parallelism) const {
     std::vector<SortedPair<GeometryId>> candidates = FindCollisionCandidates();
 
     vector<ContactSurface<T>> surfaces;
@@ -825,11 +939,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic::ContactCalculator<T> calculator{
         &X_WGs, &hydroelastic_geometries_, representation};
 
-    // As a suggestion to future thread parallelizers, make available a fully
-    // allocated and prepared vector for results of the parallelizable step.
+    // Each candidate writes only to its own slot, so the candidates can be
+    // evaluated in any order (or concurrently) with identical results.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    ParallelForWithErrorCapture(ssize(candidates), parallelism, [&](int k) {
       const auto& [id0, id1] = candidates[k];
       auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
       if (ContactSurfaceFailed(result)) {
@@ -837,7 +950,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       } else if (surface != nullptr) {
         surface_ptrs[k] = std::move(surface);
       }
-    }
+    });
     CullFlatten(&surface_ptrs, &surfaces);
     DRAKE_ASSERT(IsSortedByOrder(surfaces));
     return surfaces;
@@ -849,7 +962,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelism) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
 
@@ -861,13 +975,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     penetration_as_point_pair::CallbackData<T> point_data{&collision_filter_,
                                                           &X_WGs, point_pairs};
 
-    // As a suggestion to future thread parallelizers, make available fully
-    // allocated and prepared vectors for results of the parallelizable steps.
+    // Each candidate writes only to its own slots, so the candidates can be
+    // evaluated in any order (or concurrently) with identical results.
     vector<std::unique_ptr<ContactSurface<T>>> surface_ptrs(candidates.size());
     vector<std::optional<PenetrationAsPointPair<T>>> point_pair_maybes(
         candidates.size());
-    // TODO(rpoyner-tri): try some thread parallelism here.
-    for (int k = 0; k < ssize(candidates); ++k) {
+    ParallelForWithErrorCapture(ssize(candidates), parallelism, [&](int k) {
       const auto& [id0, id1] = candidates[k];
       auto [result, surface] = calculator.MaybeMakeContactSurface(id0, id1);
       if (ContactSurfaceFailed(result)) {
@@ -879,7 +992,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       } else if (surface != nullptr) {
         surface_ptrs[k] = std::move(surface);
       }
-    }
+    });
     CullFlatten(&surface_ptrs, surfaces);
     DRAKE_ASSERT(IsSortedByOrder(*surfaces));
     CullFlatten(&point_pair_maybes, point_pairs);
@@ -1420,16 +1533,18 @@ template <typename T>
 void ProximityEngine<T>::UpdateDeformableVertexPositions(
     const std::unordered_map<GeometryId, VectorX<T>>& q_WGs,
     const std::unordered_map<GeometryId, std::vector<DrivenTriangleMesh>>&
-        driven_meshes) {
-  impl_->UpdateDeformableVertexPositions(q_WGs, driven_meshes);
+        driven_meshes,
+    Parallelism parallelism) {
+  impl_->UpdateDeformableVertexPositions(q_WGs, driven_meshes, parallelism);
 }
 
 template <typename T>
 std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-    const double max_distance) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
+    const double max_distance, Parallelism parallelism) const {
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                                           parallelism);
 }
 
 template <typename T>
@@ -1467,9 +1582,9 @@ bool ProximityEngine<T>::HasCollisions() const {
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration(
-    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-    const {
-  return impl_->ComputePointPairPenetration(X_WGs);
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    Parallelism parallelism) const {
+  return impl_->ComputePointPairPenetration(X_WGs, parallelism);
 }
 
 template <typename T>
@@ -1478,8 +1593,9 @@ typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                           std::vector<ContactSurface<T>>>
 ProximityEngine<T>::ComputeContactSurfaces(
     HydroelasticContactRepresentation representation,
-    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(representation, X_WGs);
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    Parallelism parallelism) const {
+  return impl_->ComputeContactSurfaces(representation, X_WGs, parallelism);
 }
 
 template <typename T>
@@ -1489,9 +1605,10 @@ ProximityEngine<T>::ComputeContactSurfacesWithFallback(
     HydroelasticContactRepresentation representation,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     std::vector<ContactSurface<T>>* surfaces,
-    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
-  return impl_->ComputeContactSurfacesWithFallback(representation, X_WGs,
-                                                   surfaces, point_pairs);
+    std::vector<PenetrationAsPointPair<T>>* point_pairs,
+    Parallelism parallelism) const {
+  return impl_->ComputeContactSurfacesWithFallback(
+      representation, X_WGs, surfaces, point_pairs, parallelism);
 }
 
 template <typename T>
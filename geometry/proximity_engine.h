@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -215,12 +216,19 @@ class ProximityEngine {
                  proximity roles.
    @pre if a deformable geometry with the given `id` is registered, its number
    of dofs matches the size of the value in the corresponding q_WG.
+   @param parallelism
+                 The number of threads used to refit the bounding volume
+                 hierarchies of the deformable geometries. Distinct geometries
+                 are refit concurrently when there are at least as many of
+                 them as threads; otherwise each geometry's hierarchy is refit
+                 with all of the threads.
    @pre if a deformable geometry with the given `id` is registered with a
    proximity role, driven_mesh.at(id) has size 1. */
   void UpdateDeformableVertexPositions(
       const std::unordered_map<GeometryId, VectorX<T>>& q_WGs,
       const std::unordered_map<GeometryId, std::vector<DrivenTriangleMesh>>&
-          driven_meshes);
+          driven_meshes,
+      Parallelism parallelism = Parallelism::None());
 
   // ----------------------------------------------------------------------
   /* @name              Signed Distance Queries
@@ -231,10 +239,14 @@ class ProximityEngine {
   /* Implementation of
    GeometryState::ComputeSignedDistancePairwiseClosestPoints().
    This includes `X_WGs`, the current poses of all geometries in World in the
-   current scalar type, keyed on each geometry's GeometryId.  */
+   current scalar type, keyed on each geometry's GeometryId.
+   @param parallelism  The number of threads used to evaluate the narrowphase
+                       of the candidate pairs reported by the broadphase. The
+                       results do not depend on this value.  */
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
-      const double max_distance) const;
+      const double max_distance,
+      Parallelism parallelism = Parallelism::None()) const;
 
   /* Implementation of
    GeometryState::ComputeSignedDistancePairClosestPoints().
@@ -276,32 +288,42 @@ class ProximityEngine {
   // be updated).
   /* Implementation of GeometryState::ComputePointPairPenetration().
    This includes `X_WGs`, the current poses of all geometries in World in the
-   current scalar type, keyed on each geometry's GeometryId.  */
+   current scalar type, keyed on each geometry's GeometryId.
+   @param parallelism  The number of threads used to evaluate the narrowphase
+                       of the candidate pairs reported by the broadphase. The
+                       results do not depend on this value.  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      Parallelism parallelism = Parallelism::None()) const;
 
   /* Implementation of GeometryState::ComputeContactSurfaces().
    @param X_WGs the current poses of all geometries in World in the
-                current scalar type, keyed on each geometry's GeometryId.  */
+                current scalar type, keyed on each geometry's GeometryId.
+   @param parallelism  The number of threads used to compute the contact
+                       surfaces of the candidate pairs reported by the
+                       broadphase. The results do not depend on this value. */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      Parallelism parallelism = Parallelism::None()) const;
 
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
    @param X_WGs the current poses of all geometries in World in the
-                current scalar type, keyed on each geometry's GeometryId.  */
+                current scalar type, keyed on each geometry's GeometryId.
+   @param parallelism  The number of threads used to compute the contact
+                       results of the candidate pairs reported by the
+                       broadphase. The results do not depend on this value. */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
   ComputeContactSurfacesWithFallback(
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelism = Parallelism::None()) const;
 
   /* Implementation of GeometryState::ComputeDeformableContact(). Assumes
    the poses of rigid bodies and the vertex positions of the deformable bodies
@@ -30,14 +30,17 @@ QueryObject<T>& QueryObject<T>::operator=(const QueryObject<T>& query_object) {
   context_ = nullptr;
   scene_graph_ = nullptr;
   state_.reset();
+  baked_proximity_parallelism_ = Parallelism::None();
 
   if (query_object.state_) {
     // Share the underlying baked state.
     state_ = query_object.state_;
+    baked_proximity_parallelism_ = query_object.baked_proximity_parallelism_;
   } else if (query_object.context_ && query_object.scene_graph_) {
     // Create a new baked state; make sure the source is fully updated.
     query_object.FullPoseAndConfigurationUpdate();
     state_ = std::make_shared<GeometryState<T>>(query_object.geometry_state());
+    baked_proximity_parallelism_ = query_object.proximity_parallelism();
   }
   inspector_.set(state_.get());
   // If `query_object` is default, then this will likewise be default.
@@ -110,7 +113,7 @@ QueryObject<T>::ComputePointPairPenetration() const {
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputePointPairPenetration();
+  return state.ComputePointPairPenetration(proximity_parallelism());
 }
 
 template <typename T>
@@ -142,7 +145,7 @@ QueryObject<T>::ComputeContactSurfaces(
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputeContactSurfaces(representation);
+  return state.ComputeContactSurfaces(representation, proximity_parallelism());
 }
 
 template <typename T>
@@ -159,8 +162,8 @@ QueryObject<T>::ComputeContactSurfacesWithFallback(
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  state.ComputeContactSurfacesWithFallback(representation, surfaces,
-                                           point_pairs);
+  state.ComputeContactSurfacesWithFallback(
+      representation, surfaces, point_pairs, proximity_parallelism());
 }
 
 template <typename T>
@@ -185,7 +188,8 @@ QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
+  return state.ComputeSignedDistancePairwiseClosestPoints(
+      max_distance, proximity_parallelism());
 }
 
 template <typename T>
@@ -257,6 +261,16 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(
+    const std::vector<CameraImagesRequest>& requests) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.RenderImages(requests);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
@@ -278,6 +292,17 @@ const GeometryState<T>& QueryObject<T>::geometry_state() const {
   }
 }
 
+template <typename T>
+Parallelism QueryObject<T>::proximity_parallelism() const {
+  DRAKE_ASSERT_VOID(ThrowIfNotCallable());
+  if (context_) {
+    return Parallelism(
+        scene_graph_->get_config(*context_).proximity_query_num_threads);
+  } else {
+    return baked_proximity_parallelism_;
+  }
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
     (&QueryObject<T>::template ComputeContactSurfaces<T>,
      &QueryObject<T>::template ComputeContactSurfacesWithFallback<T>));
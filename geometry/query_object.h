@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include "drake/common/parallelism.h"
+#include "drake/geometry/camera_images_request.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/deformable_contact.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
@@ -50,6 +52,14 @@ class SceneGraph;
  will always reproduce the same query results. This baking process is not cheap
  and should not be done without consideration.
 
+ The all-pairs proximity queries (ComputePointPairPenetration(),
+ ComputeContactSurfaces(), ComputeContactSurfacesWithFallback(), and
+ ComputeSignedDistancePairwiseClosestPoints()) can evaluate the geometry pairs
+ found by the broadphase on multiple threads, as configured by
+ SceneGraphConfig::proximity_query_num_threads. The results are independent of
+ the number of threads. A baked %QueryObject uses the number of threads that was
+ configured when it was baked.
+
  @anchor query_object_precision_methodology
  <h2>Queries and scalar type</h2>
 
@@ -912,6 +922,22 @@ class QueryObject {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Renders the images of any number of cameras, all against a single update
+   of the geometry poses. The result is the same as calling the
+   Render*Image() methods above for each requested image, but every render
+   engine receives all of its images in a single call to
+   RenderEngine::RenderImages(), so that it can amortize its work over all of
+   the cameras. This is the preferred way to render many cameras at the same
+   time (e.g., the sensors of a robot cell).
+
+   @param requests  The cameras and their output images; see
+                    CameraImagesRequest.
+   @throws std::exception if any request names a renderer that doesn't exist,
+                          or if any requested image lacks a camera or has a
+                          size inconsistent with its camera. In that case, no
+                          images are rendered by the offending renderer. */
+  void RenderImages(const std::vector<CameraImagesRequest>& requests) const;
+
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
   const render::RenderEngine* GetRenderEngineByName(
@@ -929,6 +955,11 @@ class QueryObject {
   // @pre ThrowIfNotCallable() has been invoked prior to this.
   const GeometryState<T>& geometry_state() const;
 
+  // Reports the parallelism for the all-pairs proximity queries; see
+  // SceneGraphConfig::proximity_query_num_threads.
+  // @pre ThrowIfNotCallable() has been invoked prior to this.
+  Parallelism proximity_parallelism() const;
+
   // Sets the query object to be *live*. That means the `context` and
   // `scene_graph` cannot be null.
   void set(const systems::Context<T>* context,
@@ -1025,6 +1056,10 @@ class QueryObject {
   // When a QueryObject is copied to a "baked" version, it contains a fully
   // updated GeometryState. Copies of bakes all share the same version.
   std::shared_ptr<const GeometryState<T>> state_{};
+
+  // When a QueryObject is copied to a "baked" version, the parallelism of the
+  // proximity queries configured in the live SceneGraph's context.
+  Parallelism baked_proximity_parallelism_{};
 };
 
 }  // namespace geometry
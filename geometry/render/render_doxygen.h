@@ -16,7 +16,7 @@ namespace render {
  three types of images: color, depth, and label. (For more details about the
  API, refer to the RenderEngine documentation.)
 
- Drake includes *three* implementations of that API:
+ Drake includes *four* implementations of that API:
 
    - RenderEngineVtk - A GPU-based rasterization renderer using the VTK library.
    - RenderEngineGl - A GPU-based rasterization renderer using direct calls to
@@ -24,6 +24,8 @@ namespace render {
    - RenderEngineGltfClient - An implementation of a client-server RPC renderer
                               that broadcasts Drake's visual state in a glTF
                               file.
+   - RenderEngineCpu - A CPU-based rasterization renderer that requires no
+                       graphics hardware or display.
 
  These implementations differ mostly in performance and flexibility.
  RenderEngineVtk is slower but has the possibility of leveraging the full VTK
@@ -32,7 +34,8 @@ namespace render {
  barebones rendering pipeline. RenderEngineGltfClient can connect to a server
  backed by arbitrary rendering technology with the potential of producing the
  highest fidelity images possible, but with a much higher latency on producing
- individual images.
+ individual images. RenderEngineCpu is intended for depth and label images on
+ headless machines; its color images are only flat shaded.
 
  Picking the right renderer for your simulated sensors will be based on
  considering those differences and picking the trade-off that best suits your
@@ -60,6 +63,8 @@ namespace render {
    - geometry::RenderEngineVtkParams and geometry::MakeRenderEngineVtk().
    - geometry::RenderEngineGltfClientParams and
      geometry::MakeRenderEngineGltfClient().
+   - geometry::RenderEngineCpuParams and geometry::MakeRenderEngineCpu(). (This
+     engine can't yet be selected by systems::sensors::CameraConfig.)
 
 
  <h2>Performance</h2>
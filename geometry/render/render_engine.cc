@@ -160,6 +160,51 @@ void RenderEngine::DoUpdateDeformableConfigurations(
     GeometryId, const std::vector<VectorX<double>>&,
     const std::vector<VectorX<double>>&) {}
 
+void RenderEngine::RenderImages(
+    const std::vector<RenderImagesRequest>& requests) {
+  for (const RenderImagesRequest& request : requests) {
+    const bool needs_color =
+        request.color_image != nullptr || request.label_image != nullptr;
+    if (needs_color && request.color_camera == nullptr) {
+      throw std::logic_error(
+          "Can't render a color or label image without a color camera");
+    }
+    if (request.depth_image != nullptr && request.depth_camera == nullptr) {
+      throw std::logic_error(
+          "Can't render a depth image without a depth camera");
+    }
+    if (request.color_image != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.color_image, "color");
+    }
+    if (request.depth_image != nullptr) {
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image, "depth");
+    }
+    if (request.label_image != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.label_image, "label");
+    }
+  }
+  DoRenderImages(requests);
+}
+
+void RenderEngine::DoRenderImages(
+    const std::vector<RenderImagesRequest>& requests) {
+  for (const RenderImagesRequest& request : requests) {
+    UpdateViewpoint(request.X_WR);
+    if (request.color_image != nullptr) {
+      DoRenderColorImage(*request.color_camera, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      DoRenderDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      DoRenderLabelImage(*request.color_camera, request.label_image);
+    }
+  }
+}
+
 void RenderEngine::DoRenderColorImage(const ColorRenderCamera&,
                                       ImageRgba8U*) const {
   throw std::runtime_error(
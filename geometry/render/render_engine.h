@@ -26,6 +26,22 @@ namespace drake {
 namespace geometry {
 namespace render {
 
+/** The images to render from a single viewpoint as part of a call to
+ RenderEngine::RenderImages(). Any of the output images can be `nullptr`, in
+ which case that image is not rendered. The color camera is used for both the
+ color and the label image; a camera is only required if one of the images it
+ is used for is requested. None of the pointers are owned by the request.  */
+struct RenderImagesRequest {
+  /** The pose of the renderer's viewpoint in the world frame (as would be
+   passed to RenderEngine::UpdateViewpoint()).  */
+  math::RigidTransformd X_WR;
+  const ColorRenderCamera* color_camera{};
+  const DepthRenderCamera* depth_camera{};
+  systems::sensors::ImageRgba8U* color_image{};
+  systems::sensors::ImageDepth32F* depth_image{};
+  systems::sensors::ImageLabel16I* label_image{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -298,6 +314,20 @@ class RenderEngine {
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** Renders the images of all the given `requests` against the current
+   poses of the registered geometry. This is equivalent to calling
+   UpdateViewpoint() followed by the Render*Image() methods for each request in
+   turn, but gives the engine the opportunity to amortize the work that
+   doesn't depend on the viewpoint (e.g., traversing the scene) over all of
+   the requests. Upon return, the renderer's viewpoint is that of the last
+   request.
+
+   All requests are validated before any image is rendered.
+   @throws std::exception if any requested image has no corresponding camera
+                          or its size doesn't match the size declared in its
+                          camera.  */
+  void RenderImages(const std::vector<RenderImagesRequest>& requests);
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
@@ -411,6 +441,15 @@ class RenderEngine {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for RenderImages(). When RenderImages calls this, it
+   has already confirmed that every requested image has a camera and that its
+   size is consistent with that camera's intrinsics.
+
+   The default implementation calls UpdateViewpoint() and the
+   DoRender*Image() methods for each request in turn. Derived classes can
+   override it to share work across the requests.  */
+  virtual void DoRenderImages(const std::vector<RenderImagesRequest>& requests);
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -468,6 +469,97 @@ GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
   });
 }
 
+// A RenderEngine that logs the calls it receives from the default
+// implementation of DoRenderImages().
+class LoggingEngine : public MinimumEngine {
+ public:
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) override {
+    log_.push_back(fmt::format("viewpoint {}", X_WR.translation().x()));
+  }
+
+  const std::vector<std::string>& log() const { return log_; }
+
+ private:
+  void DoRenderColorImage(const ColorRenderCamera& camera,
+                          ImageRgba8U*) const override {
+    log_.push_back(fmt::format("color {}", camera.core().renderer_name()));
+  }
+  void DoRenderDepthImage(const DepthRenderCamera& camera,
+                          ImageDepth32F*) const override {
+    log_.push_back(fmt::format("depth {}", camera.core().renderer_name()));
+  }
+  void DoRenderLabelImage(const ColorRenderCamera& camera,
+                          ImageLabel16I*) const override {
+    log_.push_back(fmt::format("label {}", camera.core().renderer_name()));
+  }
+
+  mutable std::vector<std::string> log_;
+};
+
+// The default implementation of the batched API renders the requested images
+// of each request in turn, after moving the viewpoint.
+GTEST_TEST(RenderEngine, RenderImagesDefault) {
+  LoggingEngine engine;
+  const CameraInfo intrinsics{2, 2, M_PI};
+  const ColorRenderCamera color_camera{
+      {"a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"b", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  ImageRgba8U color{2, 2};
+  ImageDepth32F depth{2, 2};
+  ImageLabel16I label{2, 2};
+
+  engine.RenderImages(
+      {{.X_WR = RigidTransformd(Vector3d(1, 0, 0)),
+        .color_camera = &color_camera,
+        .depth_camera = &depth_camera,
+        .color_image = &color,
+        .depth_image = &depth,
+        .label_image = &label},
+       {.X_WR = RigidTransformd(Vector3d(2, 0, 0)),
+        .depth_camera = &depth_camera,
+        .depth_image = &depth}});
+  const std::vector<std::string> expected{"viewpoint 1", "color a", "depth b",
+                                          "label a",     "viewpoint 2",
+                                          "depth b"};
+  EXPECT_EQ(engine.log(), expected);
+}
+
+// The batched API validates all of the requests before rendering anything.
+GTEST_TEST(RenderEngine, RenderImagesValidation) {
+  LoggingEngine engine;
+  const CameraInfo intrinsics{2, 2, M_PI};
+  const ColorRenderCamera color_camera{
+      {"a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"b", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  ImageRgba8U color{2, 2};
+  ImageDepth32F depth{2, 2};
+  ImageLabel16I label{2, 2};
+  ImageLabel16I bad_label{1, 2};
+
+  const RenderImagesRequest good{.color_camera = &color_camera,
+                                 .depth_camera = &depth_camera,
+                                 .color_image = &color,
+                                 .depth_image = &depth,
+                                 .label_image = &label};
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({good, {.label_image = &label}}),
+      "Can't render a color or label image without a color camera");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages({good, {.depth_image = &depth}}),
+      "Can't render a depth image without a depth camera");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine.RenderImages(
+          {good, {.color_camera = &color_camera, .label_image = &bad_label}}),
+      "The label image to write has a size different .*");
+  EXPECT_TRUE(engine.log().empty());
+
+  // An empty request is valid, and does nothing but set the viewpoint.
+  engine.RenderImages({RenderImagesRequest{}});
+  EXPECT_EQ(engine.log(), std::vector<std::string>{"viewpoint 0"});
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable
 // with both a copy constructor *and* a valid DoClone() implementation.
 class CloneableEngine : public MinimumEngine {
@@ -0,0 +1,17 @@
+#include "drake/geometry/render_cpu/factory.h"
+
+#include <utility>
+
+#include "drake/geometry/render_cpu/internal_render_engine_cpu.h"
+
+namespace drake {
+namespace geometry {
+
+std::unique_ptr<render::RenderEngine> MakeRenderEngineCpu(
+    RenderEngineCpuParams params) {
+  return std::make_unique<render_cpu::internal::RenderEngineCpu>(
+      std::move(params));
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render_cpu/render_engine_cpu_params.h"
+
+namespace drake {
+namespace geometry {
+
+/** Constructs a RenderEngine implementation which rasterizes triangles
+ directly on the CPU. It requires no graphics hardware, drivers, or display,
+ which makes it well suited to headless machines (e.g., for batch data
+ generation or continuous integration).
+
+ The engine is primarily intended for depth and label images. For those
+ images, it agrees with RenderEngineVtk and RenderEngineGl up to differences
+ in the tessellation of primitive shapes and in the sampling of pixels along
+ the edges of geometries. Color images are supported as well, but only with
+ flat shading: each triangle is lit by a single directional light fixed to the
+ camera (as with the default light of the other engines) and colored with its
+ diffuse color. Textures, transparency, and user-specified lights are not
+ supported.
+
+ Every primitive Shape is supported, as are Convex (rendered as its convex
+ hull) and Mesh specifications which use .obj files. Meshes of other types
+ are ignored with a warning.
+
+ Each image is split into tiles which can be rasterized concurrently; see
+ RenderEngineCpuParams::num_threads.
+
+ <b> Using RenderEngineCpu in multiple threads </b>
+
+ A single %RenderEngineCpu should not be exercised in multiple threads. A
+ %RenderEngineCpu instance and its clones can be used in different threads
+ simultaneously, so long as each thread only renders with its own instance.
+
+ @throws std::exception if params.num_threads is not positive. */
+std::unique_ptr<render::RenderEngine> MakeRenderEngineCpu(
+    RenderEngineCpuParams params = {});
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,246 @@
+#include "drake/geometry/render_cpu/internal_rasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/ssize.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+/* The edge length (in pixels) of the square tiles the image is split into. */
+constexpr int kTileSize = 64;
+
+/* A triangle projected into the image, ready for scan conversion. The three
+ barycentric coordinates and the inverse depth are all affine functions of the
+ image coordinates (u, v), f(u, v) = a * u + b * v + c. The barycentric
+ coordinates are normalized by the signed area, so a pixel is covered iff all
+ three are non-negative, regardless of the triangle's winding. */
+struct ScreenTriangle {
+  std::array<double, 3> a{};
+  std::array<double, 3> b{};
+  std::array<double, 3> c{};
+  /* The coefficients of the inverse depth. */
+  double w_a{};
+  double w_b{};
+  double w_c{};
+  /* The inclusive range of pixels whose centers may be covered, clamped to
+   the image. */
+  int x_min{};
+  int x_max{};
+  int y_min{};
+  int y_max{};
+  int32_t payload{};
+  bool valid{false};
+};
+
+/* Clips the triangle p against the plane z = near, keeping the part with
+ z >= near. The result is a convex polygon written to `out`; the return value
+ is its number of vertices: 0, 3, or 4. */
+int ClipAgainstNearPlane(const std::array<Vector3d, 3>& p, double near,
+                         std::array<Vector3d, 4>* out) {
+  int count = 0;
+  for (int i = 0; i < 3; ++i) {
+    const Vector3d& current = p[i];
+    const Vector3d& next = p[(i + 1) % 3];
+    const bool current_inside = current.z() >= near;
+    const bool next_inside = next.z() >= near;
+    if (current_inside) (*out)[count++] = current;
+    if (current_inside != next_inside) {
+      const double t = (near - current.z()) / (next.z() - current.z());
+      Vector3d crossing = current + t * (next - current);
+      crossing.z() = near;
+      (*out)[count++] = crossing;
+    }
+  }
+  return count;
+}
+
+/* Projects the triangle with vertices p0, p1, p2 (in the camera frame, with
+ z >= near) and computes its scan conversion data. The returned triangle is
+ marked invalid if it is degenerate or covers no pixel centers. */
+ScreenTriangle SetUpTriangle(const RasterCamera& camera, const Vector3d& p0,
+                             const Vector3d& p1, const Vector3d& p2,
+                             int32_t payload) {
+  ScreenTriangle result;
+  const std::array<const Vector3d*, 3> p{&p0, &p1, &p2};
+  std::array<double, 3> u, v, w;
+  for (int i = 0; i < 3; ++i) {
+    w[i] = 1.0 / p[i]->z();
+    u[i] = camera.focal_x * p[i]->x() * w[i] + camera.center_x;
+    v[i] = camera.focal_y * p[i]->y() * w[i] + camera.center_y;
+  }
+  // Twice the signed area of the projected triangle.
+  const double area = (u[1] - u[0]) * (v[2] - v[0]) -
+                      (v[1] - v[0]) * (u[2] - u[0]);
+  if (!(std::abs(area) > 1e-12)) return result;
+
+  // The barycentric coordinate of vertex i is the signed area of the triangle
+  // formed by the opposite edge (j, k) and the point (u, v), over the area.
+  for (int i = 0; i < 3; ++i) {
+    const int j = (i + 1) % 3;
+    const int k = (i + 2) % 3;
+    result.a[i] = -(v[k] - v[j]) / area;
+    result.b[i] = (u[k] - u[j]) / area;
+    result.c[i] = ((v[k] - v[j]) * u[j] - (u[k] - u[j]) * v[j]) / area;
+    result.w_a += result.a[i] * w[i];
+    result.w_b += result.b[i] * w[i];
+    result.w_c += result.c[i] * w[i];
+  }
+
+  // Pixel x samples at x + 0.5; find the pixels whose centers lie within the
+  // triangle's bounding box.
+  const auto [u_min, u_max] = std::minmax({u[0], u[1], u[2]});
+  const auto [v_min, v_max] = std::minmax({v[0], v[1], v[2]});
+  const double x_lo = std::max(std::ceil(u_min - 0.5), 0.0);
+  const double x_hi = std::min(std::floor(u_max - 0.5), camera.width - 1.0);
+  const double y_lo = std::max(std::ceil(v_min - 0.5), 0.0);
+  const double y_hi = std::min(std::floor(v_max - 0.5), camera.height - 1.0);
+  if (x_lo > x_hi || y_lo > y_hi) return result;
+  result.x_min = static_cast<int>(x_lo);
+  result.x_max = static_cast<int>(x_hi);
+  result.y_min = static_cast<int>(y_lo);
+  result.y_max = static_cast<int>(y_hi);
+  result.payload = payload;
+  result.valid = true;
+  return result;
+}
+
+/* Scan converts `triangle` into the part of the image within the pixel range
+ [x_begin, x_end) × [y_begin, y_end). */
+void RasterizeTriangleInRegion(const ScreenTriangle& triangle,
+                               float inverse_far, int width, int x_begin,
+                               int x_end, int y_begin, int y_end,
+                               float* inverse_depth, int32_t* payload) {
+  const int x0 = std::max(triangle.x_min, x_begin);
+  const int x1 = std::min(triangle.x_max + 1, x_end);
+  const int y0 = std::max(triangle.y_min, y_begin);
+  const int y1 = std::min(triangle.y_max + 1, y_end);
+  if (x0 >= x1 || y0 >= y1) return;
+  const int count = x1 - x0;
+  const float a0 = triangle.a[0];
+  const float a1 = triangle.a[1];
+  const float a2 = triangle.a[2];
+  const float w_a = triangle.w_a;
+  const int32_t value = triangle.payload;
+  // Evaluate the affine functions at the first pixel center of each row in
+  // double precision, and step along the row in single precision; the row is
+  // short, so the accumulated error stays small.
+  const double u0 = x0 + 0.5;
+  for (int y = y0; y < y1; ++y) {
+    const double v = y + 0.5;
+    const float e0 = triangle.a[0] * u0 + triangle.b[0] * v + triangle.c[0];
+    const float e1 = triangle.a[1] * u0 + triangle.b[1] * v + triangle.c[1];
+    const float e2 = triangle.a[2] * u0 + triangle.b[2] * v + triangle.c[2];
+    const float w = triangle.w_a * u0 + triangle.w_b * v + triangle.w_c;
+    float* row_depth = inverse_depth + y * width + x0;
+    int32_t* row_payload = payload + y * width + x0;
+    // Keep this loop free of branches so that it vectorizes.
+    for (int k = 0; k < count; ++k) {
+      const float step = static_cast<float>(k);
+      const float b0 = e0 + a0 * step;
+      const float b1 = e1 + a1 * step;
+      const float b2 = e2 + a2 * step;
+      const float w_k = w + w_a * step;
+      const bool covered = (b0 >= 0.0f) & (b1 >= 0.0f) & (b2 >= 0.0f) &
+                           (w_k > row_depth[k]) & (w_k >= inverse_far);
+      row_depth[k] = covered ? w_k : row_depth[k];
+      row_payload[k] = covered ? value : row_payload[k];
+    }
+  }
+}
+
+}  // namespace
+
+void Rasterize(const RasterCamera& camera,
+               const std::vector<Vector3<float>>& vertices_C,
+               const std::vector<RasterTriangle>& triangles,
+               int32_t background, Parallelism parallelism,
+               RasterImage* image) {
+  DRAKE_DEMAND(image != nullptr);
+  DRAKE_DEMAND(0 < camera.near && camera.near < camera.far);
+  const int width = camera.width;
+  const int height = camera.height;
+  image->inverse_depth.assign(width * height, 0.0f);
+  image->payload.assign(width * height, background);
+  [[maybe_unused]] const int num_threads = parallelism.num_threads();
+
+  // Set up every triangle. Clipping against the near plane produces at most
+  // two triangles, so input triangle t owns the slots 2t and 2t + 1.
+  const int num_triangles = static_cast<int>(triangles.size());
+  std::vector<ScreenTriangle> screen_triangles(2 * num_triangles);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+  for (int t = 0; t < num_triangles; ++t) {
+    const RasterTriangle& triangle = triangles[t];
+    std::array<Vector3d, 3> p;
+    for (int i = 0; i < 3; ++i) {
+      DRAKE_ASSERT(0 <= triangle.vertices[i] &&
+                   triangle.vertices[i] < ssize(vertices_C));
+      p[i] = vertices_C[triangle.vertices[i]].cast<double>();
+    }
+    if (p[0].z() > camera.far && p[1].z() > camera.far &&
+        p[2].z() > camera.far) {
+      continue;
+    }
+    std::array<Vector3d, 4> polygon;
+    const int num_vertices = ClipAgainstNearPlane(p, camera.near, &polygon);
+    if (num_vertices >= 3) {
+      screen_triangles[2 * t] = SetUpTriangle(
+          camera, polygon[0], polygon[1], polygon[2], triangle.payload);
+    }
+    if (num_vertices == 4) {
+      screen_triangles[2 * t + 1] = SetUpTriangle(
+          camera, polygon[0], polygon[2], polygon[3], triangle.payload);
+    }
+  }
+
+  // Bin the triangles into the tiles overlapped by their bounding boxes. We
+  // visit the triangles in order so that every tile's list is in order, too.
+  const int tiles_x = (width + kTileSize - 1) / kTileSize;
+  const int tiles_y = (height + kTileSize - 1) / kTileSize;
+  std::vector<std::vector<int>> bins(tiles_x * tiles_y);
+  for (int s = 0; s < ssize(screen_triangles); ++s) {
+    const ScreenTriangle& triangle = screen_triangles[s];
+    if (!triangle.valid) continue;
+    for (int ty = triangle.y_min / kTileSize; ty <= triangle.y_max / kTileSize;
+         ++ty) {
+      for (int tx = triangle.x_min / kTileSize;
+           tx <= triangle.x_max / kTileSize; ++tx) {
+        bins[ty * tiles_x + tx].push_back(s);
+      }
+    }
+  }
+
+  // Rasterize the tiles. Each tile writes a disjoint set of pixels.
+  const float inverse_far = static_cast<float>(1.0 / camera.far);
+  float* const inverse_depth = image->inverse_depth.data();
+  int32_t* const payload = image->payload.data();
+  const int num_tiles = tiles_x * tiles_y;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int tile = 0; tile < num_tiles; ++tile) {
+    const int x_begin = (tile % tiles_x) * kTileSize;
+    const int y_begin = (tile / tiles_x) * kTileSize;
+    const int x_end = std::min(x_begin + kTileSize, width);
+    const int y_end = std::min(y_begin + kTileSize, height);
+    for (const int s : bins[tile]) {
+      RasterizeTriangleInRegion(screen_triangles[s], inverse_far, width,
+                                x_begin, x_end, y_begin, y_end, inverse_depth,
+                                payload);
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+
+/* The pinhole model and clipping range used for a single rasterization. The
+ camera frame C follows the RenderEngine convention: X-right, Y-down, and
+ Z-forward. A point p_CP projects to the continuous image coordinates
+
+   u = focal_x * x / z + center_x,  v = focal_y * y / z + center_y,
+
+ and pixel (i, j) samples the image at its center (i + 0.5, j + 0.5). This is
+ the same mapping the OpenGL-based engines realize with
+ RenderCameraCore::CalcProjectionMatrix(). */
+struct RasterCamera {
+  int width{};
+  int height{};
+  double focal_x{};
+  double focal_y{};
+  double center_x{};
+  double center_y{};
+  /* Surfaces closer than `near` are clipped away and surfaces farther than
+   `far` are discarded. */
+  double near{};
+  double far{};
+};
+
+/* A triangle to rasterize, referencing three vertices by index. The `payload`
+ is an arbitrary value (e.g., a label or a packed color) reported for every
+ pixel in which this triangle is the nearest surface. The winding of the
+ vertices doesn't matter; both sides of a triangle are rasterized. */
+struct RasterTriangle {
+  std::array<int, 3> vertices;
+  int32_t payload{};
+};
+
+/* The per-pixel output of Rasterize(). Both vectors are stored in row-major
+ order (i.e., pixel (i, j) is at index j * width + i), like the images in
+ systems::sensors::Image. */
+struct RasterImage {
+  /* The inverse of the depth (z_C) of the nearest surface, or zero if no
+   surface covers the pixel. The inverse depth is what varies linearly in
+   image space, so it is what we interpolate and compare. */
+  std::vector<float> inverse_depth;
+  /* The payload of the nearest triangle, or the background value passed to
+   Rasterize() if no surface covers the pixel. */
+  std::vector<int32_t> payload;
+};
+
+/* Rasterizes the given triangles into `image`, resolving visibility with a
+ depth test.
+
+ The image is split into square tiles. Each triangle is first clipped against
+ the near plane, projected, and binned into the tiles its bounding box overlaps
+ (in the order given). The tiles are then rasterized independently, so that
+ they can be processed concurrently. Because each tile processes its triangles
+ in the same order regardless of which thread does the work, the result is
+ independent of the degree of parallelism. Within a tile, the inner loop
+ evaluates the edge functions and the inverse depth for a run of pixels without
+ branches so that the compiler can vectorize it.
+
+ @param camera       The camera model; width and height determine the size of
+                     the output.
+ @param vertices_C   The vertex positions, measured and expressed in the
+                     camera frame C.
+ @param triangles    The triangles to rasterize.
+ @param background   The payload reported for pixels no triangle covers.
+ @param parallelism  The number of threads used to rasterize the tiles.
+ @param[out] image   The rasterized result; it is resized as necessary.
+ @pre 0 < camera.near < camera.far.
+ @pre Every vertex index is a valid index into `vertices_C`. */
+void Rasterize(const RasterCamera& camera,
+               const std::vector<Vector3<float>>& vertices_C,
+               const std::vector<RasterTriangle>& triangles,
+               int32_t background, Parallelism parallelism,
+               RasterImage* image);
+
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
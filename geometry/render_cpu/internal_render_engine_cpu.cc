@@ -0,0 +1,513 @@
+#include "drake/geometry/render_cpu/internal_render_engine_cpu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/diagnostic_policy.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/ssize.h"
+#include "drake/common/text_logging.h"
+#include "drake/common/yaml/yaml_io.h"
+#include "drake/geometry/proximity/polygon_to_triangle_mesh.h"
+#include "drake/geometry/render_gl/internal_shape_meshes.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using geometry::internal::LoadRenderMeshesFromObj;
+using geometry::internal::RenderMaterial;
+using geometry::internal::RenderMesh;
+using math::RigidTransformd;
+using render::ColorRenderCamera;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using render_gl::internal::MakeCapsule;
+using render_gl::internal::MakeLongLatUnitSphere;
+using render_gl::internal::MakeSquarePatch;
+using render_gl::internal::MakeUnitBox;
+using render_gl::internal::MakeUnitCylinder;
+using std::string;
+using std::unique_ptr;
+using std::vector;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Given a mesh source, this produces a string that we use in our maps to
+// guarantee we only load the mesh once. (This mirrors RenderEngineGl.)
+std::string GetPathKey(const MeshSource& mesh_source, bool is_convex) {
+  std::string prefix;
+  if (mesh_source.is_in_memory()) {
+    prefix = mesh_source.in_memory().mesh_file.sha256().to_string();
+  } else {
+    DRAKE_DEMAND(mesh_source.is_path());
+    prefix = mesh_source.path().string();
+    std::error_code path_error;
+    const fs::path path = fs::canonical(mesh_source.path(), path_error);
+    if (path_error) {
+      throw std::runtime_error(
+          fmt::format("RenderEngineCpu: unable to access the file {}; {}",
+                      prefix, path_error.message()));
+    }
+  }
+  // Note: We're using "?". It isn't valid for filenames, so using it in the
+  // key guarantees we won't collide with potential file names.
+  return prefix + (is_convex ? "?convex" : "");
+}
+
+uint8_t ToByte(double channel) {
+  return static_cast<uint8_t>(std::lround(std::clamp(channel, 0.0, 1.0) * 255));
+}
+
+// Packs the given color, with its rgb channels scaled by `intensity`, into a
+// raster payload: one byte per channel, with red in the least significant byte.
+int32_t PackColor(const Rgba& color, double intensity) {
+  const uint32_t packed = ToByte(color.r() * intensity) |
+                          (ToByte(color.g() * intensity) << 8) |
+                          (ToByte(color.b() * intensity) << 16) |
+                          (static_cast<uint32_t>(ToByte(color.a())) << 24);
+  return static_cast<int32_t>(packed);
+}
+
+// The inverse of PackColor().
+void UnpackColor(int32_t payload, uint8_t* rgba) {
+  const uint32_t packed = static_cast<uint32_t>(payload);
+  for (int c = 0; c < 4; ++c) {
+    rgba[c] = static_cast<uint8_t>(packed >> (8 * c));
+  }
+}
+
+RasterCamera MakeRasterCamera(const RenderCameraCore& core) {
+  const systems::sensors::CameraInfo& intrinsics = core.intrinsics();
+  return RasterCamera{.width = intrinsics.width(),
+                      .height = intrinsics.height(),
+                      .focal_x = intrinsics.focal_x(),
+                      .focal_y = intrinsics.focal_y(),
+                      .center_x = intrinsics.center_x(),
+                      .center_y = intrinsics.center_y(),
+                      .near = core.clipping().near(),
+                      .far = core.clipping().far()};
+}
+
+}  // namespace
+
+RenderEngineCpu::RenderEngineCpu(RenderEngineCpuParams params)
+    : RenderEngine(RenderLabel::kDontCare), parameters_(std::move(params)) {
+  if (parameters_.num_threads < 1) {
+    throw std::logic_error(
+        fmt::format("RenderEngineCpu requires a positive number of threads; "
+                    "{} specified.",
+                    parameters_.num_threads));
+  }
+}
+
+RenderEngineCpu::~RenderEngineCpu() = default;
+
+void RenderEngineCpu::UpdateViewpoint(const RigidTransformd& X_WR) {
+  X_CW_ = X_WR.inverse();
+}
+
+void RenderEngineCpu::ImplementGeometry(const Box& box, void* user_data) {
+  AddInstance(GetBox(), Vector3d(box.width(), box.depth(), box.height()),
+              static_cast<RegistrationData*>(user_data));
+}
+
+void RenderEngineCpu::ImplementGeometry(const Capsule& capsule,
+                                        void* user_data) {
+  const int resolution = 50;
+  const int mesh_index =
+      AddMesh(MakeCapsule(resolution, capsule.radius(), capsule.length()));
+  AddInstance(mesh_index, Vector3d::Ones(),
+              static_cast<RegistrationData*>(user_data));
+}
+
+void RenderEngineCpu::ImplementGeometry(const Convex& convex, void* user_data) {
+  const std::string file_key = GetPathKey(convex.source(), /*is_convex=*/true);
+  if (!file_meshes_.contains(file_key)) {
+    const bool unscaled = (convex.scale3().array() == 1.0).all();
+    // We store a hull of the mesh's *unscaled* vertices (applying a particular
+    // instance's scale when rendering that instance).
+    const TriangleSurfaceMesh<double> tri_hull =
+        geometry::internal::MakeTriangleFromPolygonMesh(
+            unscaled ? convex.GetConvexHull()
+                     : Convex(convex.source()).GetConvexHull());
+    const int mesh_index = AddMesh(
+        geometry::internal::MakeFacetedRenderMeshFromTriangleSurfaceMesh(
+            tri_hull, PerceptionProperties()));
+    file_meshes_[file_key] = {{.mesh_index = mesh_index}};
+  }
+  for (const FileMesh& file_mesh : file_meshes_.at(file_key)) {
+    AddInstance(file_mesh.mesh_index, convex.scale3(),
+                static_cast<RegistrationData*>(user_data));
+  }
+}
+
+void RenderEngineCpu::ImplementGeometry(const Cylinder& cylinder,
+                                        void* user_data) {
+  const double r = cylinder.radius();
+  const double l = cylinder.length();
+  AddInstance(GetCylinder(), Vector3d(r, r, l),
+              static_cast<RegistrationData*>(user_data));
+}
+
+void RenderEngineCpu::ImplementGeometry(const Ellipsoid& ellipsoid,
+                                        void* user_data) {
+  AddInstance(GetSphere(),
+              Vector3d(ellipsoid.a(), ellipsoid.b(), ellipsoid.c()),
+              static_cast<RegistrationData*>(user_data));
+}
+
+void RenderEngineCpu::ImplementGeometry(const HalfSpace&, void* user_data) {
+  AddInstance(GetHalfSpace(), Vector3d::Ones(),
+              static_cast<RegistrationData*>(user_data));
+}
+
+void RenderEngineCpu::ImplementGeometry(const Mesh& mesh, void* user_data) {
+  RegistrationData* data = static_cast<RegistrationData*>(user_data);
+  CacheFileMeshesMaybe(mesh.source(), data);
+  if (!data->accepted) return;
+  const std::string file_key = GetPathKey(mesh.source(), /*is_convex=*/false);
+  for (const FileMesh& file_mesh : file_meshes_.at(file_key)) {
+    AddInstance(file_mesh.mesh_index, mesh.scale3(), data, file_mesh.diffuse);
+  }
+}
+
+void RenderEngineCpu::ImplementGeometry(const Sphere& sphere, void* user_data) {
+  const double r = sphere.radius();
+  AddInstance(GetSphere(), Vector3d(r, r, r),
+              static_cast<RegistrationData*>(user_data));
+}
+
+bool RenderEngineCpu::DoRegisterVisual(GeometryId id, const Shape& shape,
+                                       const PerceptionProperties& properties,
+                                       const RigidTransformd& X_WG) {
+  RegistrationData data{.id = id, .properties = properties};
+  shape.Reify(this, &data);
+  if (data.accepted) {
+    visuals_[id].X_WG = X_WG;
+  }
+  return data.accepted;
+}
+
+bool RenderEngineCpu::DoRegisterDeformableVisual(
+    GeometryId id, const std::vector<RenderMesh>& render_meshes,
+    const PerceptionProperties& properties) {
+  RegistrationData data{.id = id, .properties = properties};
+  std::vector<int> mesh_indices;
+  for (const auto& render_mesh : render_meshes) {
+    const int mesh_index = AddMesh(render_mesh);
+    mesh_indices.push_back(mesh_index);
+    std::optional<Rgba> diffuse;
+    if (render_mesh.material.has_value()) {
+      diffuse = render_mesh.material->diffuse;
+    }
+    AddInstance(mesh_index, Vector3d::Ones(), &data, diffuse);
+  }
+  visuals_[id].X_WG = RigidTransformd::Identity();
+  deformable_meshes_.emplace(id, std::move(mesh_indices));
+  return true;
+}
+
+void RenderEngineCpu::DoUpdateVisualPose(GeometryId id,
+                                         const RigidTransformd& X_WG) {
+  visuals_.at(id).X_WG = X_WG;
+}
+
+void RenderEngineCpu::DoUpdateDeformableConfigurations(
+    GeometryId id, const std::vector<VectorX<double>>& q_WGs,
+    const std::vector<VectorX<double>>&) {
+  DRAKE_DEMAND(deformable_meshes_.contains(id));
+  const std::vector<int>& mesh_indices = deformable_meshes_.at(id);
+  DRAKE_DEMAND(q_WGs.size() == mesh_indices.size());
+  for (int i = 0; i < ssize(q_WGs); ++i) {
+    std::shared_ptr<CpuMesh>& mesh = meshes_.at(mesh_indices[i]);
+    // The mesh may be shared with a clone; copy it before writing to it.
+    if (mesh.use_count() > 1) {
+      mesh = std::make_shared<CpuMesh>(*mesh);
+    }
+    DRAKE_DEMAND(q_WGs[i].size() == 3 * ssize(mesh->positions));
+    for (int v = 0; v < ssize(mesh->positions); ++v) {
+      mesh->positions[v] = q_WGs[i].segment<3>(3 * v);
+    }
+  }
+}
+
+bool RenderEngineCpu::DoRemoveGeometry(GeometryId id) {
+  deformable_meshes_.erase(id);
+  return visuals_.erase(id) > 0;
+}
+
+unique_ptr<RenderEngine> RenderEngineCpu::DoClone() const {
+  return unique_ptr<RenderEngineCpu>(new RenderEngineCpu(*this));
+}
+
+void RenderEngineCpu::DoRenderColorImage(const ColorRenderCamera& camera,
+                                         ImageRgba8U* color_image_out) const {
+  PrepareScene();
+  PoseScene(X_CW_);
+  DrawColorImage(camera, color_image_out);
+}
+
+void RenderEngineCpu::DoRenderDepthImage(const DepthRenderCamera& camera,
+                                         ImageDepth32F* depth_image_out) const {
+  PrepareScene();
+  PoseScene(X_CW_);
+  DrawDepthImage(camera, depth_image_out);
+}
+
+void RenderEngineCpu::DoRenderLabelImage(const ColorRenderCamera& camera,
+                                         ImageLabel16I* label_image_out) const {
+  PrepareScene();
+  PoseScene(X_CW_);
+  DrawLabelImage(camera, label_image_out);
+}
+
+void RenderEngineCpu::DoRenderImages(
+    const vector<render::RenderImagesRequest>& requests) {
+  // The world-frame scene is shared by all requests, and the camera-frame
+  // scene by all of the images of a single request.
+  PrepareScene();
+  for (const render::RenderImagesRequest& request : requests) {
+    UpdateViewpoint(request.X_WR);
+    PoseScene(X_CW_);
+    if (request.color_image != nullptr) {
+      DrawColorImage(*request.color_camera, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      DrawDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      DrawLabelImage(*request.color_camera, request.label_image);
+    }
+  }
+}
+
+std::string RenderEngineCpu::DoGetParameterYaml() const {
+  return yaml::SaveYamlString(parameters_, "RenderEngineCpuParams");
+}
+
+void RenderEngineCpu::PrepareScene() const {
+  vertices_W_.clear();
+  scene_triangles_.clear();
+  for (const auto& [_, visual] : visuals_) {
+    for (const Instance& instance : visual.instances) {
+      const CpuMesh& mesh = *meshes_[instance.mesh_index];
+      // The affine map from the scaled mesh frame to the world frame.
+      const Matrix3d A_WM =
+          visual.X_WG.rotation().matrix() * instance.scale.asDiagonal();
+      const Vector3d& p_WG = visual.X_WG.translation();
+      const int offset = ssize(vertices_W_);
+      for (const Vector3d& p_MV : mesh.positions) {
+        vertices_W_.push_back(A_WM * p_MV + p_WG);
+      }
+      for (const auto& [a, b, c] : mesh.triangles) {
+        const Vector3d& p_WA = vertices_W_[offset + a];
+        const Vector3d n_W = (vertices_W_[offset + b] - p_WA)
+                                 .cross(vertices_W_[offset + c] - p_WA);
+        const double norm = n_W.norm();
+        scene_triangles_.push_back(SceneTriangle{
+            .vertices = {offset + a, offset + b, offset + c},
+            .unit_normal_W = norm > 0 ? n_W / norm : Vector3d::Zero().eval(),
+            .instance = &instance});
+      }
+    }
+  }
+}
+
+void RenderEngineCpu::PoseScene(const RigidTransformd& X_CW) const {
+  vertices_C_.resize(vertices_W_.size());
+  for (int v = 0; v < ssize(vertices_W_); ++v) {
+    vertices_C_[v] = (X_CW * vertices_W_[v]).cast<float>();
+  }
+  // The camera's view direction Cz, expressed in the world frame.
+  Cz_W_ = X_CW.rotation().row(2).transpose();
+}
+
+void RenderEngineCpu::DrawColorImage(const ColorRenderCamera& camera,
+                                     ImageRgba8U* color_image_out) const {
+  const int32_t background = PackColor(parameters_.default_clear_color, 1.0);
+  Draw(camera.core(), PayloadType::kColor, background);
+  const int width = color_image_out->width();
+  for (int v = 0; v < color_image_out->height(); ++v) {
+    for (int u = 0; u < width; ++u) {
+      UnpackColor(image_.payload[v * width + u], color_image_out->at(u, v));
+    }
+  }
+}
+
+void RenderEngineCpu::DrawDepthImage(const DepthRenderCamera& camera,
+                                     ImageDepth32F* depth_image_out) const {
+  Draw(camera.core(), PayloadType::kNone, 0);
+  // Depths outside the depth range are saturated to "too close" and "too far",
+  // as with the other engines. Pixels without a surface are "too far".
+  const float kTooClose = ImageTraits<PixelType::kDepth32F>::kTooClose;
+  const float kTooFar = ImageTraits<PixelType::kDepth32F>::kTooFar;
+  const float min_depth = camera.depth_range().min_depth();
+  const float max_depth = camera.depth_range().max_depth();
+  const int width = depth_image_out->width();
+  for (int v = 0; v < depth_image_out->height(); ++v) {
+    for (int u = 0; u < width; ++u) {
+      const float inverse_depth = image_.inverse_depth[v * width + u];
+      float depth = kTooFar;
+      if (inverse_depth > 0) {
+        depth = 1.0f / inverse_depth;
+        if (depth < min_depth) {
+          depth = kTooClose;
+        } else if (depth > max_depth) {
+          depth = kTooFar;
+        }
+      }
+      *depth_image_out->at(u, v) = depth;
+    }
+  }
+}
+
+void RenderEngineCpu::DrawLabelImage(const ColorRenderCamera& camera,
+                                     ImageLabel16I* label_image_out) const {
+  Draw(camera.core(), PayloadType::kLabel,
+       static_cast<RenderLabel::ValueType>(RenderLabel::kEmpty));
+  const int width = label_image_out->width();
+  for (int v = 0; v < label_image_out->height(); ++v) {
+    for (int u = 0; u < width; ++u) {
+      *label_image_out->at(u, v) =
+          static_cast<int16_t>(image_.payload[v * width + u]);
+    }
+  }
+}
+
+void RenderEngineCpu::Draw(const RenderCameraCore& camera,
+                           PayloadType payload_type, int32_t background) const {
+  triangles_.resize(scene_triangles_.size());
+  for (int t = 0; t < ssize(scene_triangles_); ++t) {
+    const SceneTriangle& triangle = scene_triangles_[t];
+    int32_t payload = 0;
+    if (payload_type == PayloadType::kLabel) {
+      payload = static_cast<RenderLabel::ValueType>(triangle.instance->label);
+    } else if (payload_type == PayloadType::kColor) {
+      // Flat Lambertian shading with a directional light along the camera's
+      // view direction Cz. Both sides of the triangle are lit.
+      const double intensity = std::abs(Cz_W_.dot(triangle.unit_normal_W));
+      payload = PackColor(triangle.instance->diffuse, intensity);
+    }
+    triangles_[t] = RasterTriangle{.vertices = triangle.vertices,
+                                   .payload = payload};
+  }
+  Rasterize(MakeRasterCamera(camera), vertices_C_, triangles_, background,
+            Parallelism(parameters_.num_threads), &image_);
+}
+
+void RenderEngineCpu::AddInstance(int mesh_index, const Vector3d& scale,
+                                  RegistrationData* data,
+                                  const std::optional<Rgba>& diffuse) {
+  DRAKE_DEMAND(0 <= mesh_index && mesh_index < ssize(meshes_));
+  visuals_[data->id].instances.push_back(Instance{
+      .mesh_index = mesh_index,
+      .scale = scale,
+      .diffuse = diffuse.value_or(data->properties.GetPropertyOrDefault(
+          "phong", "diffuse", parameters_.default_diffuse)),
+      .label = GetRenderLabelOrThrow(data->properties)});
+}
+
+int RenderEngineCpu::AddMesh(const RenderMesh& render_mesh) {
+  auto mesh = std::make_shared<CpuMesh>();
+  mesh->positions.reserve(render_mesh.positions.rows());
+  for (int v = 0; v < render_mesh.positions.rows(); ++v) {
+    mesh->positions.push_back(render_mesh.positions.row(v).transpose());
+  }
+  mesh->triangles.reserve(render_mesh.indices.rows());
+  for (int t = 0; t < render_mesh.indices.rows(); ++t) {
+    mesh->triangles.push_back({static_cast<int>(render_mesh.indices(t, 0)),
+                               static_cast<int>(render_mesh.indices(t, 1)),
+                               static_cast<int>(render_mesh.indices(t, 2))});
+  }
+  meshes_.push_back(std::move(mesh));
+  return ssize(meshes_) - 1;
+}
+
+int RenderEngineCpu::GetSphere() {
+  if (sphere_ < 0) {
+    const int kLatitudeBands = 50;
+    const int kLongitudeBands = 50;
+    sphere_ = AddMesh(MakeLongLatUnitSphere(kLongitudeBands, kLatitudeBands));
+  }
+  return sphere_;
+}
+
+int RenderEngineCpu::GetCylinder() {
+  if (cylinder_ < 0) {
+    const int kLongitudeBands = 50;
+    cylinder_ = AddMesh(MakeUnitCylinder(kLongitudeBands, 1));
+  }
+  return cylinder_;
+}
+
+int RenderEngineCpu::GetHalfSpace() {
+  if (half_space_ < 0) {
+    // This matches the RenderEngineVtk and RenderEngineGl half space size.
+    const double kMeasure = 100.0;
+    half_space_ = AddMesh(MakeSquarePatch(kMeasure, 1));
+  }
+  return half_space_;
+}
+
+int RenderEngineCpu::GetBox() {
+  if (box_ < 0) {
+    box_ = AddMesh(MakeUnitBox());
+  }
+  return box_;
+}
+
+void RenderEngineCpu::CacheFileMeshesMaybe(const MeshSource& mesh_source,
+                                           RegistrationData* data) {
+  if (mesh_source.extension() != ".obj") {
+    static const logging::Warn one_time(
+        "RenderEngineCpu only supports Mesh specifications which use .obj "
+        "files. Mesh specifications using other mesh types (e.g., .gltf, "
+        ".stl, .dae, etc.) will be ignored.");
+    data->accepted = false;
+    return;
+  }
+
+  const std::string file_key = GetPathKey(mesh_source, /* is_convex= */ false);
+  if (file_meshes_.contains(file_key)) return;
+
+  // As in RenderEngineGl, the material is only cached if the file itself
+  // defines it; otherwise every instance defines its own from its properties.
+  vector<FileMesh> file_meshes;
+  for (const RenderMesh& render_mesh : LoadRenderMeshesFromObj(
+           mesh_source, PerceptionProperties(), parameters_.default_diffuse,
+           drake::internal::DiagnosticPolicy())) {
+    FileMesh& file_mesh =
+        file_meshes.emplace_back(FileMesh{.mesh_index = AddMesh(render_mesh)});
+    DRAKE_DEMAND(render_mesh.material.has_value());
+    const RenderMaterial& material = *render_mesh.material;
+    if (material.from_mesh_file) {
+      file_mesh.diffuse = material.diffuse;
+    }
+  }
+  file_meshes_[file_key] = std::move(file_meshes);
+}
+
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/render/render_engine.h"
+#include "drake/geometry/render/render_mesh.h"
+#include "drake/geometry/render_cpu/internal_rasterizer.h"
+#include "drake/geometry/render_cpu/render_engine_cpu_params.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+
+/* See documentation of MakeRenderEngineCpu().
+
+ The engine stores every registered geometry as one or more instances of a
+ triangle mesh. Primitives share a single unit mesh per shape type, scaled per
+ instance (as RenderEngineGl does), and file meshes are loaded once per file.
+ Rendering happens in three stages: PrepareScene() poses every instance's
+ triangles in the world frame, PoseScene() transforms the resulting triangle
+ soup into the camera frame, and Draw() hands it to Rasterize(). The three image
+ types only differ in the per-triangle payload (nothing, the label, or the
+ shaded color) and in how the rasterized result is converted to the output
+ image. A single image runs all three stages, but RenderImages() prepares the
+ scene once for all cameras and poses it once for all images of a camera.
+
+ The mesh data is shared between an engine and its clones. A deformable
+ geometry's mesh is copied before it is first modified, so updating the
+ configuration of a clone doesn't affect the original (and vice versa). */
+class RenderEngineCpu final : public render::RenderEngine,
+                              private ShapeReifier {
+ public:
+  /* @name Does not allow public copy, move, or assignment  */
+  //@{
+  RenderEngineCpu& operator=(const RenderEngineCpu&) = delete;
+  RenderEngineCpu(RenderEngineCpu&&) = delete;
+  RenderEngineCpu& operator=(RenderEngineCpu&&) = delete;
+  //@}
+
+  /* Constructs an instance of the render engine with the given `params`.
+   @throws std::exception if params.num_threads is not positive.  */
+  explicit RenderEngineCpu(RenderEngineCpuParams params = {});
+
+  ~RenderEngineCpu() final;
+
+  /* @see RenderEngine::UpdateViewpoint().  */
+  void UpdateViewpoint(const math::RigidTransformd& X_WR) final;
+
+  const RenderEngineCpuParams& parameters() const { return parameters_; }
+
+  /* @name    Shape reification  */
+  //@{
+  using ShapeReifier::ImplementGeometry;
+  void ImplementGeometry(const Box& box, void* user_data) final;
+  void ImplementGeometry(const Capsule& capsule, void* user_data) final;
+  void ImplementGeometry(const Convex& convex, void* user_data) final;
+  void ImplementGeometry(const Cylinder& cylinder, void* user_data) final;
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void* user_data) final;
+  void ImplementGeometry(const HalfSpace& half_space, void* user_data) final;
+  void ImplementGeometry(const Mesh& mesh, void* user_data) final;
+  void ImplementGeometry(const Sphere& sphere, void* user_data) final;
+  //@}
+
+ private:
+  friend class RenderEngineCpuTester;
+
+  // Data to pass through the reification process.
+  struct RegistrationData {
+    const GeometryId id;
+    const PerceptionProperties& properties;
+    bool accepted{true};
+  };
+
+  /* The triangles of a mesh, with vertex positions measured and expressed in
+   the mesh's frame M.  */
+  struct CpuMesh {
+    std::vector<Vector3<double>> positions;
+    std::vector<std::array<int, 3>> triangles;
+  };
+
+  /* One of the meshes loaded from a file; the diffuse color is only defined if
+   the file's material specifies it.  */
+  struct FileMesh {
+    int mesh_index{};
+    std::optional<Rgba> diffuse;
+  };
+
+  /* A single mesh drawn on behalf of a geometry. The instance's mesh frame M
+   is aligned with the geometry frame G, but the mesh is scaled by `scale`
+   along each of the frame's axes.  */
+  struct Instance {
+    int mesh_index{};
+    Vector3<double> scale;
+    Rgba diffuse;
+    render::RenderLabel label;
+  };
+
+  /* All of the instances that comprise a single geometry.  */
+  struct Visual {
+    math::RigidTransformd X_WG;
+    std::vector<Instance> instances;
+  };
+
+  /* A triangle of the prepared scene; its vertices index into vertices_W_
+   (and vertices_C_). The normal is zero for degenerate triangles.  */
+  struct SceneTriangle {
+    std::array<int, 3> vertices;
+    Vector3<double> unit_normal_W;
+    const Instance* instance{};
+  };
+
+  /* The contents of the triangle payloads for each image type.  */
+  enum class PayloadType { kNone, kLabel, kColor };
+
+  bool DoRegisterVisual(GeometryId id, const Shape& shape,
+                        const PerceptionProperties& properties,
+                        const math::RigidTransformd& X_WG) final;
+
+  bool DoRegisterDeformableVisual(
+      GeometryId id,
+      const std::vector<geometry::internal::RenderMesh>& render_meshes,
+      const PerceptionProperties& properties) final;
+
+  void DoUpdateVisualPose(GeometryId id,
+                          const math::RigidTransformd& X_WG) final;
+
+  void DoUpdateDeformableConfigurations(
+      GeometryId id, const std::vector<VectorX<double>>& q_WGs,
+      const std::vector<VectorX<double>>& nhats_W) final;
+
+  bool DoRemoveGeometry(GeometryId id) final;
+
+  std::unique_ptr<RenderEngine> DoClone() const final;
+
+  void DoRenderColorImage(
+      const render::ColorRenderCamera& camera,
+      systems::sensors::ImageRgba8U* color_image_out) const final;
+
+  void DoRenderDepthImage(
+      const render::DepthRenderCamera& render_camera,
+      systems::sensors::ImageDepth32F* depth_image_out) const final;
+
+  void DoRenderLabelImage(
+      const render::ColorRenderCamera& camera,
+      systems::sensors::ImageLabel16I* label_image_out) const final;
+
+  void DoRenderImages(
+      const std::vector<render::RenderImagesRequest>& requests) final;
+
+  std::string DoGetParameterYaml() const final;
+
+  // Copy constructor used for cloning.
+  RenderEngineCpu(const RenderEngineCpu& other) = default;
+
+  /* Poses the triangles of all instances in the world frame, in
+   scene_triangles_ and vertices_W_.  */
+  void PrepareScene() const;
+
+  /* Transforms the prepared scene into the frame of the camera C, in
+   vertices_C_.  */
+  void PoseScene(const math::RigidTransformd& X_CW) const;
+
+  /* Renders the posed scene into the given image.  */
+  void DrawColorImage(const render::ColorRenderCamera& camera,
+                      systems::sensors::ImageRgba8U* color_image_out) const;
+  void DrawDepthImage(const render::DepthRenderCamera& camera,
+                      systems::sensors::ImageDepth32F* depth_image_out) const;
+  void DrawLabelImage(const render::ColorRenderCamera& camera,
+                      systems::sensors::ImageLabel16I* label_image_out) const;
+
+  /* Rasterizes the posed scene as seen by the given camera into `image_`,
+   using the given payload for the triangles and `background` for empty
+   pixels.  */
+  void Draw(const render::RenderCameraCore& camera, PayloadType payload_type,
+            int32_t background) const;
+
+  /* Adds an instance of the indexed mesh to the geometry being registered.
+   The diffuse color comes from the ("phong", "diffuse") property unless
+   `diffuse` is provided.  */
+  void AddInstance(int mesh_index, const Vector3<double>& scale,
+                   RegistrationData* data,
+                   const std::optional<Rgba>& diffuse = std::nullopt);
+
+  /* Adds the given mesh data to meshes_, returning its index.  */
+  int AddMesh(const geometry::internal::RenderMesh& render_mesh);
+
+  /* Returns the index of the indicated unit primitive, creating it first if
+   necessary.  */
+  int GetSphere();
+  int GetCylinder();
+  int GetHalfSpace();
+  int GetBox();
+
+  /* Adds the meshes of the given source to the file_meshes_ cache if they
+   aren't already there. For unsupported file types, marks the registration as
+   not accepted.  */
+  void CacheFileMeshesMaybe(const MeshSource& mesh_source,
+                            RegistrationData* data);
+
+  const RenderEngineCpuParams parameters_;
+
+  // The pose of the world frame in the camera frame.
+  math::RigidTransformd X_CW_;
+
+  // All meshes, shared with clones. The meshes of deformable geometries get
+  // copied before they are modified if they are shared.
+  std::vector<std::shared_ptr<CpuMesh>> meshes_;
+
+  // The indices into meshes_ of the unit primitives, or -1 if not yet created.
+  int sphere_{-1};
+  int cylinder_{-1};
+  int half_space_{-1};
+  int box_{-1};
+
+  // The meshes loaded from files, keyed by the file (see GetPathKey()).
+  std::map<std::string, std::vector<FileMesh>> file_meshes_;
+
+  // The visuals of all registered geometries.
+  std::unordered_map<GeometryId, Visual> visuals_;
+
+  // The indices into meshes_ of each deformable geometry's meshes.
+  std::unordered_map<GeometryId, std::vector<int>> deformable_meshes_;
+
+  // Scratch space for rendering; it holds no state between renderings.
+  mutable std::vector<Vector3<double>> vertices_W_;
+  mutable std::vector<SceneTriangle> scene_triangles_;
+  mutable std::vector<Vector3<float>> vertices_C_;
+  mutable Vector3<double> Cz_W_;
+  mutable std::vector<RasterTriangle> triangles_;
+  mutable RasterImage image_;
+};
+
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,203 @@
+#include "drake/geometry/render_cpu/internal_rasterizer.h"
+
+#include <cmath>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+namespace {
+
+using Eigen::Vector3f;
+
+constexpr int32_t kBackground = -7;
+
+class RasterizerTest : public ::testing::Test {
+ protected:
+  /* Appends a quad parallel to the image plane at depth z, whose corners
+   project to the image coordinates (u0, v0) and (u1, v1).  */
+  void AddQuad(double u0, double v0, double u1, double v1, double z,
+               int32_t payload) {
+    auto add_vertex = [this, z](double u, double v) {
+      vertices_.emplace_back((u - camera_.center_x) * z / camera_.focal_x,
+                             (v - camera_.center_y) * z / camera_.focal_y, z);
+    };
+    const int first = static_cast<int>(vertices_.size());
+    add_vertex(u0, v0);
+    add_vertex(u1, v0);
+    add_vertex(u1, v1);
+    add_vertex(u0, v1);
+    triangles_.push_back({{first, first + 1, first + 2}, payload});
+    // Deliberately use the opposite winding for the second triangle.
+    triangles_.push_back({{first, first + 3, first + 2}, payload});
+  }
+
+  RasterImage Render(int num_threads = 1) const {
+    RasterImage image;
+    Rasterize(camera_, vertices_, triangles_, kBackground,
+              Parallelism(num_threads), &image);
+    return image;
+  }
+
+  int index(int i, int j) const { return j * camera_.width + i; }
+
+  // Not a square image, and not a multiple of the tile size.
+  RasterCamera camera_{.width = 150,
+                       .height = 100,
+                       .focal_x = 120.0,
+                       .focal_y = 110.0,
+                       .center_x = 75.0,
+                       .center_y = 50.0,
+                       .near = 0.1,
+                       .far = 10.0};
+  std::vector<Vector3f> vertices_;
+  std::vector<RasterTriangle> triangles_;
+};
+
+TEST_F(RasterizerTest, Empty) {
+  const RasterImage image = Render();
+  ASSERT_EQ(image.inverse_depth.size(), 150 * 100);
+  ASSERT_EQ(image.payload.size(), 150 * 100);
+  for (int p = 0; p < 150 * 100; ++p) {
+    EXPECT_EQ(image.inverse_depth[p], 0.0f);
+    EXPECT_EQ(image.payload[p], kBackground);
+  }
+}
+
+/* A pixel is covered iff its center lies within the quad. The quad spans
+ several tiles.  */
+TEST_F(RasterizerTest, PixelCoverage) {
+  const double z = 2.0;
+  AddQuad(10.2, 20.6, 120.7, 80.4, z, 3);
+  const RasterImage image = Render();
+  for (int j = 0; j < camera_.height; ++j) {
+    for (int i = 0; i < camera_.width; ++i) {
+      const bool inside = 10 <= i && i <= 120 && 21 <= j && j <= 79;
+      const int p = index(i, j);
+      if (inside) {
+        EXPECT_EQ(image.payload[p], 3) << i << ", " << j;
+        EXPECT_NEAR(1.0 / image.inverse_depth[p], z, 1e-5);
+      } else {
+        EXPECT_EQ(image.payload[p], kBackground) << i << ", " << j;
+        EXPECT_EQ(image.inverse_depth[p], 0.0f);
+      }
+    }
+  }
+}
+
+/* The nearest surface wins, independent of the order of the triangles.  */
+TEST_F(RasterizerTest, DepthTest) {
+  AddQuad(0, 0, 100, 100, 3.0, 1);
+  AddQuad(50, 0, 150, 100, 2.0, 2);
+  AddQuad(0, 0, 150, 100, 4.0, 3);
+  const RasterImage image = Render();
+  EXPECT_EQ(image.payload[index(10, 10)], 1);
+  EXPECT_EQ(image.payload[index(60, 10)], 2);
+  EXPECT_EQ(image.payload[index(110, 10)], 2);
+
+  triangles_ = {triangles_[2], triangles_[3], triangles_[0], triangles_[1],
+                triangles_[4], triangles_[5]};
+  const RasterImage swapped = Render();
+  EXPECT_EQ(swapped.payload, image.payload);
+  EXPECT_EQ(swapped.inverse_depth, image.inverse_depth);
+}
+
+/* Surfaces beyond the far plane are discarded; triangles that cross it are
+ drawn only where they are closer than the far plane.  */
+TEST_F(RasterizerTest, FarPlane) {
+  AddQuad(0, 0, 20, 20, 11.0, 1);
+  // A triangle that recedes from depth 5 to depth 15 as u increases.
+  const int first = static_cast<int>(vertices_.size());
+  vertices_.emplace_back(-1, -1, 5);
+  vertices_.emplace_back(1, -1, 15);
+  vertices_.emplace_back(-1, 1, 5);
+  triangles_.push_back({{first, first + 1, first + 2}, 2});
+  const RasterImage image = Render();
+  EXPECT_EQ(image.payload[index(10, 10)], kBackground);
+  int num_drawn = 0;
+  for (int p = 0; p < ssize(image.payload); ++p) {
+    if (image.payload[p] == 2) {
+      ++num_drawn;
+      EXPECT_LE(1.0 / image.inverse_depth[p], camera_.far * (1 + 1e-6));
+    }
+  }
+  EXPECT_GT(num_drawn, 0);
+}
+
+/* Triangles are clipped by the near plane, rather than discarded.  */
+TEST_F(RasterizerTest, NearPlane) {
+  // A triangle entirely closer than the near plane is not drawn.
+  const int first = static_cast<int>(vertices_.size());
+  vertices_.emplace_back(-1, -1, 0.05);
+  vertices_.emplace_back(1, -1, 0.05);
+  vertices_.emplace_back(0, 1, 0.05);
+  triangles_.push_back({{first, first + 1, first + 2}, 1});
+  EXPECT_EQ(Render().payload,
+            std::vector<int32_t>(150 * 100, kBackground));
+
+  // A floor that extends from behind the camera out to depth 5; it is visible
+  // in the bottom half of the image, below the horizon (the row of the
+  // principal point).
+  vertices_.clear();
+  triangles_.clear();
+  vertices_.emplace_back(-50, 1, -5);
+  vertices_.emplace_back(50, 1, -5);
+  vertices_.emplace_back(50, 1, 5);
+  vertices_.emplace_back(-50, 1, 5);
+  triangles_.push_back({{0, 1, 2}, 2});
+  triangles_.push_back({{0, 2, 3}, 2});
+  const RasterImage image = Render();
+  for (int j = 0; j < camera_.height; ++j) {
+    const double v = j + 0.5;
+    // The ray through the pixel center hits the floor at depth fy / (v - cy).
+    const double expected_depth = camera_.focal_y / (v - camera_.center_y);
+    const bool visible = v > camera_.center_y && expected_depth < 5.0;
+    const int p = index(75, j);
+    if (visible) {
+      EXPECT_EQ(image.payload[p], 2) << j;
+      EXPECT_NEAR(1.0 / image.inverse_depth[p], expected_depth,
+                  1e-5 * expected_depth);
+    } else {
+      EXPECT_EQ(image.payload[p], kBackground) << j;
+    }
+  }
+  // Nothing closer than the near plane is drawn.
+  for (const float inverse_depth : image.inverse_depth) {
+    EXPECT_LE(inverse_depth, (1 + 1e-6) / camera_.near);
+  }
+}
+
+/* The result doesn't depend on the number of threads, even for heavily
+ overlapping triangles.  */
+TEST_F(RasterizerTest, DeterministicParallelism) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<float> xy(-1.5f, 1.5f);
+  std::uniform_real_distribution<float> z(0.05f, 12.0f);
+  for (int t = 0; t < 500; ++t) {
+    const int first = static_cast<int>(vertices_.size());
+    for (int k = 0; k < 3; ++k) {
+      vertices_.emplace_back(xy(generator), xy(generator), z(generator));
+    }
+    triangles_.push_back({{first, first + 1, first + 2}, t});
+  }
+  const RasterImage serial = Render(1);
+  const RasterImage parallel = Render(4);
+  EXPECT_EQ(serial.inverse_depth, parallel.inverse_depth);
+  EXPECT_EQ(serial.payload, parallel.payload);
+  int num_drawn = 0;
+  for (const int32_t payload : serial.payload) {
+    num_drawn += (payload != kBackground);
+  }
+  EXPECT_GT(num_drawn, 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
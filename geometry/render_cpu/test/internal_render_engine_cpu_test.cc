@@ -0,0 +1,340 @@
+#include "drake/geometry/render_cpu/internal_render_engine_cpu.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/render_cpu/factory.h"
+#include "drake/geometry/render_vtk/factory.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace geometry {
+namespace render_cpu {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using geometry::internal::RenderMesh;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using render::ColorRenderCamera;
+using render::DepthRange;
+using render::DepthRenderCamera;
+using render::RenderCameraCore;
+using render::RenderEngine;
+using render::RenderLabel;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageLabel16I;
+using systems::sensors::ImageRgba8U;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+constexpr float kTooClose = ImageTraits<PixelType::kDepth32F>::kTooClose;
+constexpr float kTooFar = ImageTraits<PixelType::kDepth32F>::kTooFar;
+
+class RenderEngineCpuTest : public ::testing::Test {
+ protected:
+  RenderEngineCpuTest()
+      : core_("unused", CameraInfo(kWidth, kHeight, M_PI / 4), {0.01, 10.0},
+              {}),
+        color_camera_(core_),
+        depth_camera_(core_, {0.1, 5.0}) {}
+
+  /* Returns properties with the given label and diffuse color.  */
+  static PerceptionProperties MakeProperties(
+      RenderLabel label, const Rgba& diffuse = Rgba(0.2, 0.4, 0.6)) {
+    PerceptionProperties properties;
+    properties.AddProperty("label", "id", label);
+    properties.AddProperty("phong", "diffuse", diffuse);
+    return properties;
+  }
+
+  /* Registers a sphere of radius 0.5 whose center is 2 m in front of the
+   camera (which sits at the world origin, looking along Wz).  */
+  GeometryId AddSphere(RenderEngine* engine) {
+    const GeometryId id = GeometryId::get_new_id();
+    engine->RegisterVisual(id, Sphere(0.5), MakeProperties(kLabel),
+                           RigidTransformd(Vector3d(0, 0, 2)));
+    return id;
+  }
+
+  /* Reports the depth of the center pixel.  */
+  float CenterDepth(const RenderEngine& engine) const {
+    ImageDepth32F depth(kWidth, kHeight);
+    engine.RenderDepthImage(depth_camera_, &depth);
+    return depth.at(kCenterU, kCenterV)[0];
+  }
+
+  static constexpr int kWidth = 64;
+  static constexpr int kHeight = 48;
+  // The pixel whose center lies on the camera's optical axis; see CameraInfo.
+  static constexpr int kCenterU = kWidth / 2 - 1;
+  static constexpr int kCenterV = kHeight / 2 - 1;
+  const RenderLabel kLabel{5};
+  const RenderCameraCore core_;
+  const ColorRenderCamera color_camera_;
+  const DepthRenderCamera depth_camera_;
+};
+
+TEST_F(RenderEngineCpuTest, DepthAndLabel) {
+  RenderEngineCpu engine;
+  AddSphere(&engine);
+  ImageDepth32F depth(kWidth, kHeight);
+  engine.RenderDepthImage(depth_camera_, &depth);
+  ImageLabel16I label(kWidth, kHeight);
+  engine.RenderLabelImage(color_camera_, &label);
+
+  // The ray through the center pixel hits the sphere (nearly) at the pole of
+  // its tessellation.
+  EXPECT_NEAR(depth.at(kCenterU, kCenterV)[0], 1.5, 1e-3);
+  EXPECT_EQ(label.at(kCenterU, kCenterV)[0], kLabel);
+  EXPECT_EQ(depth.at(0, 0)[0], kTooFar);
+  EXPECT_EQ(label.at(0, 0)[0], RenderLabel::kEmpty);
+
+  // Depths outside of the depth range are saturated.
+  const DepthRenderCamera too_close(core_, DepthRange(1.6, 5.0));
+  engine.RenderDepthImage(too_close, &depth);
+  EXPECT_EQ(depth.at(kCenterU, kCenterV)[0], kTooClose);
+  const DepthRenderCamera too_far(core_, DepthRange(0.1, 1.4));
+  engine.RenderDepthImage(too_far, &depth);
+  EXPECT_EQ(depth.at(kCenterU, kCenterV)[0], kTooFar);
+}
+
+TEST_F(RenderEngineCpuTest, Color) {
+  const RenderEngineCpuParams params;
+  RenderEngineCpu engine(params);
+  AddSphere(&engine);
+  ImageRgba8U color(kWidth, kHeight);
+  engine.RenderColorImage(color_camera_, &color);
+
+  // The center of the sphere faces the light fixed to the camera; it shows
+  // (nearly) its full diffuse color.
+  const uint8_t* center = color.at(kCenterU, kCenterV);
+  EXPECT_NEAR(center[0], 0.2 * 255, 1.0);
+  EXPECT_NEAR(center[1], 0.4 * 255, 1.0);
+  EXPECT_NEAR(center[2], 0.6 * 255, 1.0);
+  EXPECT_EQ(center[3], 255);
+
+  const uint8_t* corner = color.at(0, 0);
+  const Rgba& clear = params.default_clear_color;
+  EXPECT_NEAR(corner[0], clear.r() * 255, 0.5);
+  EXPECT_NEAR(corner[1], clear.g() * 255, 0.5);
+  EXPECT_NEAR(corner[2], clear.b() * 255, 0.5);
+  EXPECT_EQ(corner[3], 255);
+}
+
+/* Updating the pose of a geometry and the viewpoint both move the geometry in
+ the image.  */
+TEST_F(RenderEngineCpuTest, UpdatePoseAndViewpoint) {
+  RenderEngineCpu engine;
+  const GeometryId id = AddSphere(&engine);
+  engine.UpdatePoses(std::unordered_map<GeometryId, RigidTransformd>{
+      {id, RigidTransformd(Vector3d(0, 0, 3))}});
+  EXPECT_NEAR(CenterDepth(engine), 2.5, 1e-3);
+  engine.UpdateViewpoint(RigidTransformd(Vector3d(0, 0, 1)));
+  EXPECT_NEAR(CenterDepth(engine), 1.5, 1e-3);
+}
+
+/* A clone and its original can be modified independently.  */
+TEST_F(RenderEngineCpuTest, Clone) {
+  RenderEngineCpu engine;
+  const GeometryId sphere_id = AddSphere(&engine);
+
+  // A single triangle, spanning the image center, 1 m in front of the camera.
+  RenderMesh mesh;
+  mesh.positions.resize(3, 3);
+  mesh.positions << -1, -1, 1, 1, -1, 1, 0, 1, 1;
+  mesh.normals.resize(3, 3);
+  mesh.normals << 0, 0, -1, 0, 0, -1, 0, 0, -1;
+  mesh.uvs.setZero(3, 2);
+  mesh.indices.resize(1, 3);
+  mesh.indices << 0, 1, 2;
+  const GeometryId deformable_id = GeometryId::get_new_id();
+  engine.RegisterDeformableVisual(deformable_id, {mesh},
+                                  MakeProperties(RenderLabel(7)));
+  EXPECT_NEAR(CenterDepth(engine), 1.0, 1e-5);
+
+  std::unique_ptr<RenderEngine> clone = engine.Clone();
+  EXPECT_NEAR(CenterDepth(*clone), 1.0, 1e-5);
+
+  // Pushing the clone's triangle away leaves the original untouched.
+  VectorX<double> q(9);
+  q << -1, -1, 1.25, 1, -1, 1.25, 0, 1, 1.25;
+  clone->UpdateDeformableConfigurations(deformable_id, {q},
+                                        {VectorX<double>::Zero(9)});
+  EXPECT_NEAR(CenterDepth(*clone), 1.25, 1e-5);
+  EXPECT_NEAR(CenterDepth(engine), 1.0, 1e-5);
+
+  // Removing geometry from the original leaves the clone untouched.
+  EXPECT_TRUE(engine.RemoveGeometry(deformable_id));
+  EXPECT_TRUE(engine.RemoveGeometry(sphere_id));
+  EXPECT_EQ(CenterDepth(engine), kTooFar);
+  EXPECT_NEAR(CenterDepth(*clone), 1.25, 1e-5);
+}
+
+/* The number of threads doesn't change the images.  */
+TEST_F(RenderEngineCpuTest, Parallelism) {
+  RenderEngineCpu serial;
+  RenderEngineCpu parallel({.num_threads = 2});
+  for (RenderEngine* engine : {static_cast<RenderEngine*>(&serial),
+                               static_cast<RenderEngine*>(&parallel)}) {
+    AddSphere(engine);
+    engine->RegisterVisual(GeometryId::get_new_id(), Box(1, 2, 0.5),
+                           MakeProperties(RenderLabel(2)),
+                           RigidTransformd(RollPitchYawd(0.3, 0.2, 0.1),
+                                           Vector3d(0.3, 0.1, 1.8)));
+  }
+  ImageDepth32F serial_depth(kWidth, kHeight);
+  ImageDepth32F parallel_depth(kWidth, kHeight);
+  serial.RenderDepthImage(depth_camera_, &serial_depth);
+  parallel.RenderDepthImage(depth_camera_, &parallel_depth);
+  EXPECT_EQ(serial_depth, parallel_depth);
+  ImageLabel16I serial_label(kWidth, kHeight);
+  ImageLabel16I parallel_label(kWidth, kHeight);
+  serial.RenderLabelImage(color_camera_, &serial_label);
+  parallel.RenderLabelImage(color_camera_, &parallel_label);
+  EXPECT_EQ(serial_label, parallel_label);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(RenderEngineCpu({.num_threads = 0}),
+                              ".*positive number of threads.*");
+}
+
+/* Rendering a batch of cameras produces the same images as rendering them one
+ at a time, and leaves the viewpoint at the last camera.  */
+TEST_F(RenderEngineCpuTest, RenderImages) {
+  RenderEngineCpu engine;
+  AddSphere(&engine);
+  engine.RegisterVisual(GeometryId::get_new_id(), Box(1, 2, 0.5),
+                        MakeProperties(RenderLabel(2)),
+                        RigidTransformd(RollPitchYawd(0.3, 0.2, 0.1),
+                                        Vector3d(0.3, 0.1, 1.8)));
+  const std::vector<RigidTransformd> X_WRs{
+      RigidTransformd(),
+      RigidTransformd(RollPitchYawd(0, 0.2, 0), Vector3d(-0.4, 0, 0.1))};
+
+  std::vector<ImageRgba8U> colors(2, ImageRgba8U(kWidth, kHeight));
+  std::vector<ImageDepth32F> depths(2, ImageDepth32F(kWidth, kHeight));
+  std::vector<ImageLabel16I> labels(2, ImageLabel16I(kWidth, kHeight));
+  std::vector<render::RenderImagesRequest> requests;
+  for (int i = 0; i < 2; ++i) {
+    requests.push_back({.X_WR = X_WRs[i],
+                        .color_camera = &color_camera_,
+                        .depth_camera = &depth_camera_,
+                        .color_image = &colors[i],
+                        .depth_image = &depths[i],
+                        .label_image = &labels[i]});
+  }
+  engine.RenderImages(requests);
+
+  for (int i = 0; i < 2; ++i) {
+    engine.UpdateViewpoint(X_WRs[i]);
+    ImageRgba8U color(kWidth, kHeight);
+    ImageDepth32F depth(kWidth, kHeight);
+    ImageLabel16I label(kWidth, kHeight);
+    engine.RenderColorImage(color_camera_, &color);
+    engine.RenderDepthImage(depth_camera_, &depth);
+    engine.RenderLabelImage(color_camera_, &label);
+    EXPECT_EQ(colors[i], color);
+    EXPECT_EQ(depths[i], depth);
+    EXPECT_EQ(labels[i], label);
+  }
+  EXPECT_NE(depths[0], depths[1]);
+
+  // The viewpoint is left at the last request's pose.
+  engine.UpdateViewpoint(RigidTransformd());
+  engine.RenderImages({{.X_WR = RigidTransformd(Vector3d(0, 0, 1))}});
+  EXPECT_NEAR(CenterDepth(engine), 0.5, 1e-3);
+}
+
+TEST_F(RenderEngineCpuTest, UnsupportedMesh) {
+  RenderEngineCpu engine;
+  EXPECT_FALSE(engine.RegisterVisual(GeometryId::get_new_id(),
+                                     Mesh("unsupported.stl"),
+                                     MakeProperties(kLabel), {}));
+}
+
+TEST_F(RenderEngineCpuTest, ParameterYaml) {
+  const RenderEngineCpu engine({.num_threads = 3});
+  const std::string yaml = engine.GetParameterYaml();
+  EXPECT_EQ(yaml.find("RenderEngineCpuParams:"), 0);
+  EXPECT_NE(yaml.find("num_threads: 3"), std::string::npos);
+}
+
+/* The depth and label images agree with RenderEngineVtk for a scene with every
+ primitive shape, up to differences in tessellation along the silhouettes.  */
+TEST_F(RenderEngineCpuTest, MatchesVtk) {
+  const int width = 320;
+  const int height = 240;
+  const RenderCameraCore core("unused", CameraInfo(width, height, M_PI / 3),
+                              {0.01, 20.0}, {});
+  const ColorRenderCamera color_camera(core);
+  const DepthRenderCamera depth_camera(core, {0.05, 15.0});
+
+  std::unique_ptr<RenderEngine> cpu = MakeRenderEngineCpu();
+  std::unique_ptr<RenderEngine> vtk = MakeRenderEngineVtk({});
+  // The camera looks down at the ground from above.
+  const RigidTransformd X_WC(RollPitchYawd(-2.2, 0, 0), Vector3d(0, -3, 2.5));
+  int label = 1;
+  auto add = [&](const Shape& shape, const Vector3d& p_WG) {
+    const GeometryId id = GeometryId::get_new_id();
+    const PerceptionProperties properties =
+        MakeProperties(RenderLabel(label++));
+    const RigidTransformd X_WG(RollPitchYawd(0.1, 0.2, 0.3), p_WG);
+    cpu->RegisterVisual(id, shape, properties, X_WG);
+    vtk->RegisterVisual(id, shape, properties, X_WG);
+  };
+  add(HalfSpace(), Vector3d(0, 0, -0.5));
+  add(Sphere(0.4), Vector3d(-1, 0, 0));
+  add(Box(0.5, 0.6, 0.7), Vector3d(0, 0, 0));
+  add(Cylinder(0.3, 0.8), Vector3d(1, 0, 0));
+  add(Capsule(0.2, 0.5), Vector3d(-0.5, 1, 0));
+  add(Ellipsoid(0.3, 0.4, 0.2), Vector3d(0.5, 1, 0));
+  cpu->UpdateViewpoint(X_WC);
+  vtk->UpdateViewpoint(X_WC);
+
+  ImageLabel16I cpu_label(width, height);
+  ImageLabel16I vtk_label(width, height);
+  cpu->RenderLabelImage(color_camera, &cpu_label);
+  vtk->RenderLabelImage(color_camera, &vtk_label);
+  ImageDepth32F cpu_depth(width, height);
+  ImageDepth32F vtk_depth(width, height);
+  cpu->RenderDepthImage(depth_camera, &cpu_depth);
+  vtk->RenderDepthImage(depth_camera, &vtk_depth);
+
+  int label_mismatches = 0;
+  int depth_mismatches = 0;
+  for (int v = 0; v < height; ++v) {
+    for (int u = 0; u < width; ++u) {
+      const int16_t cpu_value = cpu_label.at(u, v)[0];
+      if (cpu_value != vtk_label.at(u, v)[0]) {
+        ++label_mismatches;
+        continue;
+      }
+      const float expected = vtk_depth.at(u, v)[0];
+      const float actual = cpu_depth.at(u, v)[0];
+      if (std::isinf(expected) || std::isinf(actual)) {
+        depth_mismatches += (expected != actual);
+      } else {
+        depth_mismatches += (std::abs(expected - actual) > 0.01 * expected);
+      }
+    }
+  }
+  // Pixels along silhouettes may differ; they're a small fraction of the image.
+  EXPECT_LT(label_mismatches, 0.02 * width * height);
+  EXPECT_LT(depth_mismatches, 0.02 * width * height);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace render_cpu
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,27 @@
+#include "drake/geometry/render_cpu/render_engine_cpu_params.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/yaml/yaml_io.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+GTEST_TEST(RenderEngineCpuParams, Serialization) {
+  using Params = RenderEngineCpuParams;
+  const Params original{
+      .default_diffuse = Rgba{1.0, 0.5, 0.25},
+      .default_clear_color = Rgba{0.25, 0.5, 1.0},
+      .num_threads = 4,
+  };
+  const std::string yaml = yaml::SaveYamlString<Params>(original);
+  const Params dut = yaml::LoadYamlString<Params>(yaml);
+  EXPECT_EQ(dut.default_diffuse, original.default_diffuse);
+  EXPECT_EQ(dut.default_clear_color, original.default_clear_color);
+  EXPECT_EQ(dut.num_threads, original.num_threads);
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
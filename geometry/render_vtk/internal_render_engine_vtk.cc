@@ -78,6 +78,7 @@ using render::DepthRenderCamera;
 using render::LightParameter;
 using render::RenderCameraCore;
 using render::RenderEngine;
+using render::RenderImagesRequest;
 using render::RenderLabel;
 using std::make_unique;
 using systems::sensors::CameraInfo;
@@ -506,9 +507,19 @@ void RenderEngineVtk::DoRenderDepthImage(const DepthRenderCamera& camera,
                                          ImageDepth32F* depth_image_out) const {
   UpdateWindow(camera, *pipelines_[ImageType::kDepth]);
   PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
+  ImageRgba8U image;
+  ExtractDepthImage(camera, &image, depth_image_out);
+}
 
+void RenderEngineVtk::ExtractDepthImage(const DepthRenderCamera& camera,
+                                        ImageRgba8U* scratch,
+                                        ImageDepth32F* depth_image_out) const {
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
+  if (scratch->width() != intrinsics.width() ||
+      scratch->height() != intrinsics.height()) {
+    scratch->resize(intrinsics.width(), intrinsics.height());
+  }
+  ImageRgba8U& image = *scratch;
   // TODO(SeanCurtis-TRI): We're doing multiple passes on the pixel data. This
   // does one pass by copying the filter to the given image. We then do a second
   // pass where we re-encode the values. It would be much better to process the
@@ -546,13 +557,23 @@ void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera,
   UpdateWindow(camera.core(), camera.show_window(),
                *pipelines_[ImageType::kLabel], "Label Image");
   PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
+  ImageRgba8U image;
+  ExtractLabelImage(camera, &image, label_image_out);
+}
 
+void RenderEngineVtk::ExtractLabelImage(const ColorRenderCamera& camera,
+                                        ImageRgba8U* scratch,
+                                        ImageLabel16I* label_image_out) const {
   // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
   // would be much better to process the pixels directly. The solution is to
   // simply call exporter->GetPointerToData() and process the pixels myself.
   // See the implementation in vtkImageExport::Export() for details.
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
+  if (scratch->width() != intrinsics.width() ||
+      scratch->height() != intrinsics.height()) {
+    scratch->resize(intrinsics.width(), intrinsics.height());
+  }
+  ImageRgba8U& image = *scratch;
   pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
 
   for (int v = 0; v < intrinsics.height(); ++v) {
@@ -563,6 +584,64 @@ void RenderEngineVtk::DoRenderLabelImage(const ColorRenderCamera& camera,
   }
 }
 
+void RenderEngineVtk::DoRenderImages(
+    const std::vector<RenderImagesRequest>& requests) {
+  if (requests.empty()) {
+    return;
+  }
+  // The geometry poses are common to all requests. So, for each request, only
+  // the pipelines it renders get their camera moved, and a pipeline's window
+  // (display, size, and projection) is only reconfigured when its camera
+  // differs from the one it last rendered with in this batch. The scratch
+  // image used to decode depth and label images is shared, too.
+  std::array<const void*, kNumPipelines> last_camera{};
+  ImageRgba8U scratch;
+  for (const RenderImagesRequest& request : requests) {
+    const vtkSmartPointer<vtkTransform> vtk_X_WR =
+        ConvertToVtkTransform(request.X_WR);
+    // Moves the camera of the given pipeline and reports whether its window
+    // needs to be configured for the given `camera`.
+    auto prepare = [&](ImageType image_type, const void* camera) {
+      SetModelTransformMatrixToVtkCamera(
+          pipelines_[image_type]->renderer->GetActiveCamera(), vtk_X_WR);
+      const bool needs_window_update = (last_camera[image_type] != camera);
+      last_camera[image_type] = camera;
+      return needs_window_update;
+    };
+    if (request.color_image != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kColor];
+      const ColorRenderCamera shadow_camera =
+          MakeShadowCamera(*request.color_camera, parameters_.cast_shadows);
+      if (prepare(ImageType::kColor, request.color_camera)) {
+        UpdateWindow(shadow_camera.core(), shadow_camera.show_window(), p,
+                     "Color Image");
+      }
+      PerformVtkUpdate(p);
+      ExtractImage(shadow_camera, p.exporter, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kDepth];
+      if (prepare(ImageType::kDepth, request.depth_camera)) {
+        UpdateWindow(*request.depth_camera, p);
+      }
+      PerformVtkUpdate(p);
+      ExtractDepthImage(*request.depth_camera, &scratch, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      const RenderingPipeline& p = *pipelines_[ImageType::kLabel];
+      if (prepare(ImageType::kLabel, request.color_camera)) {
+        UpdateWindow(request.color_camera->core(),
+                     request.color_camera->show_window(), p, "Label Image");
+      }
+      PerformVtkUpdate(p);
+      ExtractLabelImage(*request.color_camera, &scratch, request.label_image);
+    }
+  }
+  // Leave every pipeline looking from the last request's viewpoint, as
+  // documented by RenderEngine::RenderImages().
+  UpdateViewpoint(requests.back().X_WR);
+}
+
 RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
     : RenderEngine(other),
       parameters_(other.parameters_),
@@ -210,6 +210,24 @@ class DRAKE_NO_EXPORT RenderEngineVtk : public render::RenderEngine,
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages().
+  void DoRenderImages(
+      const std::vector<render::RenderImagesRequest>& requests) override;
+
+  // Decodes the depth image most recently rendered by the depth pipeline for
+  // the given `camera`, using `scratch` for the raw pixels.
+  void ExtractDepthImage(
+      const render::DepthRenderCamera& camera,
+      systems::sensors::ImageRgba8U* scratch,
+      systems::sensors::ImageDepth32F* depth_image_out) const;
+
+  // Decodes the label image most recently rendered by the label pipeline for
+  // the given `camera`, using `scratch` for the raw pixels.
+  void ExtractLabelImage(
+      const render::ColorRenderCamera& camera,
+      systems::sensors::ImageRgba8U* scratch,
+      systems::sensors::ImageLabel16I* label_image_out) const;
+
   // @see RenderEngine::DoGetParameterYaml().
   std::string DoGetParameterYaml() const override;
 
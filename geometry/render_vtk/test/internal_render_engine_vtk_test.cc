@@ -1464,6 +1464,86 @@ TEST_F(RenderEngineVtkTest, DifferentCameras) {
   }
 }
 
+// Tests that a batch of requests rendered with RenderImages() produces the same
+// images as rendering each request on its own, even as the requests switch
+// between cameras and viewpoints.
+TEST_F(RenderEngineVtkTest, RenderImages) {
+  Init(X_WC_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const auto& ref_core = depth_camera_.core();
+  const auto& ref_intrinsics = ref_core.intrinsics();
+  const DepthRenderCamera small_depth_camera{
+      {ref_core.renderer_name(),
+       {ref_intrinsics.width() / 2, ref_intrinsics.height() / 2,
+        ref_intrinsics.fov_y()},
+       ref_core.clipping(),
+       ref_core.sensor_pose_in_camera_body()},
+      depth_camera_.depth_range()};
+  const ColorRenderCamera color_camera(ref_core, FLAGS_show_window);
+  const ColorRenderCamera small_color_camera(small_depth_camera.core(),
+                                             FLAGS_show_window);
+  const RigidTransformd X_WC_shifted(X_WC_.rotation(),
+                                     X_WC_.translation() + Vector3d(0.1, 0, 0));
+
+  struct Case {
+    RigidTransformd X_WR;
+    const ColorRenderCamera* color_camera{};
+    const DepthRenderCamera* depth_camera{};
+  };
+  const std::vector<Case> cases{{X_WC_, &color_camera, &depth_camera_},
+                                {X_WC_shifted, &color_camera, &depth_camera_},
+                                {X_WC_, &small_color_camera,
+                                 &small_depth_camera},
+                                {X_WC_shifted, &color_camera, &depth_camera_}};
+
+  // The images rendered one at a time.
+  std::vector<ImageRgba8U> expected_color;
+  std::vector<ImageDepth32F> expected_depth;
+  std::vector<ImageLabel16I> expected_label;
+  for (const Case& c : cases) {
+    const CameraInfo& intrinsics = c.color_camera->core().intrinsics();
+    expected_color.emplace_back(intrinsics.width(), intrinsics.height());
+    expected_depth.emplace_back(intrinsics.width(), intrinsics.height());
+    expected_label.emplace_back(intrinsics.width(), intrinsics.height());
+    renderer_->UpdateViewpoint(c.X_WR);
+    renderer_->RenderColorImage(*c.color_camera, &expected_color.back());
+    renderer_->RenderDepthImage(*c.depth_camera, &expected_depth.back());
+    renderer_->RenderLabelImage(*c.color_camera, &expected_label.back());
+  }
+
+  // The same images rendered as one batch; the viewpoint is deliberately left
+  // somewhere else beforehand.
+  renderer_->UpdateViewpoint(RigidTransformd::Identity());
+  std::vector<ImageRgba8U> color(expected_color);
+  std::vector<ImageDepth32F> depth(expected_depth);
+  std::vector<ImageLabel16I> label(expected_label);
+  std::vector<render::RenderImagesRequest> requests;
+  for (int i = 0; i < ssize(cases); ++i) {
+    color[i].resize(color[i].width(), color[i].height());
+    depth[i].resize(depth[i].width(), depth[i].height());
+    label[i].resize(label[i].width(), label[i].height());
+    requests.push_back({.X_WR = cases[i].X_WR,
+                        .color_camera = cases[i].color_camera,
+                        .depth_camera = cases[i].depth_camera,
+                        .color_image = &color[i],
+                        .depth_image = &depth[i],
+                        .label_image = &label[i]});
+  }
+  renderer_->RenderImages(requests);
+  for (int i = 0; i < ssize(cases); ++i) {
+    SCOPED_TRACE(fmt::format("request {}", i));
+    EXPECT_EQ(color[i], expected_color[i]);
+    EXPECT_EQ(depth[i], expected_depth[i]);
+    EXPECT_EQ(label[i], expected_label[i]);
+  }
+
+  // The renderer is left looking from the last request's viewpoint.
+  ImageRgba8U last_color(ref_intrinsics.width(), ref_intrinsics.height());
+  renderer_->RenderColorImage(color_camera, &last_color);
+  EXPECT_EQ(last_color, expected_color.back());
+}
+
 // Tests that RenderEngineVtk's default render label is kDontCare.
 TEST_F(RenderEngineVtkTest, DefaultProperties_RenderLabel) {
   // A variation of PopulateSphereTest(), but uses an empty set of properties.
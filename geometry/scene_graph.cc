@@ -342,6 +342,16 @@ GeometryId SceneGraph<T>::RegisterDeformableGeometry(
       source_id, frame_id, std::move(geometry), resolution_hint);
 }
 
+template <typename T>
+void SceneGraph<T>::SetDeformableGeometryParallelism(Parallelism parallelism) {
+  hub_.mutable_model().SetDeformableGeometryParallelism(parallelism);
+}
+
+template <typename T>
+Parallelism SceneGraph<T>::GetDeformableGeometryParallelism() const {
+  return hub_.model().GetDeformableGeometryParallelism();
+}
+
 template <typename T>
 void SceneGraph<T>::RenameGeometry(GeometryId geometry_id,
                                    const std::string& name) {
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_set.h"
@@ -602,6 +603,23 @@ class SceneGraph final : public systems::LeafSystem<T> {
       systems::Context<T>* context, SourceId source_id, FrameId frame_id,
       std::unique_ptr<GeometryInstance> geometry, double resolution_hint) const;
 
+  /** (Internal use only) Sets the number of threads %SceneGraph may use to
+   update the proximity representations of deformable geometries (e.g., to
+   refit their bounding volume hierarchies) whenever their configurations
+   change. MultibodyPlant configures this from the parallelism of its
+   DeformableModel. The resulting representations do not depend on the number
+   of threads.
+
+   This method modifies the underlying model and requires a new Context to be
+   allocated.
+   @experimental  */
+  void SetDeformableGeometryParallelism(Parallelism parallelism);
+
+  /** (Internal use only) Returns the parallelism set by
+   SetDeformableGeometryParallelism(), Parallelism::None() by default.
+   @experimental  */
+  Parallelism GetDeformableGeometryParallelism() const;
+
   /** Renames the geometry to `name`.
 
    This method modifies the underlying model and requires a new Context to be
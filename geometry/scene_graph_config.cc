@@ -97,6 +97,12 @@ void DefaultProximityProperties::ValidateOrThrow() const {
 
 void SceneGraphConfig::ValidateOrThrow() const {
   default_proximity_properties.ValidateOrThrow();
+  if (proximity_query_num_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "Invalid scene graph configuration: 'proximity_query_num_threads' ({}) "
+        "must be a positive value.",
+        proximity_query_num_threads));
+  }
 }
 
 }  // namespace geometry
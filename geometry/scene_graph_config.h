@@ -166,12 +166,24 @@ struct SceneGraphConfig {
   template <typename Archive>
   void Serialize(Archive* a) {
     a->Visit(DRAKE_NVP(default_proximity_properties));
+    a->Visit(DRAKE_NVP(proximity_query_num_threads));
   }
 
   /** Provides SceneGraph-wide contact material values to use when none have
   been otherwise specified. */
   DefaultProximityProperties default_proximity_properties;
 
+  /** The number of threads QueryObject may use to evaluate the narrowphase
+  of the all-pairs proximity queries (ComputeContactSurfaces(),
+  ComputeContactSurfacesWithFallback(), ComputePointPairPenetration(), and
+  ComputeSignedDistancePairwiseClosestPoints()). The broadphase gathers the
+  candidate geometry pairs and then each pair is evaluated independently. The
+  results are bit-identical to (and in the same order as) the serial
+  computation, regardless of the number of threads. The default value of 1
+  evaluates all pairs serially. Values greater than 1 only have an effect if
+  Drake was built with OpenMP enabled. Must be positive. */
+  int proximity_query_num_threads{1};
+
   /** Throws if the values are inconsistent. */
   void ValidateOrThrow() const;
 };
@@ -5046,8 +5046,9 @@ class GeometryStateRenderTest : public ::testing::Test {
     auto engine1 = std::make_unique<DummyRenderEngine>();
     engine1_ = engine1.get();
     geometry_state_.AddRenderer("engine1", std::move(engine1));
-    geometry_state_.AddRenderer("engine2",
-                                std::make_unique<DummyRenderEngine>());
+    auto engine2 = std::make_unique<DummyRenderEngine>();
+    engine2_ = engine2.get();
+    geometry_state_.AddRenderer("engine2", std::move(engine2));
     // Make sure the geometry data knows the parent frame's pose.
     GeometryStateTester<double> tester;
     tester.set_state(&geometry_state_);
@@ -5083,6 +5084,7 @@ class GeometryStateRenderTest : public ::testing::Test {
   // The concatenated pose of the sensor frame in the world.  See Setup().
   RigidTransformd X_WS_;
   DummyRenderEngine* engine1_{};
+  DummyRenderEngine* engine2_{};
 };
 
 TEST_F(GeometryStateRenderTest, RenderColorImage) {
@@ -5160,6 +5162,56 @@ TEST_F(GeometryStateRenderTest, RenderLabelImage) {
                std::exception);
 }
 
+TEST_F(GeometryStateRenderTest, RenderImages) {
+  systems::sensors::ImageRgba8U color(width(), height());
+  systems::sensors::ImageDepth32F depth(width(), height());
+  systems::sensors::ImageLabel16I label(width(), height());
+  const render::ColorRenderCamera color1 = color_camera("engine1");
+  const render::DepthRenderCamera depth1 = depth_camera("engine1");
+  const render::DepthRenderCamera depth2 = depth_camera("engine2");
+
+  // Each engine renders its own images, from the sensor pose.
+  geometry_state_.RenderImages({{.parent_frame = parent_id_,
+                                 .X_PC = X_PC_,
+                                 .color_camera = &color1,
+                                 .depth_camera = &depth1,
+                                 .color_image = &color,
+                                 .depth_image = &depth,
+                                 .label_image = &label},
+                                {.parent_frame = parent_id_,
+                                 .X_PC = X_PC_,
+                                 .depth_camera = &depth2,
+                                 .depth_image = &depth}});
+  for (const DummyRenderEngine* engine : {engine1_, engine2_}) {
+    EXPECT_TRUE(CompareMatrices(engine->last_updated_X_WC().GetAsMatrix4(),
+                                X_WS_.GetAsMatrix4(), 1e-15));
+  }
+  EXPECT_EQ(engine1_->num_color_renders(), 1);
+  EXPECT_EQ(engine1_->num_depth_renders(), 1);
+  EXPECT_EQ(engine1_->num_label_renders(), 1);
+  EXPECT_EQ(engine2_->num_color_renders(), 0);
+  EXPECT_EQ(engine2_->num_depth_renders(), 1);
+  EXPECT_EQ(engine2_->num_label_renders(), 0);
+
+  // A bad renderer name anywhere in the batch prevents all rendering.
+  const render::DepthRenderCamera bad = depth_camera("not_an_engine");
+  EXPECT_THROW(geometry_state_.RenderImages({{.parent_frame = parent_id_,
+                                              .X_PC = X_PC_,
+                                              .color_camera = &color1,
+                                              .color_image = &color},
+                                             {.parent_frame = parent_id_,
+                                              .X_PC = X_PC_,
+                                              .depth_camera = &bad,
+                                              .depth_image = &depth}}),
+               std::exception);
+  EXPECT_EQ(engine1_->num_color_renders(), 1);
+
+  // An image without a camera is an error.
+  EXPECT_THROW(geometry_state_.RenderImages(
+                   {{.parent_frame = parent_id_, .label_image = &label}}),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -3,6 +3,8 @@
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -2413,6 +2415,102 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that evaluating the candidate pairs in parallel produces results
+// that are bit-identical to (and in the same order as) the serial evaluation.
+TEST_F(ProximityEngineHydroWithFallback, ParallelMatchesSerial) {
+  engine_.UpdateWorldPoses(poses_);
+  const Parallelism serial = Parallelism::None();
+  const Parallelism parallel(2);
+
+  vector<ContactSurface<double>> surfaces_serial;
+  vector<PenetrationAsPointPair<double>> points_serial;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kPolygon, poses_, &surfaces_serial,
+      &points_serial, serial);
+  vector<ContactSurface<double>> surfaces_parallel;
+  vector<PenetrationAsPointPair<double>> points_parallel;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kPolygon, poses_, &surfaces_parallel,
+      &points_parallel, parallel);
+  ASSERT_EQ(surfaces_parallel.size(), surfaces_serial.size());
+  for (size_t i = 0; i < surfaces_serial.size(); ++i) {
+    EXPECT_TRUE(surfaces_parallel[i].Equal(surfaces_serial[i]));
+  }
+  ASSERT_EQ(points_parallel.size(), points_serial.size());
+  for (size_t i = 0; i < points_serial.size(); ++i) {
+    EXPECT_EQ(points_parallel[i].id_A, points_serial[i].id_A);
+    EXPECT_EQ(points_parallel[i].id_B, points_serial[i].id_B);
+    EXPECT_EQ(points_parallel[i].p_WCa, points_serial[i].p_WCa);
+    EXPECT_EQ(points_parallel[i].p_WCb, points_serial[i].p_WCb);
+    EXPECT_EQ(points_parallel[i].nhat_BA_W, points_serial[i].nhat_BA_W);
+    EXPECT_EQ(points_parallel[i].depth, points_serial[i].depth);
+  }
+
+  const auto penetrations_serial =
+      engine_.ComputePointPairPenetration(poses_, serial);
+  const auto penetrations_parallel =
+      engine_.ComputePointPairPenetration(poses_, parallel);
+  ASSERT_EQ(penetrations_serial.size(), N_);
+  ASSERT_EQ(penetrations_parallel.size(), penetrations_serial.size());
+  for (size_t i = 0; i < penetrations_serial.size(); ++i) {
+    const auto& expected = penetrations_serial[i];
+    const auto& actual = penetrations_parallel[i];
+    EXPECT_EQ(actual.id_A, expected.id_A);
+    EXPECT_EQ(actual.id_B, expected.id_B);
+    EXPECT_EQ(actual.p_WCa, expected.p_WCa);
+    EXPECT_EQ(actual.p_WCb, expected.p_WCb);
+    EXPECT_EQ(actual.nhat_BA_W, expected.nhat_BA_W);
+    EXPECT_EQ(actual.depth, expected.depth);
+  }
+
+  // Every pair of spheres in the ring is reported for an infinite distance.
+  const double kInf = std::numeric_limits<double>::infinity();
+  const auto distances_serial =
+      engine_.ComputeSignedDistancePairwiseClosestPoints(poses_, kInf, serial);
+  const auto distances_parallel =
+      engine_.ComputeSignedDistancePairwiseClosestPoints(poses_, kInf,
+                                                         parallel);
+  ASSERT_EQ(distances_serial.size(), N_ * (N_ - 1) / 2);
+  ASSERT_EQ(distances_parallel.size(), distances_serial.size());
+  for (size_t i = 0; i < distances_serial.size(); ++i) {
+    const auto& expected = distances_serial[i];
+    const auto& actual = distances_parallel[i];
+    EXPECT_EQ(actual.id_A, expected.id_A);
+    EXPECT_EQ(actual.id_B, expected.id_B);
+    EXPECT_EQ(actual.p_ACa, expected.p_ACa);
+    EXPECT_EQ(actual.p_BCb, expected.p_BCb);
+    EXPECT_EQ(actual.distance, expected.distance);
+    EXPECT_EQ(actual.nhat_BA_W, expected.nhat_BA_W);
+  }
+
+  // A finite distance culls distant pairs the same way.
+  const auto near_serial =
+      engine_.ComputeSignedDistancePairwiseClosestPoints(poses_, 0.0, serial);
+  const auto near_parallel =
+      engine_.ComputeSignedDistancePairwiseClosestPoints(poses_, 0.0, parallel);
+  ASSERT_EQ(near_parallel.size(), near_serial.size());
+  for (size_t i = 0; i < near_serial.size(); ++i) {
+    EXPECT_EQ(near_parallel[i].id_A, near_serial[i].id_A);
+    EXPECT_EQ(near_parallel[i].id_B, near_serial[i].id_B);
+    EXPECT_EQ(near_parallel[i].distance, near_serial[i].distance);
+  }
+
+  // Without the fallback, the rigid-rigid pairs are an error. Regardless of
+  // the number of threads, the error is reported for the same pair.
+  auto error_message = [this](Parallelism parallelism) {
+    try {
+      engine_.ComputeContactSurfaces(
+          HydroelasticContactRepresentation::kPolygon, poses_, parallelism);
+    } catch (const std::exception& e) {
+      return std::string(e.what());
+    }
+    return std::string();
+  };
+  const std::string serial_message = error_message(serial);
+  EXPECT_FALSE(serial_message.empty());
+  EXPECT_EQ(error_message(parallel), serial_message);
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
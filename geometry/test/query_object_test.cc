@@ -109,6 +109,11 @@ class QueryObjectTest : public ::testing::Test {
     return object.geometry_state();
   }
 
+  template <typename T>
+  static Parallelism get_proximity_parallelism(const QueryObject<T>& object) {
+    return object.proximity_parallelism();
+  }
+
   SceneGraph<double> scene_graph_;
 };
 
@@ -140,6 +145,33 @@ TEST_F(QueryObjectTest, CopySemantics) {
   EXPECT_TRUE(is_live(baked_from_baked));
 }
 
+// Confirms that live query objects report the proximity query parallelism of
+// their context's configuration and that baked copies retain it.
+TEST_F(QueryObjectTest, ProximityParallelism) {
+  SceneGraphConfig config;
+  config.proximity_query_num_threads = 3;
+  scene_graph_.set_config(config);
+
+  unique_ptr<Context<double>> live_context =
+      scene_graph_.CreateDefaultContext();
+  unique_ptr<QueryObject<double>> live_query_object =
+      MakeQueryObject(live_context.get(), &scene_graph_);
+  EXPECT_EQ(get_proximity_parallelism(*live_query_object).num_threads(), 3);
+
+  QueryObject<double> baked_from_live{*live_query_object};
+  EXPECT_EQ(get_proximity_parallelism(baked_from_live).num_threads(), 3);
+
+  QueryObject<double> baked_from_baked{baked_from_live};
+  EXPECT_EQ(get_proximity_parallelism(baked_from_baked).num_threads(), 3);
+
+  // Changing the SceneGraph's configuration doesn't affect existing contexts
+  // (or the query objects baked from them).
+  config.proximity_query_num_threads = 1;
+  scene_graph_.set_config(config);
+  EXPECT_EQ(get_proximity_parallelism(*live_query_object).num_threads(), 3);
+  EXPECT_EQ(get_proximity_parallelism(baked_from_live).num_threads(), 3);
+}
+
 // NOTE: This doesn't test the specific queries; GeometryQuery simply wraps
 // the class (SceneGraph) that actually *performs* those queries. The
 // correctness of those queries is handled in geometry_state_test.cc. The
@@ -211,6 +243,10 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   ImageLabel16I label;
   EXPECT_DEFAULT_ERROR(default_object.RenderLabelImage(
       color_camera, FrameId::get_new_id(), X_WC, &label));
+  EXPECT_DEFAULT_ERROR(default_object.RenderImages(
+      {{.parent_frame = FrameId::get_new_id(),
+        .color_camera = &color_camera,
+        .label_image = &label}}));
 
   EXPECT_DEFAULT_ERROR(default_object.GetRenderEngineByName("dummy"));
 
@@ -23,6 +23,7 @@ default_proximity_properties:
   hunt_crossley_dissipation: 7.0
   relaxation_time: 8.0
   point_stiffness: 9.0
+proximity_query_num_threads: 4
 )""";
 
 GTEST_TEST(SceneGraphConfigTest, YamlTest) {
@@ -37,6 +38,7 @@ GTEST_TEST(SceneGraphConfigTest, YamlTest) {
   EXPECT_EQ(props.hunt_crossley_dissipation, 7);
   EXPECT_EQ(props.relaxation_time, 8);
   EXPECT_EQ(props.point_stiffness, 9);
+  EXPECT_EQ(config.proximity_query_num_threads, 4);
   EXPECT_EQ("\n" + SaveYamlString(config), kExampleConfig);
 }
 
@@ -159,6 +161,15 @@ GTEST_TEST(SceneGraphConfigTest, ValidatePointStiffness) {
   // TODO(#21167) document a disposition for NaN.
 }
 
+GTEST_TEST(SceneGraphConfigTest, ValidateProximityQueryNumThreads) {
+  SceneGraphConfig config;
+  config.proximity_query_num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      config.ValidateOrThrow(),
+      "Invalid scene graph configuration:"
+      " 'proximity_query_num_threads' \\(0\\) must be a positive value.");
+}
+
 GTEST_TEST(SceneGraphConfigTest, ValidateCoulombFriction) {
   SceneGraphConfig config;
   auto& props = config.default_proximity_properties;
@@ -351,6 +351,45 @@ TEST_F(SceneGraphTest, RegisterDeformableGeometry) {
       "Non-deformable geometries.*Use get_pose_in_world().*.");
 }
 
+// Tests that the parallelism for updating deformable geometries is recorded in
+// the model, copied into new contexts, and used for configuration updates.
+TEST_F(SceneGraphTest, DeformableGeometryParallelism) {
+  EXPECT_EQ(scene_graph_.GetDeformableGeometryParallelism().num_threads(), 1);
+  scene_graph_.SetDeformableGeometryParallelism(Parallelism(2));
+  EXPECT_EQ(scene_graph_.GetDeformableGeometryParallelism().num_threads(), 2);
+
+  SourceId s_id = scene_graph_.RegisterSource();
+  constexpr double kRezHint = 0.5;
+  std::unique_ptr<GeometryInstance> geometry_instance = make_sphere_instance();
+  geometry_instance->set_proximity_properties(ProximityProperties());
+  GeometryId deformable_id = scene_graph_.RegisterDeformableGeometry(
+      s_id, scene_graph_.world_frame_id(), std::move(geometry_instance),
+      kRezHint);
+  const VolumeMesh<double>* mesh_ptr =
+      scene_graph_.model_inspector().GetReferenceMesh(deformable_id);
+  ASSERT_NE(mesh_ptr, nullptr);
+
+  CreateDefaultContext();
+  EXPECT_EQ(SceneGraphTester::GetGeometryState(scene_graph_, *context_)
+                .GetDeformableGeometryParallelism()
+                .num_threads(),
+            2);
+
+  // The configuration update refits the deformable geometry with the
+  // configured parallelism.
+  VectorX<double> q_WG(mesh_ptr->num_vertices() * 3);
+  for (int i = 0; i < mesh_ptr->num_vertices(); ++i) {
+    q_WG.segment<3>(3 * i) = 2.0 * mesh_ptr->vertex(i);
+  }
+  GeometryConfigurationVector<double> configuration_vector;
+  configuration_vector.set_value(deformable_id, q_WG);
+  scene_graph_.get_source_configuration_port(s_id).FixValue(
+      context_.get(), configuration_vector);
+  EXPECT_NO_THROW(
+      SceneGraphTester::FullConfigurationUpdate(scene_graph_, *context_));
+  EXPECT_EQ(query_object().GetConfigurationsInWorld(deformable_id), q_WG);
+}
+
 // Smoke test for registering a deformable geometry
 TEST_F(SceneGraphTest, RegisterUnsupportedDeformableGeometry) {
   constexpr double kRezHint = 0.5;
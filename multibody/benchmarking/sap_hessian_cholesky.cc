@@ -0,0 +1,130 @@
+// @file
+// Benchmarks for the block sparse Cholesky factorization of SAP Hessians.
+//
+// This measures the speedup of the multithreaded factorization and solves in
+// BlockSparseCholeskySolver (see SapSolverParameters::parallelism) over the
+// single threaded ones. The Hessian has the sparsity pattern of a SAP problem
+// for a square pile of free floating objects where each object is in contact
+// with its four neighbors. That is, there is one 6x6 block per clique, and
+// off-diagonal blocks couple neighboring cliques.
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+constexpr int kBlockSize = 6;
+
+// Makes the SPD Hessian for a grid of `grid_size` x `grid_size` cliques.
+BlockSparseSymmetricMatrix MakeGridHessian(int grid_size) {
+  const int num_cliques = grid_size * grid_size;
+  std::vector<std::vector<int>> sparsity(num_cliques);
+  for (int r = 0; r < grid_size; ++r) {
+    for (int c = 0; c < grid_size; ++c) {
+      const int i = r * grid_size + c;
+      sparsity[i].push_back(i);
+      if (c + 1 < grid_size) sparsity[i].push_back(i + 1);
+      if (r + 1 < grid_size) sparsity[i].push_back(i + grid_size);
+    }
+  }
+  const std::vector<int> block_sizes(num_cliques, kBlockSize);
+  BlockSparseSymmetricMatrix H(BlockSparsityPattern(block_sizes, sparsity));
+  for (int j = 0; j < num_cliques; ++j) {
+    for (int i : sparsity[j]) {
+      MatrixXd Hij(kBlockSize, kBlockSize);
+      for (int r = 0; r < kBlockSize; ++r) {
+        for (int c = 0; c < kBlockSize; ++c) {
+          Hij(r, c) = 0.1 * std::sin(1.0 + i + 2.0 * j + 3.0 * r + 5.0 * c);
+        }
+      }
+      if (i == j) {
+        // Diagonal dominance ensures SPDness.
+        Hij = Hij * Hij.transpose() +
+              10.0 * MatrixXd::Identity(kBlockSize, kBlockSize);
+      }
+      H.AddToBlock(i, j, Hij);
+    }
+  }
+  return H;
+}
+
+class SapHessianCholeskyBenchmark : public benchmark::Fixture {
+ public:
+  SapHessianCholeskyBenchmark() {
+    tools::performance::AddMinMaxStatistics(this);
+  }
+
+  // The benchmark arguments are the size of the grid of cliques and the number
+  // of threads.
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    const int grid_size = state.range(0);
+    const int num_threads = state.range(1);
+    H_ = std::make_unique<BlockSparseSymmetricMatrix>(
+        MakeGridHessian(grid_size));
+    b_ = VectorXd::LinSpaced(H_->cols(), -1.0, 1.0);
+    solver_.set_parallelism(Parallelism(num_threads));
+    solver_.SetMatrix(*H_);
+    DRAKE_DEMAND(solver_.Factor());
+  }
+
+ protected:
+  std::unique_ptr<BlockSparseSymmetricMatrix> H_;
+  VectorXd b_;
+  BlockSparseCholeskySolver<MatrixXd> solver_;
+};
+
+// Numeric factorization only, as done at each Newton iteration of SAP.
+BENCHMARK_DEFINE_F(SapHessianCholeskyBenchmark, Factor)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    solver_.UpdateMatrix(*H_);
+    benchmark::DoNotOptimize(solver_.Factor());
+  }
+}
+
+BENCHMARK_DEFINE_F(SapHessianCholeskyBenchmark, Solve)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  VectorXd x(b_.size());
+  for (auto _ : state) {
+    x = b_;
+    solver_.SolveInPlace(&x);
+    benchmark::DoNotOptimize(x.data());
+  }
+}
+
+BENCHMARK_REGISTER_F(SapHessianCholeskyBenchmark, Factor)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime()
+    ->ArgNames({"grid", "threads"})
+    ->ArgsProduct({{8, 16, 32}, {1, 2, 4, 8}});
+
+BENCHMARK_REGISTER_F(SapHessianCholeskyBenchmark, Solve)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime()
+    ->ArgNames({"grid", "threads"})
+    ->ArgsProduct({{8, 16, 32}, {1, 2, 4, 8}});
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <vector>
 
@@ -25,6 +26,43 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrix(const SymmetricMatrix& A) {
   SetMatrixImpl(A, elimination_ordering, std::move(L_block_pattern));
 }
 
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::SetMatrix(
+    const SymmetricMatrix& A,
+    std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+        symbolic_factorization) {
+  DRAKE_THROW_UNLESS(symbolic_factorization != nullptr);
+  const BlockSparsityPattern& A_block_pattern = A.sparsity_pattern();
+  if (*symbolic_factorization == nullptr ||
+      !(*symbolic_factorization)->IsCompatibleWith(A_block_pattern)) {
+    std::vector<int> elimination_ordering =
+        ComputeMinimumDegreeOrdering(A_block_pattern);
+    BlockSparsityPattern L_block_pattern =
+        SymbolicFactor(A, elimination_ordering);
+    *symbolic_factorization =
+        std::make_shared<const BlockSparseCholeskySymbolicFactorization>(
+            BlockSparseCholeskySymbolicFactorization{
+                A_block_pattern, std::move(elimination_ordering),
+                std::move(L_block_pattern)});
+  }
+  const BlockSparseCholeskySymbolicFactorization& symbolic =
+      **symbolic_factorization;
+  SetMatrixImpl(A, symbolic.elimination_ordering,
+                BlockSparsityPattern(symbolic.L_pattern));
+}
+
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::SetMatrixForIncompleteFactorization(
+    const SymmetricMatrix& A) {
+  /* The ordering that reduces fill-in for the complete factorization also
+   reduces the amount of fill-in that we drop. */
+  const std::vector<int> elimination_ordering =
+      ComputeMinimumDegreeOrdering(A.sparsity_pattern());
+  SetMatrixImpl(A, elimination_ordering,
+                CalcPermutedSparsityPattern(A, elimination_ordering));
+  incomplete_ = true;
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::UpdateMatrix(
     const SymmetricMatrix& A) {
@@ -35,7 +73,17 @@ void BlockSparseCholeskySolver<BlockType>::UpdateMatrix(
 template <typename BlockType>
 bool BlockSparseCholeskySolver<BlockType>::Factor() {
   DRAKE_THROW_UNLESS(solver_mode_ == SolverMode::kAnalyzed);
-  const bool success = CalcPartialFactorization(0, L_->block_cols());
+  [[maybe_unused]] const int num_threads = parallelism_.num_threads();
+#if defined(_OPENMP)
+  /* The elimination tree levels are only meaningful for the sparsity pattern of
+   a complete factorization. */
+  const bool operate_in_parallel = num_threads > 1 && !incomplete_;
+#else
+  constexpr bool operate_in_parallel = false;
+#endif
+  const bool success = operate_in_parallel
+                           ? CalcLevelScheduledFactorization(num_threads)
+                           : CalcPartialFactorization(0, L_->block_cols());
   solver_mode_ = success ? SolverMode::kFactored : SolverMode::kEmpty;
   return success;
 }
@@ -188,38 +236,87 @@ void BlockSparseCholeskySolver<BlockType>::SolveInPlace(
   const std::vector<int>& block_sizes = block_sparsity_pattern.block_sizes();
   const std::vector<int>& starting_cols = L_->starting_cols();
 
-  /* Solve Lz = b in place. */
-  for (int j = 0; j < L_->block_cols(); ++j) {
-    const int block_size = block_sizes[j];
-    const int offset = starting_cols[j];
-    /* Solve for the j-th block entry. */
-    const VectorX<double> bj =
-        L_diag_[j].matrixL().solve(permuted_b.segment(offset, block_size));
-    permuted_b.segment(offset, block_size) = bj;
-    /* Eliminate for the j-th block entry from the system. */
-    const auto& blocks_in_col_j = L_->block_row_indices(j);
-    for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
-      const int i = blocks_in_col_j[flat];
-      permuted_b.segment(starting_cols[i], block_sizes[i]).noalias() -=
-          L_->block_flat(flat, j) * bj;
+  [[maybe_unused]] const int num_threads = parallelism_.num_threads();
+#if defined(_OPENMP)
+  const bool operate_in_parallel = num_threads > 1 && !incomplete_;
+#else
+  constexpr bool operate_in_parallel = false;
+#endif
+
+  if (operate_in_parallel) {
+    /* Solve Lz = b in place, level by level in the elimination tree. Unlike
+     the serial code below, the j-th block entry gathers the contributions of
+     all previously solved entries (i.e., it works on the rows of L) so that
+     each thread only writes to the entries it is solving for. */
+    for (const std::vector<int>& level : elimination_tree_levels_) {
+      [[maybe_unused]] const int level_size = ssize(level);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (level_size > 1)
+#endif
+      for (int l = 0; l < level_size; ++l) {
+        const int j = level[l];
+        auto bj = permuted_b.segment(starting_cols[j], block_sizes[j]);
+        for (int k : L_row_blocks_[j]) {
+          bj.noalias() -=
+              L_->block(j, k) *
+              permuted_b.segment(starting_cols[k], block_sizes[k]);
+        }
+        L_diag_[j].matrixL().solveInPlace(bj);
+      }
+    }
+  } else {
+    /* Solve Lz = b in place. */
+    for (int j = 0; j < L_->block_cols(); ++j) {
+      const int block_size = block_sizes[j];
+      const int offset = starting_cols[j];
+      /* Solve for the j-th block entry. */
+      const VectorX<double> bj =
+          L_diag_[j].matrixL().solve(permuted_b.segment(offset, block_size));
+      permuted_b.segment(offset, block_size) = bj;
+      /* Eliminate for the j-th block entry from the system. */
+      const auto& blocks_in_col_j = L_->block_row_indices(j);
+      for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
+        const int i = blocks_in_col_j[flat];
+        permuted_b.segment(starting_cols[i], block_sizes[i]).noalias() -=
+            L_->block_flat(flat, j) * bj;
+      }
     }
   }
 
   VectorX<double>& permuted_z = permuted_b;
-  /* Solve Lᵀx = z in place. */
-  for (int j = L_->block_cols() - 1; j >= 0; --j) {
+  /* Solves for the j-th block entry of Lᵀx = z, assuming all entries i > j
+   with L(i, j) ≠ 0 have been solved for. */
+  auto solve_transpose_for_block = [&](int j) {
+    auto zj = permuted_z.segment(starting_cols[j], block_sizes[j]);
     /* Eliminate all solved variables. */
     const auto& blocks_in_col_j = L_->block_row_indices(j);
     for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
       const int i = blocks_in_col_j[flat];
-      permuted_z.segment(starting_cols[j], block_sizes[j]).noalias() -=
-          L_->block_flat(flat, j).transpose() *
-          permuted_z.segment(starting_cols[i], block_sizes[i]);
+      zj.noalias() -= L_->block_flat(flat, j).transpose() *
+                      permuted_z.segment(starting_cols[i], block_sizes[i]);
     }
     /* Solve for the j-th block entry. */
-    const VectorX<double> zj = L_diag_[j].matrixU().solve(
-        permuted_z.segment(starting_cols[j], block_sizes[j]));
-    permuted_z.segment(starting_cols[j], block_sizes[j]) = zj;
+    L_diag_[j].matrixU().solveInPlace(zj);
+  };
+  if (operate_in_parallel) {
+    /* Solve Lᵀx = z in place. Ancestors in the elimination tree are at higher
+     levels, so we traverse the levels in reverse order. */
+    for (int level_index = ssize(elimination_tree_levels_) - 1;
+         level_index >= 0; --level_index) {
+      const std::vector<int>& level = elimination_tree_levels_[level_index];
+      [[maybe_unused]] const int level_size = ssize(level);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (level_size > 1)
+#endif
+      for (int l = 0; l < level_size; ++l) {
+        solve_transpose_for_block(level[l]);
+      }
+    }
+  } else {
+    /* Solve Lᵀx = z in place. */
+    for (int j = L_->block_cols() - 1; j >= 0; --j) {
+      solve_transpose_for_block(j);
+    }
   }
   scalar_permutation_.ApplyInverse(permuted_z, b);
 }
@@ -254,13 +351,45 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrixImpl(
   block_permutation_ = PartialPermutation(std::move(permutation));
   /* Second documented responsibility: set `scalar_permutation_`. */
   SetScalarPermutation(A, elimination_ordering);
-  /* Third documented responsibility: allocate for `L_` and `L_diag_`. */
+  /* Third documented responsibility: allocate for `L_` and `L_diag_` and
+   analyze the elimination tree. */
   L_ = std::make_unique<LowerTriangularMatrix>(std::move(L_pattern));
   L_diag_.resize(A.block_cols());
+  CalcEliminationTreeLevels();
+  incomplete_ = false;
   /* Fourth documented responsibility: UpdateMatrix. */
   UpdateMatrix(A);
 }
 
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::CalcEliminationTreeLevels() {
+  const int n = L_->block_cols();
+  L_row_blocks_.assign(n, {});
+  /* The level of each block column, i.e., its height in the elimination tree.
+   */
+  std::vector<int> levels(n, 0);
+  int num_levels = n > 0 ? 1 : 0;
+  /* Since the parent of j is always greater than j, visiting the columns in
+   increasing order finalizes the level of each column before it's propagated
+   to its parent. That also keeps each entry in `L_row_blocks_` sorted. */
+  for (int j = 0; j < n; ++j) {
+    const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
+    /* We start from flat = 1 here to skip the j,j diagonal entry. */
+    for (int flat = 1; flat < ssize(blocks_in_col_j); ++flat) {
+      L_row_blocks_[blocks_in_col_j[flat]].push_back(j);
+    }
+    if (ssize(blocks_in_col_j) > 1) {
+      const int parent = blocks_in_col_j[1];
+      levels[parent] = std::max(levels[parent], levels[j] + 1);
+      num_levels = std::max(num_levels, levels[parent] + 1);
+    }
+  }
+  elimination_tree_levels_.assign(num_levels, {});
+  for (int j = 0; j < n; ++j) {
+    elimination_tree_levels_[levels[j]].push_back(j);
+  }
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::SetScalarPermutation(
     const SymmetricMatrix& A, const std::vector<int>& elimination_ordering) {
@@ -299,7 +428,17 @@ void BlockSparseCholeskySolver<BlockType>::SetScalarPermutation(
 template <typename BlockType>
 BlockSparsityPattern BlockSparseCholeskySolver<BlockType>::SymbolicFactor(
     const SymmetricMatrix& A, const std::vector<int>& elimination_ordering) {
-  /* 1. Compute the block permutation as well as the scalar permutation. */
+  /* Compute the sparsity pattern of L given the sparsity pattern of A in the
+   new ordering. */
+  return contact_solvers::internal::SymbolicCholeskyFactor(
+      CalcPermutedSparsityPattern(A, elimination_ordering));
+}
+
+template <typename BlockType>
+BlockSparsityPattern
+BlockSparseCholeskySolver<BlockType>::CalcPermutedSparsityPattern(
+    const SymmetricMatrix& A, const std::vector<int>& elimination_ordering) {
+  /* Compute the block permutation. */
   const int n = elimination_ordering.size();
   /* Construct the inverse of the elimination ordering, which permutes the
    original indices to new indices. */
@@ -327,11 +466,8 @@ BlockSparsityPattern BlockSparseCholeskySolver<BlockType>::SymbolicFactor(
   }
   std::vector<int> permuted_block_sizes(A.block_cols());
   block_permutation.Apply(A_block_sizes, &permuted_block_sizes);
-
-  /* Compute the sparsity pattern of L given the sparsity pattern of A in the
-   new ordering. */
-  return contact_solvers::internal::SymbolicCholeskyFactor(
-      BlockSparsityPattern(permuted_block_sizes, permuted_sparsity_pattern));
+  return BlockSparsityPattern(std::move(permuted_block_sizes),
+                              std::move(permuted_sparsity_pattern));
 }
 
 template <typename BlockType>
@@ -342,33 +478,86 @@ bool BlockSparseCholeskySolver<BlockType>::CalcPartialFactorization(
                starting_col_block <= L_->block_cols());
   DRAKE_DEMAND(ending_col_block >= 0 && ending_col_block <= L_->block_cols());
   for (int j = starting_col_block; j < ending_col_block; ++j) {
-    /* Update diagonal. */
-    const BlockType& Ajj = L_->diagonal_block(j);
-    L_diag_[j].compute(Ajj);
-    if (L_diag_[j].info() != Eigen::Success) {
+    if (!FactorColumn(j)) {
       return false;
     }
-    L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
-    /* Update L₂₁ column.
-     | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
-     | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
-     So we have
-      L₂₁λ₁₁ᵀ = a₂₁, and thus
-      λ₁₁L₂₁ᵀ = a₂₁ᵀ */
-    const std::vector<int>& row_blocks = L_->block_row_indices(j);
-    const auto Ljj = L_diag_[j].matrixL();
-    /* We start from flat = 1 here to skip the j,j diagonal entry. */
-    for (int flat = 1; flat < ssize(row_blocks); ++flat) {
-      const BlockType& Aij = L_->block_flat(flat, j);
-      BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
-      L_->SetBlockFlat(flat, j, std::move(Lij));
-    }
     /* Update L₂₂ according to L₂₂ = a₂₂ - L₂₁⋅L₂₁ᵀ. */
     RightLookingSymmetricRank1Update(j);
   }
   return true;
 }
 
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::FactorColumn(int j) {
+  /* Update diagonal. */
+  const BlockType& Ajj = L_->diagonal_block(j);
+  L_diag_[j].compute(Ajj);
+  if (L_diag_[j].info() != Eigen::Success) {
+    return false;
+  }
+  L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
+  /* Update L₂₁ column.
+   | a₁₁  *  | = | λ₁₁  0 | * | λ₁₁ᵀ L₂₁ᵀ |
+   | a₂₁ a₂₂ |   | L₂₁ L₂₂|   |  0   L₂₂ᵀ |
+   So we have
+    L₂₁λ₁₁ᵀ = a₂₁, and thus
+    λ₁₁L₂₁ᵀ = a₂₁ᵀ */
+  const std::vector<int>& row_blocks = L_->block_row_indices(j);
+  const auto Ljj = L_diag_[j].matrixL();
+  /* We start from flat = 1 here to skip the j,j diagonal entry. */
+  for (int flat = 1; flat < ssize(row_blocks); ++flat) {
+    const BlockType& Aij = L_->block_flat(flat, j);
+    BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
+    L_->SetBlockFlat(flat, j, std::move(Lij));
+  }
+  return true;
+}
+
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::LeftLookingUpdate(int j) {
+  for (int k : L_row_blocks_[j]) {
+    const std::vector<int>& blocks_in_col_k = L_->block_row_indices(k);
+    const int n = blocks_in_col_k.size();
+    /* The flat index of the (j, k) block in the k-th column. */
+    const int flat_jk = L_->block_row_to_flat()[k][j];
+    const BlockType& B = L_->block_flat(flat_jk, k);
+    /* These are exactly the updates RightLookingSymmetricRank1Update(k) would
+     apply to the j-th column. */
+    for (int l = flat_jk; l < n; ++l) {
+      const int row = blocks_in_col_k[l];
+      const BlockType& A = L_->block_flat(l, k);
+      L_->AddToBlock(row, j, -A * B.transpose());
+    }
+  }
+}
+
+template <typename BlockType>
+bool BlockSparseCholeskySolver<BlockType>::CalcLevelScheduledFactorization(
+    [[maybe_unused]] int num_threads) {
+  DRAKE_THROW_UNLESS(solver_mode() == SolverMode::kAnalyzed);
+  /* Columns within the same level have no ancestor/descendant relationship in
+   the elimination tree, so L(j, k) = 0 for any two of them, and each only
+   reads from columns in previous levels and writes to its own column. */
+  for (const std::vector<int>& level : elimination_tree_levels_) {
+    [[maybe_unused]] const int level_size = ssize(level);
+    std::atomic<bool> success{true};
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) if (level_size > 1)
+#endif
+    for (int l = 0; l < level_size; ++l) {
+      const int j = level[l];
+      LeftLookingUpdate(j);
+      if (!FactorColumn(j)) {
+        success = false;
+      }
+    }
+    if (!success) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
     int j) {
@@ -380,6 +569,8 @@ void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
     const BlockType& B = L_->block_flat(k, j);
     for (int l = k; l < n; ++l) {
       const int row = blocks_in_col_j[l];
+      /* Drop the fill-in for incomplete factorizations. */
+      if (incomplete_ && !L_->HasBlock(row, col)) continue;
       const BlockType& A = L_->block_flat(l, j);
       L_->AddToBlock(row, col, -A * B.transpose());
     }
@@ -8,6 +8,7 @@
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
@@ -17,6 +18,28 @@ namespace multibody {
 namespace contact_solvers {
 namespace internal {
 
+/* The symbolic analysis performed by BlockSparseCholeskySolver::SetMatrix(),
+ i.e., the elimination ordering of the blocks of a matrix A together with the
+ resulting block sparsity pattern of its Cholesky factor L. The analysis only
+ depends on the block sparsity pattern of A and it can therefore be reused for
+ any matrix with the same pattern. */
+struct BlockSparseCholeskySymbolicFactorization {
+  /* Returns true iff `this` is the analysis of matrices with block sparsity
+   pattern `A_block_pattern`. */
+  bool IsCompatibleWith(const BlockSparsityPattern& A_block_pattern) const {
+    return A_pattern.block_sizes() == A_block_pattern.block_sizes() &&
+           A_pattern.neighbors() == A_block_pattern.neighbors();
+  }
+
+  /* The block sparsity pattern of A. */
+  BlockSparsityPattern A_pattern;
+  /* Elimination ordering of the blocks of A. */
+  std::vector<int> elimination_ordering;
+  /* The block sparsity pattern of L when A is factored with the
+   `elimination_ordering`. */
+  BlockSparsityPattern L_pattern;
+};
+
 /* A Cholesky solver for solving the symmetric positive definite
  system
    A⋅x = b
@@ -41,6 +64,11 @@ namespace internal {
   x = solver.Solve(b);
  ```
 
+ Factor() and Solve() may optionally use multiple threads (see
+ set_parallelism()). Independent subtrees of the elimination tree of the
+ permuted matrix are processed concurrently, one level of the tree at a time,
+ and the result is bit-for-bit identical to the single-threaded one.
+
  @tparam BlockType The matrix type for individual block matrices;
  MatrixX<double> or Matrix3<double>. The fixed-size matrix version is preferred
  if you know the sizes of blocks are uniform and fixed. */
@@ -87,6 +115,37 @@ class BlockSparseCholeskySolver {
    @post solver_mode() == SolverMode::kAnalyzed. */
   void SetMatrix(const SymmetricMatrix& A);
 
+  /* Variant of SetMatrix() that reuses the symbolic analysis of a previous
+   matrix with the same sparsity pattern. If `*symbolic_factorization` is
+   non-null and compatible with the sparsity pattern of A, the (expensive)
+   computation of the elimination ordering and the symbolic factorization is
+   skipped. Otherwise, the analysis is performed and `*symbolic_factorization`
+   is overwritten with its result so that it can be reused later, possibly by
+   other solvers.
+   @pre symbolic_factorization != nullptr.
+   @pre A is positive definite.
+   @post solver_mode() == SolverMode::kAnalyzed. */
+  void SetMatrix(
+      const SymmetricMatrix& A,
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+          symbolic_factorization);
+
+  /* Variant of SetMatrix() that prepares for an incomplete Cholesky
+   factorization with zero fill-in, i.e., the blocks of L are restricted to the
+   block sparsity pattern of the permuted A and all fill-in outside of that
+   pattern is dropped by Factor(). Hence L⋅Lᵀ only approximates P⋅A⋅Pᵀ and
+   Solve() only approximately solves A⋅x = b, which is useful for
+   preconditioning iterative solvers. UpdateMatrix() may be used afterwards to
+   update the numerical values as usual. Note that Factor() may fail even when A
+   is positive definite. Factor() and Solve() are always single-threaded in this
+   mode.
+   @post solver_mode() == SolverMode::kAnalyzed. */
+  void SetMatrixForIncompleteFactorization(const SymmetricMatrix& A);
+
+  /* Returns true iff the matrix was last set with
+   SetMatrixForIncompleteFactorization(). */
+  bool is_incomplete() const { return incomplete_; }
+
   /* Updates the matrix to be factored. This is useful for solving a series of
    matrices with the same sparsity pattern using the same elimination ordering.
    For example, with matrices A and B with the same sparisty pattern. It's more
@@ -175,6 +234,15 @@ class BlockSparseCholeskySolver {
    @throws std::exception unless solver_mode() == SolverMode::kFactored. */
   void SolveInPlace(VectorX<double>* b) const;
 
+  /* Sets the parallelism used by Factor() and Solve(). The default is
+   Parallelism::None(). Multithreading is only effective when Drake is built
+   with OpenMP; otherwise this is a no-op. FactorAndCalcSchurComplement() is
+   always single-threaded. */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /* Returns the parallelism set via set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Returns the current mode of the solver. See SolverMode. */
   SolverMode solver_mode() const { return solver_mode_; }
 
@@ -198,7 +266,8 @@ class BlockSparseCholeskySolver {
    following:
     1. sets `block_permutation_`;
     2. sets `scalar_permutation_`;
-    3. allocates for `L_` and `L_diag_`;
+    3. allocates for `L_` and `L_diag_` and computes `L_row_blocks_` and
+       `elimination_tree_levels_`;
     4. calls UpdateMatrix(A) to copy the numeric values of A to L_.
    @param[in] A                     The matrix to be factored.
    @param[in] elimination_ordering  Elimination ordering of the blocks of A.
@@ -229,6 +298,15 @@ class BlockSparseCholeskySolver {
   BlockSparsityPattern SymbolicFactor(
       const SymmetricMatrix& A, const std::vector<int>& elimination_ordering);
 
+  /* Returns the block sparsity pattern of P⋅A⋅Pᵀ, where P is the block
+   permutation induced by the prescribed elimination ordering.
+   @param[in] A                     The matrix to be permuted.
+   @param[in] elimination_ordering  Elimination ordering of the blocks of A.
+                                    Must be a permutation of {0, 1, ...,
+                                    A.block_cols() - 1}. */
+  static BlockSparsityPattern CalcPermutedSparsityPattern(
+      const SymmetricMatrix& A, const std::vector<int>& elimination_ordering);
+
   /* Factorizes matrix A but in particular only processes a range of columns.
    If the range of columns is [0, L_.block_cols()), then this method performs a
    full factorization of A. Otherwise, this leaves the underlying factorization
@@ -243,6 +321,33 @@ class BlockSparseCholeskySolver {
    @pre 0 <= j < L.block_cols(). */
   void RightLookingSymmetricRank1Update(int j);
 
+  /* Computes the row structure of L (`L_row_blocks_`) and groups the block
+   columns of L by their level in the elimination tree
+   (`elimination_tree_levels_`).
+   @pre `L_` has been allocated with its final sparsity pattern. */
+  void CalcEliminationTreeLevels();
+
+  /* Computes the Cholesky factorization of the diagonal block of the j-th
+   block column of L and then scales the off-diagonal blocks of that column.
+   Returns false if the factorization of the diagonal block fails.
+   @pre All updates from block columns k < j have been applied to the j-th
+   block column. */
+  bool FactorColumn(int j);
+
+  /* Performs L(j:, j) -= L(j:, k) * L(j, k).transpose() for all k < j with
+   L(j, k) ≠ 0, in increasing order of k. Only writes into the j-th block
+   column of L.
+   @pre Block columns k < j with L(j, k) ≠ 0 have been fully factored. */
+  void LeftLookingUpdate(int j);
+
+  /* Computes the full factorization with a left-looking variant of
+   CalcPartialFactorization() that factors the block columns within each level
+   of the elimination tree concurrently. The floating point operations applied
+   to each block are the same (and in the same order) as the right-looking
+   CalcPartialFactorization(0, L_->block_cols()).
+   @pre solver_mode() == kAnalyzed. */
+  bool CalcLevelScheduledFactorization(int num_threads);
+
   /* Permutes the given matrix A with `block_permutation_` p and set L such that
    the lower triangular part of L satisfies L(p(i), p(j)) = A(i, j).
    @pre SetMarix() has been called. */
@@ -264,6 +369,22 @@ class BlockSparseCholeskySolver {
    index into L_. */
   PartialPermutation scalar_permutation_;
 
+  /* The row structure of L, i.e., `L_row_blocks_[i]` stores, in increasing
+   order, the indices of the block columns k < i such that L(i, k) ≠ 0. */
+  std::vector<std::vector<int>> L_row_blocks_;
+  /* Block columns of L grouped by their height in the elimination tree, the
+   parent of column j being the smallest i > j such that L(i, j) ≠ 0. Leaves
+   have level 0 and a column's level is strictly greater than those of all its
+   descendants, so that columns within the same level can be factored (and
+   solved for) independently once the preceding levels are done. */
+  std::vector<std::vector<int>> elimination_tree_levels_;
+
+  Parallelism parallelism_{Parallelism::None()};
+
+  /* Whether L is restricted to the sparsity pattern of the permuted A. See
+   SetMatrixForIncompleteFactorization(). */
+  bool incomplete_{false};
+
   reset_after_move<SolverMode> solver_mode_{SolverMode::kEmpty};
 };
 
@@ -34,12 +34,20 @@ bool MassMatrixPartitionEqualsJacobianPartition(
 }  // namespace
 
 BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
-    const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J)
-    : BlockSparseSuperNodalSolver(J.block_rows(), J.get_blocks(), A) {}
+    const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J,
+    Parallelism parallelism,
+    std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+        symbolic_factorization)
+    : BlockSparseSuperNodalSolver(J.block_rows(), J.get_blocks(), A,
+                                  symbolic_factorization) {
+  solver_.set_parallelism(parallelism);
+}
 
 BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
     int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
-    std::vector<Eigen::MatrixXd> mass_matrices)
+    std::vector<Eigen::MatrixXd> mass_matrices,
+    std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+        symbolic_factorization)
     : jacobian_blocks_(std::move(jacobian_blocks)),
       mass_matrices_(std::move(mass_matrices)) {
   const std::vector<int> jacobian_column_block_size =
@@ -80,7 +88,11 @@ BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
   /* The solver analyzes the sparsity pattern of the H_ (currently a zero
    matrix) so that subsequent updates to the matrix can use UpdateMatrix()
    that doesn't perform symbolic factorization and allocation. */
-  solver_.SetMatrix(*H_);
+  if (symbolic_factorization != nullptr) {
+    solver_.SetMatrix(*H_, symbolic_factorization);
+  } else {
+    solver_.SetMatrix(*H_);
+  }
 }
 
 BlockSparseSuperNodalSolver::~BlockSparseSuperNodalSolver() = default;
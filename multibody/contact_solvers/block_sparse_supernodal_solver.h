@@ -6,6 +6,7 @@
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
 
@@ -29,9 +30,19 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
      otherwise an exception is thrown.
    @param[in] J
      A BlockSparseMatrix specifying the Jacobian matrix. An exception is thrown
-     if there are more than two blocks within the same block row. */
-  BlockSparseSuperNodalSolver(const std::vector<MatrixX<double>>& A,
-                              const BlockSparseMatrix<double>& J);
+     if there are more than two blocks within the same block row.
+   @param[in] parallelism
+     Specifies the parallelism used to factor and solve H. See
+     BlockSparseCholeskySolver::set_parallelism().
+   @param[in, out] symbolic_factorization
+     If not nullptr, the symbolic analysis of H is read from (or, when
+     missing or incompatible with the sparsity of H, written to)
+     `*symbolic_factorization`. See BlockSparseCholeskySolver::SetMatrix(). */
+  BlockSparseSuperNodalSolver(
+      const std::vector<MatrixX<double>>& A, const BlockSparseMatrix<double>& J,
+      Parallelism parallelism = Parallelism::None(),
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+          symbolic_factorization = nullptr);
 
   ~BlockSparseSuperNodalSolver() final;
 
@@ -53,10 +64,14 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
      columns of the mass matrix and the block columns of the Jacobian J both
      induce a partition of the set {0, 1, ..., nᵥ - 1}, where nᵥ denotes the
      number of scalar variables. These two partitions must be the same,
-     otherwise an exception is thrown. */
-  BlockSparseSuperNodalSolver(int num_jacobian_row_blocks,
-                              std::vector<BlockTriplet> jacobian_blocks,
-                              std::vector<Eigen::MatrixXd> mass_matrices);
+     otherwise an exception is thrown.
+   @param[in, out] symbolic_factorization
+     See the public constructor. */
+  BlockSparseSuperNodalSolver(
+      int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
+      std::vector<Eigen::MatrixXd> mass_matrices,
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+          symbolic_factorization);
 
   /* NVI implementations. */
   bool DoSetWeightMatrix(
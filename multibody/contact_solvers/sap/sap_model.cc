@@ -19,12 +19,15 @@ using systems::Context;
 
 HessianFactorizationCache::HessianFactorizationCache(
     SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
-    const BlockSparseMatrix<double>* J) {
+    const BlockSparseMatrix<double>* J, Parallelism parallelism,
+    std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+        symbolic_factorization) {
   DRAKE_DEMAND(A != nullptr);
   DRAKE_DEMAND(J != nullptr);
   switch (type) {
     case SapHessianFactorizationType::kBlockSparseCholesky:
-      factorization_ = std::make_unique<BlockSparseSuperNodalSolver>(*A, *J);
+      factorization_ = std::make_unique<BlockSparseSuperNodalSolver>(
+          *A, *J, parallelism, symbolic_factorization);
       break;
     case SapHessianFactorizationType::kDense:
       factorization_ = std::make_unique<DenseSuperNodalSolver>(A, J);
@@ -63,9 +66,15 @@ void HessianFactorizationCache::SolveInPlace(
 }
 
 template <typename T>
-SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr,
-                      SapHessianFactorizationType hessian_type)
-    : problem_(problem_ptr), hessian_type_(hessian_type) {
+SapModel<T>::SapModel(
+    const SapContactProblem<T>* problem_ptr,
+    SapHessianFactorizationType hessian_type, Parallelism parallelism,
+    std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+        symbolic_factorization)
+    : problem_(problem_ptr),
+      hessian_type_(hessian_type),
+      parallelism_(parallelism),
+      symbolic_factorization_(symbolic_factorization) {
   // Graph to the original contact problem, including all cliques
   // (participating and non-participating).
   const ContactProblemGraph& graph = problem().graph();
@@ -330,7 +339,8 @@ void SapModel<double>::CalcHessianFactorizationCache(
   // sparse Hessians even when the factorization is not yet computed.
   if (hessian->is_empty()) {
     *hessian = HessianFactorizationCache(hessian_type_, &dynamics_matrix(),
-                                         &constraints_bundle().J());
+                                         &constraints_bundle().J(),
+                                         parallelism_, symbolic_factorization_);
   }
   const std::vector<MatrixX<double>>& G = EvalConstraintsHessian(context);
   hessian->UpdateWeightMatrixAndFactor(G);
@@ -4,6 +4,8 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint_bundle.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
@@ -138,10 +140,19 @@ class HessianFactorizationCache {
   // @warning This is a potentially expensive constructor, performing the
   // necessary symbolic analysis for the case of sparse factorizations.
   //
+  // The factorization and solves of a kBlockSparseCholesky factorization use
+  // `parallelism`. If `symbolic_factorization` is not nullptr, the symbolic
+  // analysis of a kBlockSparseCholesky factorization is reused from (or stored
+  // into) `*symbolic_factorization`, see BlockSparseSuperNodalSolver. Both are
+  // ignored for kDense factorizations.
+  //
   // @pre A and J are not nullptr.
-  HessianFactorizationCache(SapHessianFactorizationType type,
-                            const std::vector<MatrixX<double>>* A,
-                            const BlockSparseMatrix<double>* J);
+  HessianFactorizationCache(
+      SapHessianFactorizationType type, const std::vector<MatrixX<double>>* A,
+      const BlockSparseMatrix<double>* J,
+      Parallelism parallelism = Parallelism::None(),
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+          symbolic_factorization = nullptr);
 
   // @returns `true` if `this` factorization was never provided with a type and
   // matrices A and J.
@@ -212,10 +223,17 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
-  explicit SapModel(const SapContactProblem<T>* problem,
-                    SapHessianFactorizationType hessian_type =
-                        SapHessianFactorizationType::kBlockSparseCholesky);
+   The input `problem` must outlive `this` model. The factorization of the
+   Hessian uses `parallelism` and `symbolic_factorization`, see
+   HessianFactorizationCache. If not nullptr, `symbolic_factorization` must
+   also outlive `this` model. */
+  explicit SapModel(
+      const SapContactProblem<T>* problem,
+      SapHessianFactorizationType hessian_type =
+          SapHessianFactorizationType::kBlockSparseCholesky,
+      Parallelism parallelism = Parallelism::None(),
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+          symbolic_factorization = nullptr);
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
@@ -226,6 +244,9 @@ class SapModel {
   /* Returns the type of factorization used for the Hessian. */
   SapHessianFactorizationType hessian_type() const { return hessian_type_; }
 
+  /* Returns the parallelism used to factor the Hessian. */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Returns the number of (participating) cliques. */
   int num_cliques() const;
 
@@ -584,6 +605,9 @@ class SapModel {
   const SapContactProblem<T>* problem_{nullptr};
   SapHessianFactorizationType hessian_type_{
       SapHessianFactorizationType::kBlockSparseCholesky};
+  Parallelism parallelism_{Parallelism::None()};
+  std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>*
+      symbolic_factorization_{nullptr};
 
   /* TODO(amcastro-tri): Data below is heap allocated once per time step.
    Consider how to pre-allocate once to minimize heap allocation.
@@ -111,7 +111,8 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     return SapSolverStatus::kSuccess;
   }
   auto model = std::make_unique<SapModel<double>>(
-      &problem, parameters_.linear_solver_type);
+      &problem, parameters_.linear_solver_type, parameters_.parallelism,
+      &symbolic_factorization_);
   auto context = model->MakeContext();
   // Initialize context with v_guess.
   SetProblemVelocitiesIntoModelContext(*model, v_guess, context.get());
@@ -156,7 +157,8 @@ SapSolverStatus SapSolver<AutoDiffXd>::SolveWithGuess(
   // Create a <double> version of the problem and its model.
   std::unique_ptr<SapContactProblem<double>> problem = problem_ad.ToDouble();
   auto model = std::make_unique<SapModel<double>>(
-      problem.get(), parameters_.linear_solver_type);
+      problem.get(), parameters_.linear_solver_type, parameters_.parallelism,
+      &symbolic_factorization_);
   auto context = model->MakeContext();
   const VectorX<double> v_guess = math::DiscardGradient(v_guess_ad);
 
@@ -6,6 +6,8 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_model.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
 #include "drake/systems/framework/context.h"
@@ -165,6 +167,15 @@ struct SapSolverParameters {
 
   SapHessianFactorizationType linear_solver_type{
       SapHessianFactorizationType::kBlockSparseCholesky};
+
+  // Parallelism used to factor the Hessian and to solve for the search
+  // direction when linear_solver_type = kBlockSparseCholesky. Independent
+  // branches of the elimination tree of the Hessian are processed concurrently,
+  // which pays off for problems with many weakly coupled cliques (e.g., many
+  // robots or objects in contact with a common body). Results do not depend on
+  // the number of threads. Multithreading requires Drake to be built with
+  // OpenMP; otherwise this parameter has no effect.
+  Parallelism parallelism{Parallelism::None()};
 };
 
 // Struct used to store SAP solver statistics.
@@ -258,6 +269,30 @@ class SapSolver {
   // New parameters will affect the next call to SolveWithGuess().
   void set_parameters(const SapSolverParameters& parameters);
 
+  // (Advanced) Sets the symbolic analysis of the Hessian's sparsity used by the
+  // next call to SolveWithGuess(), typically obtained from
+  // symbolic_factorization() on a previous solve. The analysis is reused when
+  // the Hessian of the new problem has the same block sparsity pattern, i.e.,
+  // the same participating cliques coupled by the same clusters of
+  // constraints, so that only numeric factorizations are performed. Otherwise
+  // it is recomputed and replaced. Only used when
+  // SapSolverParameters::linear_solver_type is kBlockSparseCholesky.
+  void set_symbolic_factorization(
+      std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>
+          symbolic_factorization) {
+    symbolic_factorization_ = std::move(symbolic_factorization);
+  }
+
+  // Returns the symbolic analysis of the Hessian used by the last call to
+  // SolveWithGuess(), or the one provided with set_symbolic_factorization() if
+  // no analysis was needed since. Since consecutive calls to SolveWithGuess()
+  // on `this` solver reuse it automatically, this is only needed to share the
+  // analysis among solvers.
+  const std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>&
+  symbolic_factorization() const {
+    return symbolic_factorization_;
+  }
+
   // Returns solver statistics from the last call to SolveWithGuess().
   // Statistics are reset with SapStatistics::Reset() on each new call to
   // SolveWithGuess().
@@ -445,6 +480,9 @@ class SapSolver {
     requires std::is_same_v<T, double>;
 
   SapSolverParameters parameters_;
+  // Symbolic analysis of the Hessian, reused across calls to SolveWithGuess().
+  std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>
+      symbolic_factorization_;
   // Stats are mutable so we can update them from within const methods (e.g.
   // Eval() methods). Nothing in stats is allowed to affect the computation; it
   // is purely a passive observer.
@@ -891,6 +891,11 @@ class SapNewtonIterationTest
     params_supernodal.line_search_type = GetParam();
     const VectorXd v_supernodal = SolveWithGuess(params_supernodal, v_guess);
 
+    // The supernodal factorization gives the same results when multithreaded.
+    SapSolverParameters params_parallel = params_supernodal;
+    params_parallel.parallelism = Parallelism(2);
+    EXPECT_EQ(SolveWithGuess(params_parallel, v_guess), v_supernodal);
+
     // Perform computation with dense algebra.
     SapSolverParameters params_dense;  // Default set of parameters.
     params_dense.linear_solver_type = SapHessianFactorizationType::kDense;
@@ -1062,6 +1067,44 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Consecutive solves of problems with the same sparsity reuse the symbolic
+// analysis of the Hessian and produce the same results as solves that perform
+// the full analysis.
+TEST_P(SapNewtonIterationTest, ReuseSymbolicFactorization) {
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  EXPECT_EQ(sap.symbolic_factorization(), nullptr);
+
+  // Arbitrary initial guess outside the constraint bounds to force Newton
+  // iterations.
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+  SapSolverResults<double> result;
+  ASSERT_EQ(sap.SolveWithGuess(*sap_problem_, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  const auto symbolic_factorization = sap.symbolic_factorization();
+  ASSERT_NE(symbolic_factorization, nullptr);
+
+  // Solving again reuses the analysis.
+  SapSolverResults<double> second_result;
+  ASSERT_EQ(sap.SolveWithGuess(*sap_problem_, v_guess, &second_result),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(sap.symbolic_factorization(), symbolic_factorization);
+  EXPECT_EQ(second_result.v, result.v);
+
+  // The analysis can be shared with other solvers.
+  SapSolver<double> other_sap;
+  other_sap.set_parameters(params);
+  other_sap.set_symbolic_factorization(symbolic_factorization);
+  SapSolverResults<double> other_result;
+  ASSERT_EQ(other_sap.SolveWithGuess(*sap_problem_, v_guess, &other_result),
+            SapSolverStatus::kSuccess);
+  EXPECT_EQ(other_sap.symbolic_factorization(), symbolic_factorization);
+  EXPECT_EQ(other_result.v, result.v);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
@@ -1,5 +1,6 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
+#include <cmath>
 #include <memory>
 #include <numeric>
 #include <utility>
@@ -163,6 +164,237 @@ GTEST_TEST(BlockSparseCholeskySolverTest, FailureDueToNonSpdness) {
   }
 }
 
+GTEST_TEST(BlockSparseCholeskySolverTest, ReuseSymbolicFactorization) {
+  const BlockSparseSymmetricMatrix A = MakeSparseSpdMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), 0.0, 1.0);
+
+  /* The symbolic analysis is computed and stored when none is provided. */
+  std::shared_ptr<const BlockSparseCholeskySymbolicFactorization> symbolic;
+  BlockSparseCholeskySolver<MatrixXd> solver;
+  solver.SetMatrix(A, &symbolic);
+  ASSERT_NE(symbolic, nullptr);
+  EXPECT_TRUE(symbolic->IsCompatibleWith(A.sparsity_pattern()));
+  ASSERT_TRUE(solver.Factor());
+  EXPECT_TRUE(CompareMatrices(solver.Solve(b),
+                              A.MakeDenseMatrix().llt().solve(b), 1e-13));
+
+  /* A different solver for a matrix with the same sparsity pattern reuses the
+   analysis and gives the same results as a full analysis. */
+  const BlockSparseSymmetricMatrix A2 = MakeSparseSpdMatrix(10);
+  const BlockSparseCholeskySymbolicFactorization* const symbolic_ptr =
+      symbolic.get();
+  BlockSparseCholeskySolver<MatrixXd> reusing_solver;
+  reusing_solver.SetMatrix(A2, &symbolic);
+  EXPECT_EQ(symbolic.get(), symbolic_ptr);
+  ASSERT_TRUE(reusing_solver.Factor());
+  BlockSparseCholeskySolver<MatrixXd> expected_solver;
+  expected_solver.SetMatrix(A2);
+  ASSERT_TRUE(expected_solver.Factor());
+  EXPECT_TRUE(CompareMatrices(reusing_solver.L().MakeDenseMatrix(),
+                              expected_solver.L().MakeDenseMatrix(), 0.0));
+  EXPECT_EQ(reusing_solver.CalcPermutationMatrix().indices(),
+            expected_solver.CalcPermutationMatrix().indices());
+  EXPECT_EQ(reusing_solver.Solve(b), expected_solver.Solve(b));
+
+  /* An incompatible analysis is replaced. */
+  std::vector<std::vector<int>> sparsity;
+  sparsity.emplace_back(std::vector<int>{0, 1});
+  sparsity.emplace_back(std::vector<int>{1});
+  BlockSparseSymmetricMatrix A3(BlockSparsityPattern({3, 2}, sparsity));
+  A3.AddToBlock(0, 0, Matrix3d::Identity());
+  A3.AddToBlock(1, 1, Eigen::Matrix2d::Identity());
+  EXPECT_FALSE(symbolic->IsCompatibleWith(A3.sparsity_pattern()));
+  reusing_solver.SetMatrix(A3, &symbolic);
+  EXPECT_NE(symbolic.get(), symbolic_ptr);
+  EXPECT_TRUE(symbolic->IsCompatibleWith(A3.sparsity_pattern()));
+  ASSERT_TRUE(reusing_solver.Factor());
+  const VectorXd b3 = VectorXd::LinSpaced(5, 0.0, 1.0);
+  EXPECT_TRUE(CompareMatrices(reusing_solver.Solve(b3), b3, 1e-15));
+}
+
+/* Makes an SPD matrix with `num_trees` independent chains of `chain_length`
+ blocks each, all of which are coupled to a single trailing "root" block. This
+ gives an elimination tree with many independent subtrees, similar to the
+ Hessians of SAP problems with several trees of bodies in contact with a
+ common body. All blocks are of size `block_size`. The scaling factor can be
+ used to control the values of each nonzero entry. */
+template <typename BlockType>
+BlockSparseLowerTriangularOrSymmetricMatrix<BlockType, true>
+MakeForestSpdMatrix(int num_trees, int chain_length, int block_size,
+                    double scale = 1.0) {
+  const int num_blocks = num_trees * chain_length + 1;
+  const int root = num_blocks - 1;
+  std::vector<std::vector<int>> sparsity(num_blocks);
+  for (int t = 0; t < num_trees; ++t) {
+    for (int c = 0; c < chain_length; ++c) {
+      const int i = t * chain_length + c;
+      sparsity[i].push_back(i);
+      if (c + 1 < chain_length) {
+        sparsity[i].push_back(i + 1);
+      }
+      sparsity[i].push_back(root);
+    }
+  }
+  sparsity[root].push_back(root);
+  const std::vector<int> block_sizes(num_blocks, block_size);
+  BlockSparseLowerTriangularOrSymmetricMatrix<BlockType, true> A(
+      BlockSparsityPattern(block_sizes, sparsity));
+  for (int j = 0; j < num_blocks; ++j) {
+    for (int i : sparsity[j]) {
+      BlockType Aij(block_size, block_size);
+      for (int r = 0; r < block_size; ++r) {
+        for (int c = 0; c < block_size; ++c) {
+          Aij(r, c) = 0.1 * std::sin(1.0 + i + 2.0 * j + 3.0 * r + 5.0 * c);
+        }
+      }
+      if (i == j) {
+        /* Diagonal dominance ensures SPDness. */
+        Aij = Aij * Aij.transpose() +
+              4.0 * num_blocks * BlockType::Identity(block_size, block_size);
+      }
+      A.AddToBlock(i, j, scale * Aij);
+    }
+  }
+  return A;
+}
+
+/* Factoring and solving in parallel gives the same results as doing it on a
+ single thread. */
+template <typename BlockType>
+void TestParallelMatchesSerial(int block_size) {
+  using SymmetricMatrix =
+      typename BlockSparseCholeskySolver<BlockType>::SymmetricMatrix;
+  const SymmetricMatrix A = MakeForestSpdMatrix<BlockType>(6, 4, block_size);
+  const MatrixXd dense_A = A.MakeDenseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+
+  BlockSparseCholeskySolver<BlockType> serial_solver;
+  serial_solver.SetMatrix(A);
+  ASSERT_TRUE(serial_solver.Factor());
+  const VectorXd serial_x = serial_solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(serial_x, dense_A.llt().solve(b), 1e-13));
+
+  BlockSparseCholeskySolver<BlockType> parallel_solver;
+  parallel_solver.set_parallelism(Parallelism(2));
+  EXPECT_EQ(parallel_solver.parallelism().num_threads(), 2);
+  parallel_solver.SetMatrix(A);
+  ASSERT_TRUE(parallel_solver.Factor());
+  /* The factorization performs exactly the same floating point operations. */
+  EXPECT_TRUE(CompareMatrices(parallel_solver.L().MakeDenseMatrix(),
+                              serial_solver.L().MakeDenseMatrix(), 0.0));
+  EXPECT_TRUE(CompareMatrices(parallel_solver.Solve(b), serial_x, 0.0));
+
+  /* Refactoring after updating the values works in parallel as well. */
+  const SymmetricMatrix A2 =
+      MakeForestSpdMatrix<BlockType>(6, 4, block_size, 10.0);
+  parallel_solver.UpdateMatrix(A2);
+  ASSERT_TRUE(parallel_solver.Factor());
+  EXPECT_TRUE(CompareMatrices(parallel_solver.Solve(b),
+                              A2.MakeDenseMatrix().llt().solve(b), 1e-13));
+
+  /* Failures are reported in parallel as well. */
+  SymmetricMatrix negative_A = A;
+  for (int j = 0; j < A.block_cols(); ++j) {
+    negative_A.AddToBlock(j, j, -2.0 * A.diagonal_block(j));
+  }
+  parallel_solver.SetMatrix(negative_A);
+  EXPECT_FALSE(parallel_solver.Factor());
+  EXPECT_EQ(parallel_solver.solver_mode(),
+            BlockSparseCholeskySolver<BlockType>::SolverMode::kEmpty);
+}
+
+GTEST_TEST(BlockSparseCholeskySolverTest, ParallelMatchesSerial) {
+  TestParallelMatchesSerial<MatrixXd>(2);
+  TestParallelMatchesSerial<Matrix3d>(3);
+}
+
+/* With no fill-in to drop, the incomplete factorization is exact. */
+GTEST_TEST(BlockSparseCholeskySolverTest, IncompleteWithoutFillIn) {
+  /* The minimum degree ordering eliminates the chains from their ends, which
+   only connects blocks that are already connected. */
+  const BlockSparseLowerTriangularOrSymmetricMatrix<Matrix3d, true> A =
+      MakeForestSpdMatrix<Matrix3d>(3, 4, 3);
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+  BlockSparseCholeskySolver<Matrix3d> solver;
+  /* Parallelism is ignored for incomplete factorizations. */
+  solver.set_parallelism(Parallelism(2));
+  solver.SetMatrixForIncompleteFactorization(A);
+  EXPECT_TRUE(solver.is_incomplete());
+  ASSERT_TRUE(solver.Factor());
+  EXPECT_TRUE(CompareMatrices(solver.Solve(b),
+                              A.MakeDenseMatrix().llt().solve(b), 1e-13));
+
+  /* Setting the matrix again resets to a complete factorization. */
+  solver.SetMatrix(A);
+  EXPECT_FALSE(solver.is_incomplete());
+}
+
+/* An incomplete Cholesky factorization with zero fill-in has the sparsity
+ pattern of A and matches A on that pattern, i.e. (L⋅Lᵀ)ᵢⱼ = (P⋅A⋅Pᵀ)ᵢⱼ for all
+ blocks i, j in the pattern of P⋅A⋅Pᵀ. */
+GTEST_TEST(BlockSparseCholeskySolverTest, IncompleteDropsFillIn) {
+  /* A ring of blocks, where eliminating any block causes fill-in. */
+  const int num_blocks = 6;
+  const int block_size = 3;
+  std::vector<std::vector<int>> sparsity(num_blocks);
+  for (int i = 0; i < num_blocks; ++i) {
+    sparsity[i].push_back(i);
+    if (i + 1 < num_blocks) sparsity[i].push_back(i + 1);
+  }
+  sparsity[0].push_back(num_blocks - 1);
+  BlockSparseLowerTriangularOrSymmetricMatrix<Matrix3d, true> A(
+      BlockSparsityPattern(std::vector<int>(num_blocks, block_size),
+                           sparsity));
+  for (int j = 0; j < num_blocks; ++j) {
+    for (int i : sparsity[j]) {
+      Matrix3d Aij;
+      for (int r = 0; r < block_size; ++r) {
+        for (int c = 0; c < block_size; ++c) {
+          Aij(r, c) = 0.5 * std::cos(2.0 + i + 3.0 * j + r - 2.0 * c);
+        }
+      }
+      if (i == j) {
+        Aij = Aij * Aij.transpose() + 4.0 * Matrix3d::Identity();
+      }
+      A.AddToBlock(i, j, Aij);
+    }
+  }
+
+  BlockSparseCholeskySolver<Matrix3d> solver;
+  solver.SetMatrixForIncompleteFactorization(A);
+  ASSERT_TRUE(solver.Factor());
+  const MatrixXd P = solver.CalcPermutationMatrix();
+  const MatrixXd PAPt = P * A.MakeDenseMatrix() * P.transpose();
+  const MatrixXd L = solver.L().MakeDenseMatrix();
+  const MatrixXd LLt = L * L.transpose();
+  int num_dropped_blocks = 0;
+  for (int j = 0; j < num_blocks; ++j) {
+    for (int i = j; i < num_blocks; ++i) {
+      const auto PAPt_ij = PAPt.block<3, 3>(3 * i, 3 * j);
+      if (PAPt_ij.isZero(0.0)) {
+        EXPECT_TRUE((L.block<3, 3>(3 * i, 3 * j).isZero(0.0)));
+        if (!(LLt.block<3, 3>(3 * i, 3 * j).isZero(0.0))) {
+          ++num_dropped_blocks;
+        }
+      } else {
+        EXPECT_TRUE(CompareMatrices(LLt.block<3, 3>(3 * i, 3 * j), PAPt_ij,
+                                    1e-13));
+      }
+    }
+  }
+  /* The approximation is not exact. */
+  EXPECT_GT(num_dropped_blocks, 0);
+
+  /* The complete factorization of the same matrix solves exactly. */
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 2.0);
+  const VectorXd x_incomplete = solver.Solve(b);
+  solver.SetMatrix(A);
+  ASSERT_TRUE(solver.Factor());
+  const VectorXd x = solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(x, A.MakeDenseMatrix().llt().solve(b), 1e-13));
+  EXPECT_FALSE(CompareMatrices(x_incomplete, x, 1e-6));
+}
+
 GTEST_TEST(BlockSparseCholeskySolverTest, FactorBeforeSetMatrixThrows) {
   BlockSparseCholeskySolver<MatrixXd> solver;
   EXPECT_THROW(unused(solver.Factor()), std::exception);
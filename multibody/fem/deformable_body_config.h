@@ -44,6 +44,28 @@ enum class MaterialModel {
   kLinear,
 };
 
+/** Types of preconditioners for the conjugate gradient iterations used to
+ solve the linear systems that arise in each Newton iteration when advancing
+ deformable bodies with nonlinear material models. They have no effect for
+ MaterialModel::kLinear, whose linear system is solved directly. */
+enum class LinearSolverPreconditioner {
+  /** Jacobi preconditioner, i.e., the inverse of the diagonal of the tangent
+   matrix. The cheapest to set up, but it does little for stiff materials or
+   fine meshes. */
+  kDiagonal,
+  /** Block Jacobi preconditioner, i.e., the inverse of the 3x3 diagonal blocks
+   of the tangent matrix, one per vertex. Almost as cheap as kDiagonal while
+   accounting for the coupling between the coordinates of each vertex. */
+  kBlockJacobi,
+  /** Incomplete block Cholesky factorization with zero fill-in of the tangent
+   matrix. The most expensive to set up, but it usually reduces the number of
+   conjugate gradient iterations the most. Requires the assembled tangent
+   matrix, so block Jacobi is used instead if the matrix-free tangent is in
+   use (see DeformableBodyConfig::set_use_matrix_free_tangent()). If the
+   incomplete factorization fails, block Jacobi is used as a fallback. */
+  kIncompleteCholesky,
+};
+
 /** %DeformableBodyConfig stores the physical parameters for a deformable body.
  A default constructed configuration approximately represents a hard rubber
  material (density, elasticity, and poisson's ratio) without any damping.
@@ -67,6 +89,15 @@ enum class MaterialModel {
  - Material model: The constitutive model that describes the stress-strain
    relationship of the body, see MaterialModel. Default to
    MaterialModel::kCorotated.
+
+ In addition, the config contains the following numerical parameters used to
+ advance the body in time:
+ - Linear solver preconditioner: The preconditioner for the iterative linear
+   solver, see LinearSolverPreconditioner. Default to
+   LinearSolverPreconditioner::kDiagonal.
+ - Use matrix-free tangent: Whether the iterative linear solver applies the
+   tangent matrix element by element instead of assembling it on every Newton
+   iteration. Default to false.
  @tparam_nonsymbolic_scalar */
 template <typename T>
 class DeformableBodyConfig {
@@ -109,6 +140,21 @@ class DeformableBodyConfig {
     material_model_ = material_model;
   }
 
+  void set_linear_solver_preconditioner(
+      LinearSolverPreconditioner linear_solver_preconditioner) {
+    linear_solver_preconditioner_ = linear_solver_preconditioner;
+  }
+
+  /** When `use_matrix_free_tangent` is true, the conjugate gradient iterations
+   apply the tangent matrix as a sum of element contributions instead of
+   assembling the global sparse matrix on every Newton iteration. This saves
+   the assembly cost (and the associated memory traffic) for large meshes,
+   especially when few conjugate gradient iterations are needed per Newton
+   iteration. */
+  void set_use_matrix_free_tangent(bool use_matrix_free_tangent) {
+    use_matrix_free_tangent_ = use_matrix_free_tangent;
+  }
+
   /** Returns the Young's modulus, with unit of N/m². */
   const T& youngs_modulus() const { return youngs_modulus_; }
   /** Returns the Poisson's ratio, unitless. */
@@ -125,6 +171,13 @@ class DeformableBodyConfig {
   const T& mass_density() const { return mass_density_; }
   /** Returns the constitutive model of the material. */
   MaterialModel material_model() const { return material_model_; }
+  /** Returns the preconditioner for the iterative linear solver. */
+  LinearSolverPreconditioner linear_solver_preconditioner() const {
+    return linear_solver_preconditioner_;
+  }
+  /** Returns true if the tangent matrix is applied without assembling it. See
+   set_use_matrix_free_tangent(). */
+  bool use_matrix_free_tangent() const { return use_matrix_free_tangent_; }
 
  private:
   T youngs_modulus_{1e8};
@@ -133,6 +186,9 @@ class DeformableBodyConfig {
   T stiffness_damping_coefficient_{0};
   T mass_density_{1.5e3};
   MaterialModel material_model_{MaterialModel::kLinearCorotated};
+  LinearSolverPreconditioner linear_solver_preconditioner_{
+      LinearSolverPreconditioner::kDiagonal};
+  bool use_matrix_free_tangent_{false};
 };
 
 }  // namespace fem
@@ -67,6 +67,39 @@ void FemModel<T>::CalcTangentMatrix(
   }
 }
 
+template <typename T>
+void FemModel<T>::MultiplyByTangentMatrix(const FemState<T>& fem_state,
+                                          const Eigen::Ref<const VectorX<T>>& x,
+                                          EigenPtr<VectorX<T>> y) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(y != nullptr);
+    DRAKE_DEMAND(x.size() == num_dofs());
+    DRAKE_DEMAND(y->size() == num_dofs());
+    ThrowIfModelStateIncompatible(__func__, fem_state);
+    DoMultiplyByTangentMatrix(fem_state, x, y);
+  } else {
+    throw std::logic_error(
+        "FemModel::MultiplyByTangentMatrix() only supports double at the "
+        "moment.");
+  }
+}
+
+template <typename T>
+void FemModel<T>::CalcTangentMatrixDiagonalBlocks(
+    const FemState<T>& fem_state,
+    std::vector<Matrix3<T>>* diagonal_blocks) const {
+  if constexpr (std::is_same_v<T, double>) {
+    DRAKE_DEMAND(diagonal_blocks != nullptr);
+    ThrowIfModelStateIncompatible(__func__, fem_state);
+    diagonal_blocks->resize(num_nodes());
+    DoCalcTangentMatrixDiagonalBlocks(fem_state, diagonal_blocks);
+  } else {
+    throw std::logic_error(
+        "FemModel::CalcTangentMatrixDiagonalBlocks() only supports double at "
+        "the moment.");
+  }
+}
+
 template <typename T>
 std::unique_ptr<contact_solvers::internal::Block3x3SparseSymmetricMatrix>
 FemModel<T>::MakeTangentMatrix() const {
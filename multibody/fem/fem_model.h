@@ -171,6 +171,33 @@ class FemModel {
       contact_solvers::internal::Block3x3SparseSymmetricMatrix* tangent_matrix)
       const;
 
+  /** Calculates y = A⋅x, where A is the tangent matrix evaluated at the given
+   FEM state (exactly as computed by CalcTangentMatrix(), including the
+   treatment of Dirichlet boundary conditions), without assembling A. Instead,
+   the product is accumulated element by element from the element tangent
+   matrices.
+   @param[in] fem_state  The FemState used to evaluate the tangent matrix.
+   @param[in] x          The vector to be multiplied, of size num_dofs().
+   @param[out] y         The product A⋅x, of size num_dofs().
+   @pre y != nullptr.
+   @pre x.size() == y->size() == num_dofs().
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if T is not double. */
+  void MultiplyByTangentMatrix(const FemState<T>& fem_state,
+                               const Eigen::Ref<const VectorX<T>>& x,
+                               EigenPtr<VectorX<T>> y) const;
+
+  /** Calculates the 3x3 diagonal blocks of the tangent matrix evaluated at the
+   given FEM state (exactly as computed by CalcTangentMatrix()) without
+   assembling the full matrix. On return, `diagonal_blocks` has num_nodes()
+   entries and the i-th entry is the diagonal block for the i-th node.
+   @pre diagonal_blocks != nullptr.
+   @throws std::exception if the FEM state is incompatible with this model.
+   @throws std::exception if T is not double. */
+  void CalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state,
+      std::vector<Matrix3<T>>* diagonal_blocks) const;
+
   /** Creates a symmetric block sparse matrix that has the sparsity pattern
    of the tangent matrix of this FEM model. In particular, the size of the
    tangent matrix is `num_dofs()` by `num_dofs()`. All entries are initialized
@@ -264,6 +291,22 @@ class FemModel {
       contact_solvers::internal::Block3x3SparseSymmetricMatrix* tangent_matrix)
       const = 0;
 
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI MultiplyByTangentMatrix(). The input `fem_state` is guaranteed to be
+   compatible with `this` FEM model, and the output `y` is guaranteed to be
+   non-null and properly sized. */
+  virtual void DoMultiplyByTangentMatrix(const FemState<T>& fem_state,
+                                         const Eigen::Ref<const VectorX<T>>& x,
+                                         EigenPtr<VectorX<T>> y) const = 0;
+
+  /** FemModelImpl must override this method to provide an implementation for
+   the NVI CalcTangentMatrixDiagonalBlocks(). The input `fem_state` is
+   guaranteed to be compatible with `this` FEM model, and `diagonal_blocks` is
+   guaranteed to be non-null and of size num_nodes(). */
+  virtual void DoCalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state,
+      std::vector<Matrix3<T>>* diagonal_blocks) const = 0;
+
   /** FemModelImpl must override this method to provide an implementation for
    the NVI MakeTangentMatrix(). */
   virtual std::unique_ptr<
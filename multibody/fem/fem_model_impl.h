@@ -146,6 +146,93 @@ class FemModelImpl : public FemModel<typename Element::T> {
     }
   }
 
+  void DoMultiplyByTangentMatrix(const FemState<T>& fem_state,
+                                 const Eigen::Ref<const VectorX<T>>& x,
+                                 EigenPtr<VectorX<T>> y) const final {
+    if constexpr (std::is_same_v<T, double>) {
+      y->setZero();
+      constexpr int kDim = 3;
+      const std::vector<Data>& element_data =
+          fem_state.template EvalElementData<Data>(element_data_index_);
+      const auto& boundary_nodes =
+          this->dirichlet_boundary_condition().index_to_boundary_state();
+      /* Scratch space for the element-local portions of x and y. */
+      Vector<T, Element::num_dofs> x_e;
+      Vector<T, Element::num_dofs> y_e;
+      std::array<bool, Element::num_nodes> is_boundary_node;
+      for (int e = 0; e < num_elements(); ++e) {
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          const FemNodeIndex i = element_node_indices[a];
+          is_boundary_node[a] =
+              !boundary_nodes.empty() && boundary_nodes.contains(i);
+          /* The columns for nodes under the boundary condition are zeroed out
+           in the tangent matrix, see CalcTangentMatrix(). */
+          if (is_boundary_node[a]) {
+            x_e.template segment<kDim>(kDim * a).setZero();
+          } else {
+            x_e.template segment<kDim>(kDim * a) =
+                x.template segment<kDim>(kDim * i);
+          }
+        }
+        const Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>&
+            element_tangent_matrix = element_data[e].tangent_matrix;
+        y_e.noalias() = element_tangent_matrix * x_e;
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          const int i = element_node_indices[a];
+          if (is_boundary_node[a]) {
+            /* Only the diagonal entries remain in the rows for the nodes under
+             the boundary condition. */
+            y->template segment<kDim>(kDim * i) +=
+                element_tangent_matrix
+                    .template block<kDim, kDim>(kDim * a, kDim * a)
+                    .diagonal()
+                    .cwiseProduct(x.template segment<kDim>(kDim * i));
+          } else {
+            y->template segment<kDim>(kDim * i) +=
+                y_e.template segment<kDim>(kDim * a);
+          }
+        }
+      }
+    } else {
+      unused(fem_state, x, y);
+      DRAKE_UNREACHABLE();
+    }
+  }
+
+  void DoCalcTangentMatrixDiagonalBlocks(
+      const FemState<T>& fem_state,
+      std::vector<Matrix3<T>>* diagonal_blocks) const final {
+    if constexpr (std::is_same_v<T, double>) {
+      constexpr int kDim = 3;
+      for (Matrix3<T>& block : *diagonal_blocks) {
+        block.setZero();
+      }
+      const std::vector<Data>& element_data =
+          fem_state.template EvalElementData<Data>(element_data_index_);
+      for (int e = 0; e < num_elements(); ++e) {
+        const std::array<FemNodeIndex, Element::num_nodes>&
+            element_node_indices = elements_[e].node_indices();
+        for (int a = 0; a < Element::num_nodes; ++a) {
+          (*diagonal_blocks)[element_node_indices[a]] +=
+              element_data[e].tangent_matrix.template block<kDim, kDim>(
+                  kDim * a, kDim * a);
+        }
+      }
+      /* Only the diagonal entries remain in the diagonal blocks for the nodes
+       under the boundary condition, see CalcTangentMatrix(). */
+      for (const auto& it :
+           this->dirichlet_boundary_condition().index_to_boundary_state()) {
+        Matrix3<T>& block = (*diagonal_blocks)[it.first];
+        block = block.diagonal().eval().asDiagonal();
+      }
+    } else {
+      unused(fem_state, diagonal_blocks);
+      DRAKE_UNREACHABLE();
+    }
+  }
+
   std::unique_ptr<contact_solvers::internal::Block3x3SparseSymmetricMatrix>
   DoMakeTangentMatrix() const final {
     /* We already check for the scalar type in `MakeTangentMatrix()` but the `if
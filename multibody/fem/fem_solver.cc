@@ -10,11 +10,218 @@ namespace multibody {
 namespace fem {
 namespace internal {
 
+using LinearSolver =
+    contact_solvers::internal::BlockSparseCholeskySolver<Matrix3<double>>;
+
+namespace {
+
+/* Forward declaration to allow the specialization of the Eigen traits below. */
+class MatrixFreeTangentOperator;
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+namespace Eigen {
+namespace internal {
+
+/* Gives the wrapper class a dense matrix trait so that Eigen chooses the GEMV
+ multiplication in the CG solver. */
+template <>
+struct traits<drake::multibody::fem::internal::MatrixFreeTangentOperator>
+    : traits<drake::MatrixX<double>> {};
+
+}  // namespace internal
+}  // namespace Eigen
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+/* Wrapper around FemModel::MultiplyByTangentMatrix() that's compatible with
+ Eigen::ConjugateGradient, in the same spirit as
+ EigenBlock3x3SparseSymmetricMatrix. It only supports matrix-vector products,
+ so it must be used with a preconditioner that doesn't query the matrix, such
+ as CgPreconditioner below. The wrapper is supposed to be short-lived: the
+ model and the state must outlive it. */
+class MatrixFreeTangentOperator
+    : public Eigen::EigenBase<MatrixFreeTangentOperator> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MatrixFreeTangentOperator);
+
+  using Scalar = double;
+  using RealScalar = double;
+  using StorageIndex = int;
+
+  enum {
+    ColsAtCompileTime = Eigen::Dynamic,
+    MaxColsAtCompileTime = Eigen::Dynamic,
+    IsRowMajor = false
+  };
+
+  MatrixFreeTangentOperator(const FemModel<double>* model,
+                            const FemState<double>* state)
+      : model_(model), state_(state) {
+    DRAKE_DEMAND(model != nullptr);
+    DRAKE_DEMAND(state != nullptr);
+  }
+
+  Eigen::Index rows() const { return model_->num_dofs(); }
+  Eigen::Index cols() const { return model_->num_dofs(); }
+
+  template <typename Rhs>
+  auto operator*(const Eigen::MatrixBase<Rhs>& x) const {
+    return Eigen::Product<MatrixFreeTangentOperator, Rhs,
+                          Eigen::AliasFreeProduct>(*this, x.derived());
+  }
+
+  /* Performs y = A*x where A is the tangent matrix. */
+  void Multiply(const Eigen::Ref<const VectorX<double>>& x,
+                EigenPtr<VectorX<double>> y) const {
+    model_->MultiplyByTangentMatrix(*state_, x, y);
+  }
+
+ private:
+  const FemModel<double>* const model_{};
+  const FemState<double>* const state_{};
+};
+
+}  // namespace
+}  // namespace internal
+}  // namespace fem
+}  // namespace multibody
+}  // namespace drake
+
+namespace Eigen {
+namespace internal {
+
+/* Implements Eigen's GEMV with the custom Multiply. */
+template <typename Rhs>
+struct generic_product_impl<
+    drake::multibody::fem::internal::MatrixFreeTangentOperator, Rhs,
+    DenseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<
+          drake::multibody::fem::internal::MatrixFreeTangentOperator, Rhs,
+          generic_product_impl<
+              drake::multibody::fem::internal::MatrixFreeTangentOperator,
+              Rhs>> {
+  using MatrixType = drake::multibody::fem::internal::MatrixFreeTangentOperator;
+
+  template <typename Dest>
+  // NOLINTNEXTLINE(runtime/references): Eigen-dictated signature.
+  static void scaleAndAddTo(Dest& dst, const MatrixType& A, const Rhs& x,
+                            const double&) {
+    A.Multiply(x, &dst);
+  }
+};
+
+}  // namespace internal
+}  // namespace Eigen
+
+namespace drake {
+namespace multibody {
+namespace fem {
+namespace internal {
+namespace {
+
+/* A preconditioner compatible with Eigen::ConjugateGradient that applies one of
+ the preconditioners set up by FemSolver. Unlike Eigen's preconditioners, it
+ doesn't compute anything from the matrix in compute(); instead, it must be
+ given the (already computed) preconditioner data with one of the Set*()
+ methods, which must outlive it. Without data, it's the identity. */
+class CgPreconditioner {
+ public:
+  CgPreconditioner() = default;
+
+  /* P⁻¹ = diag(d) where d = `inverse_diagonal`. */
+  void SetInverseDiagonal(const VectorX<double>* inverse_diagonal) {
+    *this = {};
+    inverse_diagonal_ = inverse_diagonal;
+  }
+
+  /* P⁻¹ = blockdiag(B₀, B₁, ...) where Bᵢ = `inverse_diagonal_blocks[i]`. */
+  void SetInverseDiagonalBlocks(
+      const std::vector<Matrix3<double>>* inverse_diagonal_blocks) {
+    *this = {};
+    inverse_diagonal_blocks_ = inverse_diagonal_blocks;
+  }
+
+  /* P⁻¹ = (L⋅Lᵀ)⁻¹ where L is the (incomplete) Cholesky factor in `cholesky`.
+   @pre cholesky->solver_mode() == kFactored. */
+  void SetCholesky(const LinearSolver* cholesky) {
+    *this = {};
+    cholesky_ = cholesky;
+  }
+
+  /* The following are required by Eigen. */
+  template <typename MatrixType>
+  CgPreconditioner& analyzePattern(const MatrixType&) {
+    return *this;
+  }
+
+  template <typename MatrixType>
+  CgPreconditioner& factorize(const MatrixType&) {
+    return *this;
+  }
+
+  template <typename MatrixType>
+  CgPreconditioner& compute(const MatrixType&) {
+    return *this;
+  }
+
+  template <typename Rhs>
+  VectorX<double> solve(const Eigen::MatrixBase<Rhs>& b) const {
+    VectorX<double> x(b);
+    if (inverse_diagonal_ != nullptr) {
+      x.array() *= inverse_diagonal_->array();
+    } else if (inverse_diagonal_blocks_ != nullptr) {
+      for (int i = 0; i < ssize(*inverse_diagonal_blocks_); ++i) {
+        x.template segment<3>(3 * i) =
+            (*inverse_diagonal_blocks_)[i] * b.template segment<3>(3 * i);
+      }
+    } else if (cholesky_ != nullptr) {
+      cholesky_->SolveInPlace(&x);
+    }
+    return x;
+  }
+
+  Eigen::ComputationInfo info() const { return Eigen::Success; }
+
+ private:
+  const VectorX<double>* inverse_diagonal_{};
+  const std::vector<Matrix3<double>>* inverse_diagonal_blocks_{};
+  const LinearSolver* cholesky_{};
+};
+
+/* Solves A⋅x = rhs with preconditioned conjugate gradient up to the given
+ relative tolerance. Returns false if the solve fails. */
+template <typename Operator>
+bool SolveWithConjugateGradient(const Operator& A,
+                                const CgPreconditioner& preconditioner,
+                                double tolerance, const VectorX<double>& rhs,
+                                VectorX<double>* x) {
+  Eigen::ConjugateGradient<Operator, Eigen::Lower | Eigen::Upper,
+                           CgPreconditioner>
+      cg;
+  cg.setTolerance(tolerance);
+  cg.compute(A);
+  if (cg.info() != Eigen::Success) {
+    return false;
+  }
+  cg.preconditioner() = preconditioner;
+  *x = cg.solve(rhs);
+  return true;
+}
+
+}  // namespace
+
 using contact_solvers::internal::Block3x3SparseSymmetricMatrix;
 using contact_solvers::internal::EigenBlock3x3SparseSymmetricMatrix;
 using contact_solvers::internal::SchurComplement;
-using LinearSolver =
-    contact_solvers::internal::BlockSparseCholeskySolver<Matrix3<double>>;
 
 template <typename T>
 FemSolver<T>::FemStateAndSchurComplement::FemStateAndSchurComplement(
@@ -39,6 +246,9 @@ void FemSolver<T>::Scratch::ReinitializeIfNeeded(const FemModel<T>& model) {
     b.resize(model.num_dofs());
     dz.resize(model.num_dofs());
     tangent_matrix = model.MakeTangentMatrix();
+    diagonal_blocks.clear();
+    inverse_diagonal.resize(0);
+    incomplete_cholesky = LinearSolver{};
   }
 }
 
@@ -154,9 +364,6 @@ int FemSolver<T>::SolveNonlinearModel(
   T residual_norm = b.norm();
   const T initial_residual_norm = residual_norm;
   T prev_residual_norm = residual_norm;
-  Eigen::ConjugateGradient<EigenBlock3x3SparseSymmetricMatrix,
-                           Eigen::Lower | Eigen::Upper>
-      cg;
   double prev_cg_tolerance = 0;
   int iter = 0;
   /* For non-linear FEM models, the system of equations is non-linear and we use
@@ -168,17 +375,11 @@ int FemSolver<T>::SolveNonlinearModel(
   while (iter < max_iterations_ &&
          /* On first iteration, this is equivalent to residual_norm < abs_tol */
          !solver_converged(residual_norm, initial_residual_norm)) {
-    model_->CalcTangentMatrix(state, &tangent_matrix);
-    const EigenBlock3x3SparseSymmetricMatrix wrapper(&tangent_matrix,
-                                                     model_->parallelism());
     const double cg_tolerance = ComputeLinearSolverTolerance(
         residual_norm, prev_residual_norm, prev_cg_tolerance);
-    cg.setTolerance(cg_tolerance);
-    cg.compute(wrapper);
-    if (cg.info() != Eigen::Success) {
+    if (!SolveNewtonStep(state, cg_tolerance)) {
       return -1;
     }
-    dz = cg.solve(-b);
     integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
     prev_residual_norm = residual_norm;
     prev_cg_tolerance = cg_tolerance;
@@ -198,6 +399,94 @@ int FemSolver<T>::SolveNonlinearModel(
   return iter;
 }
 
+template <typename T>
+bool FemSolver<T>::SolveNewtonStep(const FemState<T>& state,
+                                   double tolerance) {
+  Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
+  std::vector<Matrix3<T>>& diagonal_blocks = scratch_.diagonal_blocks;
+  const int num_nodes = model_->num_nodes();
+  if (!use_matrix_free_tangent_) {
+    model_->CalcTangentMatrix(state, &tangent_matrix);
+  }
+  /* Fills in `diagonal_blocks` from whichever representation of the tangent
+   matrix is in use. */
+  auto calc_diagonal_blocks = [&]() {
+    if (use_matrix_free_tangent_) {
+      model_->CalcTangentMatrixDiagonalBlocks(state, &diagonal_blocks);
+    } else {
+      diagonal_blocks.resize(num_nodes);
+      for (int i = 0; i < num_nodes; ++i) {
+        diagonal_blocks[i] = tangent_matrix.diagonal_block(i);
+      }
+    }
+  };
+  auto set_up_block_jacobi = [&](CgPreconditioner* preconditioner) {
+    calc_diagonal_blocks();
+    for (Matrix3<T>& block : diagonal_blocks) {
+      block = block.inverse().eval();
+    }
+    preconditioner->SetInverseDiagonalBlocks(&diagonal_blocks);
+  };
+
+  CgPreconditioner preconditioner;
+  switch (linear_solver_preconditioner_) {
+    case LinearSolverPreconditioner::kDiagonal: {
+      calc_diagonal_blocks();
+      VectorX<T>& inverse_diagonal = scratch_.inverse_diagonal;
+      inverse_diagonal.resize(3 * num_nodes);
+      for (int i = 0; i < num_nodes; ++i) {
+        for (int k = 0; k < 3; ++k) {
+          /* Same as Eigen::DiagonalPreconditioner. */
+          const T& d = diagonal_blocks[i](k, k);
+          inverse_diagonal(3 * i + k) = d != 0 ? 1.0 / d : 1.0;
+        }
+      }
+      preconditioner.SetInverseDiagonal(&inverse_diagonal);
+      break;
+    }
+    case LinearSolverPreconditioner::kBlockJacobi: {
+      set_up_block_jacobi(&preconditioner);
+      break;
+    }
+    case LinearSolverPreconditioner::kIncompleteCholesky: {
+      /* The incomplete factorization needs the assembled matrix. */
+      if (use_matrix_free_tangent_) {
+        set_up_block_jacobi(&preconditioner);
+        break;
+      }
+      LinearSolver& incomplete_cholesky = scratch_.incomplete_cholesky;
+      /* The sparsity pattern of the tangent matrix never changes, so the
+       symbolic analysis is only done once. */
+      if (incomplete_cholesky.is_incomplete()) {
+        incomplete_cholesky.UpdateMatrix(tangent_matrix);
+      } else {
+        incomplete_cholesky.SetMatrixForIncompleteFactorization(
+            tangent_matrix);
+      }
+      if (incomplete_cholesky.Factor()) {
+        preconditioner.SetCholesky(&incomplete_cholesky);
+      } else {
+        log()->debug(
+            "FemSolver: the incomplete Cholesky factorization of the tangent "
+            "matrix failed; falling back to block Jacobi preconditioning.");
+        set_up_block_jacobi(&preconditioner);
+      }
+      break;
+    }
+  }
+
+  const VectorX<T> rhs = -scratch_.b;
+  if (use_matrix_free_tangent_) {
+    const MatrixFreeTangentOperator A(model_, &state);
+    return SolveWithConjugateGradient(A, preconditioner, tolerance, rhs,
+                                      &scratch_.dz);
+  }
+  const EigenBlock3x3SparseSymmetricMatrix A(&tangent_matrix,
+                                             model_->parallelism());
+  return SolveWithConjugateGradient(A, preconditioner, tolerance, rhs,
+                                    &scratch_.dz);
+}
+
 }  // namespace internal
 }  // namespace fem
 }  // namespace multibody
@@ -3,11 +3,13 @@
 #include <memory>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "drake/common/eigen_types.h"
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/contact_solvers/schur_complement.h"
+#include "drake/multibody/fem/deformable_body_config.h"
 #include "drake/multibody/fem/discrete_time_integrator.h"
 #include "drake/multibody/fem/fem_model.h"
 #include "drake/multibody/fem/fem_state.h"
@@ -111,6 +113,30 @@ class FemSolver {
   bool solver_converged(const T& residual_norm,
                         const T& initial_residual_norm) const;
 
+  /* Sets the preconditioner for the conjugate gradient iterations used to
+   solve for the Newton steps of nonlinear models. The default is
+   LinearSolverPreconditioner::kDiagonal. */
+  void set_linear_solver_preconditioner(
+      LinearSolverPreconditioner preconditioner) {
+    linear_solver_preconditioner_ = preconditioner;
+  }
+
+  LinearSolverPreconditioner linear_solver_preconditioner() const {
+    return linear_solver_preconditioner_;
+  }
+
+  /* Sets whether the conjugate gradient iterations used to solve for the
+   Newton steps of nonlinear models apply the tangent matrix element by element
+   (see FemModel::MultiplyByTangentMatrix()) instead of assembling it on every
+   Newton iteration. The tangent matrix is still assembled once the Newton
+   iterations have converged to compute the Schur complement. The default is
+   false. */
+  void set_use_matrix_free_tangent(bool use_matrix_free_tangent) {
+    use_matrix_free_tangent_ = use_matrix_free_tangent;
+  }
+
+  bool use_matrix_free_tangent() const { return use_matrix_free_tangent_; }
+
   /* Sets the maximum linear solver tolerance for iterative linear solvers. The
    current solver of choice is Eigen::ConjugateGradient. */
   void set_max_linear_solver_tolerance(double tolerance) {
@@ -189,8 +215,20 @@ class FemSolver {
         tangent_matrix;
     VectorX<T> b;
     VectorX<T> dz;
+    /* Storage for the preconditioners, see SolveNewtonStep(). */
+    std::vector<Matrix3<T>> diagonal_blocks;
+    VectorX<T> inverse_diagonal;
+    contact_solvers::internal::BlockSparseCholeskySolver<Matrix3<double>>
+        incomplete_cholesky;
   };
 
+  /* Solves A⋅dz = -b for the Newton step dz with preconditioned conjugate
+   gradient iterations up to the given relative `tolerance`, where A is the
+   tangent matrix evaluated at `state` and b is the residual stored in
+   `scratch_.b`. The result is written to `scratch_.dz`. Returns false if the
+   solve fails. */
+  bool SolveNewtonStep(const FemState<T>& state, double tolerance);
+
   /* Uses a Newton-Raphson solver to solve for the equilibrium FEM state z
    such that the residual is zero, i.e. b(z) = 0, up to the specified
    tolerances. In addition, computes the Schur complement of the tangent
@@ -244,6 +282,9 @@ class FemSolver {
   /* Max number of Newton-Raphson iterations the solver takes before it gives
    up. */
   int max_iterations_{100};
+  LinearSolverPreconditioner linear_solver_preconditioner_{
+      LinearSolverPreconditioner::kDiagonal};
+  bool use_matrix_free_tangent_{false};
   FemStateAndSchurComplement next_state_and_schur_complement_;
   Scratch scratch_;
 };
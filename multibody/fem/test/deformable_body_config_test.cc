@@ -15,6 +15,9 @@ GTEST_TEST(DeformableBodyConfigTest, DefaultValues) {
   EXPECT_EQ(config.stiffness_damping_coefficient(), 0.0);
   EXPECT_EQ(config.mass_density(), 1.5e3);
   EXPECT_EQ(config.material_model(), MaterialModel::kLinearCorotated);
+  EXPECT_EQ(config.linear_solver_preconditioner(),
+            LinearSolverPreconditioner::kDiagonal);
+  EXPECT_FALSE(config.use_matrix_free_tangent());
 }
 
 GTEST_TEST(DeformableBodyConfigTest, Setters) {
@@ -31,6 +34,12 @@ GTEST_TEST(DeformableBodyConfigTest, Setters) {
   EXPECT_EQ(config.mass_density(), 1e3);
   config.set_material_model(MaterialModel::kLinear);
   EXPECT_EQ(config.material_model(), MaterialModel::kLinear);
+  config.set_linear_solver_preconditioner(
+      LinearSolverPreconditioner::kIncompleteCholesky);
+  EXPECT_EQ(config.linear_solver_preconditioner(),
+            LinearSolverPreconditioner::kIncompleteCholesky);
+  config.set_use_matrix_free_tangent(true);
+  EXPECT_TRUE(config.use_matrix_free_tangent());
 }
 
 }  // namespace
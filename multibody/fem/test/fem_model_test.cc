@@ -220,6 +220,49 @@ GTEST_TEST(FemModelTest, CalcTangentMatrix) {
                               MatrixCompareType::relative));
 }
 
+/* The matrix-free product with the tangent matrix and its diagonal blocks
+ agree with the assembled tangent matrix, with and without boundary conditions.
+ */
+GTEST_TEST(FemModelTest, MatrixFreeTangentMatrix) {
+  const Vector3d weights(0.1, 0.2, 0.3);
+  LinearDummyModel model(weights);
+  LinearDummyModel::DummyBuilder builder(&model);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  const VectorXd x = VectorXd::LinSpaced(model.num_dofs(), -1.0, 2.0);
+
+  auto verify = [&]() {
+    unique_ptr<FemState<double>> fem_state = model.MakeFemState();
+    unique_ptr<contact_solvers::internal::Block3x3SparseSymmetricMatrix>
+        tangent_matrix = model.MakeTangentMatrix();
+    model.CalcTangentMatrix(*fem_state, tangent_matrix.get());
+    const MatrixXd A = tangent_matrix->MakeDenseMatrix();
+
+    VectorXd y(model.num_dofs());
+    model.MultiplyByTangentMatrix(*fem_state, x, &y);
+    EXPECT_TRUE(CompareMatrices(y, A * x, 1e-14, MatrixCompareType::relative));
+
+    std::vector<Matrix3<double>> diagonal_blocks;
+    model.CalcTangentMatrixDiagonalBlocks(*fem_state, &diagonal_blocks);
+    ASSERT_EQ(ssize(diagonal_blocks), model.num_nodes());
+    for (int i = 0; i < model.num_nodes(); ++i) {
+      EXPECT_TRUE(CompareMatrices(diagonal_blocks[i],
+                                  A.block<3, 3>(3 * i, 3 * i), 1e-14,
+                                  MatrixCompareType::relative));
+    }
+  };
+
+  verify();
+
+  /* Put a node shared by both elements under boundary condition. */
+  DirichletBoundaryCondition<double> bc;
+  bc.AddBoundaryCondition(FemNodeIndex(2),
+                          {Vector3<double>(1, 1, 1), Vector3<double>(2, 2, 2),
+                           Vector3<double>(3, 3, 3)});
+  model.SetDirichletBoundaryCondition(bc);
+  verify();
+}
+
 GTEST_TEST(FemModelTest, CalcTangentMatrixNoAutoDiff) {
   using T = AutoDiffXd;
   constexpr int kNaturalDimension = 3;
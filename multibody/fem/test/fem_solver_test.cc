@@ -144,6 +144,63 @@ TYPED_TEST_P(FemSolverTest, AdvanceOneTimeStep) {
                               kTolerance, MatrixCompareType::relative));
 }
 
+/* Tests that every combination of preconditioner and matrix-free tangent
+ option converges to the same next state as the default solver. */
+TYPED_TEST_P(FemSolverTest, PreconditionersAndMatrixFree) {
+  EXPECT_EQ(this->solver_.linear_solver_preconditioner(),
+            LinearSolverPreconditioner::kDiagonal);
+  EXPECT_FALSE(this->solver_.use_matrix_free_tangent());
+
+  constexpr bool is_linear = TypeParam::value;
+  typename DummyModel<is_linear>::DummyBuilder builder(&this->model_);
+  builder.AddTwoElementsWithSharedNodes();
+  builder.Build();
+  std::unique_ptr<FemState<double>> state0 = this->model_.MakeFemState();
+  const std::unordered_set<int> nonparticipating_vertices = {0, 1};
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+  this->solver_.set_max_linear_solver_tolerance(
+      std::numeric_limits<double>::epsilon());
+  this->solver_.AdvanceOneTimeStep(*state0, dummy_data,
+                                   nonparticipating_vertices);
+  const FemState<double>& expected_state = this->solver_.next_fem_state();
+
+  for (const LinearSolverPreconditioner preconditioner :
+       {LinearSolverPreconditioner::kDiagonal,
+        LinearSolverPreconditioner::kBlockJacobi,
+        LinearSolverPreconditioner::kIncompleteCholesky}) {
+    for (const bool matrix_free : {false, true}) {
+      SCOPED_TRACE(fmt::format("preconditioner = {}, matrix_free = {}",
+                               static_cast<int>(preconditioner), matrix_free));
+      FemSolver<double> solver(&this->model_, &this->integrator_);
+      solver.set_linear_solver_preconditioner(preconditioner);
+      solver.set_use_matrix_free_tangent(matrix_free);
+      EXPECT_EQ(solver.linear_solver_preconditioner(), preconditioner);
+      EXPECT_EQ(solver.use_matrix_free_tangent(), matrix_free);
+      solver.set_max_linear_solver_tolerance(
+          std::numeric_limits<double>::epsilon());
+      /* Take two steps to exercise reusing the preconditioner storage. */
+      for (int i = 0; i < 2; ++i) {
+        const int num_iterations = solver.AdvanceOneTimeStep(
+            *state0, dummy_data, nonparticipating_vertices);
+        EXPECT_EQ(num_iterations, 1);
+      }
+      const FemState<double>& computed_state = solver.next_fem_state();
+      EXPECT_TRUE(CompareMatrices(expected_state.GetPositions(),
+                                  computed_state.GetPositions(), kTolerance));
+      EXPECT_TRUE(CompareMatrices(expected_state.GetVelocities(),
+                                  computed_state.GetVelocities(), kTolerance));
+      EXPECT_TRUE(CompareMatrices(expected_state.GetAccelerations(),
+                                  computed_state.GetAccelerations(),
+                                  kTolerance));
+      EXPECT_TRUE(CompareMatrices(
+          this->solver_.next_schur_complement().get_D_complement(),
+          solver.next_schur_complement().get_D_complement(), kTolerance,
+          MatrixCompareType::relative));
+    }
+  }
+}
+
 /* Tests that AdvanceOneTimeStep for nonlinear models throws an error message if
  the Newton solver doesn't converge within the max number of iterations. */
 TYPED_TEST_P(FemSolverTest, Nonconvergence) {
@@ -240,7 +297,7 @@ TYPED_TEST_P(FemSolverTest, SetNextFemState) {
 using AllTypes = ::testing::Types<BoolWrapper<true>, BoolWrapper<false>>;
 REGISTER_TYPED_TEST_SUITE_P(FemSolverTest, Tolerance, AdvanceOneTimeStep,
                             Nonconvergence, DefaultStateAndSchurComplement,
-                            SetNextFemState);
+                            SetNextFemState, PreconditionersAndMatrixFree);
 INSTANTIATE_TYPED_TEST_SUITE_P(LinearAndNonLinear, FemSolverTest, AllTypes);
 
 }  // namespace
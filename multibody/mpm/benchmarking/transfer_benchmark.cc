@@ -0,0 +1,128 @@
+// @file
+// Benchmarks for the MPM particle-to-grid (P2G) and grid-to-particle (G2P)
+// transfers.
+//
+// The particles are uniformly sampled in a cube with eight particles per grid
+// cell on average, as is typical for granular media. The benchmarks report the
+// number of particles transferred per second (items_per_second) as a function
+// of the number of particles and the number of threads.
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/parallelism.h"
+#include "drake/multibody/mpm/particle_data.h"
+#include "drake/multibody/mpm/sparse_grid.h"
+#include "drake/multibody/mpm/transfer.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+constexpr double kDx = 0.01;
+constexpr double kDt = 1e-3;
+constexpr int kParticlesPerCell = 8;
+
+class TransferBenchmark : public benchmark::Fixture {
+ public:
+  TransferBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  // The benchmark arguments are the number of particles and the number of
+  // threads.
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    const int num_particles = state.range(0);
+    parallelism_ = Parallelism(static_cast<int>(state.range(1)));
+    const double length =
+        kDx * std::cbrt(static_cast<double>(num_particles) / kParticlesPerCell);
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> distribution(0.0, length);
+    std::vector<Vector3d> positions(num_particles);
+    for (Vector3d& x : positions) {
+      x = Vector3d(distribution(generator), distribution(generator),
+                   distribution(generator));
+    }
+    particles_ = ParticleData<double>();
+    particles_.AddParticles(positions, length * length * length,
+                            fem::DeformableBodyConfig<double>());
+    for (int p = 0; p < num_particles; ++p) {
+      particles_.mutable_v()[p] = Vector3d(0.1, -0.2, 0.3);
+    }
+    grid_ = std::make_unique<SparseGrid<double>>(kDx);
+    grid_->Allocate(particles_.x());
+  }
+
+  // NOLINTNEXTLINE(runtime/references)
+  void TearDown(benchmark::State& state) override {
+    state.SetItemsProcessed(state.iterations() * particles_.num_particles());
+  }
+
+ protected:
+  Parallelism parallelism_;
+  ParticleData<double> particles_;
+  std::unique_ptr<SparseGrid<double>> grid_;
+  Transfer<SparseGrid<double>> transfer_{kDt, kDx};
+};
+
+BENCHMARK_DEFINE_F(TransferBenchmark, ParticleToGrid)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    // Clear the grid data left by the previous iteration. This is not timed
+    // because it is part of Allocate() in a simulation.
+    state.PauseTiming();
+    grid_->IterateGrid([](GridData<double>* node) {
+      node->reset();
+    });
+    state.ResumeTiming();
+    transfer_.ParticleToGrid(particles_, grid_.get(), parallelism_);
+  }
+}
+
+BENCHMARK_DEFINE_F(TransferBenchmark, GridToParticle)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  transfer_.ParticleToGrid(particles_, grid_.get(), parallelism_);
+  grid_->IterateGrid([](GridData<double>* node) {
+    if (node->m > 0.0) node->v /= node->m;
+  });
+  // G2P advects the particles, so we keep a pristine copy to restart from on
+  // every iteration; otherwise the particles would drift off the allocated
+  // grid.
+  const ParticleData<double> initial_particles = particles_;
+  for (auto _ : state) {
+    state.PauseTiming();
+    particles_ = initial_particles;
+    state.ResumeTiming();
+    transfer_.GridToParticle(*grid_, &particles_, parallelism_);
+  }
+}
+
+BENCHMARK_REGISTER_F(TransferBenchmark, ParticleToGrid)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"particles", "threads"})
+    ->ArgsProduct({{10'000, 100'000, 1'000'000}, {1, 2, 4, 8}});
+
+BENCHMARK_REGISTER_F(TransferBenchmark, GridToParticle)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"particles", "threads"})
+    ->ArgsProduct({{10'000, 100'000, 1'000'000}, {1, 2, 4, 8}});
+
+}  // namespace
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
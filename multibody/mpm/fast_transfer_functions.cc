@@ -0,0 +1,293 @@
+/* clang-format off to disable clang-format-includes */
+#include "drake/multibody/mpm/fast_transfer_functions.h"
+/* clang-format on */
+
+#include <cmath>
+#include <cstddef>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "multibody/mpm/fast_transfer_functions.cc"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+#pragma GCC diagnostic pop
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+/* The number of doubles between consecutive nodes in a pad. */
+constexpr int kNodeStride = sizeof(GridData<double>) / sizeof(double);
+static_assert(kNodeStride * sizeof(double) == sizeof(GridData<double>));
+/* The kernels below rely on GridData<double> starting with its `v` and `m`
+fields, so that they form a single array of four doubles at the start of each
+node. */
+static_assert(offsetof(GridData<double>, v) == 0);
+static_assert(offsetof(GridData<double>, m) == 3 * sizeof(double));
+
+/* Computes the 1D weights of a single particle coordinate, exactly as in
+BsplineWeights::ComputeWeights. */
+void CalcBsplineWeights1d(double x, double dx, double* w) {
+  const double x_reference = x / dx;
+  const double d = std::floor(x_reference + 0.5) - x_reference;
+  const double d1 = 0.5 + d;
+  w[0] = 0.5 * d1 * d1;
+  w[1] = 0.75 - d * d;
+  const double d2 = 0.5 - d;
+  w[2] = 0.5 * d2 * d2;
+}
+
+// The SIMD approach is only useful when we have registers of size `double[4]`
+// or larger. When we have smaller registers (e.g., SSE2's 2-wide lanes, or
+// SVE's variable-length vectors) we will fall back to non-SIMD code.
+#if HWY_MAX_BYTES >= 32 && HWY_HAVE_SCALABLE == 0
+
+/* The weights are computed for four particles at a time, one particle per lane.
+The positions are de-interleaved into <xxxx>, <yyyy>, <zzzz> on load and the
+weights are re-interleaved into <w₀w₁w₂ w₀w₁w₂ ...> on store, so that each
+dimension's plane ends up particle-major. */
+void CalcBsplineWeightsImpl(const double* x, int num_particles, double dx,
+                            double* weights) {
+  using D = hn::FixedTag<double, 4>;
+  const D tag;
+  const auto dx_vec = hn::Set(tag, dx);
+  const auto half = hn::Set(tag, 0.5);
+  const auto three_quarters = hn::Set(tag, 0.75);
+  int p = 0;
+  for (; p + 4 <= num_particles; p += 4) {
+    hn::Vec<D> xyz[3];
+    hn::LoadInterleaved3(tag, x + 3 * p, xyz[0], xyz[1], xyz[2]);
+    for (int d = 0; d < 3; ++d) {
+      const auto x_reference = hn::Div(xyz[d], dx_vec);
+      const auto base_node = hn::Floor(hn::Add(x_reference, half));
+      const auto dist = hn::Sub(base_node, x_reference);
+      const auto d1 = hn::Add(half, dist);
+      const auto w0 = hn::Mul(hn::Mul(half, d1), d1);
+      const auto w1 = hn::Sub(three_quarters, hn::Mul(dist, dist));
+      const auto d2 = hn::Sub(half, dist);
+      const auto w2 = hn::Mul(hn::Mul(half, d2), d2);
+      hn::StoreInterleaved3(w0, w1, w2, tag,
+                            weights + 3 * (d * num_particles + p));
+    }
+  }
+  for (; p < num_particles; ++p) {
+    for (int d = 0; d < 3; ++d) {
+      CalcBsplineWeights1d(x[3 * p + d], dx,
+                           weights + 3 * (d * num_particles + p));
+    }
+  }
+}
+
+/* Each node's `v` and `m` fields are updated together as a single <vvvm>
+register. The per-node momentum g + h_x * oₐ + h_y * o_b + h_z * o_c is built
+up incrementally along the loop nest, where g = <q m> and h_e = <dx_A.col(e) 0>,
+so that the innermost loop is one FMA for the momentum and one for the update.
+*/
+void AccumulateParticleToPadImpl(const double* wx, const double* wy,
+                                 const double* wz, const double* q, double m,
+                                 const double* dx_A, double* pad) {
+  const hn::FixedTag<double, 4> tag;
+  const auto g = hn::InsertLane(hn::LoadN(tag, q, 3), 3, m);
+  const auto h_x = hn::LoadN(tag, dx_A, 3);
+  const auto h_y = hn::LoadN(tag, dx_A + 3, 3);
+  const auto h_z = hn::LoadN(tag, dx_A + 6, 3);
+  for (int a = 0; a < 3; ++a) {
+    const auto g_a = hn::MulAdd(hn::Set(tag, a - 1.0), h_x, g);
+    for (int b = 0; b < 3; ++b) {
+      const auto g_ab = hn::MulAdd(hn::Set(tag, b - 1.0), h_y, g_a);
+      const double w_ab = wx[a] * wy[b];
+      for (int c = 0; c < 3; ++c) {
+        const auto g_abc = hn::MulAdd(hn::Set(tag, c - 1.0), h_z, g_ab);
+        double* node = pad + kNodeStride * (9 * a + 3 * b + c);
+        const auto w = hn::Set(tag, w_ab * wz[c]);
+        hn::StoreU(hn::MulAdd(w, g_abc, hn::LoadU(tag, node)), tag, node);
+      }
+    }
+  }
+}
+
+/* The weights are separable and the offsets o are in {-1, 0, 1}, so we contract
+one dimension at a time: first along c (for fixed a, b) into the weighted sum
+T_ab and the offset-weighted sum U_ab, then along b, and finally along a. The
+mass lane of each <vvvm> load rides along and is discarded on store. */
+void AccumulatePadToParticleImpl(const double* wx, const double* wy,
+                                 const double* wz, const double* pad,
+                                 double* v, double* B) {
+  const hn::FixedTag<double, 4> tag;
+  const auto wz0 = hn::Set(tag, wz[0]);
+  const auto wz1 = hn::Set(tag, wz[1]);
+  const auto wz2 = hn::Set(tag, wz[2]);
+  auto sum_v = hn::Zero(tag);
+  auto sum_x = hn::Zero(tag);
+  auto sum_y = hn::Zero(tag);
+  auto sum_z = hn::Zero(tag);
+  for (int a = 0; a < 3; ++a) {
+    auto p_a = hn::Zero(tag);  // ∑_bc w_b w_c v
+    auto q_a = hn::Zero(tag);  // ∑_bc w_b w_c v o_b
+    auto r_a = hn::Zero(tag);  // ∑_bc w_b w_c v o_c
+    for (int b = 0; b < 3; ++b) {
+      const double* node = pad + kNodeStride * (9 * a + 3 * b);
+      const auto v0 = hn::LoadU(tag, node);
+      const auto v1 = hn::LoadU(tag, node + kNodeStride);
+      const auto v2 = hn::LoadU(tag, node + 2 * kNodeStride);
+      const auto t_ab =
+          hn::MulAdd(wz2, v2, hn::MulAdd(wz1, v1, hn::Mul(wz0, v0)));
+      const auto u_ab = hn::NegMulAdd(wz0, v0, hn::Mul(wz2, v2));
+      const auto w_b = hn::Set(tag, wy[b]);
+      p_a = hn::MulAdd(w_b, t_ab, p_a);
+      r_a = hn::MulAdd(w_b, u_ab, r_a);
+      if (b == 0) q_a = hn::NegMulAdd(w_b, t_ab, q_a);
+      if (b == 2) q_a = hn::MulAdd(w_b, t_ab, q_a);
+    }
+    const auto w_a = hn::Set(tag, wx[a]);
+    sum_v = hn::MulAdd(w_a, p_a, sum_v);
+    sum_y = hn::MulAdd(w_a, q_a, sum_y);
+    sum_z = hn::MulAdd(w_a, r_a, sum_z);
+    if (a == 0) sum_x = hn::NegMulAdd(w_a, p_a, sum_x);
+    if (a == 2) sum_x = hn::MulAdd(w_a, p_a, sum_x);
+  }
+  hn::StoreN(sum_v, tag, v, 3);
+  hn::StoreN(sum_x, tag, B, 3);
+  hn::StoreN(sum_y, tag, B + 3, 3);
+  hn::StoreN(sum_z, tag, B + 6, 3);
+}
+
+#else  // HWY_MAX_BYTES
+
+void CalcBsplineWeightsImpl(const double* x, int num_particles, double dx,
+                            double* weights) {
+  for (int p = 0; p < num_particles; ++p) {
+    for (int d = 0; d < 3; ++d) {
+      CalcBsplineWeights1d(x[3 * p + d], dx,
+                           weights + 3 * (d * num_particles + p));
+    }
+  }
+}
+
+void AccumulateParticleToPadImpl(const double* wx, const double* wy,
+                                 const double* wz, const double* q, double m,
+                                 const double* dx_A, double* pad) {
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      for (int c = 0; c < 3; ++c) {
+        const double w = wx[a] * wy[b] * wz[c];
+        const double o[3] = {a - 1.0, b - 1.0, c - 1.0};
+        double* node = pad + kNodeStride * (9 * a + 3 * b + c);
+        for (int i = 0; i < 3; ++i) {
+          node[i] += w * (q[i] + dx_A[i] * o[0] + dx_A[3 + i] * o[1] +
+                          dx_A[6 + i] * o[2]);
+        }
+        node[3] += w * m;
+      }
+    }
+  }
+}
+
+void AccumulatePadToParticleImpl(const double* wx, const double* wy,
+                                 const double* wz, const double* pad,
+                                 double* v, double* B) {
+  for (int i = 0; i < 3; ++i) v[i] = 0;
+  for (int i = 0; i < 9; ++i) B[i] = 0;
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      for (int c = 0; c < 3; ++c) {
+        const double w = wx[a] * wy[b] * wz[c];
+        const double o[3] = {a - 1.0, b - 1.0, c - 1.0};
+        const double* node = pad + kNodeStride * (9 * a + 3 * b + c);
+        for (int i = 0; i < 3; ++i) {
+          const double wv = w * node[i];
+          v[i] += wv;
+          B[i] += wv * o[0];
+          B[3 + i] += wv * o[1];
+          B[6 + i] += wv * o[2];
+        }
+      }
+    }
+  }
+}
+
+#endif  // HWY_MAX_BYTES
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(CalcBsplineWeightsImpl);
+struct ChooseBestCalcBsplineWeights {
+  auto operator()() { return HWY_DYNAMIC_POINTER(CalcBsplineWeightsImpl); }
+};
+HWY_EXPORT(AccumulateParticleToPadImpl);
+struct ChooseBestAccumulateParticleToPad {
+  auto operator()() {
+    return HWY_DYNAMIC_POINTER(AccumulateParticleToPadImpl);
+  }
+};
+HWY_EXPORT(AccumulatePadToParticleImpl);
+struct ChooseBestAccumulatePadToParticle {
+  auto operator()() {
+    return HWY_DYNAMIC_POINTER(AccumulatePadToParticleImpl);
+  }
+};
+
+}  // namespace
+
+void CalcBsplineWeights(const Vector3<double>* x, int num_particles, double dx,
+                        double* weights) {
+  DRAKE_ASSERT(num_particles >= 0);
+  DRAKE_ASSERT(dx > 0);
+  if (num_particles == 0) return;
+  DRAKE_ASSERT(x != nullptr && weights != nullptr);
+  // Vector3<double> is three tightly packed doubles, so an array of them is
+  // 3 * num_particles contiguous doubles.
+  static_assert(sizeof(Vector3<double>) == 3 * sizeof(double));
+  LateBoundFunction<ChooseBestCalcBsplineWeights>::Call(
+      x->data(), num_particles, dx, weights);
+}
+
+void AccumulateParticleToPad(const double* wx, const double* wy,
+                             const double* wz, const Vector3<double>& q,
+                             double m, const Matrix3<double>& dx_A,
+                             GridData<double>* pad) {
+  DRAKE_ASSERT(pad != nullptr);
+  LateBoundFunction<ChooseBestAccumulateParticleToPad>::Call(
+      wx, wy, wz, q.data(), m, dx_A.data(), reinterpret_cast<double*>(pad));
+}
+
+void AccumulatePadToParticle(const double* wx, const double* wy,
+                             const double* wz, const GridData<double>* pad,
+                             Vector3<double>* v, Matrix3<double>* B) {
+  DRAKE_ASSERT(pad != nullptr);
+  DRAKE_ASSERT(v != nullptr && B != nullptr);
+  LateBoundFunction<ChooseBestAccumulatePadToParticle>::Call(
+      wx, wy, wz, reinterpret_cast<const double*>(pad), v->data(), B->data());
+}
+
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
+#endif  // HWY_ONCE
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/mpm/grid_data.h"
+
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+
+/* Declarations for fast, low-level kernels used by Transfer for particle-grid
+transfers with double scalars. Ideally these are implemented using
+platform-specific SIMD instructions for speed; however, we always provide a
+straightforward portable fallback. */
+
+/* Computes the quadratic B-spline weights (see BsplineWeights) of a batch of
+particles with positions `x` in a grid with spacing `dx`.
+
+The result is stored in `weights` as three planes, one per dimension, each
+holding three weights per particle. That is, the weight between particle p and
+the k-th node in its support along dimension d is stored in
+`weights[3 * (d * num_particles + p) + k]`, and matches (up to roundoff)
+what BsplineWeights<double> reports for the same particle.
+
+@pre x and weights are non-null unless num_particles is zero.
+@pre weights has room for 9 * num_particles doubles.
+@pre dx > 0. */
+void CalcBsplineWeights(const Vector3<double>* x, int num_particles, double dx,
+                        double* weights);
+
+/* Accumulates the APIC particle-to-grid contribution of a single particle into
+the 3x3x3 pad of grid nodes in its support. For the node with offset
+o = (a-1, b-1, c-1) from the center node and weight w = wx[a] * wy[b] * wz[c],
+this computes
+
+  pad[a][b][c].v += w * (q + dx_A * o)
+  pad[a][b][c].m += w * m
+
+where, in terms of Transfer::ParticleToGrid, A = m * C - D⁻¹dt * τv₀ is the
+affine momentum matrix, q = m * v + A * (x_center - x) is the particle momentum
+as seen from the center node, and dx_A = dx * A.
+
+@param wx, wy, wz  The particle's three B-spline weights along each dimension.
+@param q           The momentum as seen from the center node.
+@param m           The particle mass.
+@param dx_A        The affine momentum matrix scaled by the grid spacing.
+@param pad         The first of 27 contiguous nodes in [a][b][c] order. Only
+                   the `v` and `m` fields are modified. */
+void AccumulateParticleToPad(const double* wx, const double* wy,
+                             const double* wz, const Vector3<double>& q,
+                             double m, const Matrix3<double>& dx_A,
+                             GridData<double>* pad);
+
+/* Gathers the APIC grid-to-particle quantities of a single particle from the
+3x3x3 pad of grid nodes in its support. With the same notation as
+AccumulateParticleToPad, this computes
+
+  v = ∑ w * pad[a][b][c].v
+  B = ∑ w * pad[a][b][c].v * oᵀ
+
+The APIC matrix (equation 176 [Jiang et al. 2016]) is then given by
+dx * B + v * (x_center - x)ᵀ.
+
+@param pad  The first of 27 contiguous nodes in [a][b][c] order.
+@param[out] v, B  The gathered quantities; must not be null. */
+void AccumulatePadToParticle(const double* wx, const double* wy,
+                             const double* wz, const GridData<double>* pad,
+                             Vector3<double>* v, Matrix3<double>* B);
+
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
@@ -79,11 +79,15 @@ class MockSparseGrid {
 
   int num_blocks() const { return spgrid_.num_blocks(); }
 
+  /* The grid data in MockSparseGrid is stored in a std::map that doesn't
+   support concurrent writes, so the kernels below always run serially and the
+   Parallelism argument is ignored. */
   void ApplyGridToParticleKernel(
       ParticleData<T>* particle_data,
       const std::function<void(int, const Pad<Vector3<double>>&,
                                const Pad<GridData<T>>&, ParticleData<T>*)>&
-          kernel) const {
+          kernel,
+      Parallelism = false) const {
     particle_sorter_.Iterate(this, particle_data, kernel);
   }
 
@@ -91,7 +95,8 @@ class MockSparseGrid {
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<double>>&,
                                const ParticleData<T>&, Pad<GridData<T>>*)>&
-          kernel) {
+          kernel,
+      Parallelism = false) {
     particle_sorter_.Iterate(this, &particle_data, kernel);
   }
 
@@ -99,7 +104,8 @@ class MockSparseGrid {
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<double>>&,
                                const Pad<GridData<T>>&,
-                               const ParticleData<T>&)>& kernel) const {
+                               const ParticleData<T>&)>& kernel,
+      Parallelism = false) const {
     particle_sorter_.Iterate(this, &particle_data, kernel);
   }
 
@@ -9,16 +9,18 @@ namespace mpm {
 namespace internal {
 
 template <typename T, typename Grid>
-MpmModel<T, Grid>::MpmModel(T dt, double dx, ParticleData<T> particle_data)
+MpmModel<T, Grid>::MpmModel(T dt, double dx, ParticleData<T> particle_data,
+                            Parallelism parallelism)
     : dt_(dt),
       dx_(dx),
+      parallelism_(parallelism),
       particle_data_(std::move(particle_data)),
       grid_(std::make_unique<Grid>(dx)),
       transfer_(dt, dx) {
   DRAKE_DEMAND(dt > 0);
   DRAKE_DEMAND(dx > 0);
   grid_->Allocate(particle_data_.x());
-  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable());
+  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable(), parallelism_);
   ConvertGridMomentumToVelocity();
   index_permutation_ = grid_->SetNodeIndices();
 }
@@ -86,7 +88,8 @@ void MpmModel<T, Grid>::CalcResidual(const SolverState<T, Grid>& solver_state,
       }
     }
   };
-  grid().IterateParticleAndGrid(particle_data_, splat_force_kernel);
+  grid().IterateParticleAndGrid(particle_data_, splat_force_kernel,
+                                parallelism_);
   /* Add in the M * dv term. */
   const VectorX<T>& dv = solver_state.dv();
   grid().IterateGrid([&](const GridData<T>& node) {
@@ -111,12 +114,12 @@ void MpmModel<T, Grid>::Update(const SolverState<T, Grid>& solver_state) {
     }
   };
   grid_->IterateGrid(update_grid_velocity);
-  transfer_.GridToParticle(grid(), &particle_data_);
+  transfer_.GridToParticle(grid(), &particle_data_, parallelism_);
   particle_data_.ComputeKirchhoffStress(
       particle_data_.F(), &particle_data_.mutable_deformation_gradient_data(),
-      &particle_data_.mutable_tau_volume());
+      &particle_data_.mutable_tau_volume(), parallelism_);
   grid_->Allocate(particle_data_.x());
-  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable());
+  transfer_.ParticleToGrid(particle_data_, grid_.get_mutable(), parallelism_);
   ConvertGridMomentumToVelocity();
   index_permutation_ = grid_->SetNodeIndices();
 }
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/mpm/particle_data.h"
 #include "drake/multibody/mpm/sparse_grid.h"
@@ -57,16 +58,22 @@ class MpmModel {
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MpmModel);
 
   /* Creates an MpmModel given the current state of particles.
-   @param[in] dt         The time step used in this MpmModel (in seconds).
-   @param[in] dx         The grid spacing (in meters).
-   @param[in] particles  The particle data.
+   @param[in] dt           The time step used in this MpmModel (in seconds).
+   @param[in] dx           The grid spacing (in meters).
+   @param[in] particles    The particle data.
+   @param[in] parallelism  The degree of parallelism used for the transfers
+                           between particles and grid and for the per-particle
+                           stress computations.
    @pre dt > 0 and dx > 0. */
-  MpmModel(T dt, double dx, ParticleData<T> particles);
+  MpmModel(T dt, double dx, ParticleData<T> particles,
+           Parallelism parallelism = false);
 
   T dt() const { return dt_; }
 
   double dx() const { return dx_; }
 
+  Parallelism parallelism() const { return parallelism_; }
+
   int num_particles() const { return particle_data_.num_particles(); }
 
   /* Computes the energy at the given solver state using the formula
@@ -99,6 +106,7 @@ class MpmModel {
 
   T dt_{};
   double dx_{};
+  Parallelism parallelism_{false};
   ParticleData<T> particle_data_{};
   copyable_unique_ptr<Grid> grid_{};
   Transfer<Grid> transfer_;
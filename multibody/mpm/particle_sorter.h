@@ -8,6 +8,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/ssize.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/mpm/bspline_weights.h"
@@ -219,6 +220,16 @@ class ParticleSorter {
    associated with the pad. If a const grid pointer is provided, no grid update
    is performed (but particle update might be performed by the kernel).
 
+   With more than one thread, the blocks are processed concurrently. For
+   grid-to-particle operations, each particle is only written by the thread
+   processing it, so all blocks are processed concurrently. For
+   particle-to-grid and traverse operations, the kernel may write to memory
+   associated with the grid nodes in the pad, so the blocks are processed one
+   color at a time (see colored_ranges()), and only the blocks within a single
+   color are processed concurrently. The blocks are processed in the same
+   color order regardless of the number of threads, so the result does not
+   depend on the degree of parallelism.
+
    @tparam Grid          MPM Grid type (e.g., SparseGrid<double> or
                          const SparseGrid<float>).
    @tparam ParticleData  ParticleData type (e.g., ParticleData<double>, or
@@ -227,21 +238,20 @@ class ParticleSorter {
                          Must be either G2PKernelType or P2GKernelType.
    @param grid_ptr           Pointer to the grid object.
    @param particle_data_ptr  Pointer to the particle data object.
-   @param func               A function to be applied to each particle.
+   @param func               A function to be applied to each particle. It
+                             must be safe to call concurrently when
+                             `parallelism` specifies more than one thread.
+   @param parallelism        Specifies the degree of parallelism to use.
    @pre  Exactly one of the grid/particle pointer is const and the other is
    mutable. When the grid pointer is mutable, the Func signature is
    P2GKernelType; when the particle pointer is mutable, the Func signature is
    G2PKernelType. */
   template <typename Grid, typename ParticleData, typename Func>
   void Iterate(Grid* grid_ptr, ParticleData* particle_data_ptr,
-               const Func& func) const {
+               const Func& func, Parallelism parallelism = false) const {
     const int num_blocks = grid_ptr->num_blocks();
     DRAKE_DEMAND(ssize(sentinel_particles_) == num_blocks + 1);
 
-    /* Deduce types for pad nodes and pad data. */
-    using PadNodeType = typename Grid::PadNodeType;
-    using PadDataType = typename Grid::PadDataType;
-
     constexpr bool const_grid = std::is_const_v<Grid>;
     constexpr bool const_particle = std::is_const_v<ParticleData>;
 
@@ -264,6 +274,45 @@ class ParticleSorter {
           "signature for traverse operations.");
     }
 
+    [[maybe_unused]] const int num_threads = parallelism.num_threads();
+    if constexpr (is_g2p) {
+      /* Each block holds at least one particle, so there is one range per
+       block. */
+      const int num_ranges = ssize(ranges_);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+      for (int r = 0; r < num_ranges; ++r) {
+        IterateRange(ranges_[r], grid_ptr, particle_data_ptr, func);
+      }
+    } else {
+      for (const RangeVector& ranges : colored_ranges_) {
+        const int num_ranges = ssize(ranges);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+        for (int r = 0; r < num_ranges; ++r) {
+          IterateRange(ranges[r], grid_ptr, particle_data_ptr, func);
+        }
+      }
+    }
+  }
+
+ private:
+  /* Helper for Iterate() that applies `func` to the sorted particles in the
+   given `range`, which holds all particles in a single block. */
+  template <typename Grid, typename ParticleData, typename Func>
+  void IterateRange(const Range& range, Grid* grid_ptr,
+                    ParticleData* particle_data_ptr, const Func& func) const {
+    /* Deduce types for pad nodes and pad data. */
+    using PadNodeType = typename Grid::PadNodeType;
+    using PadDataType = typename Grid::PadDataType;
+
+    constexpr bool const_grid = std::is_const_v<Grid>;
+    constexpr bool const_particle = std::is_const_v<ParticleData>;
+    constexpr bool is_g2p = const_grid && !const_particle;
+    constexpr bool is_p2g = const_particle && !const_grid;
+
     /* Temporary variables for pad nodes and pad data. */
     PadNodeType grid_nodes{};
     PadDataType grid_data{};
@@ -271,48 +320,42 @@ class ParticleSorter {
     /* Flag indicating when to fetch new pad data. */
     bool need_new_pad = true;
 
-    /* Iterate over each block. */
-    for (int b = 0; b < num_blocks; ++b) {
-      const int particle_start = sentinel_particles_[b];
-      const int particle_end = sentinel_particles_[b + 1];
+    const int particle_start = range.start();
+    const int particle_end = range.end();
 
-      /* Process each particle within the current block. */
-      for (int p = particle_start; p < particle_end; ++p) {
-        const int data_index = data_indices_[p];
+    /* Process each particle within the current block. */
+    for (int p = particle_start; p < particle_end; ++p) {
+      const int data_index = data_indices_[p];
 
-        /* Fetch new pad data and nodes when we meet particles belonging to a
-         new pad. */
-        if (need_new_pad) {
-          grid_data = grid_ptr->GetPadData(base_node_offsets_[p]);
-          grid_nodes =
-              grid_ptr->GetPadNodes(particle_data_ptr->x()[data_index]);
-        }
+      /* Fetch new pad data and nodes when we meet particles belonging to a
+       new pad. */
+      if (need_new_pad) {
+        grid_data = grid_ptr->GetPadData(base_node_offsets_[p]);
+        grid_nodes = grid_ptr->GetPadNodes(particle_data_ptr->x()[data_index]);
+      }
 
-        /* Apply the provided function to the current particle. */
-        if constexpr (is_g2p) {
-          func(data_index, grid_nodes, grid_data, particle_data_ptr);
-        } else if constexpr (is_p2g) {
-          func(data_index, grid_nodes, *particle_data_ptr, &grid_data);
-        } else {
-          static_assert(is_traverse);
-          func(data_index, grid_nodes, grid_data, *particle_data_ptr);
-        }
+      /* Apply the provided function to the current particle. */
+      if constexpr (is_g2p) {
+        func(data_index, grid_nodes, grid_data, particle_data_ptr);
+      } else if constexpr (is_p2g) {
+        func(data_index, grid_nodes, *particle_data_ptr, &grid_data);
+      } else {
+        func(data_index, grid_nodes, grid_data, *particle_data_ptr);
+      }
 
-        /* Determine if the next particle requires new pad data. */
-        need_new_pad = (p + 1 == particle_end) ||
-                       (base_node_offsets_[p] != base_node_offsets_[p + 1]);
+      /* Determine if the next particle requires new pad data. */
+      need_new_pad = (p + 1 == particle_end) ||
+                     (base_node_offsets_[p] != base_node_offsets_[p + 1]);
 
-        /* Write to the pad if this is a P2G operation. */
-        if constexpr (is_p2g) {
-          if (need_new_pad) {
-            grid_ptr->SetPadData(base_node_offsets_[p], grid_data);
-          }
+      /* Write to the pad if this is a P2G operation. */
+      if constexpr (is_p2g) {
+        if (need_new_pad) {
+          grid_ptr->SetPadData(base_node_offsets_[p], grid_data);
         }
       }
     }
   }
 
- private:
   /* Helper for Sort(). Resizes all containers and clear old data. */
   void Initialize(int num_particles);
 
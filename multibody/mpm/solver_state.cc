@@ -21,7 +21,8 @@ void SolverState<T, Grid>::Reset(const MpmModel<T, Grid>& model) {
   tau_volume_ = particle_data.tau_volume();
   volume_scaled_stress_derivatives_.resize(F_.size());
   particle_data.ComputePK1StressDerivatives(F_, &deformation_gradient_data_,
-                                            &volume_scaled_stress_derivatives_);
+                                            &volume_scaled_stress_derivatives_,
+                                            model.parallelism());
 
   dv_.resize(model.num_dofs());
   dv_.setZero();
@@ -64,7 +65,8 @@ void SolverState<T, Grid>::UpdateState(const VectorX<T>& ddv,
     F_[p_index] = F0 + C * dt * F0;
   };
   const auto& particle_data = model.particle_data();
-  model.grid().IterateParticleAndGrid(particle_data, update_F_kernel);
+  model.grid().IterateParticleAndGrid(particle_data, update_F_kernel,
+                                      model.parallelism());
 
   // TODO(xuchenhan-tri): This can be grouped into a single function to reduce
   // redundant computation.
@@ -72,9 +74,10 @@ void SolverState<T, Grid>::UpdateState(const VectorX<T>& ddv,
   elastic_energy_ =
       particle_data.ComputeTotalEnergy(F_, &deformation_gradient_data_);
   particle_data.ComputeKirchhoffStress(F_, &deformation_gradient_data_,
-                                       &tau_volume_);
+                                       &tau_volume_, model.parallelism());
   particle_data.ComputePK1StressDerivatives(F_, &deformation_gradient_data_,
-                                            &volume_scaled_stress_derivatives_);
+                                            &volume_scaled_stress_derivatives_,
+                                            model.parallelism());
 }
 
 }  // namespace internal
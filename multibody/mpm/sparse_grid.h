@@ -142,14 +142,18 @@ class SparseGrid {
                                  data to be modified by the kernel. This data
                                  may be modified by the kernel.
    @param[in] kernel             The grid-to-particle kernel to apply.
+   @param[in] parallelism        Specifies the degree of parallelism to use.
+                                 With more than one thread, the kernel is
+                                 called concurrently for different particles.
    @pre The grid's Allocate() method must have been called with the positions
    contained in the given particle_data. */
   void ApplyGridToParticleKernel(
       ParticleData<T>* particle_data,
       const std::function<void(int, const Pad<Vector3<T>>&,
                                const Pad<GridData<T>>&, ParticleData<T>*)>&
-          kernel) const {
-    particle_sorter_.Iterate(this, particle_data, kernel);
+          kernel,
+      Parallelism parallelism = false) const {
+    particle_sorter_.Iterate(this, particle_data, kernel, parallelism);
   }
 
   /* Iterates over all particles and the grid nodes supported by them, applying
@@ -173,14 +177,21 @@ class SparseGrid {
                              relevant grid pad as well as the current particle
                              state to be used in the kernel.
    @param[in] kernel         The grid-to-particle kernel to apply.
+   @param[in] parallelism    Specifies the degree of parallelism to use. With
+                             more than one thread, the kernel is called
+                             concurrently for particles whose supports don't
+                             overlap (see ParticleSorter::colored_ranges()),
+                             so it may write to memory associated with the
+                             grid nodes in the pad without synchronization.
    @pre The grid's Allocate() method must have been called with the positions
    contained in the given particle_data. */
   void IterateParticleAndGrid(
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<T>>&,
                                const Pad<GridData<T>>&,
-                               const ParticleData<T>&)>& kernel) const {
-    particle_sorter_.Iterate(this, &particle_data, kernel);
+                               const ParticleData<T>&)>& kernel,
+      Parallelism parallelism = false) const {
+    particle_sorter_.Iterate(this, &particle_data, kernel, parallelism);
   }
 
   /* Iterates over all particles and the grid nodes supported by them,
@@ -208,6 +219,12 @@ class SparseGrid {
    @param[in] particle_data  A const reference to the particle data to iterate
                              over.
    @param[in] kernel         The particle-to-grid kernel to apply.
+   @param[in] parallelism    Specifies the degree of parallelism to use. With
+                             more than one thread, the kernel is called
+                             concurrently for particles whose supports don't
+                             overlap (see ParticleSorter::colored_ranges()).
+                             The result doesn't depend on the number of
+                             threads.
    @post The grid data corresponding to each particle's support is updated with
    any modifications performed by the kernel.
    @pre The grid's Allocate() method must have been called with the
@@ -216,8 +233,9 @@ class SparseGrid {
       const ParticleData<T>& particle_data,
       const std::function<void(int, const Pad<Vector3<T>>&,
                                const ParticleData<T>&, Pad<GridData<T>>*)>&
-          kernel) {
-    particle_sorter_.Iterate(this, &particle_data, kernel);
+          kernel,
+      Parallelism parallelism = false) {
+    particle_sorter_.Iterate(this, &particle_data, kernel, parallelism);
   }
 
   /* Iterates over all grid nodes in the grid and applies the given function
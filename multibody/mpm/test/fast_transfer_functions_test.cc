@@ -0,0 +1,149 @@
+#include "drake/multibody/mpm/fast_transfer_functions.h"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/tests/hwy_gtest.h"
+#pragma GCC diagnostic pop
+
+#include <gtest/gtest.h>
+
+#include "drake/common/hwy_dynamic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/mpm/bspline_weights.h"
+
+namespace drake {
+namespace multibody {
+namespace mpm {
+namespace internal {
+namespace {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+/* This hwy-infused test fixture replicates every test case to be run against
+every target architecture variant (e.g., SSE4, AVX2, AVX512VL, etc). When run,
+it filters the suite to only run tests that the current CPU can handle. */
+class FastTransferFunctionsTest : public hwy::TestWithParamTarget {
+ protected:
+  void SetUp() override {
+    // Reset Drake's dispatcher, to be sure that we run all of the target
+    // architectures.
+    drake::internal::HwyDynamicReset();
+    hwy::TestWithParamTarget::SetUp();
+  }
+
+  /* Returns 27 nodes with arbitrary, distinct data in every field. */
+  static std::array<GridData<double>, 27> MakePad() {
+    std::array<GridData<double>, 27> pad;
+    for (int i = 0; i < 27; ++i) {
+      pad[i].v = Vector3d(0.1 * i, -0.2 * i + 1.0, 0.3 * i - 2.0);
+      pad[i].m = 1.0 + 0.5 * i;
+      pad[i].scratch = Vector3d(i, 2 * i, 3 * i);
+      pad[i].index_or_flag.set_index(i);
+    }
+    return pad;
+  }
+
+  /* The per-dimension weights used by the pad kernels. */
+  const std::array<double, 3> wx_{0.2, 0.7, 0.1};
+  const std::array<double, 3> wy_{0.05, 0.6, 0.35};
+  const std::array<double, 3> wz_{0.3, 0.65, 0.05};
+};
+
+HWY_TARGET_INSTANTIATE_TEST_SUITE_P(FastTransferFunctionsTest);
+
+/* The batched weights agree with BsplineWeights, including for batch sizes
+that aren't a multiple of any SIMD width and points exactly halfway between
+grid nodes. */
+TEST_P(FastTransferFunctionsTest, CalcBsplineWeights) {
+  const double dx = 0.1;
+  for (int num_particles = 0; num_particles <= 11; ++num_particles) {
+    std::vector<Vector3d> x(num_particles);
+    for (int p = 0; p < num_particles; ++p) {
+      x[p] = Vector3d(0.013 * p - 0.05, 0.25 - 0.031 * p, 0.05 + 0.1 * p);
+    }
+    std::vector<double> weights(9 * num_particles);
+    CalcBsplineWeights(x.data(), num_particles, dx, weights.data());
+    for (int p = 0; p < num_particles; ++p) {
+      const BsplineWeights<double> expected(x[p], dx);
+      const double* wx = &weights[3 * p];
+      const double* wy = &weights[3 * (num_particles + p)];
+      const double* wz = &weights[3 * (2 * num_particles + p)];
+      for (int a = 0; a < 3; ++a) {
+        for (int b = 0; b < 3; ++b) {
+          for (int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(wx[a] * wy[b] * wz[c], expected.weight(a, b, c),
+                        4.0 * kEps);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_P(FastTransferFunctionsTest, AccumulateParticleToPad) {
+  const Vector3d q(1.0, -2.0, 0.5);
+  const double m = 3.0;
+  Matrix3d dx_A;
+  // clang-format off
+  dx_A << 1, 4, 7,
+          2, 5, 8,
+          3, 6, 9;
+  // clang-format on
+  std::array<GridData<double>, 27> pad = MakePad();
+  const std::array<GridData<double>, 27> original = pad;
+  AccumulateParticleToPad(wx_.data(), wy_.data(), wz_.data(), q, m, dx_A,
+                          pad.data());
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      for (int c = 0; c < 3; ++c) {
+        const int i = 9 * a + 3 * b + c;
+        const double w = wx_[a] * wy_[b] * wz_[c];
+        const Vector3d o(a - 1, b - 1, c - 1);
+        const Vector3d expected_v = original[i].v + w * (q + dx_A * o);
+        EXPECT_TRUE(CompareMatrices(pad[i].v, expected_v, 16 * kEps));
+        EXPECT_NEAR(pad[i].m, original[i].m + w * m, 16 * kEps);
+        /* The remaining fields are untouched. */
+        EXPECT_EQ(pad[i].scratch, original[i].scratch);
+        EXPECT_EQ(pad[i].index_or_flag.index(),
+                  original[i].index_or_flag.index());
+      }
+    }
+  }
+}
+
+TEST_P(FastTransferFunctionsTest, AccumulatePadToParticle) {
+  const std::array<GridData<double>, 27> pad = MakePad();
+  Vector3d expected_v = Vector3d::Zero();
+  Matrix3d expected_B = Matrix3d::Zero();
+  for (int a = 0; a < 3; ++a) {
+    for (int b = 0; b < 3; ++b) {
+      for (int c = 0; c < 3; ++c) {
+        const double w = wx_[a] * wy_[b] * wz_[c];
+        const Vector3d o(a - 1, b - 1, c - 1);
+        const Vector3d& vi = pad[9 * a + 3 * b + c].v;
+        expected_v += w * vi;
+        expected_B += w * vi * o.transpose();
+      }
+    }
+  }
+  /* The outputs are overwritten, not accumulated into. */
+  Vector3d v = Vector3d::Constant(100);
+  Matrix3d B = Matrix3d::Constant(100);
+  AccumulatePadToParticle(wx_.data(), wy_.data(), wz_.data(), pad.data(), &v,
+                          &B);
+  EXPECT_TRUE(CompareMatrices(v, expected_v, 16 * kEps));
+  EXPECT_TRUE(CompareMatrices(B, expected_B, 16 * kEps));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace mpm
+}  // namespace multibody
+}  // namespace drake
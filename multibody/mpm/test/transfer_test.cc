@@ -1,8 +1,12 @@
 #include "drake/multibody/mpm/transfer.h"
 
+#include <array>
+#include <map>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/mpm/mock_sparse_grid.h"
 
 namespace drake {
 namespace multibody {
@@ -205,6 +209,105 @@ GTEST_TEST(TransferTest, MomentumConservation) {
                             expected);
 }
 
+/* Verifies that the transfers produce bitwise identical results regardless of
+ the degree of parallelism, with enough particles to populate many pages of
+ every color. */
+GTEST_TEST(TransferTest, ParallelTransfersMatchSerial) {
+  const double dx = 0.05;
+  ParticleData<double> serial_particles;
+  for (int i = 0; i < 2000; ++i) {
+    const Vector3d x(std::sin(1.1 * i), std::sin(2.3 * i + 0.5),
+                     std::sin(3.7 * i + 1.0));
+    AddParticle(&serial_particles, x);
+  }
+  ParticleData<double> parallel_particles = serial_particles;
+
+  SparseGrid<double> serial_grid(dx);
+  SparseGrid<double> parallel_grid(dx);
+  serial_grid.Allocate(serial_particles.x());
+  parallel_grid.Allocate(parallel_particles.x());
+
+  const double dt = 0.01;
+  Transfer transfer(dt, dx);
+  transfer.ParticleToGrid(serial_particles, &serial_grid);
+  transfer.ParticleToGrid(parallel_particles, &parallel_grid, Parallelism(4));
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> serial_data =
+      serial_grid.GetGridData();
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> parallel_data =
+      parallel_grid.GetGridData();
+  ASSERT_EQ(serial_data.size(), parallel_data.size());
+  for (int i = 0; i < ssize(serial_data); ++i) {
+    EXPECT_EQ(serial_data[i].first, parallel_data[i].first);
+    EXPECT_EQ(serial_data[i].second.v, parallel_data[i].second.v);
+    EXPECT_EQ(serial_data[i].second.m, parallel_data[i].second.m);
+  }
+
+  ConvertMomentumToVelocity(&serial_grid);
+  ConvertMomentumToVelocity(&parallel_grid);
+  transfer.GridToParticle(serial_grid, &serial_particles);
+  transfer.GridToParticle(parallel_grid, &parallel_particles, Parallelism(4));
+  EXPECT_EQ(serial_particles.x(), parallel_particles.x());
+  EXPECT_EQ(serial_particles.v(), parallel_particles.v());
+  EXPECT_EQ(serial_particles.C(), parallel_particles.C());
+  EXPECT_EQ(serial_particles.F(), parallel_particles.F());
+}
+
+/* Verifies that the transfers with SparseGrid<double>, which use the SIMD
+ kernels in fast_transfer_functions.h, agree with the generic implementation
+ used with MockSparseGrid<double>. */
+GTEST_TEST(TransferTest, SparseGridMatchesMockGrid) {
+  const double dx = 0.05;
+  ParticleData<double> sparse_particles;
+  for (int i = 0; i < 200; ++i) {
+    const Vector3d x(std::sin(1.1 * i), std::sin(2.3 * i + 0.5),
+                     std::sin(3.7 * i + 1.0));
+    AddParticle(&sparse_particles, x);
+  }
+  ParticleData<double> mock_particles = sparse_particles;
+
+  SparseGrid<double> sparse_grid(dx);
+  MockSparseGrid<double> mock_grid(dx);
+  sparse_grid.Allocate(sparse_particles.x());
+  mock_grid.Allocate(mock_particles.x());
+
+  const double dt = 0.01;
+  Transfer<SparseGrid<double>> sparse_transfer(dt, dx);
+  Transfer<MockSparseGrid<double>> mock_transfer(dt, dx);
+  sparse_transfer.ParticleToGrid(sparse_particles, &sparse_grid);
+  mock_transfer.ParticleToGrid(mock_particles, &mock_grid);
+  const double kTol = 1e-14;
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> sparse_data =
+      sparse_grid.GetGridData();
+  const std::vector<std::pair<Vector3<int>, GridData<double>>> mock_data =
+      mock_grid.GetGridData();
+  ASSERT_EQ(sparse_data.size(), mock_data.size());
+  std::map<std::array<int, 3>, GridData<double>> mock_data_by_node;
+  for (const auto& [node, data] : mock_data) {
+    mock_data_by_node[{node[0], node[1], node[2]}] = data;
+  }
+  for (const auto& [node, data] : sparse_data) {
+    const GridData<double>& expected =
+        mock_data_by_node.at({node[0], node[1], node[2]});
+    EXPECT_TRUE(CompareMatrices(data.v, expected.v, kTol));
+    EXPECT_NEAR(data.m, expected.m, kTol);
+  }
+
+  ConvertMomentumToVelocity(&sparse_grid);
+  ConvertMomentumToVelocity(&mock_grid);
+  sparse_transfer.GridToParticle(sparse_grid, &sparse_particles);
+  mock_transfer.GridToParticle(mock_grid, &mock_particles);
+  for (int p = 0; p < sparse_particles.num_particles(); ++p) {
+    EXPECT_TRUE(CompareMatrices(sparse_particles.x()[p], mock_particles.x()[p],
+                                kTol));
+    EXPECT_TRUE(CompareMatrices(sparse_particles.v()[p], mock_particles.v()[p],
+                                kTol));
+    EXPECT_TRUE(CompareMatrices(sparse_particles.C()[p], mock_particles.C()[p],
+                                1e-12));
+    EXPECT_TRUE(CompareMatrices(sparse_particles.F()[p], mock_particles.F()[p],
+                                kTol));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace mpm
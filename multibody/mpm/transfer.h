@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+
+#include "drake/common/parallelism.h"
 #include "drake/multibody/mpm/particle_data.h"
 #include "drake/multibody/mpm/sparse_grid.h"
 
@@ -46,14 +49,22 @@ class Transfer {
    process, also mark the grid nodes that are in support of any particle that is
    participating in a constraint with the "participating" flag.
    @note The `v` attribute of the grid data at the end of the operation stores
-   the momentum, not velocity, of the grid node. */
-  void ParticleToGrid(const ParticleData<T>& particle, Grid* grid);
+   the momentum, not velocity, of the grid node.
+   @param parallelism  Specifies the degree of parallelism to use. Particles
+                       whose supports don't overlap are transferred
+                       concurrently (see ParticleSorter::colored_ranges()),
+                       and the result doesn't depend on the number of
+                       threads. */
+  void ParticleToGrid(const ParticleData<T>& particle, Grid* grid,
+                      Parallelism parallelism = false);
 
   /* Grid to particle transfer (G2P). After the call to G2P, the particles store
    the mass and momentum transfered from the grid using APIC.
    @pre the grid stores mass and velocity (not momentum). Hence, the velocity
-   from the grid needs to be processed after P2G and before G2P. */
-  void GridToParticle(const Grid& grid, ParticleData<T>* particle);
+   from the grid needs to be processed after P2G and before G2P.
+   @param parallelism  Specifies the degree of parallelism to use. */
+  void GridToParticle(const Grid& grid, ParticleData<T>* particle,
+                      Parallelism parallelism = false);
 
   T D_inverse() const { return D_inverse_; }
 
@@ -64,6 +75,9 @@ class Transfer {
    course notes referenced in the class documentation. */
   T D_inverse_{};
   T D_inverse_dt_{};
+  /* Scratch space for the B-spline weights of all particles, used by the SIMD
+   transfer kernels when Grid == SparseGrid<double>. */
+  std::vector<double> bspline_weights_;
 };
 
 }  // namespace internal
@@ -126,6 +126,12 @@ void DeformableDriver<T>::DeclareCacheEntries(
         g_id, vertex_permutation_cache_entry.cache_index());
 
     FemSolver<T> model_fem_solver(&fem_model, &deformable_model_->integrator());
+    const fem::DeformableBodyConfig<T>& config =
+        deformable_model_->GetBody(id).config();
+    model_fem_solver.set_linear_solver_preconditioner(
+        config.linear_solver_preconditioner());
+    model_fem_solver.set_use_matrix_free_tangent(
+        config.use_matrix_free_tangent());
     /* Cache entry for free motion FEM state and data. */
     const auto& fem_solver_cache_entry = manager->DeclareCacheEntry(
         fmt::format("FEM solver and data for body with index {}", i),
@@ -396,6 +396,12 @@ void DeformableModel<T>::DoDeclareSystemResources() {
           this->plant().gravity_field().gravity_vector();
       body.SetExternalForces(force_densities_, gravity);
     }
+    /* SceneGraph refits the deformable geometries with the same parallelism
+     as the FEM models. */
+    if (num_bodies() > 0) {
+      this->mutable_scene_graph().SetDeformableGeometryParallelism(
+          parallelism_);
+    }
     /* Declare cache entries and input ports for force density fields that need
      them. */
     for (std::unique_ptr<ForceDensityFieldBase<T>>& force_density :
@@ -424,7 +424,10 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
   // calling SetParallelism(Parallelism::Max()) on a model that has already been
   // parallelized at a higher level.
   /** (Internal use only) Configures the parallelism that `this`
-   %DeformableModel uses when opportunities for parallel computation arises. */
+   %DeformableModel uses when opportunities for parallel computation arises.
+   When the owning plant is finalized, the parallelism in effect is also
+   handed to SceneGraph to update the deformable geometries registered by
+   `this` model (see SceneGraph::SetDeformableGeometryParallelism()). */
   void SetParallelism(Parallelism parallelism);
 
   /** (Internal use only) Returns the parallelism that `this` %DeformableModel
@@ -13,8 +13,21 @@ DiscreteStepMemory::Data<T>::~Data() = default;
 
 template <typename T>
 DiscreteStepMemory::Data<T>& DiscreteStepMemory::Allocate(
-    const MultibodyTreeTopology& topology) {
-  auto new_data = std::make_shared<Data<T>>(topology);
+    const MultibodyTreeTopology& topology, DiscreteStepMemory* spare) {
+  DRAKE_DEMAND(spare != this);
+  std::shared_ptr<Data<T>> new_data;
+  if (spare != nullptr) {
+    auto* maybe_spare =
+        std::get_if<std::shared_ptr<const Data<T>>>(&spare->data);
+    if (maybe_spare != nullptr && maybe_spare->use_count() == 1) {
+      // Nobody else can observe the spare data, so it's safe to mutate it.
+      new_data = std::const_pointer_cast<Data<T>>(std::move(*maybe_spare));
+    }
+    spare->data = std::move(data);
+  }
+  if (new_data == nullptr) {
+    new_data = std::make_shared<Data<T>>(topology);
+  }
   Data<T>* result = new_data.get();
   data = std::move(new_data);
   return *result;
@@ -25,9 +25,10 @@ including continuous-time mode, this class is not used.)
 The values here are populated during DiscreteUpdateManager::CalcDiscreteValues,
 except for `reaction_forces` which is populated in the MbP.
 
-Once it has been populated, the stored Data is immutable forever after. Copying
-or assigning the `DiscreteStepMemory` just switches which immutable Data it is
-pointing to, it doesn't overwrite anything. */
+Once it has been populated, the stored Data is immutable for as long as anyone
+else refers to it. Copying or assigning the `DiscreteStepMemory` just switches
+which immutable Data it is pointing to, it doesn't overwrite anything. Only Data
+that is no longer shared may be recycled by Allocate() (see below). */
 struct DiscreteStepMemory {
   /* Because DiscreteStepMemory lives as abstract state in the context, it can't
   be templated on a scalar type. Instead, we'll use a templated nested struct,
@@ -60,9 +61,18 @@ struct DiscreteStepMemory {
 
   /* Resets this object with fresh-allocated (empty) data.
   Returns a mutable reference to the new data.
+
+  When `spare` is non-null, it is used to recycle storage across calls: if the
+  `spare` holds Data<T> that is referred to by nobody else, that Data is reused
+  (with its previous contents, which callers must overwrite) instead of a fresh
+  allocation. In either case, `spare` is then left holding the data this object
+  referred to prior to the call, so that it can be recycled next time once all
+  other references to it are gone.
+  @pre spare != this
   @tparam_default_scalar */
   template <typename T>
-  Data<T>& Allocate(const MultibodyTreeTopology& topology);
+  Data<T>& Allocate(const MultibodyTreeTopology& topology,
+                    DiscreteStepMemory* spare = nullptr);
 
   /* If this memory holds data for scalar type T, then returns a const pointer
   to the data. Otherwise, returns nullptr. */
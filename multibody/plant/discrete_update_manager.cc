@@ -285,6 +285,13 @@ VectorX<T> DiscreteUpdateManager<T>::AssembleActuationInput(
       plant(), context);
 }
 
+template <typename T>
+void DiscreteUpdateManager<T>::AssembleActuationInput(
+    const systems::Context<T>& context, VectorX<T>* actuation_input) const {
+  MultibodyPlantDiscreteUpdateManagerAttorney<T>::AssembleActuationInput(
+      plant(), context, actuation_input);
+}
+
 template <typename T>
 DesiredStateInput<T> DiscreteUpdateManager<T>::AssembleDesiredStateInput(
     const systems::Context<T>& context) const {
@@ -1075,16 +1082,17 @@ void DiscreteUpdateManager<T>::DoCalcDiscreteValues(
   const auto q0 = x0.topRows(nq);
 
   // Retrieve the rigid velocity for the next time step.
-  const VectorX<T>& v_next = results.v_next.head(plant().num_velocities());
-
-  // Update generalized positions.
-  VectorX<T> qdot_next(plant().num_positions());
-  plant().MapVelocityToQDot(context, v_next, &qdot_next);
-  const VectorX<T> q_next = q0 + plant().time_step() * qdot_next;
-
-  VectorX<T> x_next(plant().num_multibody_states());
-  x_next << q_next, v_next;
-  updates->set_value(multibody_state_index(), x_next);
+  const auto v_next = results.v_next.head(plant().num_velocities());
+
+  // Update generalized positions. We write directly into `updates` to avoid
+  // heap allocations; q̇ is first stored in the positions' slot and then
+  // replaced with q_next = q0 + dt⋅q̇_next.
+  Eigen::VectorBlock<VectorX<T>> x_next =
+      updates->get_mutable_value(multibody_state_index());
+  auto q_next = x_next.head(nq);
+  plant().MapVelocityToQDot(context, v_next, &q_next);
+  q_next = q0 + plant().time_step() * q_next;
+  x_next.tail(plant().num_velocities()) = v_next;
 }
 
 template <typename T>
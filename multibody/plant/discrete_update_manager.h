@@ -315,6 +315,9 @@ class DiscreteUpdateManager : public ScalarConvertibleComponent<T> {
 
   VectorX<T> AssembleActuationInput(const systems::Context<T>& context) const;
 
+  void AssembleActuationInput(const systems::Context<T>& context,
+                              VectorX<T>* actuation_input) const;
+
   DesiredStateInput<T> AssembleDesiredStateInput(
       const systems::Context<T>& context) const;
 
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/multibody/math/spatial_force.h"
+#include "drake/multibody/plant/hydroelastic_traction_calculator.h"
 
 namespace drake {
 namespace multibody {
@@ -11,7 +14,8 @@ namespace internal {
 // Structure used in the calculation of hydroelastic contact forces.
 template <typename T>
 struct HydroelasticContactForcesContinuousCacheData {
-  explicit HydroelasticContactForcesContinuousCacheData(int num_bodies) {
+  explicit HydroelasticContactForcesContinuousCacheData(int num_bodies)
+      : data_array(std::make_unique<std::vector<TractionData>>()) {
     F_BBo_W_array.resize(num_bodies);
   }
 
@@ -26,6 +30,22 @@ struct HydroelasticContactForcesContinuousCacheData {
   // documentation on the semantics (but in short: it's the force on the body
   // associated with the i'th surface).
   std::vector<SpatialForce<T>> F_Ac_W_array;
+
+  // Scratch storage for integrating the tractions over the contact surfaces,
+  // kept here to avoid reallocating it on every evaluation; see
+  // HydroelasticTractionCalculator::
+  // ComputeSpatialForcesAtCentroidsFromHydroelasticModel().
+  std::vector<SpatialForce<T>> F_Ac_W_block_sums;
+  std::vector<int> first_block_index;
+
+  // Scratch storage for the per-surface inputs to the traction integration,
+  // congruent with `F_Ac_W_array`. The calculator's Data refers to its contact
+  // surface and isn't assignable, hence the copyable_unique_ptr; its entries
+  // are only meaningful during the computation that fills them in.
+  using TractionData = typename HydroelasticTractionCalculator<T>::Data;
+  copyable_unique_ptr<std::vector<TractionData>> data_array;
+  std::vector<double> dissipation_array;
+  std::vector<double> dynamic_friction_array;
 };
 
 }  // namespace internal
@@ -3,12 +3,14 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "drake/common/never_destroyed.h"
+#include "drake/common/ssize.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
-#include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 namespace drake {
 
@@ -20,6 +22,24 @@ using math::RigidTransform;
 namespace multibody {
 namespace internal {
 
+namespace {
+
+// Use a second-order Gaussian quadrature rule. For linear pressure fields,
+// the second-order rule allows exact computation (to floating point error)
+// of the moment on the bodies from the integral of the contact tractions.
+// The moment r × f is a quadratic function of the surface location, since it
+// is a linear operation (r × f) applied to a (typically) linear function
+// (i.e., the traction, f). Higher-order pressure fields and nonlinear
+// tractions (from, e.g., incorporating the Stribeck curve into the friction
+// model) might see benefit from a higher-order quadrature.
+const GaussianTriangleQuadratureRule& GetQuadratureRule() {
+  static const never_destroyed<GaussianTriangleQuadratureRule> rule(
+      2 /* order */);
+  return rule.access();
+}
+
+}  // namespace
+
 template <class T>
 void HydroelasticTractionCalculator<T>::
     ComputeSpatialForcesAtCentroidFromHydroelasticModel(
@@ -27,52 +47,121 @@ void HydroelasticTractionCalculator<T>::
         SpatialForce<T>* F_Ac_W) const {
   DRAKE_DEMAND(F_Ac_W != nullptr);
 
-  // Use a second-order Gaussian quadrature rule. For linear pressure fields,
-  // the second-order rule allows exact computation (to floating point error)
-  // of the moment on the bodies from the integral of the contact tractions.
-  // The moment r × f is a quadratic function of the surface location, since it
-  // is a linear operation (r × f) applied to a (typically) linear function
-  // (i.e., the traction, f). Higher-order pressure fields and nonlinear
-  // tractions (from, e.g., incorporating the Stribeck curve into the friction
-  // model) might see benefit from a higher-order quadrature.
-  const GaussianTriangleQuadratureRule gaussian(2 /* order */);
-
   // We'll be accumulating force on body A at the surface centroid C,
-  // triangle-by-triangle.
+  // block-by-block, in the same order as the batched version below.
   F_Ac_W->SetZero();
+  const int num_faces = data.surface.num_faces();
+  for (int begin = 0; begin < num_faces; begin += kFacesPerBlock) {
+    const int end = std::min(begin + kFacesPerBlock, num_faces);
+    (*F_Ac_W) += IntegrateFaces(data, begin, end, dissipation, mu_coulomb);
+  }
+}
 
-  // Integrate the tractions over all triangles in the contact surface.
-  for (int i = 0; i < data.surface.num_faces(); ++i) {
-    // Construct the function to be integrated over triangle i.
-    // TODO(sherm1) Pull functor creation out of the loop (not a good idea to
-    //              create a new functor for every i).
-    if (data.surface.is_triangle()) {
-      std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
-          [this, &data, i, dissipation,
-           mu_coulomb](const Vector3<T>& Q_barycentric) {
-            const HydroelasticQuadraturePointData<T> traction_output =
-                CalcTractionAtPoint(data, i, Q_barycentric, dissipation,
-                                    mu_coulomb);
-            return ComputeSpatialTractionAtAcFromTractionAtAq(
-                data, traction_output.p_WQ, traction_output.traction_Aq_W);
-          };
+template <class T>
+void HydroelasticTractionCalculator<T>::
+    ComputeSpatialForcesAtCentroidsFromHydroelasticModel(
+        const std::vector<Data>& data, const std::vector<double>& dissipation,
+        const std::vector<double>& mu_coulomb, Parallelism parallelism,
+        std::vector<SpatialForce<T>>* F_Ac_W,
+        std::vector<SpatialForce<T>>* block_sums,
+        std::vector<int>* first_block) const {
+  DRAKE_DEMAND(F_Ac_W != nullptr);
+  DRAKE_DEMAND(block_sums != nullptr);
+  DRAKE_DEMAND(first_block != nullptr);
+  const int num_surfaces = ssize(data);
+  DRAKE_DEMAND(ssize(dissipation) == num_surfaces);
+  DRAKE_DEMAND(ssize(mu_coulomb) == num_surfaces);
+
+  // Lay out the blocks of all surfaces back to back; the blocks of surface i
+  // are [first_block[i], first_block[i + 1]).
+  first_block->resize(num_surfaces + 1);
+  (*first_block)[0] = 0;
+  for (int i = 0; i < num_surfaces; ++i) {
+    const int num_faces = data[i].surface.num_faces();
+    (*first_block)[i + 1] =
+        (*first_block)[i] + (num_faces + kFacesPerBlock - 1) / kFacesPerBlock;
+  }
+  const int num_blocks = first_block->back();
+  block_sums->resize(num_blocks);
+
+  // Integrate the blocks. Each one only writes to its own partial sum.
+  // AutoDiffXd integrands are heavy on the heap, so we only run in parallel
+  // for double.
+  [[maybe_unused]] const int num_threads =
+      std::is_same_v<T, double> ? parallelism.num_threads() : 1;
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+#endif
+  for (int b = 0; b < num_blocks; ++b) {
+    // Find the surface i that block b belongs to. (Empty surfaces have no
+    // blocks, so upper_bound skips past them.)
+    const int i = std::upper_bound(first_block->begin(), first_block->end(),
+                                   b) -
+                  first_block->begin() - 1;
+    const int begin = (b - (*first_block)[i]) * kFacesPerBlock;
+    const int end =
+        std::min(begin + kFacesPerBlock, data[i].surface.num_faces());
+    (*block_sums)[b] =
+        IntegrateFaces(data[i], begin, end, dissipation[i], mu_coulomb[i]);
+  }
+
+  // Reduce the block sums of each surface, in order.
+  F_Ac_W->resize(num_surfaces);
+  for (int i = 0; i < num_surfaces; ++i) {
+    SpatialForce<T>& F = (*F_Ac_W)[i];
+    F.SetZero();
+    for (int b = (*first_block)[i]; b < (*first_block)[i + 1]; ++b) {
+      F += (*block_sums)[b];
+    }
+  }
+}
 
+template <class T>
+SpatialForce<T> HydroelasticTractionCalculator<T>::IntegrateFaces(
+    const Data& data, int begin, int end, double dissipation,
+    double mu_coulomb) const {
+  const std::vector<Eigen::Vector2d>& quadrature_points =
+      GetQuadratureRule().quadrature_points();
+  const std::vector<double>& weights = GetQuadratureRule().weights();
+  const int num_points = ssize(weights);
+  DRAKE_DEMAND(ssize(quadrature_points) == num_points && num_points >= 1);
+
+  SpatialForce<T> F_Ac_W = SpatialForce<T>::Zero();
+  for (int i = begin; i < end; ++i) {
+    if (data.surface.is_triangle()) {
       // Compute the integral over the triangle to get a force from the
-      // tractions (force/area) at the Gauss points (shifted to C).
-      const SpatialForce<T> Fi_Ac_W =  // Force from triangle i.
-          TriangleQuadrature<SpatialForce<T>, T>::Integrate(
-              traction_Ac_W, gaussian, data.surface.area(i));
-      // Update the spatial force at the centroid.
-      (*F_Ac_W) += Fi_Ac_W;
+      // tractions (force/area) at the Gauss points (shifted to C). This is
+      // TriangleQuadrature::Integrate(), without its std::function overhead.
+      SpatialForce<T> integral;
+      for (int q = 0; q < num_points; ++q) {
+        const Eigen::Vector2d& p = quadrature_points[q];
+        const typename TriangleSurfaceMesh<T>::template Barycentric<T>
+            Q_barycentric(p[0], p[1], T(1.0) - p[0] - p[1]);
+        const HydroelasticQuadraturePointData<T> traction_output =
+            CalcTractionAtPoint(data, i, Q_barycentric, dissipation,
+                                mu_coulomb);
+        const SpatialForce<T> traction_Ac_W =
+            ComputeSpatialTractionAtAcFromTractionAtAq(
+                data, traction_output.p_WQ, traction_output.traction_Aq_W);
+        if (q == 0) {
+          integral = traction_Ac_W * weights[q];
+        } else {
+          integral += traction_Ac_W * weights[q];
+        }
+      }
+      // Update the spatial force at the centroid with the force from
+      // triangle i.
+      F_Ac_W += integral * data.surface.area(i);
     } else {
       const HydroelasticQuadraturePointData<T> traction_output =
           CalcTractionAtCentroid(data, i, dissipation, mu_coulomb);
       const SpatialForce<T> traction_Ac_W =
           ComputeSpatialTractionAtAcFromTractionAtAq(
               data, traction_output.p_WQ, traction_output.traction_Aq_W);
-      (*F_Ac_W) += data.surface.area(i) * traction_Ac_W;
+      F_Ac_W += data.surface.area(i) * traction_Ac_W;
     }
   }
+  return F_Ac_W;
 }
 
 template <class T>
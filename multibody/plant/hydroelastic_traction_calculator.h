@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/math/rigid_transform.h"
@@ -107,6 +108,38 @@ class HydroelasticTractionCalculator {
       const Data& data, double dissipation, double mu_coulomb,
       multibody::SpatialForce<T>* F_Ac_W) const;
 
+  /*
+   Computes the spatial force of
+   ComputeSpatialForcesAtCentroidFromHydroelasticModel() for each of a batch
+   of contact surfaces.
+
+   The faces of every surface are split into blocks of kFacesPerBlock faces,
+   and all blocks (of all surfaces) are integrated in parallel, as governed by
+   `parallelism`. The block sums of each surface are then added in order, so
+   the results don't depend on the number of threads and are identical to
+   those of the single-surface function. Only T = double is computed in
+   parallel; other scalars ignore `parallelism`.
+   @param data, dissipation, mu_coulomb The per-surface arguments of
+          ComputeSpatialForcesAtCentroidFromHydroelasticModel(); all three
+          must have the same size.
+   @param[out] F_Ac_W resized to the number of surfaces; on return, holds the
+               spatial force on body A at the centroid of each surface.
+   @param[in,out] block_sums, first_block scratch storage for the block sums
+                  and the index of each surface's first block. Reusing the
+                  same storage across calls avoids reallocating it.
+   @pre F_Ac_W, block_sums and first_block are not null.
+   */
+  void ComputeSpatialForcesAtCentroidsFromHydroelasticModel(
+      const std::vector<Data>& data, const std::vector<double>& dissipation,
+      const std::vector<double>& mu_coulomb, Parallelism parallelism,
+      std::vector<SpatialForce<T>>* F_Ac_W,
+      std::vector<SpatialForce<T>>* block_sums,
+      std::vector<int>* first_block) const;
+
+  // The number of faces integrated serially into each partial sum of the
+  // spatial force over a contact surface.
+  static constexpr int kFacesPerBlock = 256;
+
   /*
    Shifts the spatial force applied at the centroid of the contact surface
    to equivalent spatial forces applied at the center of the body frames of
@@ -138,6 +171,11 @@ class HydroelasticTractionCalculator {
   friend class HydroelasticReportingTests_LinearTraction_Test;
   friend class HydroelasticReportingTests_LinearSlipVelocity_Test;
 
+  // Returns the integral of the spatial tractions (shifted to the centroid of
+  // the contact surface) over the faces [begin, end) of `data.surface`.
+  SpatialForce<T> IntegrateFaces(const Data& data, int begin, int end,
+                                 double dissipation, double mu_coulomb) const;
+
   HydroelasticQuadraturePointData<T> CalcTractionAtPoint(
       const Data& data, int face_index,
       const typename geometry::TriangleSurfaceMesh<T>::template Barycentric<T>&
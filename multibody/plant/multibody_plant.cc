@@ -354,6 +354,8 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other)
       friction_model_.set_stiction_tolerance(
           other.friction_model_.stiction_tolerance());
     }
+    hydroelastic_traction_parallelism_ =
+        other.hydroelastic_traction_parallelism_;
     // joint_limit_parameters_ is set in SetUpJointLimitsParameters() in
     // FinalizePlantOnly().
     body_index_to_frame_id_ = other.body_index_to_frame_id_;
@@ -2503,7 +2505,19 @@ void MultibodyPlant<T>::CalcHydroelasticContactForcesContinuous(
 
   const SceneGraphInspector<T>& inspector = EvalSceneGraphInspector(context);
 
-  F_Ac_W_array.reserve(all_surfaces.size());
+  // Gather everything the calculator needs for each surface, so that all
+  // surfaces can be integrated at once.
+  const int num_surfaces = ssize(all_surfaces);
+  std::vector<typename internal::HydroelasticTractionCalculator<T>::Data>&
+      data_array = *output->data_array;
+  std::vector<double>& dissipation_array = output->dissipation_array;
+  std::vector<double>& dynamic_friction_array = output->dynamic_friction_array;
+  data_array.clear();
+  dissipation_array.clear();
+  dynamic_friction_array.clear();
+  data_array.reserve(num_surfaces);
+  dissipation_array.reserve(num_surfaces);
+  dynamic_friction_array.reserve(num_surfaces);
   for (const ContactSurface<T>& surface : all_surfaces) {
     const GeometryId geometryM_id = surface.id_M();
     const GeometryId geometryN_id = surface.id_N();
@@ -2530,14 +2544,12 @@ void MultibodyPlant<T>::CalcHydroelasticContactForcesContinuous(
     const CoulombFriction<double> combined_friction =
         CalcContactFrictionFromSurfaceProperties(geometryM_friction,
                                                  geometryN_friction);
-    const double dynamic_friction = combined_friction.dynamic_friction();
+    dynamic_friction_array.push_back(combined_friction.dynamic_friction());
 
     // Get the bodies that the two geometries are affixed to. We'll call these
     // A and B.
-    const BodyIndex bodyA_index = FindBodyByGeometryId(geometryM_id);
-    const BodyIndex bodyB_index = FindBodyByGeometryId(geometryN_id);
-    const RigidBody<T>& bodyA = get_body(bodyA_index);
-    const RigidBody<T>& bodyB = get_body(bodyB_index);
+    const RigidBody<T>& bodyA = get_body(FindBodyByGeometryId(geometryM_id));
+    const RigidBody<T>& bodyB = get_body(FindBodyByGeometryId(geometryN_id));
 
     // The poses and spatial velocities of bodies A and B.
     const RigidTransform<T>& X_WA = bodyA.EvalPoseInWorld(context);
@@ -2546,34 +2558,38 @@ void MultibodyPlant<T>::CalcHydroelasticContactForcesContinuous(
     const SpatialVelocity<T>& V_WB = bodyB.EvalSpatialVelocityInWorld(context);
 
     // Pack everything calculator needs.
-    typename internal::HydroelasticTractionCalculator<T>::Data data(
-        X_WA, X_WB, V_WA, V_WB, &surface);
+    data_array.emplace_back(X_WA, X_WB, V_WA, V_WB, &surface);
 
     // Combined Hunt & Crossley dissipation.
     const hydroelastics::internal::HydroelasticEngine<T> hydroelastics_engine;
-    const double dissipation = hydroelastics_engine.CalcCombinedDissipation(
-        geometryM_id, geometryN_id, inspector);
+    dissipation_array.push_back(hydroelastics_engine.CalcCombinedDissipation(
+        geometryM_id, geometryN_id, inspector));
+  }
+
+  // Integrate the hydroelastic traction fields over the contact surfaces. This
+  // also fills in the information for contact reporting.
+  traction_calculator.ComputeSpatialForcesAtCentroidsFromHydroelasticModel(
+      data_array, dissipation_array, dynamic_friction_array,
+      hydroelastic_traction_parallelism_, &F_Ac_W_array,
+      &output->F_Ac_W_block_sums, &output->first_block_index);
 
-    // Integrate the hydroelastic traction field over the contact surface.
-    SpatialForce<T> F_Ac_W;
-    traction_calculator.ComputeSpatialForcesAtCentroidFromHydroelasticModel(
-        data, dissipation, dynamic_friction, &F_Ac_W);
+  for (int i = 0; i < num_surfaces; ++i) {
+    const auto& data = data_array[i];
+    const BodyIndex bodyA_index = FindBodyByGeometryId(data.surface.id_M());
+    const BodyIndex bodyB_index = FindBodyByGeometryId(data.surface.id_N());
 
     // Shift the traction at the centroid to tractions at the body origins.
     SpatialForce<T> F_Ao_W, F_Bo_W;
     traction_calculator.ShiftSpatialForcesAtCentroidToBodyOrigins(
-        data, F_Ac_W, &F_Ao_W, &F_Bo_W);
+        data, F_Ac_W_array[i], &F_Ao_W, &F_Bo_W);
 
     if (bodyA_index != world_index()) {
-      F_BBo_W_array.at(bodyA.mobod_index()) += F_Ao_W;
+      F_BBo_W_array.at(get_body(bodyA_index).mobod_index()) += F_Ao_W;
     }
 
     if (bodyB_index != world_index()) {
-      F_BBo_W_array.at(bodyB.mobod_index()) += F_Bo_W;
+      F_BBo_W_array.at(get_body(bodyB_index).mobod_index()) += F_Bo_W;
     }
-
-    // Add the information for contact reporting.
-    F_Ac_W_array.push_back(F_Ac_W);
   }
 }
 
@@ -2755,13 +2771,21 @@ void MultibodyPlant<T>::AddJointLimitsPenaltyForces(
 template <typename T>
 VectorX<T> MultibodyPlant<T>::AssembleActuationInput(
     const systems::Context<T>& context) const {
+  VectorX<T> actuation_input(num_actuated_dofs());
+  AssembleActuationInput(context, &actuation_input);
+  return actuation_input;
+}
+
+template <typename T>
+void MultibodyPlant<T>::AssembleActuationInput(
+    const systems::Context<T>& context, VectorX<T>* actuation_input) const {
   this->ValidateContext(context);
+  DRAKE_DEMAND(actuation_input != nullptr);
 
   // Assemble the vector from the model instance input ports.
-  // TODO(sherm1) Heap allocation here. Get rid of it.
   // We initialize to zero. Actuation inputs are assumed to have zero values if
   // not connected.
-  VectorX<T> actuation_input = VectorX<T>::Zero(num_actuated_dofs());
+  actuation_input->setZero(num_actuated_dofs());
 
   // Contribution from the per model-instance input ports.
   for (ModelInstanceIndex model_instance_index(0);
@@ -2780,7 +2804,7 @@ VectorX<T> MultibodyPlant<T>::AssembleActuationInput(
             "Actuation input port for model instance {} contains NaN.",
             GetModelInstanceName(model_instance_index)));
       }
-      SetActuationInArray(model_instance_index, u_instance, &actuation_input);
+      SetActuationInArray(model_instance_index, u_instance, actuation_input);
     }
   }
 
@@ -2795,10 +2819,8 @@ VectorX<T> MultibodyPlant<T>::AssembleActuationInput(
           "Detected NaN in the actuation input port for all instances.");
     }
     // Contribution is added to the per model-instance contribution.
-    actuation_input += u;
+    *actuation_input += u;
   }
-
-  return actuation_input;
 }
 
 template <typename T>
@@ -3278,9 +3300,10 @@ systems::EventStatus MultibodyPlant<T>::CalcStepUnrestricted(
   this->ValidateContext(context0);
   systems::DiscreteValues<T>& next_discrete_state =
       next_state->get_mutable_discrete_state();
+  const auto spare = spare_discrete_step_memory_.Acquire();
   DiscreteStepMemory::Data<T>& next_memory =
       next_state->template get_mutable_abstract_state<DiscreteStepMemory>(0)
-          .template Allocate<T>(internal_tree().get_topology());
+          .template Allocate<T>(internal_tree().get_topology(), spare.get());
   discrete_update_manager_->CalcDiscreteValues(context0, &next_discrete_state,
                                                &next_memory);
   next_memory.reaction_forces.resize(num_joints());
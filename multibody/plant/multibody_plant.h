@@ -17,6 +17,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/drake_export.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -29,6 +30,7 @@
 #include "drake/multibody/plant/dummy_physical_model.h"
 #include "drake/multibody/plant/multibody_plant_config.h"
 #include "drake/multibody/plant/physical_model_collection.h"
+#include "drake/multibody/plant/scratch_pool.h"
 #include "drake/multibody/topology/graph.h"
 #include "drake/multibody/tree/force_element.h"
 #include "drake/multibody/tree/frame.h"
@@ -109,6 +111,8 @@ struct ContactByPenaltyMethodParameters {
   std::optional<double> gravity;
 };
 
+// Forward declarations for discrete_step_memory.h.
+struct DiscreteStepMemory;
 // Forward declarations for discrete_update_manager.h.
 template <typename>
 class DiscreteUpdateManager;
@@ -2743,6 +2747,21 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
     return friction_model_.stiction_tolerance();
   }
 
+  /// Sets the parallelism used to integrate the hydroelastic tractions over
+  /// the contact surfaces of a continuous-time plant. The integration is split
+  /// across surfaces, and across the faces of large surfaces; the resulting
+  /// forces do not depend on the number of threads. Only plants with
+  /// T = double compute in parallel. By default, there is no parallelism.
+  void set_hydroelastic_traction_parallelism(Parallelism parallelism) {
+    hydroelastic_traction_parallelism_ = parallelism;
+  }
+
+  /// @returns the parallelism used to integrate the hydroelastic tractions.
+  /// @see set_hydroelastic_traction_parallelism.
+  Parallelism hydroelastic_traction_parallelism() const {
+    return hydroelastic_traction_parallelism_;
+  }
+
   /// @} <!-- Contact modeling -->
 
   /// @anchor mbp_state_accessors_and_mutators
@@ -3634,6 +3653,33 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
     return internal_tree().EvalBodyPoseInWorld(context, body_B);
   }
 
+  /// Computes the poses `X_WB` of all bodies in the world frame W for each of
+  /// a batch of N configurations. This is much faster than setting each
+  /// configuration into a Context and evaluating body poses one configuration
+  /// at a time: the multibody tree is traversed only once, each mobilized
+  /// body processes all N configurations together, and no cache entries are
+  /// invalidated or updated.
+  /// @param[in] context
+  ///   The context supplying the model's parameters. The positions stored in
+  ///   `context` are ignored and it is not modified.
+  /// @param[in] q_batch
+  ///   A `num_positions() x N` matrix whose k-th column holds the generalized
+  ///   positions for the k-th configuration.
+  /// @param[out] X_WB_batch
+  ///   On output, `X_WB_batch` has size N and its k-th entry holds the poses
+  ///   of all bodies for the k-th configuration, indexed by BodyIndex. The
+  ///   storage of a previously sized `X_WB_batch` is reused.
+  /// @throws std::exception if Finalize() was not called on `this` model, if
+  ///   `X_WB_batch` is nullptr, or if `q_batch` does not have num_positions()
+  ///   rows.
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<std::vector<math::RigidTransform<T>>>* X_WB_batch) const {
+    this->ValidateContext(context);
+    internal_tree().CalcAllBodyPosesInWorldBatch(context, q_batch, X_WB_batch);
+  }
+
   /// Evaluates V_WB, body B's spatial velocity in the world frame W.
   /// @param[in] context The context storing the state of the model.
   /// @param[in] body_B  The body B for which the spatial velocity is requested.
@@ -5895,6 +5941,12 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   // MultibodyPlant::get_actuation_input_port()).
   VectorX<T> AssembleActuationInput(const systems::Context<T>& context) const;
 
+  // Overload that writes the actuation input into `actuation_input`, which is
+  // resized to num_actuated_dofs() if needed. This does not allocate when
+  // `actuation_input` already has the right size.
+  void AssembleActuationInput(const systems::Context<T>& context,
+                              VectorX<T>* actuation_input) const;
+
   // Calc method for the "net_actuation" output port.
   template <bool sampled>
   void CalcNetActuationOutput(const systems::Context<T>& context,
@@ -6306,6 +6358,9 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   };
   StribeckModel friction_model_;
 
+  // See set_hydroelastic_traction_parallelism() for details.
+  Parallelism hydroelastic_traction_parallelism_{false};
+
   // This structure aids in the bookkeeping of parameters associated with joint
   // limits and the penalty method parameters used to enforce them.
   struct JointLimitsParameters {
@@ -6396,6 +6451,11 @@ class MultibodyPlant final : public internal::MultibodyTreeSystem<T> {
   // resolution into a default contact manager.
   std::unique_ptr<internal::DiscreteUpdateManager<T>> discrete_update_manager_;
 
+  // Spare DiscreteStepMemory used by CalcStepUnrestricted() to recycle the
+  // storage of a previous step's memory.
+  internal::ScratchPool<internal::DiscreteStepMemory>
+      spare_discrete_step_memory_;
+
   // (Experimental) The collection of all physical models owned by
   // this MultibodyPlant.
   std::unique_ptr<internal::PhysicalModelCollection<T>> physical_models_{
@@ -83,6 +83,12 @@ class MultibodyPlantDiscreteUpdateManagerAttorney {
     return plant.AssembleActuationInput(context);
   }
 
+  static void AssembleActuationInput(const MultibodyPlant<T>& plant,
+                                     const systems::Context<T>& context,
+                                     VectorX<T>* actuation_input) {
+    plant.AssembleActuationInput(context, actuation_input);
+  }
+
   static DesiredStateInput<T> AssembleDesiredStateInput(
       const MultibodyPlant<T>& plant, const systems::Context<T>& context) {
     return plant.AssembleDesiredStateInput(context);
@@ -1111,6 +1111,11 @@ void SapDriver<T>::CalcSapSolverResults(
   // Solve the reduced DOF locked problem.
   SapSolver<T> sap;
   sap.set_parameters(sap_parameters_);
+  // Reuse the symbolic analysis of the Hessian from previous time steps. When
+  // the contact graph doesn't change, the solver only performs numeric
+  // factorizations. Otherwise, the solver replaces it with a new one.
+  const auto symbolic_factorization = symbolic_factorizations_.Acquire();
+  sap.set_symbolic_factorization(*symbolic_factorization);
 
   SapSolverStatus status;
   if (has_locked_dofs) {
@@ -1124,6 +1129,7 @@ void SapDriver<T>::CalcSapSolverResults(
   } else {
     status = sap.SolveWithGuess(sap_problem, v0, sap_results);
   }
+  *symbolic_factorization = sap.symbolic_factorization();
 
   if (status != SapSolverStatus::kSuccess) {
     const std::string msg = fmt::format(
@@ -1234,7 +1240,7 @@ void SapDriver<T>::CalcActuation(const systems::Context<T>& context,
   // PD controlled actuation values are overwritten below with values computed
   // by the SAP solver, which includes these terms implicitly and enforces
   // effort limits.
-  *actuation = manager().AssembleActuationInput(context);
+  manager().AssembleActuationInput(context, actuation);
 
   // Add contribution from PD controllers.
   const ContactProblemCache<T>& contact_problem_cache =
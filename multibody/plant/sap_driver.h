@@ -9,11 +9,13 @@
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/math/rotation_matrix.h"
+#include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/contact_solver_results.h"
 #include "drake/multibody/contact_solvers/sap/sap_contact_problem.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
 #include "drake/multibody/plant/discrete_contact_pair.h"
+#include "drake/multibody/plant/scratch_pool.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
 #include "drake/systems/framework/context.h"
@@ -298,6 +300,11 @@ class SapDriver {
   const double near_rigid_threshold_;
   systems::CacheIndex contact_problem_;
   systems::CacheIndex sap_results_;
+  // Symbolic analyses of the SAP Hessian, reused across time steps while its
+  // sparsity pattern doesn't change. See CalcSapSolverResults().
+  ScratchPool<std::shared_ptr<
+      const contact_solvers::internal::BlockSparseCholeskySymbolicFactorization>>
+      symbolic_factorizations_;
   // Parameters for SAP.
   contact_solvers::internal::SapSolverParameters sap_parameters_;
 };
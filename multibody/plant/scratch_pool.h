@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+/* A thread-safe pool of scratch objects, used by a (const) System to recycle
+heap storage from one computation to the next, e.g., across time steps.
+
+Cache entries are the wrong home for such storage: they are not writable when
+the cache is frozen, and their values are tied to a single Context. Instead,
+the System owns a ScratchPool and a computation checks out an object with
+Acquire(); the object goes back to the pool when the returned Handle is
+destroyed. Concurrent computations (e.g., on distinct Contexts in distinct
+threads) are handed distinct objects.
+
+Objects are default-constructed when the pool runs dry and are never reset.
+Callers must not rely on their contents for correctness: an object may hold
+whatever a previous computation, possibly on another Context, left in it.
+Once the pool holds as many objects as there are concurrent computations,
+Acquire() and the Handle's destructor do not allocate.
+
+@tparam Value a default-constructible type. */
+template <typename Value>
+class ScratchPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScratchPool);
+
+  /* Exclusive access to one object checked out from a ScratchPool. */
+  class Handle {
+   public:
+    DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Handle);
+
+    ~Handle() { pool_->Release(std::move(value_)); }
+
+    Value& operator*() const { return *value_; }
+    Value* operator->() const { return value_.get(); }
+    Value* get() const { return value_.get(); }
+
+   private:
+    friend class ScratchPool;
+
+    Handle(const ScratchPool* pool, std::unique_ptr<Value> value)
+        : pool_(pool), value_(std::move(value)) {}
+
+    const ScratchPool* const pool_;
+    std::unique_ptr<Value> value_;
+  };
+
+  ScratchPool() = default;
+
+  /* Checks out an object from the pool. The pool must outlive the returned
+  Handle. This is const (and thread-safe) so that it may be called from the
+  const computations of the System that owns the pool. */
+  Handle Acquire() const {
+    std::unique_ptr<Value> value;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!available_.empty()) {
+        value = std::move(available_.back());
+        available_.pop_back();
+      }
+    }
+    if (value == nullptr) {
+      value = std::make_unique<Value>();
+    }
+    return Handle(this, std::move(value));
+  }
+
+  /* Returns the number of objects currently available for check out. */
+  int num_available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(available_.size());
+  }
+
+ private:
+  void Release(std::unique_ptr<Value> value) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    available_.push_back(std::move(value));
+  }
+
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<Value>> available_;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -713,6 +713,8 @@ TEST_F(DeformableModelTest, Parallelism) {
       deformable_model_ptr_->GetFemModel(body_id).parallelism().num_threads(),
       1);
 
+  EXPECT_EQ(scene_graph_->GetDeformableGeometryParallelism().num_threads(), 1);
+
   Parallelism parallelism(2);
   EXPECT_EQ(parallelism.num_threads(), 2);
   deformable_model_ptr_->SetParallelism(parallelism);
@@ -720,6 +722,13 @@ TEST_F(DeformableModelTest, Parallelism) {
   EXPECT_EQ(
       deformable_model_ptr_->GetFemModel(body_id).parallelism().num_threads(),
       2);
+
+  /* Upon Finalize(), SceneGraph is told to refit the deformable geometries
+   with the parallelism in effect at that time. */
+  deformable_model_ptr_->SetParallelism(Parallelism(3));
+  EXPECT_EQ(scene_graph_->GetDeformableGeometryParallelism().num_threads(), 1);
+  plant_->Finalize();
+  EXPECT_EQ(scene_graph_->GetDeformableGeometryParallelism().num_threads(), 3);
 }
 
 /* Tests getting a deformable body by name. */
@@ -40,6 +40,43 @@ GTEST_TEST(DiscreteStepMemoryTest, Lifecycle) {
   EXPECT_EQ(dut.template get<double>(), nullptr);
 }
 
+GTEST_TEST(DiscreteStepMemoryTest, Recycle) {
+  MultibodyPlant<double> plant{0.01};
+  const internal::MultibodyTree<double>& tree =
+      MultibodyPlantTester::internal_tree(plant);
+  plant.Finalize();
+  const MultibodyTreeTopology& topology = tree.get_topology();
+
+  // Mimic the pattern used by an unrestricted update: `next` is populated while
+  // `current` (a copy of the prior `next`) is still alive.
+  DiscreteStepMemory spare;
+  DiscreteStepMemory next;
+  const auto* const first = &next.template Allocate<double>(topology, &spare);
+  DiscreteStepMemory current = next;
+  EXPECT_EQ(spare.template get<double>(), nullptr);
+
+  // The spare was empty, so we get fresh storage; the spare now holds the
+  // first data, which is still shared with `current`.
+  const auto* const second = &next.template Allocate<double>(topology, &spare);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(spare.template get<double>(), first);
+  EXPECT_EQ(current.template get<double>(), first);
+
+  // While `current` still refers to the first data, it must not be recycled.
+  const auto* const third = &next.template Allocate<double>(topology, &spare);
+  EXPECT_NE(third, first);
+  EXPECT_NE(third, second);
+  EXPECT_EQ(current.template get<double>(), first);
+
+  // Once nobody else refers to the spare data, it is recycled.
+  current = next;
+  EXPECT_EQ(spare.template get<double>(), second);
+  const auto* const fourth = &next.template Allocate<double>(topology, &spare);
+  EXPECT_EQ(fourth, second);
+  EXPECT_EQ(spare.template get<double>(), third);
+  EXPECT_EQ(current.template get<double>(), third);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace multibody
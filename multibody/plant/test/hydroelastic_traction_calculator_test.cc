@@ -1,10 +1,13 @@
 #include "drake/multibody/plant/hydroelastic_traction_calculator.h"
 
+#include <cmath>
 #include <ostream>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/parallelism.h"
+#include "drake/common/ssize.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/proximity/polygon_surface_mesh.h"
 #include "drake/geometry/proximity/triangle_surface_mesh.h"
@@ -826,6 +829,101 @@ GTEST_TEST(HydroelasticTractionCalculatorTest,
   EXPECT_TRUE(CompareMatrices(grad_traction_Aq_W, expected_grad_traction_Aq_W));
 }
 
+// Creates a contact surface over a bumpy n-by-n grid of quads (each split into
+// two triangles) below the xy plane, with a pressure field that grows with
+// depth.
+std::unique_ptr<ContactSurface<double>> CreateGridContactSurface(
+    int n, GeometryId id_A, GeometryId id_B) {
+  std::vector<Vector3<double>> vertices;
+  std::vector<double> e_MN;
+  for (int j = 0; j <= n; ++j) {
+    for (int i = 0; i <= n; ++i) {
+      const double x = static_cast<double>(i) / n - 0.5;
+      const double y = static_cast<double>(j) / n - 0.5;
+      const double z = -0.5 + 0.05 * std::sin(7 * x) * std::cos(5 * y);
+      vertices.emplace_back(x, y, z);
+      e_MN.push_back(-z);
+    }
+  }
+  std::vector<SurfaceTriangle> faces;
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      const int v0 = j * (n + 1) + i;
+      const int v1 = v0 + 1;
+      const int v2 = v0 + n + 1;
+      const int v3 = v2 + 1;
+      // Wind the triangles so that the normals point downwards.
+      faces.emplace_back(v0, v2, v1);
+      faces.emplace_back(v1, v2, v3);
+    }
+  }
+  auto mesh = std::make_unique<TriangleSurfaceMesh<double>>(
+      std::move(faces), std::move(vertices));
+  TriangleSurfaceMesh<double>* mesh_pointer = mesh.get();
+  return std::make_unique<ContactSurface<double>>(
+      id_A, id_B, std::move(mesh),
+      std::make_unique<MeshFieldLinear<double, TriangleSurfaceMesh<double>>>(
+          std::move(e_MN), mesh_pointer));
+}
+
+// The batched, parallel computation of the spatial forces matches the serial
+// single-surface computation exactly, for any number of threads, including for
+// surfaces that span several blocks of faces.
+GTEST_TEST(HydroelasticTractionCalculatorTest, BatchMatchesSingleSurface) {
+  using Calculator = HydroelasticTractionCalculator<double>;
+  auto id_A = GeometryId::get_new_id();
+  auto id_B = GeometryId::get_new_id();
+  if (id_B < id_A) std::swap(id_A, id_B);
+
+  // The surfaces have 2, 288, and 800 faces, respectively.
+  std::vector<std::unique_ptr<ContactSurface<double>>> surfaces;
+  for (int n : {1, 12, 20}) {
+    surfaces.push_back(CreateGridContactSurface(n, id_A, id_B));
+  }
+  ASSERT_GT(surfaces[1]->num_faces(), Calculator::kFacesPerBlock);
+  ASSERT_GT(surfaces[2]->num_faces(), 3 * Calculator::kFacesPerBlock);
+
+  const RigidTransformd X_WA(Vector3d(0.1, -0.2, 0.3));
+  const RigidTransformd X_WB(Vector3d(-0.1, 0.2, -0.3));
+  const SpatialVelocity<double> V_WA(Vector3d(0.1, 0.2, -0.3),
+                                     Vector3d(0.5, -0.1, -1.0));
+  const SpatialVelocity<double> V_WB(Vector3d(-0.2, 0.1, 0.4),
+                                     Vector3d(-0.3, 0.2, 0.1));
+  std::vector<Calculator::Data> data;
+  std::vector<double> dissipation;
+  std::vector<double> mu_coulomb;
+  for (int i = 0; i < ssize(surfaces); ++i) {
+    data.emplace_back(X_WA, X_WB, V_WA, V_WB, surfaces[i].get());
+    dissipation.push_back(0.1 * (i + 1));
+    mu_coulomb.push_back(0.5 + 0.25 * i);
+  }
+
+  const Calculator calculator(1e-3);
+  std::vector<SpatialForce<double>> expected;
+  for (int i = 0; i < ssize(data); ++i) {
+    SpatialForce<double> F_Ac_W;
+    calculator.ComputeSpatialForcesAtCentroidFromHydroelasticModel(
+        data[i], dissipation[i], mu_coulomb[i], &F_Ac_W);
+    expected.push_back(F_Ac_W);
+  }
+
+  std::vector<SpatialForce<double>> block_sums;
+  std::vector<int> first_block;
+  for (const Parallelism parallelism :
+       {Parallelism(false), Parallelism(2), Parallelism(4)}) {
+    std::vector<SpatialForce<double>> F_Ac_W;
+    calculator.ComputeSpatialForcesAtCentroidsFromHydroelasticModel(
+        data, dissipation, mu_coulomb, parallelism, &F_Ac_W, &block_sums,
+        &first_block);
+    ASSERT_EQ(F_Ac_W.size(), expected.size());
+    for (int i = 0; i < ssize(expected); ++i) {
+      EXPECT_EQ(F_Ac_W[i].get_coeffs(), expected[i].get_coeffs())
+          << "surface = " << i
+          << ", num_threads = " << parallelism.num_threads();
+    }
+  }
+}
+
 // This fixture defines a contacting configuration between a box and a
 // half-space in a local frame, Y. See MultibodyPlantHydroelasticTractionTests
 // class documentation for a description of Frame Y.
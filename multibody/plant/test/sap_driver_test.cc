@@ -1,5 +1,7 @@
 #include "drake/multibody/plant/sap_driver.h"
 
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -24,6 +26,8 @@
 using drake::math::RigidTransformd;
 using drake::multibody::RevoluteJoint;
 using drake::multibody::RigidBody;
+using drake::multibody::contact_solvers::internal::
+    BlockSparseCholeskySymbolicFactorization;
 using drake::multibody::contact_solvers::internal::ContactSolverResults;
 using drake::multibody::contact_solvers::internal::MergeNormalAndTangent;
 using drake::multibody::contact_solvers::internal::SapContactProblem;
@@ -96,6 +100,11 @@ class SapDriverTest {
     driver.PackContactSolverResults(context, problem, num_contacts, sap_results,
                                     contact_results);
   }
+
+  static std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>
+  PeekSymbolicFactorization(const SapDriver<double>& driver) {
+    return *driver.symbolic_factorizations_.Acquire();
+  }
 };
 
 // Test fixture to test the functionality provided by SapDriver, with the
@@ -137,6 +146,11 @@ class SpheresStackTest : public SpheresStack, public ::testing::Test {
                                             contact_results);
   }
 
+  std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>
+  PeekSymbolicFactorization() const {
+    return SapDriverTest::PeekSymbolicFactorization(sap_driver());
+  }
+
   // The functions below provide access to private CompliantContactManager
   // functions for unit testing.
 
@@ -374,6 +388,28 @@ TEST_F(SpheresStackTest, EvalContactSolverResults) {
             contact_results_without_cache.v_next);
 }
 
+// The symbolic analysis of the SAP Hessian persists in the driver across
+// computations of the solver results as long as the contact graph doesn't
+// change.
+TEST_F(SpheresStackTest, ReuseSymbolicFactorization) {
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  EXPECT_EQ(PeekSymbolicFactorization(), nullptr);
+  const ContactSolverResults<double> contact_results =
+      contact_manager_->EvalContactSolverResults(*plant_context_);
+  const std::shared_ptr<const BlockSparseCholeskySymbolicFactorization>
+      symbolic_factorization = PeekSymbolicFactorization();
+  ASSERT_NE(symbolic_factorization, nullptr);
+
+  // Changing velocities changes the solution but not the contact graph.
+  const VectorXd v0 = plant_->GetVelocities(*plant_context_);
+  plant_->SetVelocities(plant_context_,
+                        v0 + VectorXd::Constant(v0.size(), 1.0e-3));
+  const ContactSolverResults<double> new_contact_results =
+      contact_manager_->EvalContactSolverResults(*plant_context_);
+  EXPECT_NE(new_contact_results.v_next, contact_results.v_next);
+  EXPECT_EQ(PeekSymbolicFactorization(), symbolic_factorization);
+}
+
 // Unit test that the manager is forwarded the active status of each constraint
 // and produces a SapContactProblem with only the active constraints and
 // recalculates the cached SapContactProblem with constraint parameters change.
@@ -0,0 +1,75 @@
+#include "drake/multibody/plant/scratch_pool.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/limit_malloc.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+GTEST_TEST(ScratchPoolTest, Recycle) {
+  const ScratchPool<std::vector<double>> dut;
+  EXPECT_EQ(dut.num_available(), 0);
+
+  // The pool starts out dry, so the first object is default constructed.
+  const double* storage{};
+  {
+    const auto scratch = dut.Acquire();
+    EXPECT_EQ(dut.num_available(), 0);
+    EXPECT_TRUE(scratch->empty());
+    scratch->resize(10, 1.0);
+    storage = scratch->data();
+  }
+  EXPECT_EQ(dut.num_available(), 1);
+
+  // The object is handed back out, contents and all, without allocating.
+  {
+    test::LimitMalloc guard;
+    const auto scratch = dut.Acquire();
+    EXPECT_EQ(dut.num_available(), 0);
+    EXPECT_EQ(scratch->size(), 10);
+    EXPECT_EQ(scratch->data(), storage);
+  }
+  EXPECT_EQ(dut.num_available(), 1);
+}
+
+GTEST_TEST(ScratchPoolTest, Concurrent) {
+  const ScratchPool<int> dut;
+
+  // Overlapping check outs get distinct objects.
+  {
+    const auto first = dut.Acquire();
+    const auto second = dut.Acquire();
+    EXPECT_NE(first.get(), second.get());
+  }
+  EXPECT_EQ(dut.num_available(), 2);
+
+  // Each thread has exclusive access to the object it checks out.
+  const int kNumThreads = 4;
+  const int kNumIterations = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&dut]() {
+      for (int j = 0; j < kNumIterations; ++j) {
+        const auto scratch = dut.Acquire();
+        *scratch = j;
+        EXPECT_EQ(*scratch, j);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_GE(dut.num_available(), 2);
+  EXPECT_LE(dut.num_available(), kNumThreads);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
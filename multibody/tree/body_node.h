@@ -242,6 +242,29 @@ class BodyNode : public MultibodyElement<T> {
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       PositionKinematicsCache<T>* pc) const = 0;
 
+  // Batched counterpart to CalcPositionKinematicsCache_BaseToTip() used by
+  // MultibodyTree::CalcAllBodyPosesInWorldBatch(). Only the pose X_WB is
+  // computed, for each of the N configurations given as the columns of
+  // `q_batch`. Poses are stored in `X_WB_batch` in a structure-of-arrays
+  // layout: the N poses for a given mobilized body are contiguous, starting
+  // at entry `mobod_index * N`. Don't call this on the World body.
+  //
+  // @param[in] frame_body_pose_cache parameterized frame offsets
+  // @param[in] q_batch
+  //   The position coordinates of the full MultibodyTree model, one
+  //   configuration per column.
+  // @param[in,out] X_WB_batch
+  //   On input, contains the poses of this node's parent body for each
+  //   configuration. On output, also contains the poses of this node's body.
+  // @pre X_WB_batch has size num_mobods() * N.
+  // @pre CalcPoseInWorldBatch_BaseToTip() must have already been called for
+  // the parent node (and, by recursive precondition, all predecessor nodes in
+  // the tree.)
+  virtual void CalcPoseInWorldBatch_BaseToTip(
+      const FrameBodyPoseCache<T>& frame_body_pose_cache,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<math::RigidTransform<T>>* X_WB_batch) const = 0;
+
   // Calculates the hinge matrix H_PB_W, the `6 x nm` hinge matrix that relates
   // V_PB_W`(body B's spatial velocity in its parent body P, expressed in world
   // W) to this node's nm generalized velocities (or mobilities) v_B as
@@ -119,6 +119,68 @@ void BodyNodeImpl<T, ConcreteMobilizer>::CalcPositionKinematicsCache_BaseToTip(
   p_PoBo_W = R_WP * p_PoBo_P;
 }
 
+template <typename T, class ConcreteMobilizer>
+void BodyNodeImpl<T, ConcreteMobilizer>::CalcPoseInWorldBatch_BaseToTip(
+    const FrameBodyPoseCache<T>& frame_body_pose_cache,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    std::vector<math::RigidTransform<T>>* X_WB_batch) const {
+  // This method must not be called for the "world" body node.
+  DRAKE_ASSERT(mobod_index() != world_mobod_index());
+  DRAKE_ASSERT(X_WB_batch != nullptr);
+
+  const int num_configurations = q_batch.cols();
+  DRAKE_ASSERT(ssize(*X_WB_batch) ==
+               this->get_parent_tree().num_mobods() * num_configurations);
+
+  // Input (const), shared by all configurations:
+  // - X_PF
+  // - X_MB
+  const math::RigidTransform<T>& X_PF =
+      inboard_frame().get_X_BF(frame_body_pose_cache);  // B==P
+  const bool X_PF_is_identity =
+      inboard_frame().is_X_BF_identity(frame_body_pose_cache);
+  const math::RigidTransform<T>& X_MB =
+      outboard_frame().get_X_FB(frame_body_pose_cache);  // F==M
+  const bool X_MB_is_identity =
+      outboard_frame().is_X_BF_identity(frame_body_pose_cache);
+
+  // The parent's poses X_WP (input) and this body's poses X_WB (output) are
+  // each contiguous over all configurations.
+  const math::RigidTransform<T>* X_WP =
+      X_WB_batch->data() + inboard_mobod_index() * num_configurations;
+  math::RigidTransform<T>* X_WB =
+      X_WB_batch->data() + mobod_index() * num_configurations;
+
+  // Computes X_PB = X_PF * X_FM * X_MB, taking the same shortcuts as
+  // CalcPositionKinematicsCache_BaseToTip() when the frame offsets are
+  // identities.
+  auto calc_X_PB = [&](const math::RigidTransform<T>& X_FM) {
+    if (X_MB_is_identity) {
+      return X_PF_is_identity ? X_FM
+                              : mobilizer_->post_multiply_by_X_FM(X_PF, X_FM);
+    }
+    const math::RigidTransform<T> X_FB =
+        mobilizer_->pre_multiply_by_X_FM(X_FM, X_MB);
+    return X_PF_is_identity ? X_FB : X_PF * X_FB;
+  };
+
+  if constexpr (kNq == 0) {
+    // X_PB does not depend on q; compute it once for the whole batch.
+    math::RigidTransform<T> X_FM;
+    mobilizer_->update_X_FM(nullptr, &X_FM);
+    const math::RigidTransform<T> X_PB = calc_X_PB(X_FM);
+    for (int k = 0; k < num_configurations; ++k) {
+      X_WB[k] = X_WP[k] * X_PB;
+    }
+  } else {
+    math::RigidTransform<T> X_FM;
+    for (int k = 0; k < num_configurations; ++k) {
+      mobilizer_->update_X_FM(get_q(q_batch.col(k).data()), &X_FM);
+      X_WB[k] = X_WP[k] * calc_X_PB(X_FM);
+    }
+  }
+}
+
 // TODO(sherm1) Consider combining this with VelocityCache computation
 //  so that we don't have to make a separate pass. Or better, get rid of this
 //  computation altogether by working in better frames.
@@ -74,6 +74,11 @@ class BodyNodeImpl final : public BodyNode<T> {
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       PositionKinematicsCache<T>* pc) const final;
 
+  void CalcPoseInWorldBatch_BaseToTip(
+      const FrameBodyPoseCache<T>& frame_body_pose_cache,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<math::RigidTransform<T>>* X_WB_batch) const final;
+
   void CalcAcrossNodeJacobianWrtVExpressedInWorld(
       const FrameBodyPoseCache<T>& frame_body_pose_cache, const T* positions,
       const PositionKinematicsCache<T>& pc,
@@ -31,6 +31,12 @@ class BodyNodeWorld final : public BodyNode<T> {
     DRAKE_UNREACHABLE();
   }
 
+  void CalcPoseInWorldBatch_BaseToTip(
+      const FrameBodyPoseCache<T>&, const Eigen::Ref<const MatrixX<T>>&,
+      std::vector<math::RigidTransform<T>>*) const final {
+    DRAKE_UNREACHABLE();
+  }
+
   void CalcAcrossNodeJacobianWrtVExpressedInWorld(
       const FrameBodyPoseCache<T>&, const T*, const PositionKinematicsCache<T>&,
       std::vector<Vector6<T>>*) const final {
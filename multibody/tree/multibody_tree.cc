@@ -1294,6 +1294,48 @@ void MultibodyTree<T>::CalcAllBodyPosesInWorld(
   }
 }
 
+// Note that the result is indexed by BodyIndex, not MobodIndex.
+template <typename T>
+void MultibodyTree<T>::CalcAllBodyPosesInWorldBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    std::vector<std::vector<RigidTransform<T>>>* X_WB_batch) const {
+  DRAKE_THROW_UNLESS(X_WB_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int num_configurations = q_batch.cols();
+
+  // Only the parameters are taken from the context; its state is ignored.
+  const FrameBodyPoseCache<T>& frame_body_pose_cache =
+      EvalFrameBodyPoses(context);
+
+  // Poses are computed in a structure-of-arrays layout where the poses of a
+  // given mobilized body for all configurations are contiguous. The world
+  // entries remain identity. Each node is then visited exactly once, so the
+  // virtual dispatch and the parameter lookups are amortized over the batch.
+  std::vector<RigidTransform<T>> X_WB_by_mobod(num_mobods() *
+                                               num_configurations);
+  for (int level = 1; level < forest_height(); ++level) {
+    for (MobodIndex mobod_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[mobod_index];
+      DRAKE_ASSERT(node.get_topology().level == level);
+      node.CalcPoseInWorldBatch_BaseToTip(frame_body_pose_cache, q_batch,
+                                          &X_WB_by_mobod);
+    }
+  }
+
+  X_WB_batch->resize(num_configurations);
+  for (int k = 0; k < num_configurations; ++k) {
+    std::vector<RigidTransform<T>>& X_WB = (*X_WB_batch)[k];
+    if (ssize(X_WB) != num_bodies()) {
+      X_WB.resize(num_bodies(), RigidTransform<T>::Identity());
+    }
+    for (BodyIndex body_index(0); body_index < num_bodies(); ++body_index) {
+      const MobodIndex mobod_index = get_body(body_index).mobod_index();
+      X_WB[body_index] = X_WB_by_mobod[mobod_index * num_configurations + k];
+    }
+  }
+}
+
 // Note that the result is indexed by BodyIndex, not MobodIndex.
 template <typename T>
 void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
@@ -1150,6 +1150,12 @@ class MultibodyTree {
       const systems::Context<T>& context,
       std::vector<math::RigidTransform<T>>* X_WB) const;
 
+  // See MultibodyPlant method.
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<std::vector<math::RigidTransform<T>>>* X_WB_batch) const;
+
   // See MultibodyPlant method.
   void CalcAllBodySpatialVelocitiesInWorld(
       const systems::Context<T>& context,
@@ -1001,6 +1001,52 @@ TEST_F(KukaIiwaModelTests, EvalPoseAndSpatialVelocity) {
                               MatrixCompareType::relative));
 }
 
+// Verifies that the batched pose computation matches, configuration by
+// configuration, the poses computed through the context.
+TEST_F(KukaIiwaModelTests, CalcAllBodyPosesInWorldBatch) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  const int kNumConfigurations = 5;
+
+  VectorX<double> q0, v0;
+  GetArbitraryNonZeroJointAnglesAndRates(&q0, &v0);
+  MatrixX<double> q_batch(tree().num_positions(), kNumConfigurations);
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    q_batch.col(k) = (k + 1) * 0.3 * q0;
+  }
+
+  std::vector<std::vector<RigidTransform<double>>> X_WB_batch;
+  tree().CalcAllBodyPosesInWorldBatch(*context_, q_batch, &X_WB_batch);
+  ASSERT_EQ(ssize(X_WB_batch), kNumConfigurations);
+
+  std::vector<RigidTransform<double>> X_WB_expected;
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    tree().GetMutablePositions(context_.get()) = q_batch.col(k);
+    tree().CalcAllBodyPosesInWorld(*context_, &X_WB_expected);
+    ASSERT_EQ(ssize(X_WB_batch[k]), tree().num_bodies());
+    for (BodyIndex i(0); i < tree().num_bodies(); ++i) {
+      EXPECT_TRUE(X_WB_batch[k][i].IsNearlyEqualTo(X_WB_expected[i],
+                                                   kTolerance));
+    }
+  }
+
+  // The output storage is reused and resized for a different batch size.
+  tree().CalcAllBodyPosesInWorldBatch(*context_, q_batch.leftCols(2),
+                                      &X_WB_batch);
+  EXPECT_EQ(ssize(X_WB_batch), 2);
+
+  // An empty batch is allowed.
+  tree().CalcAllBodyPosesInWorldBatch(
+      *context_, MatrixX<double>(tree().num_positions(), 0), &X_WB_batch);
+  EXPECT_TRUE(X_WB_batch.empty());
+
+  // Wrong number of rows.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      tree().CalcAllBodyPosesInWorldBatch(
+          *context_, MatrixX<double>(tree().num_positions() + 1, 2),
+          &X_WB_batch),
+      ".*q_batch.rows.*");
+}
+
 TEST_F(KukaIiwaModelTests, CalcJacobianSpatialVelocityA) {
   // The number of generalized positions in the Kuka iiwa robot arm model.
   const int kNumPositions = tree().num_positions();
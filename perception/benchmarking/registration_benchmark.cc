@@ -0,0 +1,135 @@
+// @file
+// Benchmarks for point cloud registration against a RegistrationTarget.
+//
+// The target is a dense sampling of an ellipsoid (which, unlike a sphere,
+// constrains the rotation) and the source is a sparser sampling of the same
+// surface, slightly displaced from it. The benchmarks report the time to
+// prepare the target and to register one source cloud with each flavor of ICP,
+// as a function of the number of target points and the number of threads.
+
+#include <cstdlib>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/parallelism.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/perception/point_cloud_registration.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr int kNumClosest = 20;
+
+// Returns `size` random points on a unit sphere squashed along y and z.
+PointCloud MakeEllipsoid(int size) {
+  PointCloud cloud(size, pc_flags::kXYZs);
+  auto xyzs = cloud.mutable_xyzs();
+  xyzs.setRandom();
+  for (int i = 0; i < size; ++i) {
+    xyzs.col(i).normalize();
+  }
+  xyzs.row(1) *= 0.7;
+  xyzs.row(2) *= 0.4;
+  return cloud;
+}
+
+class RegistrationBenchmark : public benchmark::Fixture {
+ public:
+  RegistrationBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  // The benchmark arguments are the number of target points and the number of
+  // threads.
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    const int size = state.range(0);
+    parallelism_ = Parallelism(static_cast<int>(state.range(1)));
+    std::srand(5432);
+    target_cloud_ = MakeEllipsoid(size);
+    source_ = MakeEllipsoid(size / 4);
+    const RigidTransformd X_TS(RollPitchYawd(0.02, -0.03, 0.05),
+                               Eigen::Vector3d(0.01, -0.02, 0.015));
+    source_.mutable_xyzs() = X_TS.inverse().GetAsMatrix34().cast<float>() *
+                             source_.xyzs().colwise().homogeneous();
+  }
+
+  // NOLINTNEXTLINE(runtime/references)
+  void TearDown(benchmark::State&) override { target_.reset(); }
+
+ protected:
+  void PrepareTarget() {
+    target_ = std::make_unique<RegistrationTarget>(target_cloud_, kNumClosest,
+                                                   parallelism_);
+  }
+
+  Parallelism parallelism_;
+  PointCloud target_cloud_;
+  PointCloud source_;
+  std::unique_ptr<RegistrationTarget> target_;
+  const IcpParams params_{.max_iterations = 30};
+};
+
+BENCHMARK_DEFINE_F(RegistrationBenchmark, PrepareTarget)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    PrepareTarget();
+  }
+}
+
+BENCHMARK_DEFINE_F(RegistrationBenchmark, PointToPlaneIcp)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  PrepareTarget();
+  int num_iterations = 0;
+  for (auto _ : state) {
+    const IcpResult result = PointToPlaneIcp(
+        source_, *target_, RigidTransformd(), params_, parallelism_);
+    num_iterations = result.num_iterations;
+  }
+  state.counters["icp_iterations"] = num_iterations;
+}
+
+BENCHMARK_DEFINE_F(RegistrationBenchmark, GeneralizedIcp)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  PrepareTarget();
+  int num_iterations = 0;
+  for (auto _ : state) {
+    const IcpResult result = GeneralizedIcp(source_, *target_,
+                                            RigidTransformd(), params_,
+                                            parallelism_);
+    num_iterations = result.num_iterations;
+  }
+  state.counters["icp_iterations"] = num_iterations;
+}
+
+BENCHMARK_REGISTER_F(RegistrationBenchmark, PrepareTarget)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"points", "threads"})
+    ->ArgsProduct({{1'000, 10'000, 100'000}, {1, 2, 4}});
+
+BENCHMARK_REGISTER_F(RegistrationBenchmark, PointToPlaneIcp)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"points", "threads"})
+    ->ArgsProduct({{1'000, 10'000, 100'000}, {1, 2, 4}});
+
+BENCHMARK_REGISTER_F(RegistrationBenchmark, GeneralizedIcp)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"points", "threads"})
+    ->ArgsProduct({{1'000, 10'000, 100'000}, {1, 2, 4}});
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+#include "drake/perception/depth_image_fusion.h"
+
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+using math::RigidTransformd;
+using systems::Context;
+using systems::EventStatus;
+using systems::State;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+DepthImageFusion::DepthImageFusion(std::vector<CameraInfo> camera_infos,
+                                   const VoxelMapParams& params,
+                                   double update_period)
+    : camera_infos_(std::move(camera_infos)), update_period_(update_period) {
+  DRAKE_THROW_UNLESS(!camera_infos_.empty());
+  DRAKE_THROW_UNLESS(update_period > 0);
+
+  // The input ports alternate between the depth image and the pose of each
+  // camera; see depth_image_input_port() and camera_pose_input_port().
+  for (int i = 0; i < num_cameras(); ++i) {
+    this->DeclareAbstractInputPort(fmt::format("depth_image_{}", i),
+                                   Value<ImageDepth32F>{});
+    this->DeclareAbstractInputPort(fmt::format("camera_pose_{}", i),
+                                   Value<RigidTransformd>{});
+  }
+
+  map_index_ = this->DeclareAbstractState(Value<VoxelMap>(VoxelMap(params)));
+  this->DeclarePeriodicUnrestrictedUpdateEvent(update_period, 0.0,
+                                               &DepthImageFusion::Integrate);
+  this->DeclareForcedUnrestrictedUpdateEvent(&DepthImageFusion::Integrate);
+
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{},
+                                  &DepthImageFusion::CalcPointCloud,
+                                  {this->abstract_state_ticket(map_index_)});
+  this->DeclareStateOutputPort("voxel_map", map_index_);
+}
+
+const systems::InputPort<double>& DepthImageFusion::depth_image_input_port(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return this->get_input_port(2 * i);
+}
+
+const systems::InputPort<double>& DepthImageFusion::camera_pose_input_port(
+    int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_cameras());
+  return this->get_input_port(2 * i + 1);
+}
+
+EventStatus DepthImageFusion::Integrate(const Context<double>& context,
+                                        State<double>* state) const {
+  VoxelMap& map = state->get_mutable_abstract_state<VoxelMap>(map_index_);
+  map.Decay(update_period_);
+  for (int i = 0; i < num_cameras(); ++i) {
+    const auto& depth_port = depth_image_input_port(i);
+    if (!depth_port.HasValue(context)) {
+      continue;
+    }
+    const auto& pose_port = camera_pose_input_port(i);
+    const RigidTransformd X_PC =
+        pose_port.HasValue(context)
+            ? pose_port.Eval<RigidTransformd>(context)
+            : RigidTransformd::Identity();
+    map.Integrate(camera_infos_[i], X_PC,
+                  depth_port.Eval<ImageDepth32F>(context));
+  }
+  return EventStatus::Succeeded();
+}
+
+void DepthImageFusion::CalcPointCloud(const Context<double>& context,
+                                      PointCloud* cloud) const {
+  *cloud = context.get_abstract_state<VoxelMap>(map_index_).ToPointCloud();
+}
+
+}  // namespace perception
+}  // namespace drake
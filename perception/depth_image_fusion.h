@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/perception/voxel_map.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+
+namespace drake {
+namespace perception {
+
+/// Incrementally fuses the depth images of several cameras into a persistent
+/// VoxelMap, and outputs the map along with a downsampled point cloud of the
+/// observed surfaces.
+///
+/// @system
+/// name: DepthImageFusion
+/// input_ports:
+/// - depth_image_0
+/// - camera_pose_0 (optional)
+/// - ...
+/// - depth_image_N-1
+/// - camera_pose_N-1 (optional)
+/// output_ports:
+/// - point_cloud
+/// - voxel_map
+/// @endsystem
+///
+/// Each of the N cameras has an input port for its ImageDepth32F and an input
+/// port for its pose X_PC (a RigidTransformd) in some common parent frame P.
+/// If a camera_pose port is not connected, that camera's frame is taken to be
+/// the frame P. A camera whose depth_image port is not connected is ignored.
+/// The voxel map and the point cloud are expressed in frame P.
+///
+/// Every `update_period` seconds, a periodic unrestricted update first decays
+/// the map by the update period (see VoxelMap::Decay()) and then integrates
+/// the current depth image of every camera (see VoxelMap::Integrate()). The
+/// map lives in the system's abstract state, so it persists from one update to
+/// the next and each update only touches the voxels near the newly observed
+/// surfaces. (Copies of a VoxelMap share their unmodified voxels, so the
+/// copies of the state made by the update don't copy the whole map.) This is
+/// far cheaper than converting every image to a point cloud, merging the
+/// clouds, and downsampling the merged cloud at each step. When the map
+/// decays, though, every update also touches every voxel.
+///
+/// The `point_cloud` output is VoxelMap::ToPointCloud(), and the `voxel_map`
+/// output is the map itself. Both only change when the state is updated.
+///
+/// @ingroup perception_systems
+class DepthImageFusion final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DepthImageFusion);
+
+  /// Constructs the fusion system.
+  /// @param camera_infos The intrinsics of each of the cameras.
+  /// @param params The parameters of the voxel map.
+  /// @param update_period The period (in seconds) of the integration.
+  /// @throws std::exception if `camera_infos` is empty, `update_period` is
+  /// not positive, or the `params` are invalid (see VoxelMap).
+  DepthImageFusion(std::vector<systems::sensors::CameraInfo> camera_infos,
+                   const VoxelMapParams& params, double update_period);
+
+  /// Returns the number of cameras.
+  int num_cameras() const { return static_cast<int>(camera_infos_.size()); }
+
+  /// Returns the abstract valued input port that expects the ImageDepth32F of
+  /// the i'th camera.
+  const systems::InputPort<double>& depth_image_input_port(int i) const;
+
+  /// Returns the abstract valued input port that expects X_PC of the i'th
+  /// camera as a RigidTransformd. (This input port does not necessarily need to
+  /// be connected; refer to the class overview for details.)
+  const systems::InputPort<double>& camera_pose_input_port(int i) const;
+
+  /// Returns the abstract valued output port that provides a PointCloud (with
+  /// xyzs only).
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return this->get_output_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides the VoxelMap.
+  const systems::OutputPort<double>& voxel_map_output_port() const {
+    return this->get_output_port(1);
+  }
+
+  /// Returns the update period.
+  double update_period() const { return update_period_; }
+
+ private:
+  systems::EventStatus Integrate(const systems::Context<double>& context,
+                                 systems::State<double>* state) const;
+
+  void CalcPointCloud(const systems::Context<double>& context,
+                      PointCloud* cloud) const;
+
+  const std::vector<systems::sensors::CameraInfo> camera_infos_;
+  const double update_period_;
+  systems::AbstractStateIndex map_index_;
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -2,9 +2,13 @@
 
 #include <limits>
 #include <optional>
+#include <vector>
 
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/ssize.h"
+#include "drake/perception/fast_depth_image_functions.h"
 
 using drake::AbstractValue;
 using drake::Value;
@@ -17,7 +21,6 @@ using drake::systems::sensors::ImageRgba8U;
 using drake::systems::sensors::ImageTraits;
 using drake::systems::sensors::PixelType;
 using Eigen::Matrix3Xf;
-using Eigen::Vector3d;
 
 namespace drake {
 namespace perception {
@@ -42,20 +45,52 @@ const AbstractValue& GetModelValue(PixelType pixel_type) {
   throw std::logic_error("Unsupported pixel_type in DepthImageToPointCloud");
 }
 
+// Sets `ray_x` and `ray_y` to the normalized image coordinates of the pixel
+// centers of a `width` by `height` image from the given camera, i.e., to
+// (u - cx) / fx for each column u and (v - cy) / fy for each row v.
+void CalcRays(const CameraInfo& camera_info, int width, int height,
+              std::vector<double>* ray_x, std::vector<double>* ray_y) {
+  const double cx = camera_info.center_x();
+  const double cy = camera_info.center_y();
+  const double fx_inv = 1.0 / camera_info.focal_x();
+  const double fy_inv = 1.0 / camera_info.focal_y();
+  ray_x->resize(width);
+  for (int u = 0; u < width; ++u) {
+    (*ray_x)[u] = (u - cx) * fx_inv;
+  }
+  ray_y->resize(height);
+  for (int v = 0; v < height; ++v) {
+    (*ray_y)[v] = (v - cy) * fy_inv;
+  }
+}
+
 // TODO(russt): Consider dropping NaN/kTooClose/kTooFar points from the point
 // cloud output? (This would require adding support for colored point clouds,
 // because current implementation assume that an RGB image will still line up).
+//
+// The `cached_ray_x` and `cached_ray_y` are the precomputed rays of the camera
+// (see CalcRays); they are recomputed here when null or not of the image size.
 template <PixelType pixel_type>
 void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const CameraInfo& camera_info,
+               const std::vector<double>* cached_ray_x,
+               const std::vector<double>* cached_ray_y,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
                PointCloud* output) {
+  DRAKE_THROW_UNLESS(output != nullptr);
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
 
+  const int height = depth_image.height();
+  const int width = depth_image.width();
+  if (color_image) {
+    DRAKE_THROW_UNLESS(color_image->width() == width &&
+                       color_image->height() == height);
+  }
+
   // Reset the output size, if necessary.  We can leave the memory
   // uninitialized iff we are going to fill it in below.
   if (output->size() != depth_image.size()) {
@@ -63,38 +98,49 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
     output->resize(depth_image.size(), skip_initialize);
   }
   Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
+  DRAKE_DEMAND(output_xyz.outerStride() == 3);
+
+  std::vector<double> ray_x_storage;
+  std::vector<double> ray_y_storage;
+  const std::vector<double>* ray_x = cached_ray_x;
+  const std::vector<double>* ray_y = cached_ray_y;
+  if (ray_x == nullptr || ray_y == nullptr || ssize(*ray_x) != width ||
+      ssize(*ray_y) != height) {
+    CalcRays(camera_info, width, height, &ray_x_storage, &ray_y_storage);
+    ray_x = &ray_x_storage;
+    ray_y = &ray_y_storage;
   }
-
-  const int height = depth_image.height();
-  const int width = depth_image.width();
-  const double cx = camera_info.center_x();
-  const double cy = camera_info.center_y();
-  const double fx_inv = 1.0 / camera_info.focal_x();
-  const double fy_inv = 1.0 / camera_info.focal_y();
   const RigidTransformd X_PC =
       (camera_pose != nullptr) ? *camera_pose : RigidTransformd::Identity();
 
+  // The back-projection kernel takes float depths where kTooClose is zero and
+  // kTooFar is +∞, which a 16U row needs to be converted to first.
+  using Traits = ImageTraits<pixel_type>;
+  static_assert(Traits::kTooClose == 0);
+  std::vector<float> depth_row;
   for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
-      if ((z == ImageTraits<pixel_type>::kTooClose) ||
-          (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
-      } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        const Vector3d xyz =
-            X_PC * Vector3d(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv, scale * z);
-        output_xyz.col(col) = xyz.template cast<float>();
-      }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+    const auto* const row = depth_image.at(0, v);
+    const float* z = nullptr;
+    if constexpr (pixel_type == PixelType::kDepth32F) {
+      z = row;
+    } else {
+      depth_row.resize(width);
+      for (int u = 0; u < width; ++u) {
+        depth_row[u] = (row[u] == Traits::kTooFar)
+                           ? std::numeric_limits<float>::infinity()
+                           : row[u];
       }
+      z = depth_row.data();
+    }
+    internal::BackProjectDepthRow(z, width, scale, ray_x->data(), (*ray_y)[v],
+                                  X_PC, output_xyz.data() + 3 * v * width);
+  }
+
+  if (color_image && depth_image.size() > 0) {
+    Eigen::Ref<Matrix3X<uint8_t>> output_rgb = output->mutable_rgbs();
+    const uint8_t* const rgba = color_image->at(0, 0);
+    for (int i = 0; i < depth_image.size(); ++i) {
+      output_rgb.col(i) = Eigen::Map<const Vector3<uint8_t>>(rgba + 4 * i);
     }
   }
 }
@@ -108,6 +154,9 @@ DepthImageToPointCloud::DepthImageToPointCloud(
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
       fields_(fields) {
+  CalcRays(camera_info_, camera_info_.width(), camera_info_.height(), &ray_x_,
+           &ray_y_);
+
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -138,9 +187,10 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth32F& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
     const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+  DoConvert(std::nullopt, camera_info, nullptr, nullptr,
+            camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -149,9 +199,10 @@ void DepthImageToPointCloud::Convert(
     const systems::sensors::ImageDepth16U& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
     const std::optional<float>& scale, PointCloud* output) {
-  DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
-            depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+  DoConvert(std::nullopt, camera_info, nullptr, nullptr,
+            camera_pose ? &*camera_pose : nullptr, depth_image,
+            color_image ? &*color_image : nullptr, scale.value_or(1.0f),
+            output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -163,8 +214,7 @@ void DepthImageToPointCloud::CalcOutput32F(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  CalcPointCloud(*depth_image, color_image_or_null, pose_or_null, output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -176,8 +226,21 @@ void DepthImageToPointCloud::CalcOutput16U(
   const auto* const pose_or_null =
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
-  DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+  CalcPointCloud(*depth_image, color_image_or_null, pose_or_null, output);
+}
+
+void DepthImageToPointCloud::CalcPointCloud(
+    const ImageDepth32F& depth_image, const ImageRgba8U* color_image,
+    const RigidTransformd* camera_pose, PointCloud* cloud) const {
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, camera_pose, depth_image,
+            color_image, scale_, cloud);
+}
+
+void DepthImageToPointCloud::CalcPointCloud(
+    const ImageDepth16U& depth_image, const ImageRgba8U* color_image,
+    const RigidTransformd* camera_pose, PointCloud* cloud) const {
+  DoConvert(fields_, camera_info_, &ray_x_, &ray_y_, camera_pose, depth_image,
+            color_image, scale_, cloud);
 }
 
 }  // namespace perception
@@ -94,8 +94,9 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the size of the depth image (its
+  /// storage is reused as-is when the size already matches).  The `cloud`
+  /// must have the XYZ channel enabled.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
@@ -108,8 +109,9 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// in the class overview and constructor.
   ///
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
-  /// The `cloud` will be resized to match the size of the depth image.  The
-  /// `cloud` must have the XYZ channel enabled.
+  /// The `cloud` will be resized to match the size of the depth image (its
+  /// storage is reused as-is when the size already matches).  The `cloud`
+  /// must have the XYZ channel enabled.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
@@ -117,6 +119,32 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
       const std::optional<float>& scale, PointCloud* cloud);
 
+  /// Converts a depth image to a point cloud exactly as the output port does,
+  /// but using direct arguments instead of System input and output ports. The
+  /// camera, scale, and fields are the ones passed to the constructor, and the
+  /// back-projection rays of the camera (which the constructor precomputes)
+  /// are reused, so this is the cheapest way to convert a stream of images
+  /// outside of a Diagram.
+  ///
+  /// @param[in] color_image The optional color image, or nullptr.
+  /// @param[in] camera_pose The optional pose X_PC, or nullptr to express the
+  /// points in the camera frame.
+  /// @param[in,out] cloud Destination for point data; must not be nullptr.
+  /// Its fields must be the `fields` passed to the constructor. It is resized
+  /// to match the size of the depth image, and otherwise written in place, so
+  /// reusing the same `cloud` for images of the same size never reallocates.
+  /// @throws std::exception if `cloud` has the wrong fields.
+  void CalcPointCloud(const systems::sensors::ImageDepth32F& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      const math::RigidTransformd* camera_pose,
+                      PointCloud* cloud) const;
+
+  /// Overload for a 16U depth image; see above.
+  void CalcPointCloud(const systems::sensors::ImageDepth16U& depth_image,
+                      const systems::sensors::ImageRgba8U* color_image,
+                      const math::RigidTransformd* camera_pose,
+                      PointCloud* cloud) const;
+
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
   void CalcOutput32F(const systems::Context<double>&, PointCloud*) const;
@@ -126,6 +154,11 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const float scale_;
   const pc_flags::BaseFieldT fields_;
 
+  // The normalized image coordinates of the pixel centers of camera_info_,
+  // (u - cx) / fx for each column u and (v - cy) / fy for each row v.
+  std::vector<double> ray_x_;
+  std::vector<double> ray_y_;
+
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
   systems::InputPortIndex camera_pose_input_port_{};
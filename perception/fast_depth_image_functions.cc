@@ -0,0 +1,143 @@
+/* clang-format off to disable clang-format-includes */
+#include "drake/perception/fast_depth_image_functions.h"
+/* clang-format on */
+
+#include <limits>
+
+// This is the magic juju that compiles our impl functions for multiple CPUs.
+#undef HWY_TARGET_INCLUDE
+#define HWY_TARGET_INCLUDE "perception/fast_depth_image_functions.cc"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/foreach_target.h"
+#include "hwy/highway.h"
+#pragma GCC diagnostic pop
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/hwy_dynamic_impl.h"
+
+HWY_BEFORE_NAMESPACE();
+namespace drake {
+namespace perception {
+namespace internal {
+namespace {
+namespace HWY_NAMESPACE {
+namespace hn = hwy::HWY_NAMESPACE;
+
+/* The kernels receive the pose and the row's ray_y folded into nine
+coefficients c, so that each coordinate i of a back-projected point is
+sz * (c[i] * ray_x + c[3 + i]) + c[6 + i] where sz is the scaled depth:
+c[0:3] = R_PC.col(0), c[3:6] = R_PC.col(1) * ray_y + R_PC.col(2), and
+c[6:9] = p_PC. */
+
+/* Back-projects a single pixel. */
+void BackProjectDepthPixel(float z, double scale, double ray_x,
+                           const double* c, float* xyz) {
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  if (z == 0 || z == kInf) {
+    xyz[0] = xyz[1] = xyz[2] = kInf;
+    return;
+  }
+  // N.B. This also handles NaNs.
+  const double sz = scale * z;
+  for (int i = 0; i < 3; ++i) {
+    xyz[i] = static_cast<float>(sz * (c[i] * ray_x + c[3 + i]) + c[6 + i]);
+  }
+}
+
+// The SIMD approach is only useful when we have registers of size `double[4]`
+// or larger. When we have smaller registers (e.g., SSE2's 2-wide lanes, or
+// SVE's variable-length vectors) we will fall back to non-SIMD code.
+#if HWY_MAX_BYTES >= 32 && HWY_HAVE_SCALABLE == 0
+
+/* Four pixels are processed at a time, one pixel per lane. The depths are
+promoted to double on load, and the coordinates are demoted to float and
+re-interleaved into <xyz xyz xyz xyz> on store. */
+void BackProjectDepthRowImpl(const float* z, int width, double scale,
+                             const double* ray_x, const double* c,
+                             float* xyz) {
+  using D = hn::FixedTag<double, 4>;
+  const D tag;
+  const hn::Rebind<float, D> float_tag;
+  const auto zero = hn::Zero(tag);
+  const auto inf = hn::Set(tag, std::numeric_limits<double>::infinity());
+  const auto scale_vec = hn::Set(tag, scale);
+  const hn::Vec<D> r[3] = {hn::Set(tag, c[0]), hn::Set(tag, c[1]),
+                           hn::Set(tag, c[2])};
+  const hn::Vec<D> k[3] = {hn::Set(tag, c[3]), hn::Set(tag, c[4]),
+                           hn::Set(tag, c[5])};
+  const hn::Vec<D> p[3] = {hn::Set(tag, c[6]), hn::Set(tag, c[7]),
+                           hn::Set(tag, c[8])};
+  int u = 0;
+  for (; u + 4 <= width; u += 4) {
+    const auto depth = hn::PromoteTo(tag, hn::LoadU(float_tag, z + u));
+    const auto invalid = hn::Or(hn::Eq(depth, zero), hn::Eq(depth, inf));
+    const auto sz = hn::Mul(scale_vec, depth);
+    const auto rx = hn::LoadU(tag, ray_x + u);
+    hn::Vec<hn::Rebind<float, D>> out[3];
+    for (int i = 0; i < 3; ++i) {
+      const auto coordinate = hn::MulAdd(sz, hn::MulAdd(r[i], rx, k[i]), p[i]);
+      out[i] =
+          hn::DemoteTo(float_tag, hn::IfThenElse(invalid, inf, coordinate));
+    }
+    hn::StoreInterleaved3(out[0], out[1], out[2], float_tag, xyz + 3 * u);
+  }
+  for (; u < width; ++u) {
+    BackProjectDepthPixel(z[u], scale, ray_x[u], c, xyz + 3 * u);
+  }
+}
+
+#else  // HWY_MAX_BYTES
+
+void BackProjectDepthRowImpl(const float* z, int width, double scale,
+                             const double* ray_x, const double* c,
+                             float* xyz) {
+  for (int u = 0; u < width; ++u) {
+    BackProjectDepthPixel(z[u], scale, ray_x[u], c, xyz + 3 * u);
+  }
+}
+
+#endif  // HWY_MAX_BYTES
+
+}  // namespace HWY_NAMESPACE
+}  // namespace
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
+HWY_AFTER_NAMESPACE();
+
+// This part of the file is only compiled once total, instead of once per CPU.
+#if HWY_ONCE
+namespace drake {
+namespace perception {
+namespace internal {
+namespace {
+
+// Create the lookup tables for the per-CPU hwy implementation functions, and
+// required functors that select from the lookup tables.
+HWY_EXPORT(BackProjectDepthRowImpl);
+struct ChooseBestBackProjectDepthRow {
+  auto operator()() { return HWY_DYNAMIC_POINTER(BackProjectDepthRowImpl); }
+};
+
+}  // namespace
+
+void BackProjectDepthRow(const float* z, int width, double scale,
+                         const double* ray_x, double ray_y,
+                         const math::RigidTransformd& X_PC, float* xyz) {
+  DRAKE_ASSERT(width >= 0);
+  if (width == 0) return;
+  DRAKE_ASSERT(z != nullptr && ray_x != nullptr && xyz != nullptr);
+  const Eigen::Matrix3d& R_PC = X_PC.rotation().matrix();
+  double c[9];
+  Eigen::Map<Eigen::Matrix3d> coefficients(c);
+  coefficients << R_PC.col(0), R_PC.col(1) * ray_y + R_PC.col(2),
+      X_PC.translation();
+  LateBoundFunction<ChooseBestBackProjectDepthRow>::Call(z, width, scale,
+                                                         ray_x, c, xyz);
+}
+
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
+#endif  // HWY_ONCE
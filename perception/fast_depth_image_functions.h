@@ -0,0 +1,35 @@
+#pragma once
+
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace perception {
+namespace internal {
+
+/* Declarations for fast, low-level kernels used by DepthImageToPointCloud.
+Ideally these are implemented using platform-specific SIMD instructions for
+speed; however, we always provide a straightforward portable fallback. */
+
+/* Back-projects one row of a depth image into points measured and expressed in
+the parent frame P, i.e., for each pixel u of the row this computes
+
+  xyz[u] = X_PC * (scale * z[u] * (ray_x[u], ray_y, 1))
+
+where `ray_x[u] = (u - cx) / fx` and `ray_y = (v - cy) / fy` are the normalized
+image coordinates of the pixel center. The arithmetic is done in double
+precision; only the stored result is rounded to float.
+
+A depth of exactly zero (too close) or +∞ (too far) produces the point
+(+∞, +∞, +∞), and a NaN depth produces (NaN, NaN, NaN).
+
+@param z      The `width` depths of the row, in the units of the image.
+@param ray_x  The `width` normalized image x coordinates of the row's pixels.
+@param[out] xyz  Room for `3 * width` floats, i.e., `width` packed points.
+@pre z, ray_x and xyz are non-null unless width is zero. */
+void BackProjectDepthRow(const float* z, int width, double scale,
+                         const double* ray_x, double ray_y,
+                         const math::RigidTransformd& X_PC, float* xyz);
+
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
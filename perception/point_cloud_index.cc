@@ -0,0 +1,110 @@
+#include "drake/perception/point_cloud_index.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <nanoflann.hpp>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+class PointCloudIndex::Impl {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Impl);
+
+  using Tree = nanoflann::KDTreeEigenMatrixAdaptor<Eigen::MatrixX3f, 3,
+                                                   nanoflann::metric_L2_Simple>;
+
+  explicit Impl(const PointCloud& cloud) {
+    DRAKE_THROW_UNLESS(cloud.has_xyzs());
+    const auto xyzs = cloud.xyzs();
+    for (int i = 0; i < cloud.size(); ++i) {
+      if (xyzs.col(i).array().isFinite().all()) {
+        original_indices_.push_back(i);
+      }
+    }
+    data_.resize(original_indices_.size(), 3);
+    for (int row = 0; row < data_.rows(); ++row) {
+      data_.row(row) = xyzs.col(original_indices_[row]).transpose();
+    }
+    // N.B. The tree refers to `data_`, so must be built after it.
+    tree_ = std::make_unique<Tree>(3, data_);
+  }
+
+  int size() const { return static_cast<int>(original_indices_.size()); }
+
+  int FindNearest(const Eigen::Vector3f& query, int k, int* indices,
+                  float* squared_distances) const {
+    DRAKE_DEMAND(k > 0);
+    DRAKE_DEMAND(indices != nullptr);
+    DRAKE_DEMAND(squared_distances != nullptr);
+    if (size() == 0) {
+      return 0;
+    }
+    // Eigen::Index is wider than int, so we can't write straight to `indices`.
+    constexpr int kMaxOnStack = 32;
+    Eigen::Index stack_rows[kMaxOnStack];
+    std::vector<Eigen::Index> heap_rows;
+    Eigen::Index* rows = stack_rows;
+    if (k > kMaxOnStack) {
+      heap_rows.resize(k);
+      rows = heap_rows.data();
+    }
+    const int num_found = static_cast<int>(
+        tree_->index_->knnSearch(query.data(), k, rows, squared_distances));
+    for (int i = 0; i < num_found; ++i) {
+      indices[i] = original_indices_[rows[i]];
+    }
+    return num_found;
+  }
+
+ private:
+  // The finite points, one per row, and their indices in the original cloud.
+  Eigen::MatrixX3f data_;
+  std::vector<int> original_indices_;
+  std::unique_ptr<Tree> tree_;
+};
+
+PointCloudIndex::PointCloudIndex(const PointCloud& cloud)
+    : impl_(std::make_unique<Impl>(cloud)) {}
+
+PointCloudIndex::~PointCloudIndex() = default;
+
+int PointCloudIndex::size() const {
+  return impl_->size();
+}
+
+int PointCloudIndex::FindNearest(const Eigen::Vector3f& query, int k,
+                                 int* indices, float* squared_distances) const {
+  return impl_->FindNearest(query, k, indices, squared_distances);
+}
+
+void PointCloudIndex::FindNearest(
+    const Eigen::Ref<const Matrix3X<float>>& queries,
+    [[maybe_unused]] const Parallelism parallelize, std::vector<int>* indices,
+    std::vector<float>* squared_distances) const {
+  DRAKE_THROW_UNLESS(indices != nullptr);
+  DRAKE_THROW_UNLESS(squared_distances != nullptr);
+  const int num_queries = static_cast<int>(queries.cols());
+  indices->resize(num_queries);
+  squared_distances->resize(num_queries);
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(parallelize.num_threads())
+#endif
+  for (int i = 0; i < num_queries; ++i) {
+    int index = -1;
+    float squared_distance = std::numeric_limits<float>::infinity();
+    if (queries.col(i).array().isFinite().all()) {
+      impl_->FindNearest(queries.col(i), 1, &index, &squared_distance);
+    }
+    (*indices)[i] = index;
+    (*squared_distances)[i] = squared_distance;
+  }
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/perception/point_cloud.h"
+
+namespace drake {
+namespace perception {
+
+/// A spatial index (a KD-tree) over the xyzs of a PointCloud, for nearest
+/// neighbor queries.
+///
+/// Building the index is far more expensive than querying it, so an index of a
+/// cloud that doesn't change (e.g., the model in a registration problem)
+/// should be built once and reused. The index copies the points it needs, so
+/// it remains valid even if the cloud is later modified or destroyed. Points
+/// with non-finite coordinates are not indexed. All indices reported by the
+/// queries refer to the points of the original cloud.
+///
+/// The const queries are thread-safe.
+class PointCloudIndex final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PointCloudIndex);
+
+  /// Builds the index of the xyzs of `cloud`.
+  /// @throws std::exception if `cloud` doesn't have xyzs.
+  explicit PointCloudIndex(const PointCloud& cloud);
+
+  ~PointCloudIndex();
+
+  /// Returns the number of indexed (i.e., finite) points.
+  int size() const;
+
+  /// Finds (up to) the `k` nearest neighbors of `query`. Returns the number of
+  /// neighbors found (less than `k` iff fewer than `k` points are indexed). The
+  /// neighbors are sorted by increasing distance.
+  /// @param[out] indices The indices of the neighbors in the original cloud.
+  /// @param[out] squared_distances The squared distances to the neighbors.
+  /// @pre k > 0 and `indices` and `squared_distances` have room for k entries.
+  int FindNearest(const Eigen::Vector3f& query, int k, int* indices,
+                  float* squared_distances) const;
+
+  /// Finds the nearest neighbor of each of the `queries`.
+  /// @param[out] indices Is resized to `queries.cols()`; on return, holds the
+  /// index (in the original cloud) of the nearest neighbor of each query, or
+  /// -1 if the index is empty or the query is not finite.
+  /// @param[out] squared_distances Is resized like `indices`; holds the squared
+  /// distance to each nearest neighbor (infinity when there is none).
+  void FindNearest(const Eigen::Ref<const Matrix3X<float>>& queries,
+                   Parallelism parallelize, std::vector<int>* indices,
+                   std::vector<float>* squared_distances) const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace perception
+}  // namespace drake
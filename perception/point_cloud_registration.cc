@@ -0,0 +1,305 @@
+#include "drake/perception/point_cloud_registration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/math/rotation_matrix.h"
+
+namespace drake {
+namespace perception {
+
+using Eigen::Matrix3d;
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+namespace {
+
+using Matrix6d = Eigen::Matrix<double, 6, 6>;
+using Vector6d = Eigen::Matrix<double, 6, 1>;
+
+// The variance across the surface of the Gaussians of Generalized-ICP,
+// relative to the variance along the surface (Segal et al. use 0.001).
+constexpr double kGicpEpsilon = 1e-3;
+
+// The correspondences are accumulated into this many blocks, whose sums are
+// then added in order, so the result doesn't depend on the number of threads.
+constexpr int kNumBlocks = 64;
+
+// Estimates the normals of the points of `cloud` from their `num_closest`
+// nearest neighbors in `index`, which must index `cloud`. The normals of
+// non-finite points, and of points with fewer than three neighbors, are NaN.
+void EstimateNormalsWithIndex(const PointCloud& cloud,
+                              const PointCloudIndex& index, int num_closest,
+                              Parallelism parallelize, PointCloud* output) {
+  DRAKE_DEMAND(output->has_normals() && output->size() == cloud.size());
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  const auto xyzs = cloud.xyzs();
+  auto normals = output->mutable_normals();
+  [[maybe_unused]] const int num_threads = parallelize.num_threads();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+  for (int i = 0; i < cloud.size(); ++i) {
+    std::vector<int> indices(num_closest);
+    std::vector<float> squared_distances(num_closest);
+    const Vector3f query = xyzs.col(i);
+    const int num_neighbors =
+        query.array().isFinite().all()
+            ? index.FindNearest(query, num_closest, indices.data(),
+                                squared_distances.data())
+            : 0;
+    if (num_neighbors < 3) {
+      normals.col(i).setConstant(kNaN);
+      continue;
+    }
+    Vector3d mean = Vector3d::Zero();
+    for (int j = 0; j < num_neighbors; ++j) {
+      mean += xyzs.col(indices[j]).cast<double>();
+    }
+    mean /= num_neighbors;
+    Matrix3d covariance = Matrix3d::Zero();
+    for (int j = 0; j < num_neighbors; ++j) {
+      const Vector3d x_minus_mean = xyzs.col(indices[j]).cast<double>() - mean;
+      covariance += x_minus_mean * x_minus_mean.transpose();
+    }
+    Eigen::SelfAdjointEigenSolver<Matrix3d> solver;
+    solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+    normals.col(i) = solver.eigenvectors().col(0).cast<float>();
+  }
+}
+
+// Returns the covariance of a point of Generalized-ICP with unit normal n.
+Matrix3d GicpCovariance(const Vector3d& n) {
+  return Matrix3d::Identity() - (1 - kGicpEpsilon) * n * n.transpose();
+}
+
+Matrix3d Skew(const Vector3d& v) {
+  Matrix3d result;
+  // clang-format off
+  result <<     0, -v.z(),  v.y(),
+            v.z(),      0, -v.x(),
+           -v.y(),  v.x(),      0;
+  // clang-format on
+  return result;
+}
+
+double HuberWeight(const std::optional<double>& threshold, double residual) {
+  if (!threshold.has_value() || residual <= *threshold) {
+    return 1.0;
+  }
+  return *threshold / residual;
+}
+
+// The normal equations of one Gauss-Newton step, for the twist (ω, v) that
+// updates the pose as X_TS ← exp(ω, v) X_TS.
+struct NormalEquations {
+  void operator+=(const NormalEquations& other) {
+    H += other.H;
+    g += other.g;
+    sum_squared_distance += other.sum_squared_distance;
+    num_correspondences += other.num_correspondences;
+  }
+
+  Matrix6d H{Matrix6d::Zero()};
+  Vector6d g{Vector6d::Zero()};
+  double sum_squared_distance{};
+  int num_correspondences{};
+};
+
+enum class IcpMethod { kPointToPlane, kGeneralized };
+
+// Runs the iterations shared by both variants of ICP. The `source_normals`
+// are only used by Generalized-ICP.
+IcpResult RunIcp(IcpMethod method, const Matrix3X<double>& source_points,
+                 const Matrix3X<double>& source_normals,
+                 const RegistrationTarget& target,
+                 const RigidTransformd& X_TS_initial, const IcpParams& params,
+                 Parallelism parallelize) {
+  DRAKE_THROW_UNLESS(params.max_iterations >= 0);
+  DRAKE_THROW_UNLESS(params.max_correspondence_distance > 0);
+  const int num_points = static_cast<int>(source_points.cols());
+  const double max_squared_distance =
+      params.max_correspondence_distance * params.max_correspondence_distance;
+  const auto target_xyzs = target.cloud().xyzs();
+  const auto target_normals = target.cloud().normals();
+  [[maybe_unused]] const int num_threads = parallelize.num_threads();
+
+  IcpResult result;
+  result.X_TS = X_TS_initial;
+  result.rmse = std::numeric_limits<double>::quiet_NaN();
+  Matrix3X<float> transformed(3, num_points);
+  std::vector<int> indices;
+  std::vector<float> squared_distances;
+  std::vector<NormalEquations> blocks(kNumBlocks);
+  while (result.num_iterations < params.max_iterations) {
+    const Matrix3d R_TS = result.X_TS.rotation().matrix();
+    transformed = ((R_TS * source_points).colwise() +
+                   result.X_TS.translation())
+                      .cast<float>();
+    target.index().FindNearest(transformed, parallelize, &indices,
+                               &squared_distances);
+
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(num_threads)
+#endif
+    for (int b = 0; b < kNumBlocks; ++b) {
+      NormalEquations& block = blocks[b];
+      block = {};
+      const int begin = static_cast<int>(int64_t{num_points} * b / kNumBlocks);
+      const int end =
+          static_cast<int>(int64_t{num_points} * (b + 1) / kNumBlocks);
+      for (int i = begin; i < end; ++i) {
+        if (indices[i] < 0 || squared_distances[i] > max_squared_distance) {
+          continue;
+        }
+        const Vector3d n_T = target_normals.col(indices[i]).cast<double>();
+        if (!n_T.array().isFinite().all()) {
+          continue;
+        }
+        const Vector3d p_T = R_TS * source_points.col(i) +
+                             result.X_TS.translation();
+        const Vector3d e = p_T - target_xyzs.col(indices[i]).cast<double>();
+        if (method == IcpMethod::kPointToPlane) {
+          const double r = n_T.dot(e);
+          Vector6d J;
+          J << p_T.cross(n_T), n_T;
+          const double w = HuberWeight(params.huber_threshold, std::abs(r));
+          block.H += w * J * J.transpose();
+          block.g += w * J * r;
+        } else {
+          const Vector3d n_S = source_normals.col(i);
+          if (!n_S.array().isFinite().all()) {
+            continue;
+          }
+          const Matrix3d M = (GicpCovariance(n_T) + GicpCovariance(R_TS * n_S))
+                                 .inverse();
+          const Vector3d Me = M * e;
+          // Scale the Mahalanobis distance so that, for coplanar points, it is
+          // the distance between the planes (in meters).
+          const double distance =
+              std::sqrt(std::max(2 * kGicpEpsilon * e.dot(Me), 0.0));
+          const double w = HuberWeight(params.huber_threshold, distance);
+          Eigen::Matrix<double, 3, 6> J;
+          J << -Skew(p_T), Matrix3d::Identity();
+          block.H += w * J.transpose() * M * J;
+          block.g += w * J.transpose() * Me;
+        }
+        block.sum_squared_distance += e.squaredNorm();
+        ++block.num_correspondences;
+      }
+    }
+    NormalEquations total;
+    for (const NormalEquations& block : blocks) {
+      total += block;
+    }
+
+    result.num_correspondences = total.num_correspondences;
+    if (total.num_correspondences == 0) {
+      result.rmse = std::numeric_limits<double>::quiet_NaN();
+      break;
+    }
+    result.rmse =
+        std::sqrt(total.sum_squared_distance / total.num_correspondences);
+    const Vector6d delta = total.H.ldlt().solve(-total.g);
+    if (!delta.array().isFinite().all()) {
+      break;
+    }
+    const Vector3d w = delta.head<3>();
+    const Vector3d v = delta.tail<3>();
+    const double angle = w.norm();
+    const RotationMatrixd R_delta =
+        angle > 0 ? RotationMatrixd(Eigen::AngleAxisd(angle, w / angle))
+                  : RotationMatrixd();
+    result.X_TS = RigidTransformd(R_delta, v) * result.X_TS;
+    ++result.num_iterations;
+    if (angle < params.rotation_tolerance &&
+        v.norm() < params.translation_tolerance) {
+      result.converged = true;
+      break;
+    }
+  }
+  return result;
+}
+
+// Returns the indices of the finite points of `cloud`.
+std::vector<int> FindFinitePoints(const PointCloud& cloud) {
+  std::vector<int> result;
+  result.reserve(cloud.size());
+  const auto xyzs = cloud.xyzs();
+  for (int i = 0; i < cloud.size(); ++i) {
+    if (xyzs.col(i).array().isFinite().all()) {
+      result.push_back(i);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+RegistrationTarget::RegistrationTarget(const PointCloud& cloud,
+                                       int num_closest,
+                                       Parallelism parallelize)
+    : cloud_(cloud.size(), pc_flags::kXYZs | pc_flags::kNormals) {
+  DRAKE_THROW_UNLESS(cloud.has_xyzs());
+  DRAKE_THROW_UNLESS(num_closest >= 3);
+  cloud_.mutable_xyzs() = cloud.xyzs();
+  index_ = std::make_unique<PointCloudIndex>(cloud_);
+  if (cloud.has_normals()) {
+    cloud_.mutable_normals() = cloud.normals();
+  } else {
+    EstimateNormalsWithIndex(cloud_, *index_, num_closest, parallelize,
+                             &cloud_);
+  }
+}
+
+RegistrationTarget::~RegistrationTarget() = default;
+
+IcpResult PointToPlaneIcp(const PointCloud& source,
+                          const RegistrationTarget& target,
+                          const RigidTransformd& X_TS_initial,
+                          const IcpParams& params, Parallelism parallelize) {
+  DRAKE_THROW_UNLESS(source.has_xyzs());
+  const std::vector<int> finite = FindFinitePoints(source);
+  Matrix3X<double> points(3, finite.size());
+  for (int i = 0; i < static_cast<int>(finite.size()); ++i) {
+    points.col(i) = source.xyz(finite[i]).cast<double>();
+  }
+  return RunIcp(IcpMethod::kPointToPlane, points, Matrix3X<double>(3, 0),
+                target, X_TS_initial, params, parallelize);
+}
+
+IcpResult GeneralizedIcp(const PointCloud& source,
+                         const RegistrationTarget& target,
+                         const RigidTransformd& X_TS_initial,
+                         const IcpParams& params, Parallelism parallelize,
+                         int num_closest) {
+  DRAKE_THROW_UNLESS(source.has_xyzs());
+  DRAKE_THROW_UNLESS(num_closest >= 3);
+  std::optional<PointCloud> estimated;
+  if (!source.has_normals()) {
+    estimated.emplace(source.size(), pc_flags::kXYZs | pc_flags::kNormals);
+    estimated->mutable_xyzs() = source.xyzs();
+    const PointCloudIndex source_index(*estimated);
+    EstimateNormalsWithIndex(*estimated, source_index, num_closest,
+                             parallelize, &*estimated);
+  }
+  const PointCloud& with_normals = estimated ? *estimated : source;
+  const std::vector<int> finite = FindFinitePoints(source);
+  Matrix3X<double> points(3, finite.size());
+  Matrix3X<double> normals(3, finite.size());
+  for (int i = 0; i < static_cast<int>(finite.size()); ++i) {
+    points.col(i) = with_normals.xyz(finite[i]).cast<double>();
+    normals.col(i) = with_normals.normal(finite[i]).cast<double>();
+  }
+  return RunIcp(IcpMethod::kGeneralized, points, normals, target, X_TS_initial,
+                params, parallelize);
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/perception/point_cloud_index.h"
+
+namespace drake {
+namespace perception {
+
+/// The parameters of the iterative closest point (ICP) algorithms;
+/// see PointToPlaneIcp() and GeneralizedIcp().
+struct IcpParams {
+  /// Passes this object to an Archive.
+  /// Refer to @ref yaml_serialization "YAML Serialization" for background.
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(max_iterations));
+    a->Visit(DRAKE_NVP(max_correspondence_distance));
+    a->Visit(DRAKE_NVP(translation_tolerance));
+    a->Visit(DRAKE_NVP(rotation_tolerance));
+    a->Visit(DRAKE_NVP(huber_threshold));
+  }
+
+  /// The maximum number of iterations.
+  int max_iterations{30};
+
+  /// Pairs of closest points farther apart than this distance (in meters) are
+  /// rejected as outliers.
+  double max_correspondence_distance{0.05};
+
+  /// The iterations stop once an update translates the source by less than
+  /// this distance (in meters) and rotates it by less than
+  /// `rotation_tolerance` (in radians).
+  double translation_tolerance{1e-6};
+
+  /// See `translation_tolerance`.
+  double rotation_tolerance{1e-6};
+
+  /// When set, the residuals are weighted by the Huber loss with this
+  /// threshold (in meters), which reduces the influence of the remaining
+  /// outliers. The residuals are the distances from the source points to the
+  /// target planes for PointToPlaneIcp(), and the Mahalanobis distances of
+  /// GeneralizedIcp(), scaled such that they are the distances between the
+  /// planes of coplanar points.
+  std::optional<double> huber_threshold;
+};
+
+/// The result of PointToPlaneIcp() or GeneralizedIcp().
+struct IcpResult {
+  /// The estimated pose of the source cloud's frame S in the target cloud's
+  /// frame T.
+  math::RigidTransformd X_TS;
+
+  /// The number of iterations performed.
+  int num_iterations{};
+
+  /// Whether the iterations met the tolerances before `max_iterations`.
+  bool converged{false};
+
+  /// The number of source points that were paired with target points in the
+  /// last iteration.
+  int num_correspondences{};
+
+  /// The root mean square distance between the paired points in the last
+  /// iteration (in meters), or NaN if there were no pairs.
+  double rmse{};
+};
+
+/// The target (or model) of a point cloud registration problem, with the data
+/// that is shared by every registration against it: the spatial index of its
+/// points, and their surface normals.
+///
+/// Registering a stream of scans against the same target (e.g., to track the
+/// pose of an object) only needs to build this once.
+class RegistrationTarget final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RegistrationTarget);
+
+  /// Prepares `cloud` as a registration target. If the cloud has normals,
+  /// they are used as-is; otherwise, they are estimated from the
+  /// `num_closest` nearest neighbors of each point (like
+  /// PointCloud::EstimateNormals(), but reusing this target's index).
+  /// @throws std::exception if `cloud` doesn't have xyzs, or if
+  /// `num_closest < 3`.
+  explicit RegistrationTarget(const PointCloud& cloud, int num_closest = 20,
+                              Parallelism parallelize = false);
+
+  ~RegistrationTarget();
+
+  /// Returns the target points (with normals).
+  const PointCloud& cloud() const { return cloud_; }
+
+  /// Returns the spatial index of the target points.
+  const PointCloudIndex& index() const { return *index_; }
+
+ private:
+  PointCloud cloud_;
+  std::unique_ptr<PointCloudIndex> index_;
+};
+
+/// Estimates the pose of the `source` cloud relative to the `target` with the
+/// point-to-plane variant of the iterative closest point algorithm (Chen and
+/// Medioni, "Object modelling by registration of multiple range images",
+/// 1992). Each iteration pairs every source point with its closest target
+/// point, and then takes a Gauss-Newton step on the sum of the squared
+/// distances from the source points to the tangent planes of their paired
+/// target points.
+///
+/// The closest points are found (and the normal equations are accumulated) in
+/// parallel, as governed by `parallelize`. The result does not depend on the
+/// number of threads.
+///
+/// @param source The points of the source cloud, expressed in its frame S.
+/// Non-finite points are ignored.
+/// @param target The target, expressed in its frame T.
+/// @param X_TS_initial The initial guess of the pose of S in T.
+/// @throws std::exception if `source` doesn't have xyzs.
+IcpResult PointToPlaneIcp(const PointCloud& source,
+                          const RegistrationTarget& target,
+                          const math::RigidTransformd& X_TS_initial,
+                          const IcpParams& params = {},
+                          Parallelism parallelize = false);
+
+/// Estimates the pose of the `source` cloud relative to the `target` with the
+/// plane-to-plane Generalized-ICP algorithm (Segal, Haehnel, and Thrun,
+/// "Generalized-ICP", 2009). Each point is modeled as a sample of a Gaussian
+/// that is flat along its local surface; the residual of a pair of points is
+/// the Mahalanobis distance under the sum of their covariances. This is more
+/// accurate and robust than PointToPlaneIcp() when both clouds are noisy, at a
+/// somewhat higher cost per iteration. Combined with
+/// IcpParams::huber_threshold, it is robust to outliers as well.
+///
+/// If `source` doesn't have normals, they are estimated from the
+/// `num_closest` nearest neighbors of each source point.
+///
+/// The parameters have the same meaning as for PointToPlaneIcp().
+/// @throws std::exception if `source` doesn't have xyzs.
+IcpResult GeneralizedIcp(const PointCloud& source,
+                         const RegistrationTarget& target,
+                         const math::RigidTransformd& X_TS_initial,
+                         const IcpParams& params = {},
+                         Parallelism parallelize = false,
+                         int num_closest = 20);
+
+}  // namespace perception
+}  // namespace drake
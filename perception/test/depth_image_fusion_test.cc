@@ -0,0 +1,102 @@
+#include "drake/perception/depth_image_fusion.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+const CameraInfo kCamera0{64, 48, M_PI / 4};
+const CameraInfo kCamera1{80, 60, M_PI / 3};
+const VoxelMapParams kParams{.voxel_size = 0.02,
+                             .truncation_distance = 0.06,
+                             .decay_rate = 0.5};
+
+GTEST_TEST(DepthImageFusionTest, Ports) {
+  const DepthImageFusion dut({kCamera0, kCamera1}, kParams, 0.1);
+  EXPECT_EQ(dut.num_cameras(), 2);
+  EXPECT_EQ(dut.update_period(), 0.1);
+  EXPECT_EQ(dut.num_input_ports(), 4);
+  EXPECT_EQ(dut.depth_image_input_port(1).get_name(), "depth_image_1");
+  EXPECT_EQ(dut.camera_pose_input_port(1).get_name(), "camera_pose_1");
+  EXPECT_EQ(dut.point_cloud_output_port().get_name(), "point_cloud");
+  EXPECT_EQ(dut.voxel_map_output_port().get_name(), "voxel_map");
+  EXPECT_THROW(dut.depth_image_input_port(2), std::exception);
+
+  EXPECT_THROW(DepthImageFusion({}, kParams, 0.1), std::exception);
+  EXPECT_THROW(DepthImageFusion({kCamera0}, kParams, 0.0), std::exception);
+  EXPECT_THROW(DepthImageFusion({kCamera0}, {.voxel_size = 0}, 0.1),
+               std::exception);
+}
+
+// The update integrates every camera into the map in the state, and the
+// outputs report the resulting map.
+GTEST_TEST(DepthImageFusionTest, Integrate) {
+  const double kPeriod = 0.1;
+  const DepthImageFusion dut({kCamera0, kCamera1}, kParams, kPeriod);
+  auto context = dut.CreateDefaultContext();
+  const ImageDepth32F depth0(kCamera0.width(), kCamera0.height(), 1.0f);
+  const ImageDepth32F depth1(kCamera1.width(), kCamera1.height(), 1.5f);
+  // Camera 0 uses the default pose.
+  const RigidTransformd X_PC1(Vector3d(0.1, 0.0, -0.5));
+  dut.depth_image_input_port(0).FixValue(context.get(), depth0);
+  dut.depth_image_input_port(1).FixValue(context.get(), depth1);
+  dut.camera_pose_input_port(1).FixValue(context.get(), X_PC1);
+
+  // The map starts out empty.
+  EXPECT_EQ(dut.voxel_map_output_port().Eval<VoxelMap>(*context).size(), 0);
+  EXPECT_EQ(dut.point_cloud_output_port().Eval<PointCloud>(*context).size(), 0);
+
+  VoxelMap expected(kParams);
+  for (int step = 0; step < 2; ++step) {
+    auto state = context->CloneState();
+    dut.CalcForcedUnrestrictedUpdate(*context, state.get());
+    context->get_mutable_state().SetFrom(*state);
+
+    expected.Decay(kPeriod);
+    expected.Integrate(kCamera0, RigidTransformd{}, depth0);
+    expected.Integrate(kCamera1, X_PC1, depth1);
+
+    const auto& map = dut.voxel_map_output_port().Eval<VoxelMap>(*context);
+    ASSERT_EQ(map.size(), expected.size());
+    for (const VoxelMap::Key& key : expected.GetKeys()) {
+      const VoxelMap::Voxel* actual = map.Find(key);
+      ASSERT_NE(actual, nullptr);
+      EXPECT_EQ(actual->tsdf, expected.Find(key)->tsdf);
+      EXPECT_EQ(actual->weight, expected.Find(key)->weight);
+    }
+    const auto& cloud =
+        dut.point_cloud_output_port().Eval<PointCloud>(*context);
+    ASSERT_GT(cloud.size(), 0);
+    ASSERT_EQ(cloud.size(), expected.ToPointCloud().size());
+    for (int i = 0; i < cloud.size(); ++i) {
+      const VoxelMap::Voxel* voxel =
+          expected.Find(expected.GetKey(cloud.xyz(i).cast<double>()));
+      ASSERT_NE(voxel, nullptr);
+      EXPECT_TRUE(CompareMatrices(
+          cloud.xyz(i),
+          (voxel->point_sum / voxel->point_weight).cast<float>()));
+    }
+  }
+
+  // A disconnected depth image is skipped.
+  auto fresh_context = dut.CreateDefaultContext();
+  dut.depth_image_input_port(1).FixValue(fresh_context.get(), depth1);
+  auto state = fresh_context->CloneState();
+  dut.CalcForcedUnrestrictedUpdate(*fresh_context, state.get());
+  VoxelMap camera1_only(kParams);
+  camera1_only.Integrate(kCamera1, RigidTransformd{}, depth1);
+  EXPECT_EQ(state->get_abstract_state<VoxelMap>(0).size(),
+            camera1_only.size());
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
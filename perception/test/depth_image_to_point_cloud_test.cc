@@ -479,6 +479,53 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that CalcPointCloud matches Convert and reuses the cloud's storage.
+GTEST_TEST(DepthImageToPointCloudCalcTest, CalcPointCloud) {
+  const CameraInfo camera(13, 7, 20.0, 21.0, 6.2, 3.4);
+  const RigidTransformd X_PC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+  const float scale = 0.5;
+  systems::sensors::ImageDepth32F depth(camera.width(), camera.height());
+  for (int v = 0; v < depth.height(); ++v) {
+    for (int u = 0; u < depth.width(); ++u) {
+      *depth.at(u, v) = 1.0f + 0.01f * u + 0.02f * v;
+    }
+  }
+  *depth.at(4, 2) = 0;
+  *depth.at(5, 3) = kFloatInf;
+  *depth.at(6, 4) = kFloatNaN;
+  ImageRgba8U color(camera.width(), camera.height());
+  for (int i = 0; i < color.size(); ++i) {
+    color.at(0, 0)[i] = static_cast<uint8_t>(i);
+  }
+
+  const pc_flags::BaseFieldT fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  const DepthImageToPointCloud dut(camera, PixelType::kDepth32F, scale,
+                                   fields);
+  PointCloud expected(0, fields);
+  DepthImageToPointCloud::Convert(camera, X_PC, depth, color, scale,
+                                  &expected);
+
+  PointCloud cloud(depth.size(), fields);
+  const float* const storage = cloud.xyzs().data();
+  for (int i = 0; i < 2; ++i) {
+    dut.CalcPointCloud(depth, &color, &X_PC, &cloud);
+    EXPECT_EQ(cloud.xyzs().data(), storage);
+    EXPECT_TRUE(CompareMatrices(cloud.xyzs(), expected.xyzs()));
+    EXPECT_EQ(cloud.rgbs(), expected.rgbs());
+  }
+
+  // The special depths follow the documented convention.
+  EXPECT_TRUE(cloud.xyz(2 * 13 + 4).array().isInf().all());
+  EXPECT_TRUE(cloud.xyz(3 * 13 + 5).array().isInf().all());
+  EXPECT_TRUE(cloud.xyz(4 * 13 + 6).array().isNaN().all());
+
+  // The cloud must have the constructor's fields.
+  PointCloud wrong_fields(depth.size(), pc_flags::kXYZs);
+  EXPECT_THROW(dut.CalcPointCloud(depth, &color, &X_PC, &wrong_fields),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
@@ -0,0 +1,89 @@
+#include "drake/perception/fast_depth_image_functions.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "hwy/tests/hwy_gtest.h"
+#pragma GCC diagnostic pop
+
+#include <gtest/gtest.h>
+
+#include "drake/common/hwy_dynamic.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace perception {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+/* This hwy-infused test fixture replicates every test case to be run against
+every target architecture variant (e.g., SSE4, AVX2, AVX512VL, etc). When run,
+it filters the suite to only run tests that the current CPU can handle. */
+class FastDepthImageFunctionsTest : public hwy::TestWithParamTarget {
+ protected:
+  void SetUp() override {
+    // Reset Drake's dispatcher, to be sure that we run all of the target
+    // architectures.
+    drake::internal::HwyDynamicReset();
+    hwy::TestWithParamTarget::SetUp();
+  }
+};
+
+HWY_TARGET_INSTANTIATE_TEST_SUITE_P(FastDepthImageFunctionsTest);
+
+/* The back-projected rows agree with the straightforward math, including for
+row widths that aren't a multiple of any SIMD width and for the special depth
+values. */
+TEST_P(FastDepthImageFunctionsTest, BackProjectDepthRow) {
+  const RigidTransformd X_PC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+  const double scale = 0.5;
+  const double ray_y = -0.25;
+  for (int width = 0; width <= 11; ++width) {
+    std::vector<float> z(width);
+    std::vector<double> ray_x(width);
+    for (int u = 0; u < width; ++u) {
+      z[u] = 0.5f + 0.25f * u;
+      ray_x[u] = 0.1 * u - 0.4;
+    }
+    if (width > 9) {
+      z[2] = 0;
+      z[5] = kInf;
+      z[9] = kNaN;
+    }
+    std::vector<float> xyz(3 * width);
+    BackProjectDepthRow(z.data(), width, scale, ray_x.data(), ray_y, X_PC,
+                        xyz.data());
+    for (int u = 0; u < width; ++u) {
+      const Vector3f actual(xyz[3 * u], xyz[3 * u + 1], xyz[3 * u + 2]);
+      if (z[u] == 0 || z[u] == kInf) {
+        EXPECT_EQ(actual, Vector3f::Constant(kInf));
+      } else if (std::isnan(z[u])) {
+        EXPECT_TRUE(actual.array().isNaN().all());
+      } else {
+        const double sz = scale * z[u];
+        const Vector3d expected =
+            X_PC * Vector3d(sz * ray_x[u], sz * ray_y, sz);
+        EXPECT_TRUE(CompareMatrices(actual, expected.cast<float>(), 1e-6))
+            << "width = " << width << ", u = " << u;
+      }
+    }
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,99 @@
+#include "drake/perception/point_cloud_index.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3f;
+
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Returns a cloud of points along the x axis at x = 0, 1, 2, ..., with a NaN
+// point at index 2.
+PointCloud MakeLine(int size) {
+  PointCloud cloud(size);
+  for (int i = 0; i < size; ++i) {
+    cloud.mutable_xyz(i) = Vector3f(i, 0, 0);
+  }
+  cloud.mutable_xyz(2) = Vector3f::Constant(kNaN);
+  return cloud;
+}
+
+GTEST_TEST(PointCloudIndexTest, FindNearest) {
+  PointCloud cloud = MakeLine(10);
+  const PointCloudIndex dut(cloud);
+  EXPECT_EQ(dut.size(), 9);
+  // The index is independent of the cloud.
+  cloud.mutable_xyzs().setZero();
+
+  int indices[3];
+  float squared_distances[3];
+  ASSERT_EQ(dut.FindNearest(Vector3f(2.2, 1, 0), 3, indices, squared_distances),
+            3);
+  // Point 2 is not indexed.
+  EXPECT_EQ(indices[0], 3);
+  EXPECT_EQ(indices[1], 1);
+  EXPECT_EQ(indices[2], 4);
+  EXPECT_NEAR(squared_distances[0], 0.8 * 0.8 + 1, 1e-5);
+  EXPECT_NEAR(squared_distances[1], 1.2 * 1.2 + 1, 1e-5);
+
+  // Asking for more neighbors than there are points.
+  std::vector<int> all_indices(20);
+  std::vector<float> all_distances(20);
+  EXPECT_EQ(dut.FindNearest(Vector3f::Zero(), 20, all_indices.data(),
+                            all_distances.data()),
+            9);
+}
+
+// The batch query gives the same results with and without threads.
+GTEST_TEST(PointCloudIndexTest, FindNearestBatch) {
+  const PointCloudIndex dut(MakeLine(100));
+  Matrix3X<float> queries = Matrix3X<float>::Random(3, 500) * 120;
+  queries.col(7).setConstant(kNaN);
+  std::vector<int> serial_indices, parallel_indices;
+  std::vector<float> serial_distances, parallel_distances;
+  dut.FindNearest(queries, Parallelism(false), &serial_indices,
+                  &serial_distances);
+  dut.FindNearest(queries, Parallelism(4), &parallel_indices,
+                  &parallel_distances);
+  EXPECT_EQ(serial_indices, parallel_indices);
+  EXPECT_EQ(serial_distances, parallel_distances);
+  ASSERT_EQ(serial_indices.size(), 500);
+  EXPECT_EQ(serial_indices[7], -1);
+  EXPECT_EQ(serial_distances[7], std::numeric_limits<float>::infinity());
+  for (int i = 0; i < 500; ++i) {
+    if (i == 7) continue;
+    int expected;
+    float expected_distance;
+    ASSERT_EQ(dut.FindNearest(queries.col(i), 1, &expected,
+                              &expected_distance),
+              1);
+    EXPECT_EQ(serial_indices[i], expected);
+  }
+}
+
+GTEST_TEST(PointCloudIndexTest, Empty) {
+  const PointCloudIndex dut(PointCloud(0));
+  EXPECT_EQ(dut.size(), 0);
+  int index;
+  float squared_distance;
+  EXPECT_EQ(dut.FindNearest(Vector3f::Zero(), 1, &index, &squared_distance),
+            0);
+  std::vector<int> indices;
+  std::vector<float> squared_distances;
+  dut.FindNearest(Matrix3X<float>::Zero(3, 2), false, &indices,
+                  &squared_distances);
+  EXPECT_EQ(indices, std::vector<int>({-1, -1}));
+
+  EXPECT_THROW(PointCloudIndex(PointCloud(3, pc_flags::kNormals)),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
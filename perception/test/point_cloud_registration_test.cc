@@ -0,0 +1,150 @@
+#include "drake/perception/point_cloud_registration.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+// Returns points on three faces of a box corner, which constrain all six
+// degrees of freedom of the pose.
+PointCloud MakeCorner(double spacing) {
+  std::vector<Vector3f> points;
+  for (double a = 0; a <= 0.3; a += spacing) {
+    for (double b = 0; b <= 0.2; b += spacing) {
+      points.emplace_back(a, b, 0);
+    }
+    for (double b = spacing; b <= 0.25; b += spacing) {
+      points.emplace_back(a, 0, b);
+    }
+  }
+  for (double a = spacing; a <= 0.2; a += spacing) {
+    for (double b = spacing; b <= 0.25; b += spacing) {
+      points.emplace_back(0, a, b);
+    }
+  }
+  PointCloud cloud(points.size());
+  for (int i = 0; i < cloud.size(); ++i) {
+    cloud.mutable_xyz(i) = points[i];
+  }
+  return cloud;
+}
+
+// Returns the `cloud` of points in frame T, expressed in frame S.
+PointCloud Express(const PointCloud& cloud, const RigidTransformd& X_TS) {
+  PointCloud result(cloud.size());
+  const RigidTransformd X_ST = X_TS.inverse();
+  for (int i = 0; i < cloud.size(); ++i) {
+    result.mutable_xyz(i) = (X_ST * cloud.xyz(i).cast<double>()).cast<float>();
+  }
+  return result;
+}
+
+class PointCloudRegistrationTest : public ::testing::Test {
+ protected:
+  const RigidTransformd X_TS_{RollPitchYawd(0.05, -0.04, 0.08),
+                              Vector3d(0.02, -0.015, 0.01)};
+  const PointCloud target_cloud_{MakeCorner(0.01)};
+  const RegistrationTarget target_{target_cloud_};
+};
+
+TEST_F(PointCloudRegistrationTest, Target) {
+  EXPECT_EQ(target_.cloud().size(), target_cloud_.size());
+  EXPECT_TRUE(target_.cloud().has_normals());
+  EXPECT_EQ(target_.index().size(), target_cloud_.size());
+  // Away from the edges, the normals are estimated exactly.
+  const auto normals = target_.cloud().normals();
+  for (int i = 0; i < target_cloud_.size(); ++i) {
+    const Vector3f& p = target_cloud_.xyz(i);
+    if (p.z() == 0 && p.x() > 0.05 && p.y() > 0.05 && p.x() < 0.25 &&
+        p.y() < 0.15) {
+      EXPECT_NEAR(std::abs(normals(2, i)), 1.0, 1e-5);
+    }
+  }
+
+  // Given normals are used as-is.
+  PointCloud with_normals(2, pc_flags::kXYZs | pc_flags::kNormals);
+  with_normals.mutable_xyzs().setZero();
+  with_normals.mutable_normals().setConstant(0.5);
+  const RegistrationTarget given(with_normals);
+  EXPECT_TRUE(CompareMatrices(given.cloud().normals(),
+                              with_normals.normals()));
+
+  EXPECT_THROW(RegistrationTarget(target_cloud_, 2), std::exception);
+}
+
+TEST_F(PointCloudRegistrationTest, PointToPlane) {
+  const PointCloud source = Express(target_cloud_, X_TS_);
+  const IcpResult result =
+      PointToPlaneIcp(source, target_, RigidTransformd(), {});
+  EXPECT_TRUE(result.converged);
+  EXPECT_GT(result.num_iterations, 1);
+  EXPECT_EQ(result.num_correspondences, source.size());
+  EXPECT_LT(result.rmse, 1e-5);
+  EXPECT_TRUE(result.X_TS.IsNearlyEqualTo(X_TS_, 1e-5));
+}
+
+TEST_F(PointCloudRegistrationTest, Generalized) {
+  const PointCloud source = Express(target_cloud_, X_TS_);
+  const IcpResult result =
+      GeneralizedIcp(source, target_, RigidTransformd(), {});
+  EXPECT_TRUE(result.converged);
+  EXPECT_TRUE(result.X_TS.IsNearlyEqualTo(X_TS_, 1e-5));
+}
+
+// With noise and gross outliers in the source, the robust Generalized-ICP
+// still finds the pose, and the result doesn't depend on the number of
+// threads.
+TEST_F(PointCloudRegistrationTest, RobustAndDeterministic) {
+  PointCloud source = Express(MakeCorner(0.015), X_TS_);
+  std::srand(1234);
+  source.mutable_xyzs() += 0.001 * Matrix3X<float>::Random(3, source.size());
+  // Every tenth point is an outlier, a few centimeters off the surface.
+  for (int i = 0; i < source.size(); i += 10) {
+    source.mutable_xyz(i) += Vector3f(0.02, -0.02, 0.02);
+  }
+  source.mutable_xyz(1) = Vector3f::Constant(
+      std::numeric_limits<float>::quiet_NaN());
+  const IcpParams params{.max_iterations = 50, .huber_threshold = 0.002};
+  const IcpResult serial =
+      GeneralizedIcp(source, target_, RigidTransformd(), params, false);
+  const IcpResult parallel =
+      GeneralizedIcp(source, target_, RigidTransformd(), params, 4);
+  EXPECT_TRUE(serial.converged);
+  EXPECT_TRUE(serial.X_TS.IsNearlyEqualTo(X_TS_, 2e-3));
+  EXPECT_TRUE(parallel.X_TS.IsExactlyEqualTo(serial.X_TS));
+  EXPECT_EQ(parallel.num_iterations, serial.num_iterations);
+
+  const IcpResult point_to_plane =
+      PointToPlaneIcp(source, target_, RigidTransformd(),
+                      {.max_iterations = 50, .huber_threshold = 0.002}, 4);
+  EXPECT_TRUE(point_to_plane.X_TS.IsNearlyEqualTo(X_TS_, 2e-3));
+}
+
+// Without any correspondences, the initial guess is returned.
+TEST_F(PointCloudRegistrationTest, NoCorrespondences) {
+  const PointCloud source = Express(target_cloud_, RigidTransformd(
+      Vector3d(1, 0, 0)));
+  const IcpResult result = PointToPlaneIcp(source, target_, X_TS_);
+  EXPECT_FALSE(result.converged);
+  EXPECT_EQ(result.num_iterations, 0);
+  EXPECT_EQ(result.num_correspondences, 0);
+  EXPECT_TRUE(std::isnan(result.rmse));
+  EXPECT_TRUE(result.X_TS.IsExactlyEqualTo(X_TS_));
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
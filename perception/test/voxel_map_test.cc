@@ -0,0 +1,250 @@
+#include "drake/perception/voxel_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/ssize.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+// The voxel keys, ordered lexicographically.
+struct KeyLess {
+  bool operator()(const VoxelMap::Key& a, const VoxelMap::Key& b) const {
+    return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                        b.data() + 3);
+  }
+};
+
+class VoxelMapTest : public ::testing::Test {
+ protected:
+  // Returns the points that DepthImageToPointCloud would compute for a
+  // constant depth image, in the world frame.
+  std::vector<Vector3d> BackProject(const RigidTransformd& X_WC,
+                                    float depth) const {
+    std::vector<Vector3d> result;
+    for (int v = 0; v < camera_.height(); ++v) {
+      for (int u = 0; u < camera_.width(); ++u) {
+        result.push_back(
+            X_WC * Vector3d(depth * (u - camera_.center_x()) /
+                                camera_.focal_x(),
+                            depth * (v - camera_.center_y()) /
+                                camera_.focal_y(),
+                            depth));
+      }
+    }
+    return result;
+  }
+
+  // Returns the centroids of the points in each voxel, like
+  // PointCloud::VoxelizedDownSample() does.
+  std::map<VoxelMap::Key, Vector3d, KeyLess> Voxelize(
+      const VoxelMap& map, const std::vector<Vector3d>& points) const {
+    std::map<VoxelMap::Key, std::pair<Vector3d, int>, KeyLess> sums;
+    for (const Vector3d& p : points) {
+      auto& [sum, count] = sums[map.GetKey(p)];
+      if (count == 0) sum.setZero();
+      sum += p;
+      ++count;
+    }
+    std::map<VoxelMap::Key, Vector3d, KeyLess> result;
+    for (const auto& [key, sum_and_count] : sums) {
+      result[key] = sum_and_count.first / sum_and_count.second;
+    }
+    return result;
+  }
+
+  ImageDepth32F MakeImage(float depth) const {
+    return ImageDepth32F(camera_.width(), camera_.height(), depth);
+  }
+
+  const CameraInfo camera_{160, 120, M_PI / 4};
+  VoxelMapParams params_{.voxel_size = 0.02, .truncation_distance = 0.06};
+};
+
+TEST_F(VoxelMapTest, BadParams) {
+  EXPECT_NO_THROW(VoxelMap(VoxelMapParams{}));
+  EXPECT_THROW(VoxelMap({.voxel_size = 0}), std::exception);
+  EXPECT_THROW(VoxelMap({.truncation_distance = 0}), std::exception);
+  EXPECT_THROW(VoxelMap({.max_weight = 0.01}), std::exception);
+  EXPECT_THROW(VoxelMap({.decay_rate = -1}), std::exception);
+  EXPECT_THROW(VoxelMap({.min_weight = 0}), std::exception);
+}
+
+TEST_F(VoxelMapTest, Keys) {
+  const VoxelMap map({.voxel_size = 0.1});
+  EXPECT_EQ(map.GetKey(Vector3d(0.05, -0.05, 0.25)),
+            VoxelMap::Key(0, -1, 2));
+  EXPECT_EQ(map.GetKey(Vector3d(-0.1, 0.0, 0.1)), VoxelMap::Key(-1, 0, 1));
+  EXPECT_TRUE(CompareMatrices(map.GetCenter(VoxelMap::Key(0, -1, 2)),
+                              Vector3d(0.05, -0.05, 0.25), 1e-15));
+  EXPECT_EQ(map.Find(VoxelMap::Key(0, 0, 0)), nullptr);
+}
+
+// Integrating a plane seen by two cameras produces one point per voxel of the
+// plane, at the centroid of the points of both cameras within it. The signed
+// distance is positive in front of the plane and negative behind it.
+TEST_F(VoxelMapTest, IntegratePlane) {
+  VoxelMap map(params_);
+  // Both cameras look along +z at the plane z = 0.71.
+  const RigidTransformd X_WC1(Vector3d(0.013, 0.021, -0.29));
+  const RigidTransformd X_WC2(Vector3d(-0.1, 0.05, -0.49));
+  map.Integrate(camera_, X_WC1, MakeImage(1.0));
+  map.Integrate(camera_, X_WC2, MakeImage(1.2));
+
+  std::vector<Vector3d> points = BackProject(X_WC1, 1.0);
+  const std::vector<Vector3d> points2 = BackProject(X_WC2, 1.2);
+  points.insert(points.end(), points2.begin(), points2.end());
+  const auto expected = Voxelize(map, points);
+
+  // The points are ordered by their keys.
+  const PointCloud cloud = map.ToPointCloud();
+  ASSERT_EQ(cloud.size(), ssize(expected));
+  auto iter = expected.begin();
+  for (int i = 0; i < cloud.size(); ++i, ++iter) {
+    const Vector3d p = cloud.xyz(i).cast<double>();
+    EXPECT_EQ(map.GetKey(p), iter->first);
+    EXPECT_TRUE(CompareMatrices(p, iter->second, 1e-6));
+  }
+
+  // Walk along the optical axis of the first camera.
+  const Vector3d p_WS = X_WC1 * Vector3d(0, 0, 1.0);
+  const VoxelMap::Voxel* surface = map.Find(map.GetKey(p_WS));
+  ASSERT_NE(surface, nullptr);
+  EXPECT_LE(std::abs(surface->tsdf), params_.voxel_size);
+  EXPECT_GT(surface->weight, 0);
+  const VoxelMap::Voxel* front =
+      map.Find(map.GetKey(p_WS - Vector3d(0, 0, 0.04)));
+  ASSERT_NE(front, nullptr);
+  EXPECT_GT(front->tsdf, 0.01);
+  const VoxelMap::Voxel* back =
+      map.Find(map.GetKey(p_WS + Vector3d(0, 0, 0.04)));
+  ASSERT_NE(back, nullptr);
+  EXPECT_LT(back->tsdf, -0.01);
+  // Nothing is allocated beyond the truncation distance.
+  EXPECT_EQ(map.Find(map.GetKey(p_WS - Vector3d(0, 0, 0.1))), nullptr);
+  EXPECT_EQ(map.Find(map.GetKey(p_WS + Vector3d(0, 0, 0.1))), nullptr);
+}
+
+// Invalid depths are ignored.
+TEST_F(VoxelMapTest, InvalidDepths) {
+  VoxelMap map(params_);
+  const float kInf = std::numeric_limits<float>::infinity();
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  map.Integrate(camera_, {}, MakeImage(0.0));
+  map.Integrate(camera_, {}, MakeImage(kInf));
+  map.Integrate(camera_, {}, MakeImage(kNaN));
+  EXPECT_EQ(map.size(), 0);
+
+  EXPECT_THROW(map.Integrate(camera_, {}, ImageDepth32F(10, 10, 1.0f)),
+               std::exception);
+}
+
+// When the plane moves by less than the truncation distance, the voxels of its
+// old position are found to be in free space, and are no longer reported.
+TEST_F(VoxelMapTest, FreeSpace) {
+  VoxelMap map(params_);
+  const RigidTransformd X_WC(Vector3d(0, 0, -0.29));
+  map.Integrate(camera_, X_WC, MakeImage(1.0));
+  for (int i = 0; i < 20; ++i) {
+    map.Integrate(camera_, X_WC, MakeImage(1.04));
+  }
+  const PointCloud cloud = map.ToPointCloud();
+  ASSERT_GT(cloud.size(), 0);
+  for (int i = 0; i < cloud.size(); ++i) {
+    EXPECT_NEAR(cloud.xyz(i).z(), 0.75, 1e-5);
+  }
+}
+
+// Copies of a map share the voxels that neither copy has modified, so that
+// integrating an image into a copy only copies the voxels near the image's
+// surfaces, however large the map is.
+TEST_F(VoxelMapTest, CopyOnWrite) {
+  const RigidTransformd X_WC(Vector3d(0, 0, -0.29));
+  // Returns the number of voxels of the copy of `map` that are no longer
+  // shared with it after integrating an image into the copy.
+  auto count_copied = [&](const VoxelMap& map) {
+    VoxelMap copy = map;
+    for (const VoxelMap::Key& key : map.GetKeys()) {
+      EXPECT_EQ(copy.Find(key), map.Find(key));
+    }
+    copy.Integrate(camera_, X_WC, MakeImage(1.0));
+    int result = 0;
+    for (const VoxelMap::Key& key : copy.GetKeys()) {
+      if (copy.Find(key) != map.Find(key)) {
+        ++result;
+      }
+    }
+    return result;
+  };
+
+  // The images of the cameras that built the maps don't overlap with the
+  // image integrated into the copies.
+  VoxelMap small(params_);
+  small.Integrate(camera_, RigidTransformd(Vector3d(0, 0, 2)), MakeImage(1.0));
+  VoxelMap large = small;
+  for (int i = 1; i <= 10; ++i) {
+    large.Integrate(camera_, RigidTransformd(Vector3d(0, 0, 2 + 0.5 * i)),
+                    MakeImage(1.0));
+  }
+  ASSERT_GT(large.size(), 5 * small.size());
+  const int num_copied = count_copied(small);
+  EXPECT_GT(num_copied, 0);
+  EXPECT_EQ(count_copied(large), num_copied);
+
+  // Modifying the copy leaves the original as it was.
+  const int small_size = small.size();
+  const PointCloud small_cloud = small.ToPointCloud();
+  VoxelMap copy = small;
+  copy.Integrate(camera_, {}, MakeImage(3.0));
+  EXPECT_EQ(small.size(), small_size);
+  EXPECT_TRUE(CompareMatrices(small.ToPointCloud().xyzs(),
+                              small_cloud.xyzs()));
+}
+
+TEST_F(VoxelMapTest, Decay) {
+  params_.decay_rate = 1.0;
+  params_.min_weight = 0.5;
+  VoxelMap map(params_);
+  map.Integrate(camera_, {}, MakeImage(1.0));
+  const VoxelMap original = map;
+  ASSERT_GT(original.size(), 0);
+
+  map.Decay(0.1);
+  EXPECT_EQ(map.size(), original.size());
+  for (const VoxelMap::Key& key : map.GetKeys()) {
+    const VoxelMap::Voxel& voxel = *map.Find(key);
+    const VoxelMap::Voxel* before = original.Find(key);
+    ASSERT_NE(before, nullptr);
+    EXPECT_NEAR(voxel.weight, before->weight * std::exp(-0.1), 1e-6);
+    EXPECT_EQ(voxel.tsdf, before->tsdf);
+  }
+  // The decay doesn't move the points.
+  const PointCloud cloud = map.ToPointCloud();
+  const PointCloud original_cloud = original.ToPointCloud();
+  ASSERT_EQ(cloud.size(), original_cloud.size());
+  EXPECT_TRUE(CompareMatrices(cloud.xyzs(), original_cloud.xyzs(), 1e-6));
+
+  // Eventually, everything is forgotten.
+  map.Decay(10.0);
+  EXPECT_EQ(map.size(), 0);
+
+  EXPECT_THROW(map.Decay(-1.0), std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,250 @@
+#include "drake/perception/voxel_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+VoxelMap::VoxelMap(const VoxelMapParams& params) : params_(params) {
+  DRAKE_THROW_UNLESS(params.voxel_size > 0);
+  DRAKE_THROW_UNLESS(params.truncation_distance > 0);
+  DRAKE_THROW_UNLESS(params.min_weight > 0);
+  DRAKE_THROW_UNLESS(params.min_weight <= params.max_weight);
+  DRAKE_THROW_UNLESS(params.decay_rate >= 0);
+}
+
+size_t VoxelMap::KeyHash::operator()(const Key& key) const {
+  // The classic spatial hash of Teschner et al., "Optimized Spatial Hashing
+  // for Collision Detection of Deformable Objects" (2003).
+  return static_cast<size_t>((key.x() * 73856093) ^ (key.y() * 19349663) ^
+                             (key.z() * 83492791));
+}
+
+VoxelMap::Key VoxelMap::GetKey(const Vector3d& p_W) const {
+  return (p_W / params_.voxel_size).array().floor().cast<int64_t>();
+}
+
+Vector3d VoxelMap::GetCenter(const Key& key) const {
+  return (key.cast<double>().array() + 0.5) * params_.voxel_size;
+}
+
+namespace {
+
+// Returns the key of the block that contains the voxel with the given key,
+// and the index of the voxel within the block.
+std::pair<VoxelMap::Key, int> SplitKey(const VoxelMap::Key& key) {
+  // The arithmetic shift rounds toward negative infinity.
+  const VoxelMap::Key block_key(key.x() >> 3, key.y() >> 3, key.z() >> 3);
+  const VoxelMap::Key offset = key - 8 * block_key;
+  return {block_key, static_cast<int>(offset.x() * 64 + offset.y() * 8 +
+                                      offset.z())};
+}
+
+// The inverse of SplitKey().
+VoxelMap::Key JoinKey(const VoxelMap::Key& block_key, int index) {
+  return 8 * block_key + VoxelMap::Key(index / 64, (index / 8) % 8, index % 8);
+}
+
+// The voxel keys, ordered lexicographically.
+bool KeyLess(const VoxelMap::Key& a, const VoxelMap::Key& b) {
+  return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                      b.data() + 3);
+}
+
+}  // namespace
+
+const VoxelMap::Voxel* VoxelMap::Find(const Key& key) const {
+  const auto [block_key, index] = SplitKey(key);
+  const auto iter = blocks_.find(block_key);
+  if (iter == blocks_.end() || !iter->second->allocated[index]) {
+    return nullptr;
+  }
+  return &iter->second->voxels[index];
+}
+
+VoxelMap::Voxel& VoxelMap::GetMutableVoxel(const Key& key) {
+  const auto [block_key, index] = SplitKey(key);
+  std::shared_ptr<Block>& block = blocks_[block_key];
+  if (block == nullptr) {
+    block = std::make_shared<Block>();
+  } else if (block.use_count() > 1) {
+    block = std::make_shared<Block>(*block);
+  }
+  if (!block->allocated[index]) {
+    block->allocated[index] = true;
+    block->voxels[index] = Voxel{};
+    ++size_;
+  }
+  return block->voxels[index];
+}
+
+void VoxelMap::UpdateTsdf(const Key& key, float sdf) {
+  Voxel& voxel = GetMutableVoxel(key);
+  voxel.tsdf = (voxel.tsdf * voxel.weight + sdf) / (voxel.weight + 1.0f);
+  voxel.weight = std::min(voxel.weight + 1.0f,
+                          static_cast<float>(params_.max_weight));
+}
+
+void VoxelMap::Integrate(const CameraInfo& camera_info,
+                         const RigidTransformd& X_WC,
+                         const ImageDepth32F& depth_image) {
+  if (depth_image.width() != camera_info.width() ||
+      depth_image.height() != camera_info.height()) {
+    throw std::logic_error(fmt::format(
+        "VoxelMap::Integrate(): the depth image is {}x{}, but the camera is "
+        "{}x{}",
+        depth_image.width(), depth_image.height(), camera_info.width(),
+        camera_info.height()));
+  }
+  const double s = params_.voxel_size;
+  const double truncation = params_.truncation_distance;
+  const double cx = camera_info.center_x();
+  const double cy = camera_info.center_y();
+  const double fx_inv = 1.0 / camera_info.focal_x();
+  const double fy_inv = 1.0 / camera_info.focal_y();
+  const Vector3d& p_WCo = X_WC.translation();
+  // A segment of length 2 * truncation crosses at most this many voxels.
+  const int max_steps = 3 * (static_cast<int>(std::ceil(2 * truncation / s)) +
+                             2);
+
+  for (int v = 0; v < depth_image.height(); ++v) {
+    for (int u = 0; u < depth_image.width(); ++u) {
+      const float z = depth_image.at(u, v)[0];
+      if (!std::isfinite(z) || z <= 0) {
+        continue;
+      }
+      const Vector3d p_WS =
+          X_WC * Vector3d(z * (u - cx) * fx_inv, z * (v - cy) * fy_inv, z);
+      const Vector3d ray_W = p_WS - p_WCo;
+      const double range = ray_W.norm();
+      const Vector3d dir_W = ray_W / range;
+
+      Voxel& surface_voxel = GetMutableVoxel(GetKey(p_WS));
+      surface_voxel.point_sum += p_WS;
+      surface_voxel.point_weight += 1.0;
+
+      // Walk the voxels crossed by the segment a -> b of the ray within the
+      // truncation distance of the surface point, visiting each exactly once
+      // (Amanatides and Woo, "A Fast Voxel Traversal Algorithm for Ray
+      // Tracing", 1987).
+      const Vector3d a = p_WS - truncation * dir_W;
+      const Vector3d b = p_WS + truncation * dir_W;
+      const Vector3d delta = b - a;
+      Key key = GetKey(a);
+      const Key last = GetKey(b);
+      Vector3<int64_t> step;
+      Vector3d t_max;
+      Vector3d t_delta;
+      for (int i = 0; i < 3; ++i) {
+        if (delta[i] > 0) {
+          step[i] = 1;
+          t_max[i] = ((key[i] + 1) * s - a[i]) / delta[i];
+          t_delta[i] = s / delta[i];
+        } else if (delta[i] < 0) {
+          step[i] = -1;
+          t_max[i] = (key[i] * s - a[i]) / delta[i];
+          t_delta[i] = -s / delta[i];
+        } else {
+          step[i] = 0;
+          t_max[i] = std::numeric_limits<double>::infinity();
+          t_delta[i] = std::numeric_limits<double>::infinity();
+        }
+      }
+      for (int k = 0; k < max_steps; ++k) {
+        const double sdf = range - (GetCenter(key) - p_WCo).dot(dir_W);
+        UpdateTsdf(key, static_cast<float>(std::clamp(sdf, -truncation,
+                                                      truncation)));
+        if (key == last) {
+          break;
+        }
+        int axis;
+        if (t_max.minCoeff(&axis) > 1.0) {
+          break;
+        }
+        key[axis] += step[axis];
+        t_max[axis] += t_delta[axis];
+      }
+    }
+  }
+}
+
+void VoxelMap::Decay(double dt) {
+  DRAKE_THROW_UNLESS(dt >= 0);
+  if (params_.decay_rate == 0) {
+    return;
+  }
+  const double factor = std::exp(-params_.decay_rate * dt);
+  for (auto iter = blocks_.begin(); iter != blocks_.end();) {
+    std::shared_ptr<Block>& block = iter->second;
+    if (block.use_count() > 1) {
+      block = std::make_shared<Block>(*block);
+    }
+    for (int i = 0; i < 512; ++i) {
+      if (!block->allocated[i]) {
+        continue;
+      }
+      Voxel& voxel = block->voxels[i];
+      voxel.weight *= factor;
+      voxel.point_sum *= factor;
+      voxel.point_weight *= factor;
+      if (voxel.weight < params_.min_weight) {
+        block->allocated[i] = false;
+        --size_;
+      }
+    }
+    if (block->allocated.none()) {
+      iter = blocks_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+std::vector<VoxelMap::Key> VoxelMap::GetKeys() const {
+  std::vector<Key> keys;
+  keys.reserve(size_);
+  for (const auto& [block_key, block] : blocks_) {
+    for (int i = 0; i < 512; ++i) {
+      if (block->allocated[i]) {
+        keys.push_back(JoinKey(block_key, i));
+      }
+    }
+  }
+  std::sort(keys.begin(), keys.end(), KeyLess);
+  return keys;
+}
+
+PointCloud VoxelMap::ToPointCloud() const {
+  std::vector<const Voxel*> occupied;
+  occupied.reserve(size_);
+  for (const Key& key : GetKeys()) {
+    const Voxel& voxel = *Find(key);
+    if (voxel.point_weight > 0 && std::abs(voxel.tsdf) <= params_.voxel_size) {
+      occupied.push_back(&voxel);
+    }
+  }
+  PointCloud cloud(static_cast<int>(occupied.size()), pc_flags::kXYZs,
+                   /* skip_initialize = */ true);
+  auto xyzs = cloud.mutable_xyzs();
+  for (int i = 0; i < static_cast<int>(occupied.size()); ++i) {
+    xyzs.col(i) =
+        (occupied[i]->point_sum / occupied[i]->point_weight).cast<float>();
+  }
+  return cloud;
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/name_value.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+
+/// The parameters of a VoxelMap.
+struct VoxelMapParams {
+  /// Passes this object to an Archive.
+  /// Refer to @ref yaml_serialization "YAML Serialization" for background.
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(voxel_size));
+    a->Visit(DRAKE_NVP(truncation_distance));
+    a->Visit(DRAKE_NVP(max_weight));
+    a->Visit(DRAKE_NVP(decay_rate));
+    a->Visit(DRAKE_NVP(min_weight));
+  }
+
+  /// The edge length of the (cubic) voxels, in meters.
+  double voxel_size{0.01};
+
+  /// The signed distances stored in the voxels are truncated to
+  /// [-truncation_distance, truncation_distance]; only the voxels within this
+  /// distance of an observed surface (along the camera ray) are updated. It is
+  /// typically a small multiple of the voxel size.
+  double truncation_distance{0.04};
+
+  /// The weight of a voxel saturates at this value, so that the map keeps
+  /// adapting to changes in the scene after many observations.
+  double max_weight{64.0};
+
+  /// The rate (in 1/s) at which the weights of the voxels decay
+  /// exponentially; see VoxelMap::Decay(). Zero disables the decay.
+  double decay_rate{0.0};
+
+  /// Voxels whose weight decays below this value are removed from the map.
+  double min_weight{0.1};
+};
+
+/// A sparse, voxel-hashed truncated signed distance field (TSDF) that fuses
+/// depth images from any number of cameras over time.
+///
+/// Voxels are allocated on demand near the observed surfaces, and are keyed
+/// exactly like PointCloud::VoxelizedDownSample(): the voxel with the integer
+/// key (i, j, k) spans [i s, (i + 1) s) x [j s, (j + 1) s) x [k s, (k + 1) s),
+/// where s is the voxel size. Besides the signed distance to the surface, each
+/// voxel accumulates the (weighted) mean of the observed surface points that
+/// lie within it. Thus ToPointCloud() produces the cloud that
+/// VoxelizedDownSample() would produce for the union of all the integrated
+/// points (up to the decay and the free space carved by later observations),
+/// without ever building that union.
+///
+/// All positions are expressed in a common frame, called the world frame W
+/// here.
+///
+/// The voxels are stored in blocks of 8x8x8 voxels, which copies of the map
+/// share until one of the copies modifies them (copy-on-write). Copying a map
+/// only copies the pointers to its blocks, so that a copy which then
+/// integrates a depth image only pays for the blocks near the newly observed
+/// surfaces, no matter how large the map is. (Decay() modifies every voxel, so
+/// it copies every shared block.)
+class VoxelMap final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(VoxelMap);
+
+  /// The integer coordinates of a voxel.
+  using Key = Vector3<int64_t>;
+
+  /// The data stored in each voxel.
+  struct Voxel {
+    /// The weighted average of the truncated signed distance (in meters) from
+    /// the voxel center to the observed surfaces, measured along the camera
+    /// rays. It is positive in front of the surfaces (in free space).
+    float tsdf{};
+    /// The total weight of the observations of `tsdf`.
+    float weight{};
+    /// The weighted sum of the surface points observed within this voxel.
+    Eigen::Vector3d point_sum{Eigen::Vector3d::Zero()};
+    /// The total weight of the points in `point_sum`.
+    double point_weight{};
+  };
+
+  /// Constructs an empty map.
+  /// @throws std::exception if `voxel_size` or `truncation_distance` are not
+  /// positive, or if the weights are not positive with
+  /// `min_weight <= max_weight`, or if `decay_rate` is negative.
+  explicit VoxelMap(const VoxelMapParams& params = {});
+
+  const VoxelMapParams& params() const { return params_; }
+
+  /// Returns the number of allocated voxels.
+  int size() const { return size_; }
+
+  /// Returns the key of the voxel that contains `p_W`.
+  Key GetKey(const Eigen::Vector3d& p_W) const;
+
+  /// Returns the center of the voxel with the given key.
+  Eigen::Vector3d GetCenter(const Key& key) const;
+
+  /// Returns the voxel with the given key, or nullptr if it is not allocated.
+  const Voxel* Find(const Key& key) const;
+
+  /// Removes all voxels.
+  void Clear() {
+    blocks_.clear();
+    size_ = 0;
+  }
+
+  /// Integrates a depth image into the map. Each pixel with a valid depth
+  /// (i.e., finite and not ImageTraits::kTooClose) updates the voxels within
+  /// the truncation distance of its surface point along its camera ray.
+  /// Pixels are back-projected exactly like DepthImageToPointCloud does.
+  /// @param camera_info The intrinsics of the camera.
+  /// @param X_WC The pose of the camera in the world.
+  /// @param depth_image The depth image, in meters.
+  /// @throws std::exception if the size of `depth_image` doesn't match
+  /// `camera_info`.
+  void Integrate(const systems::sensors::CameraInfo& camera_info,
+                 const math::RigidTransformd& X_WC,
+                 const systems::sensors::ImageDepth32F& depth_image);
+
+  /// Decays the weights of all voxels by the factor exp(-decay_rate * dt),
+  /// and removes the voxels whose weight falls below `min_weight`. This lets
+  /// the map forget surfaces that are no longer observed.
+  /// @throws std::exception if `dt` is negative.
+  void Decay(double dt);
+
+  /// Returns a point cloud (with xyzs only) with one point per occupied
+  /// voxel: the mean of the surface points observed within it. A voxel is
+  /// occupied if it contains surface points and its signed distance is within
+  /// a voxel size of zero; voxels that later observations found to be in free
+  /// space are omitted. The points are in the order of GetKeys().
+  PointCloud ToPointCloud() const;
+
+  /// Returns the keys of all of the allocated voxels, in lexicographic order.
+  std::vector<Key> GetKeys() const;
+
+ private:
+  // The voxels with the keys 8 b + (0..7, 0..7, 0..7), for a block key b.
+  struct Block {
+    std::array<Voxel, 512> voxels;
+    std::bitset<512> allocated;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  // Returns the voxel with the given key, allocating it if needed. The block
+  // that contains it is copied first if it is shared with another map.
+  Voxel& GetMutableVoxel(const Key& key);
+
+  // Updates the voxel with the given key with the signed distance `sdf`.
+  void UpdateTsdf(const Key& key, float sdf);
+
+  VoxelMapParams params_;
+  // The blocks, keyed by block key. No block is empty.
+  std::unordered_map<Key, std::shared_ptr<Block>, KeyHash> blocks_;
+  int size_{0};
+};
+
+}  // namespace perception
+}  // namespace drake
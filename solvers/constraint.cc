@@ -922,6 +922,15 @@ ExpressionConstraint::ExpressionConstraint(
   std::tie(vars_, map_var_to_index_) =
       symbolic::ExtractVariablesFromExpression(expressions_);
 
+  tape_ = symbolic::ExpressionTape::TryMake(
+      expressions_, std::vector<symbolic::Variable>(
+                        vars_.data(), vars_.data() + vars_.size()));
+  if (tape_.has_value()) {
+    return;
+  }
+  // The tape doesn't support some of the expressions; fall back to the
+  // symbolic evaluation below.
+
   derivatives_ = symbolic::Jacobian(expressions_, vars_);
 
   // Setup the environment.
@@ -934,6 +943,11 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
                                   Eigen::VectorXd* y) const {
   DRAKE_THROW_UNLESS(x.rows() == vars_.rows());
 
+  if (tape_.has_value()) {
+    tape_->Evaluate(x, y, &workspace_);
+    return;
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id()));
@@ -950,6 +964,16 @@ void ExpressionConstraint::DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
                                   AutoDiffVecXd* y) const {
   DRAKE_THROW_UNLESS(x.rows() == vars_.rows());
 
+  if (tape_.has_value()) {
+    // Using ∂y/∂z = ∂f/∂x ∂x/∂z.
+    Eigen::VectorXd y_value;
+    Eigen::MatrixXd dydx;
+    tape_->EvaluateWithJacobian(math::ExtractValue(x), &y_value, &dydx,
+                                &workspace_);
+    math::InitializeAutoDiff(y_value, dydx * math::ExtractGradient(x), y);
+    return;
+  }
+
   // Set environment with current x values.
   for (int i = 0; i < vars_.size(); i++) {
     environment_[vars_[i]] = x(map_var_to_index_.at(vars_[i].get_id())).value();
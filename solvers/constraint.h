@@ -19,6 +19,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/polynomial.h"
 #include "drake/common/symbolic/expression.h"
+#include "drake/common/symbolic/expression_tape.h"
 #include "drake/solvers/decision_variable.h"
 #include "drake/solvers/evaluator_base.h"
 #include "drake/solvers/function.h"
@@ -1110,10 +1111,16 @@ class LinearMatrixInequalityConstraint : public Constraint {
 
 /**
  * Impose a generic (potentially nonlinear) constraint represented as a
- * vector of symbolic Expression.  Expression::Evaluate is called on every
- * constraint evaluation.
+ * vector of symbolic Expression.
  *
- * Uses symbolic::Jacobian to provide the gradients to the AutoDiff method.
+ * The expressions are compiled into a symbolic::ExpressionTape upon
+ * construction, which evaluates them (and, for the AutoDiff method, their
+ * gradients) without walking the expression trees. Expressions that the tape
+ * does not support (if-then-else expressions and uninterpreted functions)
+ * fall back to Expression::Evaluate and symbolic::Jacobian on every
+ * evaluation. Either way, evaluating a function outside of its domain (e.g.,
+ * `log(x)` at a negative `x`, or a division by zero) throws, as
+ * Expression::Evaluate does.
  *
  * @ingroup solver_evaluators
  */
@@ -1155,13 +1162,19 @@ class ExpressionConstraint : public Constraint {
 
  private:
   VectorX<symbolic::Expression> expressions_{0};
-  MatrixX<symbolic::Expression> derivatives_{0, 0};
 
   // map_var_to_index_[vars_(i).get_id()] = i.
   VectorXDecisionVariable vars_{0};
   std::unordered_map<symbolic::Variable::Id, int> map_var_to_index_;
 
+  // The compiled expressions_, with vars_ as the parameters. This is nullopt
+  // when the tape doesn't support the expressions, in which case the
+  // symbolic derivatives_ are used instead.
+  std::optional<symbolic::ExpressionTape> tape_;
+  MatrixX<symbolic::Expression> derivatives_{0, 0};
+
   // Only for caching, does not carrying hidden state.
+  mutable symbolic::ExpressionTape::Workspace workspace_;
   mutable symbolic::Environment environment_;
 };
 
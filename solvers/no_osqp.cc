@@ -7,6 +7,18 @@
 namespace drake {
 namespace solvers {
 
+struct OsqpSolver::Workspace {};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(id(), &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
+void OsqpSolver::SetPersistentWorkspace(bool persistent) {
+  persistent_workspace_ = persistent;
+}
+
 bool OsqpSolver::is_available() {
   return false;
 }
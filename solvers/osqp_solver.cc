@@ -1,7 +1,10 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <osqp.h>
@@ -15,8 +18,9 @@
 // This function must appear in the global namespace -- the Serialize pattern
 // uses ADL (argument-dependent lookup) and the namespace for the OSQPSettings
 // struct is the global namespace. (We can't even use an anonymous namespace!)
+template <typename Archive>
 static void Serialize(
-    drake::solvers::internal::SpecificOptions* archive,
+    Archive* archive,
     // NOLINTNEXTLINE(runtime/references) to match Serialize concept.
     OSQPSettings& settings) {
   using drake::MakeNameValue;
@@ -52,6 +56,42 @@ static void Serialize(
 namespace drake {
 namespace solvers {
 namespace {
+// An archive that flattens the OSQPSettings fields visited by Serialize() into
+// a vector, so that two settings can be compared.
+struct SettingsFlattener {
+  template <typename NameValuePair>
+  void Visit(const NameValuePair& nvp) {
+    values.push_back(static_cast<double>(*nvp.value()));
+  }
+
+  std::vector<double> values;
+};
+
+std::vector<double> FlattenSettings(OSQPSettings* settings) {
+  SettingsFlattener flattener;
+  Serialize(&flattener, *settings);
+  return std::move(flattener.values);
+}
+
+// Returns true iff the compressed matrices `a` and `b` have the same size and
+// sparsity pattern.
+bool HaveSameSparsity(const Eigen::SparseMatrix<c_float>& a,
+                      const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true iff the compressed matrices `a` and `b`, which have the same
+// sparsity pattern, have the same values.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
 void ParseQuadraticCosts(const MathematicalProgram& prog,
                          Eigen::SparseMatrix<c_float>* P_upper,
                          std::vector<c_float>* q, double* constant_cost_term) {
@@ -249,6 +289,34 @@ void SetDualSolution(
 }
 }  // namespace
 
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace);
+
+  Workspace() = default;
+  ~Workspace() { osqp_cleanup(work); }
+
+  OSQPWorkspace* work{nullptr};
+
+  // The data that `work` currently holds (before OSQP's own scaling), and the
+  // flattened settings it was set up with.
+  Eigen::SparseMatrix<c_float> P_upper;
+  Eigen::SparseMatrix<c_float> A;
+  std::vector<double> settings;
+};
+
+OsqpSolver::OsqpSolver()
+    : SolverBase(id(), &is_available, &is_enabled, &ProgramAttributesSatisfied,
+                 &UnsatisfiedProgramAttributes) {}
+
+OsqpSolver::~OsqpSolver() = default;
+
+void OsqpSolver::SetPersistentWorkspace(bool persistent) {
+  persistent_workspace_ = persistent;
+  if (!persistent) {
+    workspace_.reset();
+  }
+}
+
 bool OsqpSolver::is_available() {
   return true;
 }
@@ -283,20 +351,6 @@ void OsqpSolver::DoSolve2(const MathematicalProgram& prog,
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_upper_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
   // Create the settings, initialized to the upstream defaults.
   OSQPSettings* settings =
       static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
@@ -313,18 +367,86 @@ void OsqpSolver::DoSolve2(const MathematicalProgram& prog,
     // kMaxThreads option.
   });
   options->CopyToSerializableStruct(settings);
+  std::vector<double> settings_values = FlattenSettings(settings);
 
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
+  // Take the persistent workspace if it can be reused for this program, or
+  // else discard it. N.B. workspace_ is only touched when it's persistent, so
+  // that solvers without a persistent workspace are safe to share across
+  // threads.
+  std::unique_ptr<Workspace> workspace;
+  if (persistent_workspace_) {
+    if (workspace_ != nullptr && workspace_->settings == settings_values &&
+        HaveSameSparsity(workspace_->P_upper, P_upper_sparse) &&
+        HaveSameSparsity(workspace_->A, A_sparse)) {
+      workspace = std::move(workspace_);
+      solver_details.reused_workspace = true;
+    }
+    workspace_.reset();
+  }
+
+  if (solver_details.reused_workspace) {
+    // Update the data of the workspace in place. Only changes to P or A
+    // require OSQP to refactor the KKT system.
+    OSQPWorkspace* work = workspace->work;
+    const bool P_changed = !HaveSameValues(workspace->P_upper, P_upper_sparse);
+    const bool A_changed = !HaveSameValues(workspace->A, A_sparse);
+    c_int osqp_update_err = 0;
+    if (P_changed && A_changed) {
+      osqp_update_err = osqp_update_P_A(
+          work, P_upper_sparse.valuePtr(), OSQP_NULL, P_upper_sparse.nonZeros(),
+          A_sparse.valuePtr(), OSQP_NULL, A_sparse.nonZeros());
+    } else if (P_changed) {
+      osqp_update_err = osqp_update_P(work, P_upper_sparse.valuePtr(),
+                                      OSQP_NULL, P_upper_sparse.nonZeros());
+    } else if (A_changed) {
+      osqp_update_err = osqp_update_A(work, A_sparse.valuePtr(), OSQP_NULL,
+                                      A_sparse.nonZeros());
+    }
+    if (osqp_update_err == 0) {
+      osqp_update_err = osqp_update_lin_cost(work, q.data());
+    }
+    if (osqp_update_err == 0) {
+      osqp_update_err = osqp_update_bounds(work, l.data(), u.data());
+    }
+    if (osqp_update_err != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+  } else {
+    // Now pass the constraint and cost to osqp data.
+    OSQPData* data = nullptr;
+
+    // Populate data.
+    data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+
+    data->n = prog.num_vars();
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_upper_sparse);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
+
+    // Setup workspace. OSQP copies the data, so we can free it right away.
+    workspace = std::make_unique<Workspace>();
+    const c_int osqp_setup_err = osqp_setup(&workspace->work, data, settings);
     if (osqp_setup_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
     }
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
   }
+  c_free(settings);
+  OSQPWorkspace* work = workspace->work;
 
   if (!solution_result && initial_guess.array().isFinite().all()) {
     const c_int osqp_warm_err = osqp_warm_start_x(work, initial_guess.data());
@@ -343,6 +465,7 @@ void OsqpSolver::DoSolve2(const MathematicalProgram& prog,
   }
 
   // Extract results.
+  const bool solved = !solution_result.has_value();
   if (!solution_result) {
     DRAKE_THROW_UNLESS(work->info != nullptr);
 
@@ -350,7 +473,11 @@ void OsqpSolver::DoSolve2(const MathematicalProgram& prog,
     solver_details.status_val = work->info->status_val;
     solver_details.primal_res = work->info->pri_res;
     solver_details.dual_res = work->info->dua_res;
-    solver_details.setup_time = work->info->setup_time;
+    if (solver_details.reused_workspace) {
+      solver_details.update_time = work->info->update_time;
+    } else {
+      solver_details.setup_time = work->info->setup_time;
+    }
     solver_details.solve_time = work->info->solve_time;
     solver_details.polish_time = work->info->polish_time;
     solver_details.run_time = work->info->run_time;
@@ -410,18 +537,13 @@ void OsqpSolver::DoSolve2(const MathematicalProgram& prog,
   }
   result->set_solution_result(solution_result.value());
 
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
+  // Keep the workspace for the next solve, or clean it up.
+  if (persistent_workspace_ && solved) {
+    workspace->P_upper = std::move(P_upper_sparse);
+    workspace->A = std::move(A_sparse);
+    workspace->settings = std::move(settings_values);
+    workspace_ = std::move(workspace);
+  }
 }
 
 }  // namespace solvers
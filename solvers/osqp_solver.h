@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -20,8 +21,12 @@ struct OsqpSolverDetails {
   double primal_res{};
   /// Norm of dual residue.
   double dual_res{};
-  /// Time taken for setup phase (seconds).
+  /// Time taken for setup phase (seconds). This is zero when the solve reused
+  /// a persistent workspace; see OsqpSolver::SetPersistentWorkspace().
   double setup_time{};
+  /// Time taken to update the data of a reused persistent workspace
+  /// (seconds). This is zero when the solve set up a new workspace.
+  double update_time{};
   /// Time taken for solve phase (seconds).
   double solve_time{};
   /// Time taken for polish phase (seconds).
@@ -35,6 +40,9 @@ struct OsqpSolverDetails {
   /// the problem. Notice that the order of the linear constraints are linear
   /// inequality first, and then linear equality constraints.
   Eigen::VectorXd y{};
+  /// Whether the solve reused the persistent workspace of the previous solve;
+  /// see OsqpSolver::SetPersistentWorkspace().
+  bool reused_workspace{false};
 };
 
 /** A wrapper to call [OSQP](https://osqp.org/) using Drake's
@@ -55,6 +63,9 @@ primal and dual variables inside the OSQP solver, regardless of the solver
 status (whether it is optimal, infeasible, unbounded, etc), except when the
 problem has an invalid input. Users should always check the solver status before
 interpreting the returned primal and dual variables.
+
+For the repeated solves of model predictive control, where each solve only
+changes the coefficients of the same program, see SetPersistentWorkspace().
   */
 class OsqpSolver final : public SolverBase {
  public:
@@ -78,10 +89,38 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets whether this solver keeps its OSQP workspace between calls to
+  /// Solve(). When it does, a solve whose program has the same number of
+  /// variables and constraints, the same sparsity patterns of the quadratic
+  /// cost and constraint matrices, and the same OSQP options as the previous
+  /// solve reuses the previous workspace: its data are updated in place with
+  /// `osqp_update_*()` (which refactors the KKT system only when a matrix
+  /// changed its values), and OSQP warm starts from the previous primal and
+  /// dual solution, unless a finite initial guess is given. Any other solve
+  /// sets up a new workspace, which is then kept in turn. The program is
+  /// still parsed on every solve. See OsqpSolverDetails::reused_workspace.
+  ///
+  /// Because it mutates the kept workspace, Solve() must not be called
+  /// concurrently on the same solver while its workspace is persistent.
+  ///
+  /// Turning the persistent workspace off discards the kept workspace.
+  /// It is off by default.
+  void SetPersistentWorkspace(bool persistent);
+
+  /// Returns whether this solver keeps its workspace between solves; see
+  /// SetPersistentWorkspace().
+  bool persistent_workspace() const { return persistent_workspace_; }
+
  private:
+  // The OSQP workspace kept between solves; see SetPersistentWorkspace().
+  struct Workspace;
+
   void DoSolve2(const MathematicalProgram&, const Eigen::VectorXd&,
                 internal::SpecificOptions*,
                 MathematicalProgramResult*) const final;
+
+  bool persistent_workspace_{false};
+  mutable std::unique_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
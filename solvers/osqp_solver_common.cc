@@ -12,12 +12,6 @@
 namespace drake {
 namespace solvers {
 
-OsqpSolver::OsqpSolver()
-    : SolverBase(id(), &is_available, &is_enabled, &ProgramAttributesSatisfied,
-                 &UnsatisfiedProgramAttributes) {}
-
-OsqpSolver::~OsqpSolver() = default;
-
 SolverId OsqpSolver::id() {
   static const never_destroyed<SolverId> singleton{"OSQP"};
   return singleton.access();
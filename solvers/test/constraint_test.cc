@@ -965,6 +965,65 @@ GTEST_TEST(TestConstraint, ExpressionConstraintIsThreadSafe) {
   EXPECT_FALSE(constraint.is_thread_safe());
 }
 
+// The expressions are evaluated through an ExpressionTape when possible, and
+// symbolically otherwise; both agree with the symbolic Jacobian.
+GTEST_TEST(TestConstraint, ExpressionConstraintTapeAndFallback) {
+  Variable x0{"x0"};
+  Variable x1{"x1"};
+  const Vector2<Variable> vars{x0, x1};
+  const Vector2<Expression> with_tape{sin(x0) * exp(x1), x0 / (1 + x1 * x1)};
+  const Vector2<Expression> with_fallback{
+      with_tape(0), if_then_else(x0 > 0, with_tape(1), x1)};
+  const Vector2d x{0.3, -0.8};
+  const symbolic::Environment env{{{x0, x(0)}, {x1, x(1)}}};
+  const Eigen::MatrixXd expected_gradient =
+      symbolic::Evaluate(symbolic::Jacobian(with_tape, vars), env);
+  // Derivatives with respect to a third variable z, where x = (z, 2z).
+  AutoDiffVecXd x_autodiff = x.cast<AutoDiffXd>();
+  x_autodiff(0).derivatives() = Vector1d(1);
+  x_autodiff(1).derivatives() = Vector1d(2);
+  for (const auto& e : {with_tape, with_fallback}) {
+    ExpressionConstraint constraint(e, Vector2d::Zero(), Vector2d::Ones());
+    EXPECT_TRUE(constraint.vars() == vars);
+    VectorXd y;
+    constraint.Eval(x, &y);
+    EXPECT_TRUE(CompareMatrices(
+        y, Vector2d(with_tape(0).Evaluate(env), with_tape(1).Evaluate(env)),
+        1e-14));
+    AutoDiffVecXd y_autodiff;
+    constraint.Eval(x_autodiff, &y_autodiff);
+    EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_autodiff), y, 1e-14));
+    EXPECT_TRUE(CompareMatrices(math::ExtractGradient(y_autodiff),
+                                expected_gradient * Vector2d(1, 2), 1e-14));
+  }
+}
+
+// Evaluating a function outside of its domain throws, as Expression::Evaluate
+// does, whether or not the expressions are evaluated through a tape.
+GTEST_TEST(TestConstraint, ExpressionConstraintDomainErrors) {
+  Variable x0{"x0"};
+  Variable x1{"x1"};
+  for (const Expression& e_0 : {log(x0), sqrt(x0), x0 / x1, asin(2 * x0 - 3),
+                                acos(x0 - 1), pow(x0, 0.5)}) {
+    const Vector2<Expression> with_tape{e_0, x1};
+    const Vector2<Expression> with_fallback{e_0,
+                                            if_then_else(x0 > 0, x1, 0)};
+    for (const auto& e : {with_tape, with_fallback}) {
+      SCOPED_TRACE(e(0).to_string() + ", " + e(1).to_string());
+      ExpressionConstraint constraint(e, Vector2d::Zero(), Vector2d::Ones());
+      // x0 = -1 and x1 = 0.
+      ASSERT_EQ(constraint.vars().size(), 2);
+      const Vector2d x = constraint.vars()(0).equal_to(x0) ? Vector2d(-1, 0)
+                                                           : Vector2d(0, -1);
+      const AutoDiffVecXd x_autodiff = math::InitializeAutoDiff(x);
+      VectorXd y;
+      EXPECT_THROW(constraint.Eval(x, &y), std::exception);
+      AutoDiffVecXd y_autodiff;
+      EXPECT_THROW(constraint.Eval(x_autodiff, &y_autodiff), std::exception);
+    }
+  }
+}
+
 // Test that the Eval() method of LinearComplementarityConstraint correctly
 // returns the slack.
 GTEST_TEST(testConstraint, testSimpleLCPConstraintEval) {
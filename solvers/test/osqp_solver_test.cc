@@ -548,6 +548,71 @@ GTEST_TEST(OsqpSolverTest, VariableScaling2) {
   }
 }
 
+GTEST_TEST(OsqpSolverTest, PersistentWorkspace) {
+  // A small QP whose coefficients change between solves, like in MPC.
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<3>();
+  const Eigen::Matrix3d Q = Eigen::Vector3d(2, 3, 4).asDiagonal();
+  auto quadratic_cost =
+      prog.AddQuadraticCost(Q, Eigen::Vector3d::Zero(), x, true /* convex */);
+  auto linear_cost = prog.AddLinearCost(Eigen::Vector3d(1, -1, 2), x);
+  auto constraint = prog.AddLinearConstraint(
+      Eigen::RowVector3d(1, 1, 1), Vector1d(-1), Vector1d(1), x);
+  prog.AddBoundingBoxConstraint(-0.5, 0.5, x);
+
+  OsqpSolver solver;
+  if (!solver.available()) {
+    return;
+  }
+  EXPECT_FALSE(solver.persistent_workspace());
+  solver.SetPersistentWorkspace(true);
+  EXPECT_TRUE(solver.persistent_workspace());
+
+  // Solves `prog` with a fresh solver, and with the persistent `solver`, and
+  // checks that both agree. Returns whether `solver` reused its workspace.
+  auto solve_and_compare = [&](const SolverOptions& options = {}) {
+    const MathematicalProgramResult expected =
+        OsqpSolver().Solve(prog, {}, options);
+    const MathematicalProgramResult result = solver.Solve(prog, {}, options);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(CompareMatrices(result.GetSolution(x),
+                                expected.GetSolution(x), 1e-5));
+    EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), 1e-5);
+    return result.get_solver_details<OsqpSolver>().reused_workspace;
+  };
+
+  // The first solve has no workspace to reuse.
+  EXPECT_FALSE(solve_and_compare());
+  // Changes to the linear cost, the bounds, and the values of the matrices
+  // reuse the workspace.
+  EXPECT_TRUE(solve_and_compare());
+  linear_cost.evaluator()->UpdateCoefficients(Eigen::Vector3d(-2, 1, 0.5));
+  EXPECT_TRUE(solve_and_compare());
+  constraint.evaluator()->set_bounds(Vector1d(-0.5), Vector1d(0.2));
+  EXPECT_TRUE(solve_and_compare());
+  quadratic_cost.evaluator()->UpdateCoefficients(
+      Eigen::Matrix3d(Eigen::Vector3d(1, 5, 2).asDiagonal()),
+      Eigen::Vector3d::Zero());
+  constraint.evaluator()->UpdateCoefficients(Eigen::RowVector3d(1, 2, 3),
+                                             Vector1d(-1), Vector1d(0.5));
+  EXPECT_TRUE(solve_and_compare());
+
+  // Changing the options or the sparsity pattern sets up a new workspace,
+  // which is kept in turn.
+  SolverOptions options;
+  options.SetOption(OsqpSolver::id(), "eps_abs", 1e-6);
+  EXPECT_FALSE(solve_and_compare(options));
+  EXPECT_TRUE(solve_and_compare(options));
+  prog.AddLinearEqualityConstraint(x(0) - x(1) == 0.1);
+  EXPECT_FALSE(solve_and_compare(options));
+  EXPECT_TRUE(solve_and_compare(options));
+
+  // Turning the persistent workspace off discards it.
+  solver.SetPersistentWorkspace(false);
+  EXPECT_FALSE(solve_and_compare(options));
+  EXPECT_FALSE(solve_and_compare(options));
+}
+
 }  // namespace test
 }  // namespace solvers
 }  // namespace drake
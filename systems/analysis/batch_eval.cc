@@ -14,6 +14,45 @@ using common_robotics_utilities::parallelism::DegreeOfParallelism;
 using common_robotics_utilities::parallelism::ParallelForBackend;
 using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 
+namespace {
+
+/* Splits the `num_evals` samples into one contiguous chunk per thread, and
+calls `calc_chunk(begin, end)` for each chunk in parallel. Each chunk is meant
+to set up its workspace (i.e., clone the context) once and then reuse it for
+all of its samples, so that the per-sample work only overwrites values that
+already exist in that workspace. */
+template <typename CalcChunk>
+void ParallelForEachChunk(int num_evals, Parallelism parallelize,
+                          const CalcChunk& calc_chunk) {
+  if (num_evals == 0) {
+    return;
+  }
+  const int num_chunks = std::min(parallelize.num_threads(), num_evals);
+  const auto calc_chunk_index = [&](const int, const int64_t chunk) {
+    const int64_t begin = chunk * num_evals / num_chunks;
+    const int64_t end = (chunk + 1) * num_evals / num_chunks;
+    calc_chunk(begin, end);
+  };
+  StaticParallelForIndexLoop(DegreeOfParallelism(num_chunks), 0, num_chunks,
+                             calc_chunk_index,
+                             ParallelForBackend::BEST_AVAILABLE);
+}
+
+/* Fixes the `input_port` (if any) of `context` to the input of sample `i`,
+and returns the fixed value so that subsequent samples can overwrite it in
+place rather than fixing (and thus allocating) a new value each time. */
+template <typename T>
+FixedInputPortValue* FixInputForReuse(
+    const InputPort<T>* input_port, const Eigen::Ref<const MatrixX<T>>& inputs,
+    int64_t i, Context<T>* context) {
+  if (input_port == nullptr) {
+    return nullptr;
+  }
+  return &input_port->FixValue(context, inputs.col(i));
+}
+
+}  // namespace
+
 template <typename T>
 MatrixX<T> BatchEvalUniquePeriodicDiscreteUpdate(
     const System<T>& system, const Context<T>& context,
@@ -39,34 +78,30 @@ MatrixX<T> BatchEvalUniquePeriodicDiscreteUpdate(
   }
   DRAKE_THROW_UNLESS(num_time_steps > 0);
 
-  const int num_threads_to_use = parallelize.num_threads();
-  std::vector<std::unique_ptr<Context<T>>> context_pool(num_threads_to_use);
-
   MatrixX<T> next_states = MatrixX<T>::Zero(states.rows(), num_evals);
 
-  const auto calc_next_state = [&](const int thread_num, const int64_t i) {
-    if (!context_pool[thread_num]) {
-      context_pool[thread_num] = context.Clone();
-    }
-    next_states.col(i) = states.col(i);
-
-    // The input port stays fixed for all of the steps.
-    if (input_port) {
-      input_port->FixValue(context_pool[thread_num].get(), inputs.col(i));
-    }
-    for (int step = 0; step < num_time_steps; ++step) {
-      // Set the time and state for this step.
-      context_pool[thread_num]->SetTime(times(i) + step * time_step);
-      context_pool[thread_num]->SetDiscreteState(next_states.col(i));
-      next_states.col(i) =
-          system.EvalUniquePeriodicDiscreteUpdate(*context_pool[thread_num])
-              .value();
+  const auto calc_next_states = [&](const int64_t begin, const int64_t end) {
+    std::unique_ptr<Context<T>> chunk_context = context.Clone();
+    FixedInputPortValue* input_value =
+        FixInputForReuse(input_port, inputs, begin, chunk_context.get());
+    for (int64_t i = begin; i < end; ++i) {
+      next_states.col(i) = states.col(i);
+
+      // The input port stays fixed for all of the steps.
+      if (input_value != nullptr) {
+        input_value->GetMutableVectorData<T>()->SetFromVector(inputs.col(i));
+      }
+      for (int step = 0; step < num_time_steps; ++step) {
+        // Set the time and state for this step.
+        chunk_context->SetTime(times(i) + step * time_step);
+        chunk_context->SetDiscreteState(next_states.col(i));
+        next_states.col(i) =
+            system.EvalUniquePeriodicDiscreteUpdate(*chunk_context).value();
+      }
     }
   };
 
-  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
-                             num_evals, calc_next_state,
-                             ParallelForBackend::BEST_AVAILABLE);
+  ParallelForEachChunk(num_evals, parallelize, calc_next_states);
 
   return next_states;
 }
@@ -92,27 +127,26 @@ MatrixX<T> BatchEvalTimeDerivatives(
     DRAKE_THROW_UNLESS(inputs.cols() == num_evals);
   }
 
-  const int num_threads_to_use = parallelize.num_threads();
-  std::vector<std::unique_ptr<Context<T>>> context_pool(num_threads_to_use);
-
   MatrixX<T> derivatives = MatrixX<T>::Zero(states.rows(), num_evals);
 
-  const auto calc_derivatives = [&](const int thread_num, const int64_t i) {
-    if (!context_pool[thread_num]) {
-      context_pool[thread_num] = context.Clone();
+  const auto calc_derivatives = [&](const int64_t begin, const int64_t end) {
+    std::unique_ptr<Context<T>> chunk_context = context.Clone();
+    FixedInputPortValue* input_value =
+        FixInputForReuse(input_port, inputs, begin, chunk_context.get());
+    VectorX<T> xdot(states.rows());
+    for (int64_t i = begin; i < end; ++i) {
+      if (input_value != nullptr) {
+        input_value->GetMutableVectorData<T>()->SetFromVector(inputs.col(i));
+      }
+      chunk_context->SetTimeAndContinuousState(times(i), states.col(i));
+      system.EvalTimeDerivatives(*chunk_context)
+          .get_vector()
+          .CopyToPreSizedVector(&xdot);
+      derivatives.col(i) = xdot;
     }
-    context_pool[thread_num]->SetTime(times(i));
-    context_pool[thread_num]->SetContinuousState(states.col(i));
-    if (input_port) {
-      input_port->FixValue(context_pool[thread_num].get(), inputs.col(i));
-    }
-    derivatives.col(i) =
-        system.EvalTimeDerivatives(*context_pool[thread_num]).CopyToVector();
   };
 
-  StaticParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
-                             num_evals, calc_derivatives,
-                             ParallelForBackend::BEST_AVAILABLE);
+  ParallelForEachChunk(num_evals, parallelize, calc_derivatives);
 
   return derivatives;
 }
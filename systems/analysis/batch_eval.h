@@ -35,7 +35,9 @@ time_step*num_time_steps`.
 dynamics. The default is to use the first input if there is one. A specific
 port index or kNoInput can be specified instead. The input port must be
 vector-valued and have the same size as the number of rows in `inputs`.
-@param parallelize The parallelism to use for evaluating the dynamics.
+@param parallelize The parallelism to use for evaluating the dynamics. The
+columns are split into one contiguous chunk per thread, and each thread
+evaluates its chunk using a single copy of `context`.
 
 @return A matrix with each column corresponding to the next state at `time +
 num_time_steps * time_step`.
@@ -77,7 +79,9 @@ argument will be ignored.
 dynamics. The default is to use the first input if there is one. A specific
 port index or kNoInput can be specified instead. The input port must be
 vector-valued and have the same size as the number of rows in `inputs`.
-@param parallelize The parallelism to use for evaluating the dynamics.
+@param parallelize The parallelism to use for evaluating the dynamics. The
+columns are split into one contiguous chunk per thread, and each thread
+evaluates its chunk using a single copy of `context`.
 
 @return A matrix with each column corresponding to the time derivatives.
 
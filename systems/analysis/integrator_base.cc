@@ -23,7 +23,8 @@ bool IntegratorBase<T>::StepOnceErrorControlledAtMost(const T& h_max) {
   const T current_time = context.get_time();
   VectorBase<T>& xc =
       get_mutable_context()->get_mutable_continuous_state_vector();
-  xc0_save_ = xc.CopyToVector();
+  xc0_save_.resize(xc.size());
+  xc.CopyToPreSizedVector(&xc0_save_);
 
   // Set the step size to attempt.
   T step_size_to_attempt = get_ideal_next_step_size();
@@ -170,30 +171,37 @@ T IntegratorBase<T>::CalcStateChangeNorm(
   DRAKE_DEMAND(pinvN_dq_change_->size() == dgv.size());
   DRAKE_DEMAND(weighted_q_change_->size() == dgq.size());
 
+  // Copies each substate change into its own (reused) vector, so that no heap
+  // allocations are needed after the first call.
+  const auto copy_to_scratch = [](const VectorBase<T>& change,
+                                  VectorX<T>* scratch) {
+    scratch->resize(change.size());
+    change.CopyToPreSizedVector(scratch);
+  };
+
   // TODO(edrumwri): Acquire characteristic time properly from the system
   //                 (i.e., modify the System to provide this value).
   const double characteristic_time = 1.0;
 
   // Computes the infinity norm of the weighted velocity variables.
-  unweighted_substate_change_ = dgv.CopyToVector();
-  T v_nrm = qbar_v_weight.cwiseProduct(unweighted_substate_change_)
+  copy_to_scratch(dgv, &unweighted_v_change_);
+  T v_nrm = qbar_v_weight.cwiseProduct(unweighted_v_change_)
                 .template lpNorm<Eigen::Infinity>() *
             characteristic_time;
 
   // Compute the infinity norm of the weighted auxiliary variables.
-  unweighted_substate_change_ = dgz.CopyToVector();
-  T z_nrm = (z_weight.cwiseProduct(unweighted_substate_change_))
+  copy_to_scratch(dgz, &unweighted_z_change_);
+  T z_nrm = (z_weight.cwiseProduct(unweighted_z_change_))
                 .template lpNorm<Eigen::Infinity>();
 
   // Compute N * Wq * dq = N * Wꝗ * N+ * dq.
-  unweighted_substate_change_ = dgq.CopyToVector();
-  system.MapQDotToVelocity(context, unweighted_substate_change_,
+  copy_to_scratch(dgq, &unweighted_q_change_);
+  system.MapQDotToVelocity(context, unweighted_q_change_,
                            pinvN_dq_change_.get());
-  system.MapVelocityToQDot(
-      context, qbar_v_weight.cwiseProduct(pinvN_dq_change_->CopyToVector()),
-      weighted_q_change_.get());
-  T q_nrm =
-      weighted_q_change_->CopyToVector().template lpNorm<Eigen::Infinity>();
+  weighted_v_change_ = qbar_v_weight.cwiseProduct(pinvN_dq_change_->value());
+  system.MapVelocityToQDot(context, weighted_v_change_,
+                           weighted_q_change_.get());
+  T q_nrm = weighted_q_change_->value().template lpNorm<Eigen::Infinity>();
   DRAKE_LOGGER_DEBUG("dq norm: {}, dv norm: {}, dz norm: {}", q_nrm, v_nrm,
                      z_nrm);
 
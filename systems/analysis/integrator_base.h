@@ -857,7 +857,10 @@ class IntegratorBase {
     qbar_weight_.setZero(0);
     z_weight_.setZero(0);
     pinvN_dq_change_.reset();
-    unweighted_substate_change_.setZero(0);
+    unweighted_q_change_.setZero(0);
+    unweighted_v_change_.setZero(0);
+    unweighted_z_change_.setZero(0);
+    weighted_v_change_.setZero(0);
     weighted_q_change_.reset();
 
     // Drops dense output, if any.
@@ -1681,11 +1684,15 @@ class IntegratorBase {
   // generalized coordinates to generalized velocities, multiplied by the
   // change in the generalized coordinates (used in state change norm
   // calculations).
-  mutable std::unique_ptr<VectorBase<T>> pinvN_dq_change_;
-
-  // Vectors used in state change norm calculations.
-  mutable VectorX<T> unweighted_substate_change_;
-  mutable std::unique_ptr<VectorBase<T>> weighted_q_change_;
+  mutable std::unique_ptr<BasicVector<T>> pinvN_dq_change_;
+
+  // Vectors used in state change norm calculations. These are reused from call
+  // to call to avoid heap allocations.
+  mutable VectorX<T> unweighted_q_change_;
+  mutable VectorX<T> unweighted_v_change_;
+  mutable VectorX<T> unweighted_z_change_;
+  mutable VectorX<T> weighted_v_change_;
+  mutable std::unique_ptr<BasicVector<T>> weighted_q_change_;
 
   // Variable for indicating when an integrator has been initialized.
   bool initialization_done_{false};
@@ -1,10 +1,16 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <future>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <thread>
 
+#include "drake/common/scope_exit.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -153,6 +159,226 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
   }
 }
 
+namespace {
+
+// A reusable simulator (and the context to reset it to) that runs one sample
+// at a time for StreamMonteCarloSimulation. The worker owns the generator that
+// is passed to `make_simulator`, so that the generator outlives the simulator
+// even if the factory retains the pointer.
+struct MonteCarloWorker {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MonteCarloWorker);
+
+  explicit MonteCarloWorker(const RandomSimulatorFactory& make_simulator)
+      : simulator(make_simulator(&worker_generator)),
+        initial_context(simulator->get_context().Clone()) {}
+
+  // Resets the context to its initial values and randomizes it for a new
+  // sample, recording the generator state beforehand. This must be called
+  // from the thread that owns `generator`.
+  void Prepare(int next_sample, RandomGenerator* generator) {
+    sample = next_sample;
+    result.emplace(*generator);
+    Context<double>& context = simulator->get_mutable_context();
+    context.SetTimeStateAndParametersFrom(*initial_context);
+    simulator->get_system().SetRandomContext(&context, generator);
+  }
+
+  // Simulates the prepared sample, storing either its output or the
+  // exception that it threw.
+  void Run(const ScalarSystemFunction& output, double final_time) {
+    try {
+      simulator->Initialize();
+      simulator->AdvanceTo(final_time);
+      result->output =
+          output(simulator->get_system(), simulator->get_context());
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+
+  // N.B. This must be declared before `simulator` so that it is constructed
+  // first and destroyed last.
+  RandomGenerator worker_generator;
+  std::shared_ptr<Simulator<double>> simulator;
+  std::unique_ptr<Context<double>> initial_context;
+  int sample{-1};
+  std::optional<RandomSimulationResult> result;
+  std::exception_ptr error;
+};
+
+// Serial (single-threaded) implementation of StreamMonteCarloSimulation.
+int StreamMonteCarloSimulationSerial(
+    const RandomSimulatorFactory& make_simulator,
+    const ScalarSystemFunction& output, const double final_time,
+    const int num_samples, const MonteCarloResultCallback& callback,
+    RandomGenerator* const generator) {
+  MonteCarloWorker worker(make_simulator);
+  for (int sample = 0; sample < num_samples; ++sample) {
+    worker.Prepare(sample, generator);
+    worker.Run(output, final_time);
+    if (worker.error) {
+      std::rethrow_exception(worker.error);
+    }
+    if (!callback(sample, *worker.result)) {
+      return sample + 1;
+    }
+  }
+  return num_samples;
+}
+
+// Parallel (multi-threaded) implementation of StreamMonteCarloSimulation.
+// Each worker has a dedicated thread that waits until the calling thread
+// assigns it a sample, simulates it, and then hands the worker back to the
+// calling thread through the `completed` queue.
+int StreamMonteCarloSimulationParallel(
+    const RandomSimulatorFactory& make_simulator,
+    const ScalarSystemFunction& output, const double final_time,
+    const int num_samples, const MonteCarloResultCallback& callback,
+    RandomGenerator* const generator, const int num_threads) {
+  std::vector<std::unique_ptr<MonteCarloWorker>> workers;
+  workers.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    workers.push_back(std::make_unique<MonteCarloWorker>(make_simulator));
+  }
+
+  // State shared with the worker threads, guarded by `mutex`.
+  std::mutex mutex;
+  std::condition_variable work_ready;
+  std::condition_variable work_done;
+  std::vector<bool> assigned(num_threads, false);
+  std::deque<int> completed;
+  bool shutdown = false;
+
+  const auto thread_loop = [&](int i) {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      work_ready.wait(lock, [&]() { return shutdown || assigned[i]; });
+      if (!assigned[i]) {
+        return;
+      }
+      lock.unlock();
+      workers[i]->Run(output, final_time);
+      lock.lock();
+      assigned[i] = false;
+      completed.push_back(i);
+      work_done.notify_one();
+    }
+  };
+
+  // Joins the worker threads on every exit path (including exceptions thrown
+  // by `make_simulator`, SetRandomContext(), or `callback`), after any samples
+  // in flight complete.
+  std::vector<std::thread> threads;
+  ScopeExit join_threads([&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      shutdown = true;
+    }
+    work_ready.notify_all();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  });
+  threads.reserve(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back(thread_loop, i);
+  }
+
+  std::vector<int> idle(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    idle[i] = num_threads - 1 - i;
+  }
+  int num_dispatched = 0;
+  int num_running = 0;
+  int num_delivered = 0;
+  bool stop = false;
+  std::exception_ptr first_error;
+  while (true) {
+    // Dispatch new samples to all idle workers. The generator is only used
+    // here, on the calling thread, so the samples draw from it in the same
+    // order as in the serial implementation.
+    while (!stop && num_dispatched < num_samples && !idle.empty()) {
+      const int i = idle.back();
+      idle.pop_back();
+      workers[i]->Prepare(num_dispatched, generator);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        assigned[i] = true;
+      }
+      work_ready.notify_all();
+      drake::log()->debug("Simulation {} dispatched", num_dispatched);
+      ++num_dispatched;
+      ++num_running;
+    }
+    if (num_running == 0) {
+      break;
+    }
+
+    // Wait for the next worker to complete.
+    int i{};
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      work_done.wait(lock, [&]() { return !completed.empty(); });
+      i = completed.front();
+      completed.pop_front();
+    }
+    --num_running;
+    idle.push_back(i);
+    MonteCarloWorker& worker = *workers[i];
+    drake::log()->debug("Simulation {} completed", worker.sample);
+    if (worker.error) {
+      if (!first_error) {
+        first_error = worker.error;
+      }
+      worker.error = nullptr;
+      stop = true;
+    } else if (!stop) {
+      ++num_delivered;
+      if (!callback(worker.sample, *worker.result)) {
+        stop = true;
+      }
+    }
+  }
+
+  if (first_error) {
+    std::rethrow_exception(first_error);
+  }
+  return num_delivered;
+}
+
+}  // namespace
+
+int StreamMonteCarloSimulation(const RandomSimulatorFactory& make_simulator,
+                               const ScalarSystemFunction& output,
+                               const double final_time, const int num_samples,
+                               const MonteCarloResultCallback& callback,
+                               RandomGenerator* generator,
+                               const Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+  DRAKE_THROW_UNLESS(callback != nullptr);
+  if (num_samples == 0) {
+    return 0;
+  }
+
+  // Create a generator if the user didn't provide one.
+  std::unique_ptr<RandomGenerator> owned_generator;
+  if (generator == nullptr) {
+    owned_generator = std::make_unique<RandomGenerator>();
+    generator = owned_generator.get();
+  }
+
+  // There is no use for more workers than samples.
+  const int num_threads = std::min(parallelism.num_threads(), num_samples);
+  if (num_threads > 1) {
+    return StreamMonteCarloSimulationParallel(make_simulator, output,
+                                              final_time, num_samples,
+                                              callback, generator, num_threads);
+  } else {
+    return StreamMonteCarloSimulationSerial(make_simulator, output, final_time,
+                                            num_samples, callback, generator);
+  }
+}
+
 }  // namespace analysis
 }  // namespace systems
 }  // namespace drake
@@ -166,6 +166,93 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     const ScalarSystemFunction& output, double final_time, int num_samples,
     RandomGenerator* generator = nullptr, Parallelism parallelism = false);
 
+/**
+ * Receives the results of StreamMonteCarloSimulation() one at a time, as soon
+ * as each simulation completes. The @p sample is the index of the sample
+ * (i.e., the number of samples dispatched before it) and @p result holds the
+ * generator snapshot and output of that sample. Returns true to continue
+ * sampling, or false to stop (e.g., once an estimate has converged).
+ */
+using MonteCarloResultCallback =
+    std::function<bool(int sample, const RandomSimulationResult& result)>;
+
+/**
+ * Generates samples of a scalar random variable output, like
+ * MonteCarloSimulation(), but streams each RandomSimulationResult to
+ * @p callback as soon as its simulation completes and reuses one Simulator
+ * per worker thread for all of the samples that worker runs.
+ *
+ * In pseudo-code, this algorithm implements:
+ * @code
+ *   for each worker
+ *     simulator = make_simulator(worker_generator)
+ *     initial_context = copy of simulator.get_context()
+ *   for i=0:num_samples-1, with an idle worker
+ *     const generator_snapshot = deepcopy(generator)
+ *     simulator.get_mutable_context().SetTimeStateAndParametersFrom(
+ *         initial_context)
+ *     simulator.get_system().SetRandomContext(generator)
+ *     on the worker's thread:
+ *       simulator.Initialize()
+ *       simulator.AdvanceTo(final_time)
+ *       output = output(simulator.get_context())
+ *     when the worker completes:
+ *       if !callback(i, {generator_snapshot, output}) then stop dispatching
+ * @endcode
+ *
+ * Because each System is built once per worker, not once per sample, this
+ * avoids the cost of diagram construction for every sample. It also removes
+ * the barrier between batches of samples: a worker starts on a new sample as
+ * soon as it finishes its previous one.
+ *
+ * As a consequence, all of the randomness of a sample must be introduced by
+ * SetRandomContext() and/or random input ports. @p make_simulator is only
+ * called once per worker, with a generator that is distinct from
+ * @p generator, and must return the same (deterministic) System each time.
+ * Under that condition, each result can be reproduced with RandomSimulation(),
+ * as described for RandomSimulationResult, and the results do not depend on
+ * the number of threads used.
+ *
+ * @see MonteCarloSimulation() for details about @p make_simulator,
+ * @p output, @p final_time, @p num_samples, and @p generator.
+ *
+ * @param callback Receives each result as it completes. Results are
+ * delivered in order of completion, which (with more than one thread) need
+ * not be the order of the sample indices. Once @p callback returns false, no
+ * new samples are dispatched; the samples that are already running are
+ * completed but their results are not delivered.
+ *
+ * @param parallelism Specify number of worker threads to use, each with its
+ * own Simulator. The default value (false) runs all simulations on the
+ * calling thread, using a single Simulator.
+ *
+ * @returns the number of results delivered to @p callback.
+ *
+ * @throws std::exception if a simulation (or @p output) throws. No further
+ * samples are dispatched, and the exception is rethrown after the samples
+ * that are already running complete.
+ *
+ * Thread safety when parallel execution is specified:
+ * - @p make_simulator, @p generator, and @p callback are only accessed from
+ *   the calling thread.
+ *
+ * - Each simulator created by @p make_simulator and its context are only
+ *   accessed from the calling thread while the worker that owns them is idle,
+ *   and otherwise from within that worker thread; however, any resource
+ *   shared between these simulators must be safe for concurrent use.
+ *
+ * - @p output is called from within worker threads. It must be safe to make
+ *   concurrent calls to @p output.
+ *
+ * @ingroup analysis
+ */
+int StreamMonteCarloSimulation(const RandomSimulatorFactory& make_simulator,
+                               const ScalarSystemFunction& output,
+                               double final_time, int num_samples,
+                               const MonteCarloResultCallback& callback,
+                               RandomGenerator* generator = nullptr,
+                               Parallelism parallelism = false);
+
 // The below functions are exposed for unit testing only.
 namespace internal {
 
@@ -640,14 +640,14 @@ void Simulator<T>::IsolateWitnessTriggers(
 
 // Evaluates the given vector of witness functions.
 template <class T>
-VectorX<T> Simulator<T>::EvaluateWitnessFunctions(
+void Simulator<T>::EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const {
+    const Context<T>& context, VectorX<T>* weval) const {
+  DRAKE_DEMAND(weval != nullptr);
   const System<T>& system = get_system();
-  VectorX<T> weval(witness_functions.size());
+  weval->resize(witness_functions.size());
   for (size_t i = 0; i < witness_functions.size(); ++i)
-    weval[i] = system.CalcWitnessValue(context, *witness_functions[i]);
-  return weval;
+    (*weval)[i] = system.CalcWitnessValue(context, *witness_functions[i]);
 }
 
 // Determines whether at least one of a collection of witness functions
@@ -734,14 +734,16 @@ Simulator<T>::IntegrateContinuousState(
   // Save the time and current state.
   const Context<T>& context = get_context();
   const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
+  const VectorBase<T>& xc = context.get_continuous_state().get_vector();
+  x0_.resize(xc.size());
+  xc.CopyToPreSizedVector(&x0_);
 
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
   const auto& witness_functions = *witness_functions_;
 
   // Evaluate the witness functions.
-  w0_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -752,7 +754,7 @@ Simulator<T>::IntegrateContinuousState(
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &wf_);
 
   // Triggering requires isolating the witness function time.
   if (DidWitnessTrigger(witness_functions, w0_, wf_, &triggered_witnesses_)) {
@@ -760,14 +762,14 @@ Simulator<T>::IntegrateContinuousState(
     // are detected in the interval [t0, tf], any additional time-triggered
     // events are only relevant iff at least one witness function is
     // successfully isolated (see IsolateWitnessTriggers() for details).
-    IsolateWitnessTriggers(witness_functions, w0_, t0, x0, tf,
+    IsolateWitnessTriggers(witness_functions, w0_, t0, x0_, tf,
                            &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
     // `true`, the witness might not have actually triggered after isolation).
     if (!triggered_witnesses_.empty()) {
-      event_handler_xc_->SetFromVector(x0);
+      event_handler_xc_->SetFromVector(x0_);
     }
 
     // Store witness function(s) that triggered.
@@ -803,9 +803,9 @@ class Simulator {
       const std::vector<const WitnessFunction<T>*>& witness_functions,
       const VectorX<T>& w0, const VectorX<T>& wf,
       std::vector<const WitnessFunction<T>*>* triggered_witnesses);
-  VectorX<T> EvaluateWitnessFunctions(
+  void EvaluateWitnessFunctions(
       const std::vector<const WitnessFunction<T>*>& witness_functions,
-      const Context<T>& context) const;
+      const Context<T>& context, VectorX<T>* weval) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
   // The steady_clock is immune to system clock changes so increases
@@ -856,10 +856,15 @@ class Simulator {
   };
   ContextPtr context_;
 
-  // Temporaries used for witness function isolation.
+  // Temporaries used for witness function isolation. These (and x0_) are
+  // members rather than locals so that steps after the first one do not
+  // allocate.
   std::vector<const WitnessFunction<T>*> triggered_witnesses_;
   VectorX<T> w0_, wf_;
 
+  // The continuous state at the start of the current step.
+  VectorX<T> x0_;
+
   // Slow down to this rate if possible (user settable).
   double target_realtime_rate_{SimulatorConfig{}.target_realtime_rate};
 
@@ -137,6 +137,53 @@ GTEST_TEST(BatchEvalTimeDerivatives, BasicTest) {
   EXPECT_TRUE(CompareMatrices(xdot, xdot_expected, 1e-14));
 }
 
+// Checks that the samples are all evaluated correctly when they are split into
+// chunks that are not all the same size, for both serial and parallel
+// evaluation. In particular, this checks that each sample sees its own input
+// even though the input port value is reused across the samples in a chunk.
+GTEST_TEST(BatchEvalTest, ManySamples) {
+  const int num_evals = 101;
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Random(3, 3);
+  const Eigen::MatrixXd B = Eigen::MatrixXd::Random(3, 2);
+  const Eigen::MatrixXd C(0, 3), D(0, 2);
+  const Eigen::RowVectorXd times =
+      Eigen::RowVectorXd::LinSpaced(num_evals, 0, 1);
+  const Eigen::MatrixXd states = Eigen::MatrixXd::Random(3, num_evals);
+  const Eigen::MatrixXd inputs = Eigen::MatrixXd::Random(2, num_evals);
+  const Eigen::MatrixXd expected = A * states + B * inputs;
+
+  LinearSystem<double> continuous_system(A, B, C, D);
+  auto continuous_context = continuous_system.CreateDefaultContext();
+  const double time_step = 0.1;
+  LinearSystem<double> discrete_system(A, B, C, D, time_step);
+  auto discrete_context = discrete_system.CreateDefaultContext();
+
+  for (const int num_threads : {1, 2, 3}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    EXPECT_TRUE(CompareMatrices(
+        BatchEvalTimeDerivatives<double>(
+            continuous_system, *continuous_context, times, states, inputs,
+            continuous_system.get_input_port().get_index(),
+            Parallelism(num_threads)),
+        expected, 1e-14));
+    EXPECT_TRUE(CompareMatrices(
+        BatchEvalUniquePeriodicDiscreteUpdate<double>(
+            discrete_system, *discrete_context, times, states, inputs,
+            1 /* num_time_steps */,
+            discrete_system.get_input_port().get_index(),
+            Parallelism(num_threads)),
+        expected, 1e-14));
+  }
+
+  // An empty batch is allowed.
+  EXPECT_EQ(BatchEvalTimeDerivatives<double>(
+                continuous_system, *continuous_context,
+                Eigen::RowVectorXd(0), Eigen::MatrixXd(3, 0),
+                Eigen::MatrixXd(2, 0))
+                .cols(),
+            0);
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
@@ -1,6 +1,7 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <map>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -252,6 +253,151 @@ GTEST_TEST(MonteCarloSimulationExceptionTest, BasicTest) {
                std::exception);
 }
 
+// Confirms that StreamMonteCarloSimulation delivers the same samples as
+// MonteCarloSimulation, regardless of the number of threads.
+GTEST_TEST(StreamMonteCarloSimulationTest, MatchesMonteCarloSimulation) {
+  int num_simulators_made = 0;
+  const RandomSimulatorFactory make_simulator =
+      [&num_simulators_made](RandomGenerator*) {
+        ++num_simulators_made;
+        auto system = std::make_unique<RandomContextSystem>();
+        return std::make_unique<Simulator<double>>(std::move(system));
+      };
+  const double final_time = 0.1;
+  const int num_samples = 50;
+
+  const RandomGenerator prototype_generator;
+  RandomGenerator expected_generator(prototype_generator);
+  const auto expected_results =
+      MonteCarloSimulation(make_simulator, &GetScalarOutput, final_time,
+                           num_samples, &expected_generator);
+
+  for (const int num_threads : {1, 2, 4}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    num_simulators_made = 0;
+    RandomGenerator generator(prototype_generator);
+    std::map<int, RandomSimulationResult> results;
+    const int num_delivered = StreamMonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        [&results](int sample, const RandomSimulationResult& result) {
+          EXPECT_TRUE(results.emplace(sample, result).second);
+          return true;
+        },
+        &generator, Parallelism(num_threads));
+    EXPECT_EQ(num_delivered, num_samples);
+    ASSERT_EQ(results.size(), num_samples);
+
+    // Each worker reuses a single simulator.
+    EXPECT_EQ(num_simulators_made, num_threads);
+
+    for (int sample = 0; sample < num_samples; ++sample) {
+      const RandomSimulationResult& expected = expected_results.at(sample);
+      const RandomSimulationResult& result = results.at(sample);
+      EXPECT_EQ(result.output, expected.output);
+      RandomGenerator reproduction_generator(result.generator_snapshot);
+      EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                                 &reproduction_generator),
+                result.output);
+    }
+  }
+}
+
+// Confirms that sampling stops once the callback returns false.
+GTEST_TEST(StreamMonteCarloSimulationTest, EarlyTermination) {
+  const RandomSimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<RandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 1000;
+  const int num_wanted = 10;
+
+  for (const int num_threads : {1, 2, 4}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    RandomGenerator generator;
+    int num_received = 0;
+    const int num_delivered = StreamMonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        [&num_received](int, const RandomSimulationResult&) {
+          ++num_received;
+          return num_received < num_wanted;
+        },
+        &generator, Parallelism(num_threads));
+    EXPECT_EQ(num_delivered, num_wanted);
+    EXPECT_EQ(num_received, num_wanted);
+  }
+}
+
+// Simple system whose output is drawn from the generator that was passed to
+// its RandomSimulatorFactory, which it retains for its whole lifetime.
+class GeneratorRetainingSystem : public VectorSystem<double> {
+ public:
+  explicit GeneratorRetainingSystem(RandomGenerator* generator)
+      : VectorSystem(0, 1, /* direct_feedthrough = */ false),
+        generator_(generator) {
+    DRAKE_DEMAND(generator != nullptr);
+  }
+
+ private:
+  void DoCalcVectorOutput(
+      const Context<double>&,
+      const Eigen::VectorBlock<const VectorX<double>>&,
+      const Eigen::VectorBlock<const VectorX<double>>&,
+      Eigen::VectorBlock<VectorX<double>>* output) const override {
+    std::uniform_real_distribution<> distribution;
+    (*output)(0) = distribution(*generator_);
+  }
+
+  RandomGenerator* const generator_;
+};
+
+// Confirms that the generator passed to the factory remains valid for as long
+// as the simulator that the factory made (i.e., for the whole run).
+GTEST_TEST(StreamMonteCarloSimulationTest, FactoryRetainsGenerator) {
+  const RandomSimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    auto system = std::make_unique<GeneratorRetainingSystem>(generator);
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 20;
+
+  for (const int num_threads : {1, 2}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    RandomGenerator generator;
+    const int num_delivered = StreamMonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        [](int, const RandomSimulationResult& result) {
+          EXPECT_GE(result.output, 0.0);
+          EXPECT_LT(result.output, 1.0);
+          return true;
+        },
+        &generator, Parallelism(num_threads));
+    EXPECT_EQ(num_delivered, num_samples);
+  }
+}
+
+GTEST_TEST(StreamMonteCarloSimulationTest, Exception) {
+  const RandomSimulatorFactory make_simulator = [](RandomGenerator*) {
+    auto system = std::make_unique<ThrowingRandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 10;
+  const auto callback = [](int, const RandomSimulationResult&) {
+    return true;
+  };
+
+  for (const int num_threads : {1, 2}) {
+    SCOPED_TRACE(fmt::format("num_threads = {}", num_threads));
+    RandomGenerator generator;
+    EXPECT_THROW(
+        StreamMonteCarloSimulation(make_simulator, &GetScalarOutput,
+                                   final_time, num_samples, callback,
+                                   &generator, Parallelism(num_threads)),
+        std::exception);
+  }
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
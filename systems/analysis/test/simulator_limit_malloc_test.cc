@@ -1,6 +1,11 @@
+#include <memory>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/event.h"
@@ -84,6 +89,130 @@ GTEST_TEST(SimulatorLimitMallocTest,
   }
 }
 
+// A system with continuous state x = [x₀, x₁] whose dynamics are ẋ = -x, along
+// with a witness function that never triggers.
+class ContinuousSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContinuousSystem);
+
+  ContinuousSystem() {
+    DeclareContinuousState(2);
+    witness_ =
+        MakeWitnessFunction("never", WitnessFunctionDirection::kCrossesZero,
+                            &ContinuousSystem::CalcWitness);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorBase<double>& x = context.get_continuous_state_vector();
+    VectorBase<double>& xdot = derivatives->get_mutable_vector();
+    for (int i = 0; i < x.size(); ++i) {
+      xdot[i] = -x[i];
+    }
+  }
+
+  void DoGetWitnessFunctions(
+      const Context<double>&,
+      std::vector<const WitnessFunction<double>*>* witnesses) const final {
+    witnesses->push_back(witness_.get());
+  }
+
+  double CalcWitness(const Context<double>& context) const {
+    return 1.0 + context.get_continuous_state_vector()[0] *
+                     context.get_continuous_state_vector()[0];
+  }
+
+  std::unique_ptr<WitnessFunction<double>> witness_;
+};
+
+// Tests that heap allocations do not occur from Simulator for systems with
+// continuous state and witness functions, after the first step.
+GTEST_TEST(SimulatorLimitMallocTest,
+           NoHeapAllocsInSimulatorForSystemsWithContinuousState) {
+  ContinuousSystem system;
+  Simulator<double> simulator(system);
+  simulator.get_mutable_context().SetContinuousState(
+      Eigen::Vector2d(1.0, -2.0));
+  // The first step sizes the simulator's and the integrator's temporaries.
+  simulator.AdvanceTo(0.1);
+  {
+    test::LimitMalloc heap_alloc_checker({.max_num_allocations = 0});
+    simulator.AdvanceTo(1.0);
+    simulator.AdvanceTo(2.0);
+  }
+}
+
+// Makes a discrete-time MultibodyPlant of an actuated arm with 7 revolute
+// joints. The arm has no geometry, and thus no contact.
+std::unique_ptr<multibody::MultibodyPlant<double>> MakeArm(
+    multibody::DiscreteContactApproximation approximation) {
+  using Eigen::Vector3d;
+  using math::RigidTransformd;
+  auto plant = std::make_unique<multibody::MultibodyPlant<double>>(0.001);
+  plant->set_discrete_contact_approximation(approximation);
+  const double length = 0.3;
+  const auto M_BBo_B =
+      multibody::SpatialInertia<double>::SolidCylinderWithMassAboutEnd(
+          1.0, 0.02, length, -Vector3d::UnitZ());
+  const multibody::RigidBody<double>* parent = &plant->world_body();
+  for (int i = 0; i < 7; ++i) {
+    const std::string suffix = std::to_string(i);
+    const multibody::RigidBody<double>& link =
+        plant->AddRigidBody("link" + suffix, M_BBo_B);
+    const RigidTransformd X_PF(
+        (i == 0) ? Vector3d::Zero() : Vector3d(0, 0, -length));
+    // Alternate the joint axes, so that the arm moves in 3D.
+    const auto& joint = plant->AddJoint<multibody::RevoluteJoint>(
+        "joint" + suffix, *parent, X_PF, link, RigidTransformd(),
+        (i % 2 == 0) ? Vector3d::UnitY() : Vector3d::UnitX());
+    plant->AddJointActuator("actuator" + suffix, joint);
+    parent = &link;
+  }
+  plant->Finalize();
+  return plant;
+}
+
+// Tests the heap allocations made when stepping a discrete-time MultibodyPlant
+// arm (without contact) once the Simulator has reached steady state. Neither
+// the Simulator nor its event handling allocate here; the budgets below cover
+// what the plant's discrete solvers still allocate per step (e.g., solver
+// temporaries and MultibodyForces). They guard against regressions and should
+// be lowered as that scratch is preallocated.
+GTEST_TEST(SimulatorLimitMallocTest,
+           BoundedHeapAllocsInSimulatorForDiscreteMultibodyPlant) {
+  struct Case {
+    multibody::DiscreteContactApproximation approximation;
+    int max_num_allocations_per_step;
+  };
+  for (const Case& c :
+       {Case{multibody::DiscreteContactApproximation::kTamsi, 110},
+        Case{multibody::DiscreteContactApproximation::kLagged, 45}}) {
+    SCOPED_TRACE(static_cast<int>(c.approximation));
+    DiagramBuilder<double> builder;
+    auto& plant = *builder.AddSystem(MakeArm(c.approximation));
+    builder.ExportInput(plant.get_actuation_input_port(), "actuation");
+    auto diagram = builder.Build();
+
+    Simulator<double> simulator(*diagram);
+    Context<double>& context = simulator.get_mutable_context();
+    diagram->get_input_port().FixValue(&context,
+                                       Eigen::VectorXd::Constant(7, 0.1));
+    plant.SetPositions(&plant.GetMyMutableContextFromRoot(&context),
+                       Eigen::VectorXd::LinSpaced(7, 0.1, 0.7));
+    // The first two steps size the simulator's scratch storage and fill the
+    // plant's rotation of recycled step memory.
+    simulator.AdvanceTo(0.002);
+    {
+      const int num_steps = 100;
+      test::LimitMalloc heap_alloc_checker(
+          {.max_num_allocations = num_steps * c.max_num_allocations_per_step});
+      simulator.AdvanceTo(0.002 + num_steps * 0.001);
+    }
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -0,0 +1,160 @@
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/analysis/batch_eval.h"
+#include "drake/tools/performance/fixture_common.h"
+
+/* Measures the cost of evaluating the dynamics of a MultibodyPlant for many
+samples at once, as is done (for example) to generate training data for
+learned dynamics models. */
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::RowVectorXd;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using multibody::MultibodyPlant;
+using multibody::RevoluteJoint;
+using multibody::RigidBody;
+using multibody::SpatialInertia;
+
+constexpr int kNumLinks = 7;
+constexpr int kNumEvals = 10'000;
+
+// Makes an actuated pendulum with kNumLinks links, connected by revolute
+// joints.
+std::unique_ptr<MultibodyPlant<double>> MakeChainPlant(double time_step) {
+  auto plant = std::make_unique<MultibodyPlant<double>>(time_step);
+  const double length = 0.3;
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidCylinderWithMassAboutEnd(
+          1.0, 0.02, length, -Vector3d::UnitZ());
+  const RigidBody<double>* parent = &plant->world_body();
+  for (int i = 0; i < kNumLinks; ++i) {
+    const std::string suffix = std::to_string(i);
+    const RigidBody<double>& link =
+        plant->AddRigidBody("link" + suffix, M_BBo_B);
+    const RigidTransformd X_PF(
+        (i == 0) ? Vector3d::Zero() : Vector3d(0, 0, -length));
+    const auto& joint = plant->AddJoint<RevoluteJoint>(
+        "joint" + suffix, *parent, X_PF, link, RigidTransformd(),
+        Vector3d::UnitY());
+    plant->AddJointActuator("actuator" + suffix, joint);
+    parent = &link;
+  }
+  plant->Finalize();
+  return plant;
+}
+
+class BatchEvalBenchmark : public benchmark::Fixture {
+ public:
+  BatchEvalBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  // The benchmark argument is the number of threads.
+  // NOLINTNEXTLINE(runtime/references)
+  void SetUp(benchmark::State& state) override {
+    parallelism_ = Parallelism(static_cast<int>(state.range(0)));
+    times_ = RowVectorXd::Zero(kNumEvals);
+    inputs_ = MatrixXd::Random(kNumLinks, kNumEvals);
+  }
+
+  // Creates the plant (and its default context) with the given time step,
+  // along with a random batch of states.
+  void MakePlant(double time_step) {
+    plant_ = MakeChainPlant(time_step);
+    context_ = plant_->CreateDefaultContext();
+    states_ = MatrixXd::Random(plant_->num_multibody_states(), kNumEvals);
+  }
+
+ protected:
+  Parallelism parallelism_;
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<Context<double>> context_;
+  RowVectorXd times_;
+  MatrixXd states_;
+  MatrixXd inputs_;
+};
+
+BENCHMARK_DEFINE_F(BatchEvalBenchmark, TimeDerivatives)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  MakePlant(0.0);
+  const InputPortIndex input_port_index =
+      plant_->get_actuation_input_port().get_index();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BatchEvalTimeDerivatives<double>(
+        *plant_, *context_, times_, states_, inputs_, input_port_index,
+        parallelism_));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumEvals);
+}
+
+BENCHMARK_DEFINE_F(BatchEvalBenchmark, DiscreteUpdate)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  MakePlant(0.001);
+  const InputPortIndex input_port_index =
+      plant_->get_actuation_input_port().get_index();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BatchEvalUniquePeriodicDiscreteUpdate<double>(
+        *plant_, *context_, times_, states_, inputs_, 1 /* num_time_steps */,
+        input_port_index, parallelism_));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumEvals);
+}
+
+// For reference, the time derivatives evaluated one sample at a time with
+// a new input port value fixed for each sample.
+BENCHMARK_DEFINE_F(BatchEvalBenchmark, TimeDerivativesFixValuePerSample)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  MakePlant(0.0);
+  const InputPort<double>& input_port = plant_->get_actuation_input_port();
+  MatrixXd derivatives(states_.rows(), kNumEvals);
+  for (auto _ : state) {
+    for (int i = 0; i < kNumEvals; ++i) {
+      context_->SetTime(times_(i));
+      context_->SetContinuousState(states_.col(i));
+      input_port.FixValue(context_.get(), inputs_.col(i));
+      derivatives.col(i) =
+          plant_->EvalTimeDerivatives(*context_).CopyToVector();
+    }
+    benchmark::DoNotOptimize(derivatives.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kNumEvals);
+}
+
+BENCHMARK_REGISTER_F(BatchEvalBenchmark, TimeDerivatives)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
+BENCHMARK_REGISTER_F(BatchEvalBenchmark, DiscreteUpdate)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
+BENCHMARK_REGISTER_F(BatchEvalBenchmark, TimeDerivativesFixValuePerSample)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgName("threads")
+    ->Arg(1);
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -1,12 +1,22 @@
+#include <memory>
+#include <string>
+
 #include <benchmark/benchmark.h>
 
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/linear_system.h"
 #include "drake/systems/primitives/pass_through.h"
+#include "drake/systems/primitives/zero_order_hold.h"
 #include "drake/tools/performance/fixture_common.h"
+#include "drake/tools/performance/fixture_memory.h"
 
 /* A collection of scenarios to benchmark, scoped to cover all code within the
-drake/systems/framework package. */
+drake/systems/framework package (plus Simulator stepping of a MultibodyPlant,
+as a representative workload). */
 
 namespace drake {
 namespace systems {
@@ -57,6 +67,113 @@ BENCHMARK_F(BasicFixture, PassThrough3)(benchmark::State& state) {
   }
 }
 
+// Measures a single steady-state Simulator step of a diagram with both
+// continuous state (an undamped oscillator) and periodic discrete updates (a
+// zero-order hold sampling the oscillator). Each iteration is one step, so the
+// reported allocs_per_iter is the number of heap allocations per step.
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+BENCHMARK_F(BasicFixture, SimulatorStep)(benchmark::State& state) {
+  const int n = 2;
+  const double kTimeStep = 0.001;
+  Eigen::MatrixXd A(n, n);
+  A << 0, 1, -1, 0;
+  const Eigen::MatrixXd B = Eigen::MatrixXd::Zero(n, 0);
+  const Eigen::MatrixXd C = Eigen::MatrixXd::Identity(n, n);
+  const Eigen::MatrixXd D = Eigen::MatrixXd::Zero(n, 0);
+  auto* oscillator = builder_->AddSystem<LinearSystem<double>>(A, B, C, D);
+  auto* hold = builder_->AddSystem<ZeroOrderHold<double>>(kTimeStep, n);
+  builder_->Cascade(*oscillator, *hold);
+  builder_->ExportOutput(hold->get_output_port());
+  Build();
+  oscillator->GetMyMutableContextFromRoot(context_.get())
+      .SetContinuousState(Eigen::VectorXd::Ones(n));
+
+  Simulator<double> simulator(*diagram_, std::move(context_));
+  simulator.get_mutable_integrator().set_maximum_step_size(kTimeStep);
+  simulator.Initialize();
+
+  // Take two steps so that the plant's recycled step memory and any
+  // lazily-allocated storage are already in place, then discard the
+  // allocations made so far.
+  double time = 2 * kTimeStep;
+  simulator.AdvanceTo(time);
+  tools::performance::TareMemoryManager();
+
+  for (auto _ : state) {
+    time += kTimeStep;
+    simulator.AdvanceTo(time);
+  }
+}
+
+// Makes a discrete-time arm with 7 actuated revolute joints and no geometry
+// (and thus no contact), using the given discrete contact approximation.
+std::unique_ptr<multibody::MultibodyPlant<double>> MakeArm(
+    double time_step, multibody::DiscreteContactApproximation approximation) {
+  using Eigen::Vector3d;
+  using math::RigidTransformd;
+  auto plant = std::make_unique<multibody::MultibodyPlant<double>>(time_step);
+  plant->set_discrete_contact_approximation(approximation);
+  const double length = 0.3;
+  const auto M_BBo_B =
+      multibody::SpatialInertia<double>::SolidCylinderWithMassAboutEnd(
+          1.0, 0.02, length, -Vector3d::UnitZ());
+  const multibody::RigidBody<double>* parent = &plant->world_body();
+  for (int i = 0; i < 7; ++i) {
+    const std::string suffix = std::to_string(i);
+    const multibody::RigidBody<double>& link =
+        plant->AddRigidBody("link" + suffix, M_BBo_B);
+    const RigidTransformd X_PF(
+        (i == 0) ? Vector3d::Zero() : Vector3d(0, 0, -length));
+    const auto& joint = plant->AddJoint<multibody::RevoluteJoint>(
+        "joint" + suffix, *parent, X_PF, link, RigidTransformd(),
+        (i % 2 == 0) ? Vector3d::UnitY() : Vector3d::UnitX());
+    plant->AddJointActuator("actuator" + suffix, joint);
+    parent = &link;
+  }
+  plant->Finalize();
+  return plant;
+}
+
+// Measures a single steady-state Simulator step of a diagram with a discrete
+// MultibodyPlant arm. The benchmark argument selects the plant's discrete
+// solver: 0 for TAMSI and 1 for SAP (via the lagged approximation). As above,
+// allocs_per_iter is the number of heap allocations per step.
+BENCHMARK_DEFINE_F(BasicFixture, SimulatorStepArm)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const double kTimeStep = 0.001;
+  const auto approximation =
+      (state.range(0) == 0) ? multibody::DiscreteContactApproximation::kTamsi
+                            : multibody::DiscreteContactApproximation::kLagged;
+  auto* plant = builder_->AddSystem(MakeArm(kTimeStep, approximation));
+  builder_->ExportInput(plant->get_actuation_input_port());
+  Build();
+  diagram_->get_input_port().FixValue(context_.get(),
+                                      Eigen::VectorXd::Constant(7, 0.1));
+  plant->SetPositions(&plant->GetMyMutableContextFromRoot(context_.get()),
+                      Eigen::VectorXd::LinSpaced(7, 0.1, 0.7));
+
+  Simulator<double> simulator(*diagram_, std::move(context_));
+  simulator.Initialize();
+
+  // Take two steps so that the plant's recycled step memory and any
+  // lazily-allocated storage are already in place, then discard the
+  // allocations made so far.
+  double time = 2 * kTimeStep;
+  simulator.AdvanceTo(time);
+  tools::performance::TareMemoryManager();
+
+  for (auto _ : state) {
+    time += kTimeStep;
+    simulator.AdvanceTo(time);
+  }
+}
+
+BENCHMARK_REGISTER_F(BasicFixture, SimulatorStepArm)
+    ->ArgName("sap")
+    ->Arg(0)
+    ->Arg(1);
+
 // Helper function for the DiagramBuild benchmark. Creates a diagram containing
 // num_systems subsystems.  When depth==0, each subsystem is an Adder, otherwise
 // each subsystem is a recursive self-call with the next smaller depth.
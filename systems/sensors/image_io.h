@@ -63,6 +63,17 @@ class ImageIo {
   /** Default constructor. */
   ImageIo() = default;
 
+  /** (Advanced) Sets the compression level used when saving images, from 0
+  (no compression; fastest) to 9 (smallest files; slowest). For PNG this is the
+  zlib compression level. For TIFF, level 0 writes uncompressed images and any
+  other level uses the default TIFF compression. JPEG images are unaffected.
+  When not set (the default), each format uses its default compression.
+  @throws std::exception if `level` is outside the range [0, 9]. */
+  void set_compression_level(std::optional<int> level);
+
+  /** Returns the compression level set by set_compression_level(). */
+  std::optional<int> compression_level() const { return compression_level_; }
+
   /** Returns the metadata of the given image file, or nullopt if the metadata
   cannot be determined or is unsupported. The filename extension has no bearing
   on the result; only the actual file contents determine the file format. */
@@ -223,6 +234,8 @@ class ImageIo {
   // TODO(jwnimmer-tri) Expose this so that Drake-internal callers can customize
   // their error handling.
   drake::internal::DiagnosticPolicy diagnostic_;
+
+  std::optional<int> compression_level_;
 };
 
 }  // namespace sensors
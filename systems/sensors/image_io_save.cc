@@ -8,7 +8,9 @@
 #include <vtkImageData.h>     // vtkCommonDataModel
 #include <vtkImageWriter.h>   // vtkIOImage
 #include <vtkNew.h>           // vtkCommonCore
+#include <vtkPNGWriter.h>     // vtkIOImage
 #include <vtkSmartPointer.h>  // vtkCommonCore
+#include <vtkTIFFWriter.h>    // vtkIOImage
 
 #include "drake/systems/sensors/image_io_internal.h"
 #include "drake/systems/sensors/vtk_image_reader_writer.h"
@@ -43,6 +45,15 @@ void CopyImage(const Image<kPixelType>& source_image,
 
 }  // namespace
 
+void ImageIo::set_compression_level(std::optional<int> level) {
+  if (level.has_value() && (*level < 0 || *level > 9)) {
+    throw std::logic_error(fmt::format(
+        "ImageIo::set_compression_level() requires a level in [0, 9], not {}",
+        *level));
+  }
+  compression_level_ = level;
+}
+
 void ImageIo::SaveImpl(ImageAnyConstPtr image_any,
                        std::optional<ImageFileFormat> format,
                        OutputAny output_any) const {
@@ -72,6 +83,16 @@ void ImageIo::SaveImpl(ImageAnyConstPtr image_any,
   } else {
     writer = internal::MakeWriter(chosen_format, std::get<1>(output_any));
   }
+  if (compression_level_.has_value()) {
+    if (chosen_format == ImageFileFormat::kPng) {
+      static_cast<vtkPNGWriter*>(writer.Get())
+          ->SetCompressionLevel(*compression_level_);
+    } else if (chosen_format == ImageFileFormat::kTiff &&
+               *compression_level_ == 0) {
+      static_cast<vtkTIFFWriter*>(writer.Get())
+          ->SetCompression(vtkTIFFWriter::NoCompression);
+    }
+  }
 
   // Copy the Drake image buffer to a VTK image buffer. Drake uses (x=0, y=0)
   // as the top left corner, but VTK uses it as the bottom left corner, and
@@ -2,19 +2,223 @@
 
 #include <unistd.h>
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/ssize.h"
+#include "drake/common/text_logging.h"
 #include "drake/systems/sensors/image_io.h"
 
 namespace drake {
 namespace systems {
 namespace sensors {
+namespace {
+
+static_assert(std::endian::native == std::endian::little,
+              "The .npy writer assumes a little-endian host");
+
+template <PixelType kPixelType>
+std::string NpyDescr() {
+  using ChannelType = typename ImageTraits<kPixelType>::ChannelType;
+  if constexpr (std::is_same_v<ChannelType, uint8_t>) {
+    return "|u1";
+  } else if constexpr (std::is_same_v<ChannelType, uint16_t>) {
+    return "<u2";
+  } else if constexpr (std::is_same_v<ChannelType, int16_t>) {
+    return "<i2";
+  } else {
+    static_assert(std::is_same_v<ChannelType, float>);
+    return "<f4";
+  }
+}
+
+/* Writes the image to the given file in NumPy's .npy format (version 1.0):
+ a magic string, a header describing the array (padded so that the data is
+ 64-byte aligned), and then the raw channel data in row-major order. The image
+ memory is written as-is, without any intermediate copy. */
+template <PixelType kPixelType>
+void SaveToNpy(const Image<kPixelType>& image, const std::string& file_name) {
+  constexpr int kNumChannels = Image<kPixelType>::kNumChannels;
+  const std::string shape =
+      kNumChannels == 1
+          ? fmt::format("({}, {})", image.height(), image.width())
+          : fmt::format("({}, {}, {})", image.height(), image.width(),
+                        kNumChannels);
+  std::string header =
+      fmt::format("{{'descr': '{}', 'fortran_order': False, 'shape': {}, }}",
+                  NpyDescr<kPixelType>(), shape);
+  // The magic (6 bytes), version (2 bytes), header length (2 bytes), and
+  // header (terminated by a newline) must be a multiple of 64 bytes long.
+  const int unpadded_size = 10 + static_cast<int>(header.size()) + 1;
+  header.append((64 - unpadded_size % 64) % 64, ' ');
+  header.push_back('\n');
+  const uint16_t header_size = static_cast<uint16_t>(header.size());
+
+  std::ofstream file(file_name, std::ios::binary);
+  if (!file) {
+    throw std::runtime_error(
+        fmt::format("ImageWriter: could not open '{}' for writing", file_name));
+  }
+  file.write("\x93NUMPY\x01\x00", 8);
+  file.write(reinterpret_cast<const char*>(&header_size), 2);
+  file.write(header.data(), header.size());
+  if (image.size() > 0) {
+    file.write(reinterpret_cast<const char*>(image.at(0, 0)),
+               image.size() * sizeof(typename Image<kPixelType>::T));
+  }
+  if (!file) {
+    throw std::runtime_error(
+        fmt::format("ImageWriter: error while writing '{}'", file_name));
+  }
+}
+
+}  // namespace
+
+/* A pool of threads that runs queued write jobs. The queue is bounded; Push()
+ blocks while it is full. The first error thrown by a job is stored and
+ rethrown by the next call to Push() or Flush(). */
+class ImageWriter::AsyncWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncWriter);
+
+  AsyncWriter(int num_threads, int max_queue_size)
+      : max_queue_size_(max_queue_size) {
+    DRAKE_DEMAND(num_threads > 0);
+    DRAKE_DEMAND(max_queue_size > 0);
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        ThreadLoop();
+      });
+    }
+  }
+
+  // Finishes all queued jobs before joining the threads. Errors are lost at
+  // this point; they can only be logged.
+  ~AsyncWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    work_available_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+    if (error_ != nullptr) {
+      try {
+        std::rethrow_exception(error_);
+      } catch (const std::exception& e) {
+        drake::log()->error("ImageWriter: {}", e.what());
+      }
+    }
+  }
+
+  void Push(std::function<void()> job) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ThrowIfError();
+    if (ssize(queue_) >= max_queue_size_) {
+      const auto start = std::chrono::steady_clock::now();
+      space_available_.wait(lock, [this]() {
+        return ssize(queue_) < max_queue_size_;
+      });
+      const std::chrono::duration<double> stall =
+          std::chrono::steady_clock::now() - start;
+      ++statistics_.num_stalls;
+      statistics_.stall_time += stall.count();
+    }
+    queue_.push_back(std::move(job));
+    ++statistics_.num_queued;
+    statistics_.max_queue_depth =
+        std::max(statistics_.max_queue_depth, static_cast<int>(ssize(queue_)));
+    lock.unlock();
+    work_available_.notify_one();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() {
+      return queue_.empty() && num_in_flight_ == 0;
+    });
+    ThrowIfError();
+  }
+
+  ImageWriterStatistics statistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+  }
+
+ private:
+  // Rethrows (and clears) the stored error, if any. Requires the lock.
+  void ThrowIfError() {
+    if (error_ != nullptr) {
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  void ThreadLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_available_.wait(lock, [this]() {
+        return shutdown_ || !queue_.empty();
+      });
+      if (queue_.empty()) {
+        return;
+      }
+      std::function<void()> job = std::move(queue_.front());
+      queue_.pop_front();
+      ++num_in_flight_;
+      lock.unlock();
+      space_available_.notify_one();
+      std::exception_ptr error;
+      try {
+        job();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      --num_in_flight_;
+      if (error == nullptr) {
+        ++statistics_.num_written;
+      } else if (error_ == nullptr) {
+        error_ = std::move(error);
+      }
+      if (queue_.empty() && num_in_flight_ == 0) {
+        idle_.notify_all();
+      }
+    }
+  }
+
+  const int max_queue_size_;
+
+  // The state shared with the threads, guarded by `mutex_`.
+  mutable std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable space_available_;
+  std::condition_variable idle_;
+  std::deque<std::function<void()>> queue_;
+  int num_in_flight_{0};
+  bool shutdown_{false};
+  std::exception_ptr error_;
+  ImageWriterStatistics statistics_;
+
+  std::vector<std::thread> threads_;
+};
 
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
   ImageIo{}.Save(image, file_path, ImageFileFormat::kPng);
@@ -36,7 +240,22 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path) {
   ImageIo{}.Save(image, file_path, ImageFileFormat::kPng);
 }
 
-ImageWriter::ImageWriter() {
+ImageWriter::ImageWriter() : ImageWriter(ImageWriterParams{}) {}
+
+ImageWriter::ImageWriter(const ImageWriterParams& params) : params_(params) {
+  if (params.num_threads < 0) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: num_threads must be non-negative, not {}",
+        params.num_threads));
+  }
+  if (params.max_queue_size <= 0) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: max_queue_size must be positive, not {}",
+        params.max_queue_size));
+  }
+  // Let ImageIo validate the compression level.
+  ImageIo{}.set_compression_level(params.compression_level);
+
   // NOTE: This excludes *many* of the defined `PixelType` values.
   labels_[PixelType::kRgba8U] = "color";
   extensions_[PixelType::kRgba8U] = ".png";
@@ -52,8 +271,15 @@ ImageWriter::ImageWriter() {
   // Declares a forced publish event to accommodate non-periodic image saving,
   // e.g., when saving images outside of Simulator::AdvanceTo.
   DeclareForcedPublishEvent(&ImageWriter::WriteAllImages);
+
+  if (params.num_threads > 0) {
+    async_writer_ = std::make_unique<AsyncWriter>(params.num_threads,
+                                                  params.max_queue_size);
+  }
 }
 
+ImageWriter::~ImageWriter() = default;
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -95,10 +321,11 @@ const InputPort<double>& ImageWriter::DeclareImageInputPort(
                     file_name_format, test_dir, reason));
   }
 
-  // Confirms file has appropriate extension.
+  // Confirms file has appropriate extension; raw .npy files are written for
+  // any pixel type.
+  const bool npy = file_name_format.ends_with(".npy");
   const std::string& extension = extensions_[kPixelType];
-  if (file_name_format.substr(file_name_format.size() - extension.size()) !=
-      extension) {
+  if (!npy && !file_name_format.ends_with(extension)) {
     file_name_format += extension;
   }
   // TODO(SeanCurtis-TRI): Handle other issues that may arise with filename:
@@ -122,7 +349,7 @@ const InputPort<double>& ImageWriter::DeclareImageInputPort(
         return EventStatus::Succeeded();
       });
   DeclarePeriodicEvent<PublishEvent<double>>(publish_period, start_time, event);
-  port_info_.emplace_back(std::move(file_name_format), kPixelType);
+  port_info_.emplace_back(std::move(file_name_format), kPixelType, npy);
 
   return port;
 }
@@ -174,14 +401,49 @@ void ImageWriter::ResetAllImageCounts() const {
   }
 }
 
+void ImageWriter::Flush() const {
+  if (async_writer_ != nullptr) {
+    async_writer_->Flush();
+  }
+}
+
+ImageWriterStatistics ImageWriter::GetStatistics() const {
+  if (async_writer_ == nullptr) {
+    return {};
+  }
+  return async_writer_->statistics();
+}
+
 template <PixelType kPixelType>
 void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  ImageIo{}.Save(image,
-                 MakeFileName(data.format, data.pixel_type, context.get_time(),
-                              port.get_name(), data.count++));
+  std::string file_name =
+      MakeFileName(data.format, data.pixel_type, context.get_time(),
+                   port.get_name(), data.count++);
+  const auto save = [npy = data.npy,
+                     compression_level = params_.compression_level](
+                        const Image<kPixelType>& to_save,
+                        const std::string& to_file) {
+    if (npy) {
+      SaveToNpy(to_save, to_file);
+    } else {
+      ImageIo image_io;
+      image_io.set_compression_level(compression_level);
+      image_io.Save(to_save, to_file);
+    }
+  };
+  if (async_writer_ == nullptr) {
+    save(image, file_name);
+    return;
+  }
+  // The port's value is owned by the context, so the queued job needs its own
+  // copy of the image.
+  async_writer_->Push(
+      [save, copy = image, file_name = std::move(file_name)]() {
+        save(copy, file_name);
+      });
 }
 
 EventStatus ImageWriter::WriteAllImages(const Context<double>& context) const {
@@ -7,12 +7,15 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
 
@@ -58,6 +61,57 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
 
 //@}
 
+/** The parameters of an ImageWriter, controlling how its images are encoded
+ and when they are written.  */
+struct ImageWriterParams {
+  /** Passes this object to an Archive.
+   Refer to @ref yaml_serialization "YAML Serialization" for background.  */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(num_threads));
+    a->Visit(DRAKE_NVP(max_queue_size));
+    a->Visit(DRAKE_NVP(compression_level));
+  }
+
+  /** The number of background threads that encode and write images. When
+   zero, every image is written within the publish event that captures it.
+   When positive, the publish event only copies the image into a queue, and
+   the images are written asynchronously; see ImageWriter::Flush().  */
+  int num_threads{0};
+
+  /** The maximum number of images waiting in the queue to be written (only
+   used when `num_threads` is positive). When the queue is full, the publish
+   event blocks until an image has been written; see
+   ImageWriter::GetStatistics().  */
+  int max_queue_size{16};
+
+  /** The compression level (in [0, 9]) used for PNG and TIFF images; see
+   ImageIo::set_compression_level(). Lower levels are faster to encode but
+   produce larger files. When not set, the formats' defaults are used.  */
+  std::optional<int> compression_level;
+};
+
+/** Statistics of the queue of an asynchronous ImageWriter. A large number of
+ stalls indicates that the encoder threads can't keep up with the rate at which
+ images are captured.  */
+struct ImageWriterStatistics {
+  /** The number of images that have been added to the queue.  */
+  int num_queued{};
+
+  /** The number of queued images that have been written successfully.  */
+  int num_written{};
+
+  /** The number of times that adding an image to the queue had to wait for
+   space in the queue.  */
+  int num_stalls{};
+
+  /** The total time (in seconds) spent waiting for space in the queue.  */
+  double stall_time{};
+
+  /** The largest number of images that were ever waiting in the queue.  */
+  int max_queue_depth{};
+};
+
 /** A system for periodically writing images to the file system. The system also
  provides direct image writing via a forced publish event. The system does not
  have a fixed set of input ports; the system can have an arbitrary number of
@@ -101,6 +155,25 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  simultaneously to disk. Note that one can invoke a forced publish on this
  system using the same context multiple times, resulting in multiple
  write operations, with each operation overwriting the same file(s).
+
+ <h3>Asynchronous writing</h3>
+
+ Encoding images (particularly PNG) can be expensive enough to stall a
+ simulation that logs camera streams. Given ImageWriterParams::num_threads > 0,
+ the publish event merely copies each image into a bounded queue, from which a
+ pool of background threads encodes and writes the files. When the queue is
+ full, publishing blocks until there is space (see GetStatistics()). Errors
+ encountered by the background threads are reported by the next publish event
+ or call to Flush(). The destructor waits for all queued images to be written.
+
+ <h3>Raw images</h3>
+
+ If the file name format has the extension `.npy`, images are written
+ uncompressed, in NumPy's `.npy` format, as an array of shape
+ `(height, width)` for single-channel images and `(height, width, channels)`
+ otherwise. These files are fast to write and can be memory-mapped when read
+ (e.g., via `numpy.load(file, mmap_mode="r")`), which suits large dumps of
+ depth images.
  */
 class ImageWriter : public LeafSystem<double> {
  public:
@@ -109,6 +182,15 @@ class ImageWriter : public LeafSystem<double> {
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Constructs an instance with no image ports and the given parameters.
+   @throws std::exception if `params.num_threads` is negative,
+                          `params.max_queue_size` is not positive, or
+                          `params.compression_level` is not in [0, 9].  */
+  explicit ImageWriter(const ImageWriterParams& params);
+
+  /** Waits for all queued images to be written.  */
+  ~ImageWriter() override;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -229,12 +311,28 @@ class ImageWriter : public LeafSystem<double> {
   // Resets the saved image count for all declared input ports to zero.
   void ResetAllImageCounts() const;
 
+  /** Returns the parameters this writer was constructed with.  */
+  const ImageWriterParams& params() const { return params_; }
+
+  /** Blocks until all images queued for asynchronous writing have been written
+   (if any).
+   @throws std::exception if writing any image failed since the last call to
+                          Flush() (or the last publish event).  */
+  void Flush() const;
+
+  /** Returns the statistics of the asynchronous writing queue. They are all
+   zero when the writer writes synchronously.  */
+  ImageWriterStatistics GetStatistics() const;
+
  private:
 #ifndef DRAKE_DOXYGEN_CXX
   // Friend for facilitating unit testing.
   friend class ImageWriterTester;
 #endif
 
+  // The pool of threads that writes the queued images; see the .cc file.
+  class AsyncWriter;
+
   // Does the work of writing image indexed by `index` to the disk.
   template <PixelType kPixelType>
   void WriteImage(const Context<double>& context, int index) const;
@@ -269,10 +367,14 @@ class ImageWriter : public LeafSystem<double> {
 
   // The per-input port data.
   struct ImagePortInfo {
-    ImagePortInfo(std::string format_in, PixelType pixel_type_in)
-        : format(std::move(format_in)), pixel_type(pixel_type_in) {}
+    ImagePortInfo(std::string format_in, PixelType pixel_type_in, bool npy_in)
+        : format(std::move(format_in)),
+          pixel_type(pixel_type_in),
+          npy(npy_in) {}
     const std::string format;
     const PixelType pixel_type;
+    // Whether the images are written as .npy files.
+    const bool npy;
     // NOTE: This is made mutable as a low-cost mechanism for incrementing
     // image writes without involving the overhead of discrete state.
     mutable int count{0};
@@ -287,6 +389,11 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  const ImageWriterParams params_;
+
+  // Null when writing synchronously.
+  std::unique_ptr<AsyncWriter> async_writer_;
 };
 
 }  // namespace sensors
@@ -31,8 +31,9 @@ it can run on a background thread. The Worker accomplishes that using a helper
 class, the SnapshotSensor. The SnapshotSensor (itself a diagram) contains a
 QueryObjectChef and RgbdSensor connected in series. The Worker allocates a
 standalone SnapshotSensor Context and fixes the chef's input port(s) to be a
-copy of the scene graph's FramePoseVector input port(s), and uses the RgbdSensor
-to produce a rendered image on its output port. */
+copy of the scene graph's FramePoseVector input port(s), and asks the
+RgbdSensor's QueryObject to render all of the requested images in a single batch
+(see QueryObject::RenderImages()). */
 
 namespace drake {
 namespace systems {
@@ -132,6 +133,7 @@ class SnapshotSensor final : public Diagram<double> {
     auto* chef = builder.AddNamedSystem<QueryObjectChef>("chef", scene_graph);
     auto* rgbd = builder.AddNamedSystem<RgbdSensor>("camera", parent_id, X_PB,
                                                     color_camera, depth_camera);
+    rgbd_ = rgbd;
     builder.Connect(*chef, *rgbd);
     for (InputPortIndex i{0}; i < chef->num_input_ports(); ++i) {
       const auto& input_port = chef->get_input_port(i);
@@ -147,8 +149,12 @@ class SnapshotSensor final : public Diagram<double> {
   /* Returns the version as of when this sensor was created. */
   const GeometryVersion& geometry_version() const { return geometry_version_; }
 
+  /* Returns the nested RgbdSensor. */
+  const RgbdSensor& rgbd() const { return *rgbd_; }
+
  private:
   GeometryVersion geometry_version_;
+  const RgbdSensor* rgbd_{};
 };
 
 /* The results of camera rendering. */
@@ -647,26 +653,47 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
       const auto& input_port = sensor_->GetInputPort(port_name);
       input_port.FixValue(sensor_context_.get(), pose_vector);
     }
-    RenderedImages result;
-    // TODO(jwnimmer-tri) Is there any way we can steal (move) the images from
-    // the output ports, to avoid extra copying? I suppose we could call the
-    // QueryObject directly instead of the RgbdSensor, but that would involve
-    // duplicating (copying) some of its functionality into this class.
+    // Render all of the images in a single batch, directly into the images
+    // that we'll output.
+    const RgbdSensor& rgbd = sensor_->rgbd();
+    const Context<double>& rgbd_context =
+        rgbd.GetMyContextFromRoot(*sensor_context_);
+    const ColorRenderCamera& color_camera =
+        rgbd.GetColorRenderCamera(rgbd_context);
+    const DepthRenderCamera& depth_camera =
+        rgbd.GetDepthRenderCamera(rgbd_context);
+    const CameraInfo& color_intrinsics = color_camera.core().intrinsics();
+    const CameraInfo& depth_intrinsics = depth_camera.core().intrinsics();
+    std::shared_ptr<ImageRgba8U> color;
+    std::shared_ptr<ImageDepth32F> depth;
+    std::shared_ptr<ImageLabel16I> label;
     if (color_) {
-      result.color = std::make_shared<const ImageRgba8U>(
-          sensor_->GetOutputPort("color_image")
-              .template Eval<ImageRgba8U>(*sensor_context_));
+      color = std::make_shared<ImageRgba8U>(color_intrinsics.width(),
+                                            color_intrinsics.height());
     }
     if (depth_) {
-      result.depth = std::make_shared<const ImageDepth32F>(
-          sensor_->GetOutputPort("depth_image_32f")
-              .template Eval<ImageDepth32F>(*sensor_context_));
+      depth = std::make_shared<ImageDepth32F>(depth_intrinsics.width(),
+                                              depth_intrinsics.height());
     }
     if (label_) {
-      result.label = std::make_shared<const ImageLabel16I>(
-          sensor_->GetOutputPort("label_image")
-              .template Eval<ImageLabel16I>(*sensor_context_));
+      label = std::make_shared<ImageLabel16I>(color_intrinsics.width(),
+                                              color_intrinsics.height());
     }
+    const auto& snapshot_query =
+        rgbd.query_object_input_port().template Eval<QueryObject<double>>(
+            rgbd_context);
+    snapshot_query.RenderImages(
+        {{.parent_frame = rgbd.GetParentFrameId(rgbd_context),
+          .X_PC = rgbd.GetX_PB(rgbd_context),
+          .color_camera = &color_camera,
+          .depth_camera = &depth_camera,
+          .color_image = color.get(),
+          .depth_image = depth.get(),
+          .label_image = label.get()}});
+    RenderedImages result;
+    result.color = std::move(color);
+    result.depth = std::move(depth);
+    result.label = std::move(label);
     result.X_WB = sensor_->GetOutputPort("body_pose_in_world")
                       .template Eval<RigidTransformd>(*sensor_context_);
     result.time = context_time;
@@ -182,6 +182,44 @@ GTEST_TEST(ImageIoTest, SaveToFileNoExensionNoFormatError) {
                               ".*path does not imply.*");
 }
 
+// The compression level trades file size for speed, but not image content.
+GTEST_TEST(ImageIoTest, CompressionLevel) {
+  ImageDepth16U image(64, 48);
+  for (int v = 0; v < image.height(); ++v) {
+    for (int u = 0; u < image.width(); ++u) {
+      *image.at(u, v) = static_cast<uint16_t>(u * v);
+    }
+  }
+  const auto format = ImageFileFormat::kPng;
+  ImageIo dut;
+  EXPECT_EQ(dut.compression_level(), std::nullopt);
+  dut.set_compression_level(0);
+  EXPECT_EQ(dut.compression_level(), 0);
+  const std::vector<uint8_t> uncompressed = dut.Save(image, format);
+  dut.set_compression_level(9);
+  const std::vector<uint8_t> compressed = dut.Save(image, format);
+  EXPECT_LT(compressed.size(), uncompressed.size());
+  for (const std::vector<uint8_t>* saved : {&uncompressed, &compressed}) {
+    ImageDepth16U readback;
+    ImageIo{}.Load(ImageIo::ByteSpan{saved->data(), saved->size()}, &readback);
+    EXPECT_EQ(readback, image);
+  }
+
+  // TIFF images can be saved without compression.
+  const fs::path path = GetTempPath("CompressionLevel.tiff");
+  ImageDepth32F depth(4, 3, 1.5f);
+  dut.set_compression_level(0);
+  dut.Save(depth, path);
+  ImageDepth32F depth_readback;
+  ImageIo{}.Load(path, &depth_readback);
+  EXPECT_EQ(depth_readback, depth);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.set_compression_level(10),
+                              ".*level in \\[0, 9\\].*");
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.set_compression_level(-1),
+                              ".*level in \\[0, 9\\].*");
+}
+
 // We can load metadata from a memory buffer.
 GTEST_TEST(ImageIoTest, LoadMetdataBuffer) {
   std::vector<uint8_t> saved;
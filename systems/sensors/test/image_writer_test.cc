@@ -2,10 +2,13 @@
 
 #include <unistd.h>
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
 #include <set>
 #include <string>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -668,6 +671,163 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+TEST_F(ImageWriterTest, ParamsErrors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.num_threads = -1}),
+                              ".*num_threads must be non-negative.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.max_queue_size = 0}),
+                              ".*max_queue_size must be positive.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter({.compression_level = 10}),
+                              ".*level in \\[0, 9\\].*");
+
+  const ImageWriter writer;
+  EXPECT_EQ(writer.params().num_threads, 0);
+  // Flushing a synchronous writer is a no-op, and it has no statistics.
+  EXPECT_NO_THROW(writer.Flush());
+  EXPECT_EQ(writer.GetStatistics().num_queued, 0);
+}
+
+// With background threads, images are written by the time Flush() returns.
+// A queue of a single image forces the publish events to wait for the
+// writers, so stalls are recorded in the statistics.
+TEST_F(ImageWriterTest, AsyncWrites) {
+  ImageWriter writer({.num_threads = 2,
+                      .max_queue_size = 1,
+                      .compression_level = 1});
+  ImageWriterTester tester(writer);
+  fs::path path(temp_dir());
+  path.append("async_{count}");
+  const auto& color_port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "color", path.string() + "_color", 0.1, 0.0);
+  const auto& depth_port = writer.DeclareImageInputPort<PixelType::kDepth32F>(
+      "depth", path.string() + "_depth", 0.1, 0.0);
+  auto context = writer.AllocateContext();
+  const Image<PixelType::kRgba8U> color = test_image<PixelType::kRgba8U>();
+  const Image<PixelType::kDepth32F> depth = test_image<PixelType::kDepth32F>();
+  color_port.FixValue(context.get(), color);
+  depth_port.FixValue(context.get(), depth);
+
+  const int kNumPublishes = 20;
+  for (int i = 0; i < kNumPublishes; ++i) {
+    writer.ForcedPublish(*context);
+  }
+  writer.Flush();
+
+  for (const auto& port : {&color_port, &depth_port}) {
+    EXPECT_EQ(tester.port_count(port->get_index()), kNumPublishes);
+  }
+  for (int i = 0; i < kNumPublishes; ++i) {
+    const std::string color_name = tester.MakeFileName(
+        tester.port_format(color_port.get_index()), PixelType::kRgba8U, 0.0,
+        "color", i);
+    const std::string depth_name = tester.MakeFileName(
+        tester.port_format(depth_port.get_index()), PixelType::kDepth32F, 0.0,
+        "depth", i);
+    add_file_for_cleanup(color_name);
+    add_file_for_cleanup(depth_name);
+    Image<PixelType::kRgba8U> color_readback;
+    ASSERT_TRUE(LoadImage(color_name, &color_readback));
+    EXPECT_EQ(color_readback, color);
+    Image<PixelType::kDepth32F> depth_readback;
+    ASSERT_TRUE(LoadImage(depth_name, &depth_readback));
+    EXPECT_EQ(depth_readback, depth);
+  }
+
+  const ImageWriterStatistics stats = writer.GetStatistics();
+  EXPECT_EQ(stats.num_queued, 2 * kNumPublishes);
+  EXPECT_EQ(stats.num_written, 2 * kNumPublishes);
+  EXPECT_EQ(stats.max_queue_depth, 1);
+  EXPECT_LE(stats.num_stalls, 2 * kNumPublishes);
+  EXPECT_GE(stats.stall_time, 0.0);
+}
+
+// Errors from the background threads are reported by Flush().
+TEST_F(ImageWriterTest, AsyncError) {
+  ImageWriter writer({.num_threads = 1});
+  fs::path dir(temp_dir());
+  dir.append("async_error_dir");
+  fs::create_directory(dir);
+  const auto& port = writer.DeclareImageInputPort<PixelType::kGrey8U>(
+      "grey", (dir / "image.npy").string(), 0.1, 0.0);
+  // The directory disappears after the port was validated.
+  fs::remove(dir);
+  auto context = writer.AllocateContext();
+  port.FixValue(context.get(), test_image<PixelType::kGrey8U>());
+  writer.ForcedPublish(*context);
+  EXPECT_THROW(writer.Flush(), std::exception);
+  // The error is only reported once.
+  EXPECT_NO_THROW(writer.Flush());
+  EXPECT_EQ(writer.GetStatistics().num_written, 0);
+}
+
+// Reads an .npy file written by ImageWriter, returning its header and data.
+std::pair<std::string, std::string> ReadNpy(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  const std::string contents((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+  EXPECT_EQ(contents.substr(0, 8), std::string("\x93NUMPY\x01\x00", 8));
+  const int header_size = static_cast<uint8_t>(contents[8]) +
+                          256 * static_cast<uint8_t>(contents[9]);
+  // The data must be aligned.
+  EXPECT_EQ((10 + header_size) % 64, 0);
+  return {contents.substr(10, header_size), contents.substr(10 + header_size)};
+}
+
+template <PixelType kPixelType>
+void ExpectNpyFile(const std::string& file_name,
+                   const std::string& expected_header_prefix) {
+  const Image<kPixelType> image = test_image<kPixelType>();
+  const auto [header, data] = ReadNpy(file_name);
+  EXPECT_EQ(header.substr(0, expected_header_prefix.size()),
+            expected_header_prefix);
+  EXPECT_EQ(header.back(), '\n');
+  ASSERT_EQ(data.size(), image.size() * sizeof(typename Image<kPixelType>::T));
+  EXPECT_EQ(std::memcmp(data.data(), image.at(0, 0), data.size()), 0);
+}
+
+// The .npy extension writes the raw image data, for any pixel type, in both
+// the synchronous and asynchronous modes.
+TEST_F(ImageWriterTest, WritesNpy) {
+  for (const int num_threads : {0, 1}) {
+    ImageWriter writer({.num_threads = num_threads});
+    ImageWriterTester tester(writer);
+    fs::path path(temp_dir());
+    path.append(fmt::format("npy_{}_{{image_type}}.npy", num_threads));
+    const auto& color_port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+        "color", path.string(), 0.1, 0.0);
+    const auto& depth_port =
+        writer.DeclareImageInputPort<PixelType::kDepth32F>(
+            "depth", path.string(), 0.1, 0.0);
+    const auto& label_port =
+        writer.DeclareImageInputPort<PixelType::kLabel16I>(
+            "label", path.string(), 0.1, 0.0);
+    // The extension is not replaced by the pixel type's default.
+    EXPECT_EQ(tester.port_format(depth_port.get_index()), path.string());
+
+    auto context = writer.AllocateContext();
+    color_port.FixValue(context.get(), test_image<PixelType::kRgba8U>());
+    depth_port.FixValue(context.get(), test_image<PixelType::kDepth32F>());
+    label_port.FixValue(context.get(), test_image<PixelType::kLabel16I>());
+    writer.ForcedPublish(*context);
+    writer.Flush();
+
+    const auto file_name = [&](PixelType pixel_type, const char* name) {
+      const std::string result =
+          tester.MakeFileName(path.string(), pixel_type, 0.0, name, 0);
+      add_file_for_cleanup(result);
+      return result;
+    };
+    ExpectNpyFile<PixelType::kRgba8U>(
+        file_name(PixelType::kRgba8U, "color"),
+        "{'descr': '|u1', 'fortran_order': False, 'shape': (1, 4, 4), }");
+    ExpectNpyFile<PixelType::kDepth32F>(
+        file_name(PixelType::kDepth32F, "depth"),
+        "{'descr': '<f4', 'fortran_order': False, 'shape': (1, 4), }");
+    ExpectNpyFile<PixelType::kLabel16I>(
+        file_name(PixelType::kLabel16I, "label"),
+        "{'descr': '<i2', 'fortran_order': False, 'shape': (1, 4), }");
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
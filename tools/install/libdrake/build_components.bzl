@@ -42,6 +42,7 @@ LIBDRAKE_COMPONENTS = [
     "//geometry/query_results",
     "//geometry/render",
     "//geometry/render/shaders",
+    "//geometry/render_cpu",
     "//geometry/render_gl",
     "//geometry/render_gltf_client",
     "//geometry/render_vtk",
@@ -15,10 +15,13 @@ def drake_cc_googlebench_binary(
         test_timeout = None,
         test_args = None,
         test_display = False,
-        test_tags = None):
+        test_tags = None,
+        target_compatible_with = None):
     """Declares a testonly binary that uses google benchmark.  Automatically
     adds appropriate deps and ensures it either has an automated smoke test
     (via 'add_test_rule = True'), or else explicitly opts-out ('= False').
+    The optional target_compatible_with applies to both the binary and the
+    test, e.g., to skip benchmarks of platform-specific code.
     """
     if not srcs:
         fail("Missing srcs")
@@ -37,6 +40,7 @@ def drake_cc_googlebench_binary(
         linkstatic = True,
         data = data,
         deps = new_deps,
+        target_compatible_with = target_compatible_with,
     )
 
     if add_test_rule:
@@ -58,6 +62,7 @@ def drake_cc_googlebench_binary(
                 "--benchmark_min_time=0s",
             ] + (test_args or []),
             tags = (test_tags or []) + ["nolint", "no_kcov"],
+            target_compatible_with = target_compatible_with,
         )
 
 def drake_py_experiment_binary(name, *, googlebench_binary, **kwargs):